@@ -50,8 +50,16 @@
 
 #include "internal/catch_user_interfaces.h"
 #include "internal/catch_tag_alias_autoregistrar.h"
+#include "internal/catch_register_enum.hpp"
+#include "internal/catch_suite_fixture.h"
+#include "internal/catch_suspend_timing.h"
+#include "internal/catch_thread_output.h"
 #include "internal/catch_test_registry.h"
+#include "internal/catch_test_coroutine.h"
+#include "internal/catch_fuzz_adapter.h"
+#include "internal/catch_snapshot.h"
 #include "internal/catch_capture.hpp"
+#include "internal/catch_checkpoint.h"
 #include "internal/catch_section.h"
 #include "internal/catch_benchmark.h"
 #include "internal/catch_interfaces_exception.h"
@@ -63,6 +71,8 @@
 #include "internal/catch_capture_matchers.h"
 #endif
 #include "internal/catch_generators.hpp"
+#include "internal/catch_file_generators.h"
+#include "internal/catch_property.h"
 
 // These files are included here so the single_include script doesn't put them
 // in the conditionally compiled sections
@@ -108,6 +118,8 @@
 #define CATCH_REQUIRE_THROWS_MATCHES( expr, exceptionType, matcher ) INTERNAL_CATCH_THROWS_MATCHES( "CATCH_REQUIRE_THROWS_MATCHES", exceptionType, Catch::ResultDisposition::Normal, matcher, expr )
 #endif// CATCH_CONFIG_DISABLE_MATCHERS
 #define CATCH_REQUIRE_NOTHROW( ... ) INTERNAL_CATCH_NO_THROW( "CATCH_REQUIRE_NOTHROW", Catch::ResultDisposition::Normal, __VA_ARGS__ )
+#define CATCH_REQUIRE_MAX_ALLOCATIONS( expr, budget ) INTERNAL_CATCH_MAX_ALLOCATIONS( "CATCH_REQUIRE_MAX_ALLOCATIONS", Catch::ResultDisposition::Normal, expr, budget )
+#define CATCH_REQUIRE_EVENTUALLY( expr, timeout ) INTERNAL_CATCH_EVENTUALLY( "CATCH_REQUIRE_EVENTUALLY", Catch::ResultDisposition::Normal, expr, timeout )
 
 #define CATCH_CHECK( ... ) INTERNAL_CATCH_TEST( "CATCH_CHECK", Catch::ResultDisposition::ContinueOnFailure, __VA_ARGS__ )
 #define CATCH_CHECK_FALSE( ... ) INTERNAL_CATCH_TEST( "CATCH_CHECK_FALSE", Catch::ResultDisposition::ContinueOnFailure | Catch::ResultDisposition::FalseTest, __VA_ARGS__ )
@@ -132,13 +144,19 @@
 #define CATCH_INFO( msg ) INTERNAL_CATCH_INFO( "CATCH_INFO", msg )
 #define CATCH_WARN( msg ) INTERNAL_CATCH_MSG( "CATCH_WARN", Catch::ResultWas::Warning, Catch::ResultDisposition::ContinueOnFailure, msg )
 #define CATCH_CAPTURE( ... ) INTERNAL_CATCH_CAPTURE( INTERNAL_CATCH_UNIQUE_NAME(capturer), "CATCH_CAPTURE",__VA_ARGS__ )
+#define CATCH_DEFERRED_CAPTURE( ... ) INTERNAL_CATCH_CAPTURE_DEFERRED( INTERNAL_CATCH_UNIQUE_NAME(capturer), "CATCH_DEFERRED_CAPTURE",__VA_ARGS__ )
+#define CATCH_CHECKPOINT( value ) INTERNAL_CATCH_CHECKPOINT( value )
 
 #define CATCH_TEST_CASE( ... ) INTERNAL_CATCH_TESTCASE( __VA_ARGS__ )
+#if defined(CATCH_CONFIG_CXX20_COROUTINES)
+#define CATCH_ASYNC_TEST_CASE( ... ) INTERNAL_CATCH_ASYNC_TESTCASE( __VA_ARGS__ )
+#endif
 #define CATCH_TEST_CASE_METHOD( className, ... ) INTERNAL_CATCH_TEST_CASE_METHOD( className, __VA_ARGS__ )
 #define CATCH_METHOD_AS_TEST_CASE( method, ... ) INTERNAL_CATCH_METHOD_AS_TEST_CASE( method, __VA_ARGS__ )
 #define CATCH_REGISTER_TEST_CASE( Function, ... ) INTERNAL_CATCH_REGISTER_TESTCASE( Function, __VA_ARGS__ )
 #define CATCH_SECTION( ... ) INTERNAL_CATCH_SECTION( __VA_ARGS__ )
 #define CATCH_DYNAMIC_SECTION( ... ) INTERNAL_CATCH_DYNAMIC_SECTION( __VA_ARGS__ )
+#define CATCH_SECTION_BUDGET( ms ) INTERNAL_CATCH_SECTION_BUDGET( "CATCH_SECTION_BUDGET", ms )
 #define CATCH_FAIL( ... ) INTERNAL_CATCH_MSG( "CATCH_FAIL", Catch::ResultWas::ExplicitFailure, Catch::ResultDisposition::Normal, __VA_ARGS__ )
 #define CATCH_FAIL_CHECK( ... ) INTERNAL_CATCH_MSG( "CATCH_FAIL_CHECK", Catch::ResultWas::ExplicitFailure, Catch::ResultDisposition::ContinueOnFailure, __VA_ARGS__ )
 #define CATCH_SUCCEED( ... ) INTERNAL_CATCH_MSG( "CATCH_SUCCEED", Catch::ResultWas::Ok, Catch::ResultDisposition::ContinueOnFailure, __VA_ARGS__ )
@@ -168,6 +186,8 @@
 #define REQUIRE_THROWS_MATCHES( expr, exceptionType, matcher ) INTERNAL_CATCH_THROWS_MATCHES( "REQUIRE_THROWS_MATCHES", exceptionType, Catch::ResultDisposition::Normal, matcher, expr )
 #endif // CATCH_CONFIG_DISABLE_MATCHERS
 #define REQUIRE_NOTHROW( ... ) INTERNAL_CATCH_NO_THROW( "REQUIRE_NOTHROW", Catch::ResultDisposition::Normal, __VA_ARGS__ )
+#define REQUIRE_MAX_ALLOCATIONS( expr, budget ) INTERNAL_CATCH_MAX_ALLOCATIONS( "REQUIRE_MAX_ALLOCATIONS", Catch::ResultDisposition::Normal, expr, budget )
+#define REQUIRE_EVENTUALLY( expr, timeout ) INTERNAL_CATCH_EVENTUALLY( "REQUIRE_EVENTUALLY", Catch::ResultDisposition::Normal, expr, timeout )
 
 #define CHECK( ... ) INTERNAL_CATCH_TEST( "CHECK", Catch::ResultDisposition::ContinueOnFailure, __VA_ARGS__ )
 #define CHECK_FALSE( ... ) INTERNAL_CATCH_TEST( "CHECK_FALSE", Catch::ResultDisposition::ContinueOnFailure | Catch::ResultDisposition::FalseTest, __VA_ARGS__ )
@@ -193,13 +213,19 @@
 #define INFO( msg ) INTERNAL_CATCH_INFO( "INFO", msg )
 #define WARN( msg ) INTERNAL_CATCH_MSG( "WARN", Catch::ResultWas::Warning, Catch::ResultDisposition::ContinueOnFailure, msg )
 #define CAPTURE( ... ) INTERNAL_CATCH_CAPTURE( INTERNAL_CATCH_UNIQUE_NAME(capturer), "CAPTURE",__VA_ARGS__ )
+#define DEFERRED_CAPTURE( ... ) INTERNAL_CATCH_CAPTURE_DEFERRED( INTERNAL_CATCH_UNIQUE_NAME(capturer), "DEFERRED_CAPTURE",__VA_ARGS__ )
+#define CHECKPOINT( value ) INTERNAL_CATCH_CHECKPOINT( value )
 
 #define TEST_CASE( ... ) INTERNAL_CATCH_TESTCASE( __VA_ARGS__ )
+#if defined(CATCH_CONFIG_CXX20_COROUTINES)
+#define ASYNC_TEST_CASE( ... ) INTERNAL_CATCH_ASYNC_TESTCASE( __VA_ARGS__ )
+#endif
 #define TEST_CASE_METHOD( className, ... ) INTERNAL_CATCH_TEST_CASE_METHOD( className, __VA_ARGS__ )
 #define METHOD_AS_TEST_CASE( method, ... ) INTERNAL_CATCH_METHOD_AS_TEST_CASE( method, __VA_ARGS__ )
 #define REGISTER_TEST_CASE( Function, ... ) INTERNAL_CATCH_REGISTER_TESTCASE( Function, __VA_ARGS__ )
 #define SECTION( ... ) INTERNAL_CATCH_SECTION( __VA_ARGS__ )
 #define DYNAMIC_SECTION( ... ) INTERNAL_CATCH_DYNAMIC_SECTION( __VA_ARGS__ )
+#define SECTION_BUDGET( ms ) INTERNAL_CATCH_SECTION_BUDGET( "SECTION_BUDGET", ms )
 #define FAIL( ... ) INTERNAL_CATCH_MSG( "FAIL", Catch::ResultWas::ExplicitFailure, Catch::ResultDisposition::Normal, __VA_ARGS__ )
 #define FAIL_CHECK( ... ) INTERNAL_CATCH_MSG( "FAIL_CHECK", Catch::ResultWas::ExplicitFailure, Catch::ResultDisposition::ContinueOnFailure, __VA_ARGS__ )
 #define SUCCEED( ... ) INTERNAL_CATCH_MSG( "SUCCEED", Catch::ResultWas::Ok, Catch::ResultDisposition::ContinueOnFailure, __VA_ARGS__ )
@@ -221,6 +247,7 @@
 #define AND_THEN( desc )  INTERNAL_CATCH_DYNAMIC_SECTION( "      And: " << desc )
 
 using Catch::Detail::Approx;
+using Catch::Detail::ApproxRange;
 
 #else // CATCH_CONFIG_DISABLE
 
@@ -238,6 +265,8 @@ using Catch::Detail::Approx;
 #define CATCH_REQUIRE_THROWS_MATCHES( expr, exceptionType, matcher ) (void)(0)
 #endif// CATCH_CONFIG_DISABLE_MATCHERS
 #define CATCH_REQUIRE_NOTHROW( ... ) (void)(0)
+#define CATCH_REQUIRE_MAX_ALLOCATIONS( expr, budget ) (void)(0)
+#define CATCH_REQUIRE_EVENTUALLY( expr, timeout ) (void)(0)
 
 #define CATCH_CHECK( ... )         (void)(0)
 #define CATCH_CHECK_FALSE( ... )   (void)(0)
@@ -262,13 +291,19 @@ using Catch::Detail::Approx;
 #define CATCH_INFO( msg )    (void)(0)
 #define CATCH_WARN( msg )    (void)(0)
 #define CATCH_CAPTURE( msg ) (void)(0)
+#define CATCH_DEFERRED_CAPTURE( msg ) (void)(0)
+#define CATCH_CHECKPOINT( value ) (void)(0)
 
 #define CATCH_TEST_CASE( ... ) INTERNAL_CATCH_TESTCASE_NO_REGISTRATION(INTERNAL_CATCH_UNIQUE_NAME( ____C_A_T_C_H____T_E_S_T____ ))
+#if defined(CATCH_CONFIG_CXX20_COROUTINES)
+#define CATCH_ASYNC_TEST_CASE( ... ) INTERNAL_CATCH_ASYNC_TESTCASE_NO_REGISTRATION(INTERNAL_CATCH_UNIQUE_NAME( ____C_A_T_C_H____T_E_S_T____ ))
+#endif
 #define CATCH_TEST_CASE_METHOD( className, ... ) INTERNAL_CATCH_TESTCASE_NO_REGISTRATION(INTERNAL_CATCH_UNIQUE_NAME( ____C_A_T_C_H____T_E_S_T____ ))
 #define CATCH_METHOD_AS_TEST_CASE( method, ... )
 #define CATCH_REGISTER_TEST_CASE( Function, ... ) (void)(0)
 #define CATCH_SECTION( ... )
 #define CATCH_DYNAMIC_SECTION( ... )
+#define CATCH_SECTION_BUDGET( ms ) (void)(0)
 #define CATCH_FAIL( ... ) (void)(0)
 #define CATCH_FAIL_CHECK( ... ) (void)(0)
 #define CATCH_SUCCEED( ... ) (void)(0)
@@ -298,6 +333,8 @@ using Catch::Detail::Approx;
 #define REQUIRE_THROWS_MATCHES( expr, exceptionType, matcher ) (void)(0)
 #endif // CATCH_CONFIG_DISABLE_MATCHERS
 #define REQUIRE_NOTHROW( ... ) (void)(0)
+#define REQUIRE_MAX_ALLOCATIONS( expr, budget ) (void)(0)
+#define REQUIRE_EVENTUALLY( expr, timeout ) (void)(0)
 
 #define CHECK( ... ) (void)(0)
 #define CHECK_FALSE( ... ) (void)(0)
@@ -323,13 +360,19 @@ using Catch::Detail::Approx;
 #define INFO( msg ) (void)(0)
 #define WARN( msg ) (void)(0)
 #define CAPTURE( msg ) (void)(0)
+#define DEFERRED_CAPTURE( msg ) (void)(0)
+#define CHECKPOINT( value ) (void)(0)
 
 #define TEST_CASE( ... )  INTERNAL_CATCH_TESTCASE_NO_REGISTRATION(INTERNAL_CATCH_UNIQUE_NAME( ____C_A_T_C_H____T_E_S_T____ ))
+#if defined(CATCH_CONFIG_CXX20_COROUTINES)
+#define ASYNC_TEST_CASE( ... ) INTERNAL_CATCH_ASYNC_TESTCASE_NO_REGISTRATION(INTERNAL_CATCH_UNIQUE_NAME( ____C_A_T_C_H____T_E_S_T____ ))
+#endif
 #define TEST_CASE_METHOD( className, ... ) INTERNAL_CATCH_TESTCASE_NO_REGISTRATION(INTERNAL_CATCH_UNIQUE_NAME( ____C_A_T_C_H____T_E_S_T____ ))
 #define METHOD_AS_TEST_CASE( method, ... )
 #define REGISTER_TEST_CASE( Function, ... ) (void)(0)
 #define SECTION( ... )
 #define DYNAMIC_SECTION( ... )
+#define SECTION_BUDGET( ms ) (void)(0)
 #define FAIL( ... ) (void)(0)
 #define FAIL_CHECK( ... ) (void)(0)
 #define SUCCEED( ... ) (void)(0)
@@ -351,6 +394,7 @@ using Catch::Detail::Approx;
 #define AND_THEN( desc )
 
 using Catch::Detail::Approx;
+using Catch::Detail::ApproxRange;
 
 
 #endif
@@ -362,6 +362,9 @@ namespace Catch { namespace clara { namespace TextFlow {
 // ----------- end of #include from clara_textflow.hpp -----------
 // ........... back in clara.hpp
 
+// The combinator parser below is by far the heavier half of this header;
+// hosts that bring their own parser can keep just TextFlow
+#if !defined(CATCH_CLARA_TEXTFLOW_ONLY)
 
 #include <memory>
 #include <set>
@@ -1252,5 +1255,6 @@ using detail::ParserResult;
 
 }} // namespace Catch::clara
 
+#endif // !defined(CATCH_CLARA_TEXTFLOW_ONLY)
 
 #endif // CATCH_CLARA_HPP_INCLUDED
@@ -0,0 +1,171 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_alloc_metrics.h"
+
+#if defined(CATCH_CONFIG_ALLOC_METRICS)
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace Catch {
+namespace {
+
+    // Each block is over-allocated by one maximally aligned header
+    // holding its requested size, so frees can be attributed without
+    // relying on sized delete being called
+    constexpr std::size_t allocHeaderSize = alignof( std::max_align_t );
+
+    struct ThreadAllocCounters {
+        bool active = false;
+        uint64_t allocations = 0;
+        uint64_t bytesAllocated = 0;
+        // Live bytes relative to open(); may go negative when blocks
+        // allocated earlier are freed inside the timed region
+        int64_t liveBytes = 0;
+        int64_t peakLiveBytes = 0;
+    };
+    thread_local ThreadAllocCounters s_counters;
+
+    void* trackedAllocNoThrow( std::size_t size ) noexcept {
+        void* raw = std::malloc( size + allocHeaderSize );
+        if( !raw )
+            return nullptr;
+        *static_cast<std::size_t*>( raw ) = size;
+        if( s_counters.active ) {
+            ++s_counters.allocations;
+            s_counters.bytesAllocated += size;
+            s_counters.liveBytes += static_cast<int64_t>( size );
+            if( s_counters.liveBytes > s_counters.peakLiveBytes )
+                s_counters.peakLiveBytes = s_counters.liveBytes;
+        }
+        return static_cast<char*>( raw ) + allocHeaderSize;
+    }
+
+    void* trackedAlloc( std::size_t size ) {
+        for(;;) {
+            void* block = trackedAllocNoThrow( size );
+            if( block )
+                return block;
+            std::new_handler handler = std::get_new_handler();
+            if( !handler )
+#if defined(CATCH_CONFIG_DISABLE_EXCEPTIONS)
+                std::terminate();
+#else
+                throw std::bad_alloc();
+#endif
+            handler();
+        }
+    }
+
+    void trackedFree( void* ptr ) noexcept {
+        if( !ptr )
+            return;
+        void* raw = static_cast<char*>( ptr ) - allocHeaderSize;
+        if( s_counters.active )
+            s_counters.liveBytes -= static_cast<int64_t>( *static_cast<std::size_t*>( raw ) );
+        std::free( raw );
+    }
+
+} // end anonymous namespace
+
+    void AllocMetricsSampler::open() {
+        s_counters.allocations = 0;
+        s_counters.bytesAllocated = 0;
+        s_counters.liveBytes = 0;
+        s_counters.peakLiveBytes = 0;
+    }
+    void AllocMetricsSampler::start() {
+        s_counters.active = true;
+    }
+    void AllocMetricsSampler::stop() {
+        s_counters.active = false;
+    }
+    auto AllocMetricsSampler::read() const -> AllocMetrics {
+        AllocMetrics metrics;
+        metrics.sampled = true;
+        metrics.allocations = s_counters.allocations;
+        metrics.bytesAllocated = s_counters.bytesAllocated;
+        metrics.peakLiveBytes = s_counters.peakLiveBytes > 0
+            ? static_cast<uint64_t>( s_counters.peakLiveBytes ) : 0;
+        return metrics;
+    }
+
+    AllocationCounter::AllocationCounter()
+    :   m_allocationsAtStart( s_counters.allocations ),
+        m_wasActive( s_counters.active )
+    {
+        s_counters.active = true;
+    }
+    AllocationCounter::~AllocationCounter() {
+        s_counters.active = m_wasActive;
+    }
+    auto AllocationCounter::count() const -> uint64_t {
+        return s_counters.allocations - m_allocationsAtStart;
+    }
+    auto AllocationCounter::available() -> bool {
+        return true;
+    }
+
+} // end namespace Catch
+
+void* operator new( std::size_t size ) {
+    return Catch::trackedAlloc( size );
+}
+void* operator new[]( std::size_t size ) {
+    return Catch::trackedAlloc( size );
+}
+void* operator new( std::size_t size, std::nothrow_t const& ) noexcept {
+    return Catch::trackedAllocNoThrow( size );
+}
+void* operator new[]( std::size_t size, std::nothrow_t const& ) noexcept {
+    return Catch::trackedAllocNoThrow( size );
+}
+void operator delete( void* ptr ) noexcept {
+    Catch::trackedFree( ptr );
+}
+void operator delete[]( void* ptr ) noexcept {
+    Catch::trackedFree( ptr );
+}
+void operator delete( void* ptr, std::size_t ) noexcept {
+    Catch::trackedFree( ptr );
+}
+void operator delete[]( void* ptr, std::size_t ) noexcept {
+    Catch::trackedFree( ptr );
+}
+void operator delete( void* ptr, std::nothrow_t const& ) noexcept {
+    Catch::trackedFree( ptr );
+}
+void operator delete[]( void* ptr, std::nothrow_t const& ) noexcept {
+    Catch::trackedFree( ptr );
+}
+
+#else // ^^ CATCH_CONFIG_ALLOC_METRICS // no instrumentation vv
+
+namespace Catch {
+
+    void AllocMetricsSampler::open() {}
+    void AllocMetricsSampler::start() {}
+    void AllocMetricsSampler::stop() {}
+    auto AllocMetricsSampler::read() const -> AllocMetrics {
+        return AllocMetrics();
+    }
+
+    AllocationCounter::AllocationCounter()
+    :   m_allocationsAtStart( 0 ),
+        m_wasActive( false )
+    {}
+    AllocationCounter::~AllocationCounter() {}
+    auto AllocationCounter::count() const -> uint64_t {
+        return 0;
+    }
+    auto AllocationCounter::available() -> bool {
+        return false;
+    }
+
+} // end namespace Catch
+
+#endif // CATCH_CONFIG_ALLOC_METRICS
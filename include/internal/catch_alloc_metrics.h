@@ -0,0 +1,61 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_ALLOC_METRICS_H_INCLUDED
+#define TWOBLUECUBES_CATCH_ALLOC_METRICS_H_INCLUDED
+
+#include <cstdint>
+
+namespace Catch {
+
+    // Global heap traffic accumulated over the timed region of a
+    // BENCHMARK. Only available when the binary is built with
+    // CATCH_CONFIG_ALLOC_METRICS, which replaces the global allocation
+    // functions; otherwise sampled stays false and reporters skip the
+    // values. Throughput regressions are often allocation regressions,
+    // and an accidental per-iteration allocation shows up here long
+    // before it shows up in a production profile.
+    struct AllocMetrics {
+        bool sampled = false;
+        uint64_t allocations = 0;
+        uint64_t bytesAllocated = 0;
+        uint64_t peakLiveBytes = 0;
+    };
+
+    // Counts new/delete traffic on the calling thread. Counting only
+    // happens between start() and stop(), so the benchmark bookkeeping
+    // between samples is not attributed to the measured code. All
+    // methods are no-ops unless CATCH_CONFIG_ALLOC_METRICS is defined.
+    class AllocMetricsSampler {
+    public:
+        void open();
+        void start();
+        void stop();
+        auto read() const -> AllocMetrics;
+    };
+
+    // Counts this thread's heap allocations between construction and
+    // count(), for REQUIRE_MAX_ALLOCATIONS. Counting is forced on for
+    // the counter's lifetime and the previous state restored afterwards,
+    // so it works outside benchmarks too. available() is false without
+    // CATCH_CONFIG_ALLOC_METRICS, and count() then always returns 0.
+    class AllocationCounter {
+    public:
+        AllocationCounter();
+        ~AllocationCounter();
+
+        AllocationCounter( AllocationCounter const& ) = delete;
+        AllocationCounter& operator = ( AllocationCounter const& ) = delete;
+
+        auto count() const -> uint64_t;
+        static auto available() -> bool;
+
+    private:
+        uint64_t m_allocationsAtStart;
+        bool m_wasActive;
+    };
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_ALLOC_METRICS_H_INCLUDED
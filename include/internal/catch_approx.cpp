@@ -9,6 +9,7 @@
 #include "catch_approx.h"
 #include "catch_enforce.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -69,6 +70,65 @@ namespace Detail {
         m_epsilon = epsilon;
     }
 
+
+    ApproxRange::ApproxRange( std::vector<double> values )
+    :   m_epsilon( std::numeric_limits<float>::epsilon()*100 ),
+        m_margin( 0.0 ),
+        m_scale( 0.0 ),
+        m_values( std::move(values) )
+    {}
+
+    std::vector<double> const& ApproxRange::effectiveMargins() const {
+        if( m_marginsDirty ) {
+            // An element passes if it is within the fixed margin or within
+            // the epsilon margin scaled by the expected value - which is
+            // the same as being within the larger of the two
+            m_effectiveMargins.clear();
+            m_effectiveMargins.reserve( m_values.size() );
+            for( auto value : m_values )
+                m_effectiveMargins.push_back( (std::max)( m_margin, m_epsilon * (m_scale + std::fabs(value)) ) );
+            m_marginsDirty = false;
+        }
+        return m_effectiveMargins;
+    }
+
+    bool ApproxRange::recordMismatch( std::size_t index, double value ) const {
+        ReusableStringStream rss;
+        rss << ", first mismatch at index " << index << ": "
+            << ::Catch::Detail::stringify( value ) << " vs " << ::Catch::Detail::stringify( m_values[index] );
+        m_mismatch = rss.str();
+        return false;
+    }
+
+    bool ApproxRange::recordSizeMismatch( std::size_t size ) const {
+        ReusableStringStream rss;
+        rss << ", mismatched sizes: " << size << " vs " << m_values.size();
+        m_mismatch = rss.str();
+        return false;
+    }
+
+    void ApproxRange::setMargin(double margin) {
+        CATCH_ENFORCE(margin >= 0,
+            "Invalid ApproxRange::margin: " << margin << '.'
+            << " ApproxRange::margin has to be non-negative.");
+        m_margin = margin;
+        m_marginsDirty = true;
+    }
+
+    void ApproxRange::setEpsilon(double epsilon) {
+        CATCH_ENFORCE(epsilon >= 0 && epsilon <= 1.0,
+            "Invalid ApproxRange::epsilon: " << epsilon << '.'
+            << " ApproxRange::epsilon has to be in [0, 1]");
+        m_epsilon = epsilon;
+        m_marginsDirty = true;
+    }
+
+    std::string ApproxRange::toString() const {
+        ReusableStringStream rss;
+        rss << "ApproxRange( " << m_values.size() << " elements" << m_mismatch << " )";
+        return rss.str();
+    }
+
 } // end namespace Detail
 
 namespace literals {
@@ -84,4 +144,8 @@ std::string StringMaker<Catch::Detail::Approx>::convert(Catch::Detail::Approx co
     return value.toString();
 }
 
+std::string StringMaker<Catch::Detail::ApproxRange>::convert(Catch::Detail::ApproxRange const& value) {
+    return value.toString();
+}
+
 } // end namespace Catch
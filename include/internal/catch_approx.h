@@ -11,6 +11,7 @@
 #include "catch_tostring.h"
 
 #include <type_traits>
+#include <vector>
 
 namespace Catch {
 namespace Detail {
@@ -115,6 +116,99 @@ namespace Detail {
         double m_scale;
         double m_value;
     };
+
+    // Approx over a whole contiguous buffer. The expected values are
+    // converted to double once, and the per-element comparison margins -
+    // which depend on each expected value through the scaled epsilon - are
+    // precomputed and reused, so repeated comparisons are a single fused
+    // pass with no per-element setup. On mismatch the first offending
+    // index and value are reported instead of stringifying the buffers.
+    class ApproxRange {
+    private:
+        // Performs equivalent check of std::fabs(lhs - rhs) <= margin
+        // But without the subtraction to allow for INFINITY in comparison
+        static bool marginComparison( double lhs, double rhs, double margin ) {
+            return (lhs + margin >= rhs) && (rhs + margin >= lhs);
+        }
+
+        // The two recorders always return false, so the comparison
+        // operators can record and bail out in one statement
+        bool recordMismatch( std::size_t index, double value ) const;
+        bool recordSizeMismatch( std::size_t size ) const;
+
+        std::vector<double> const& effectiveMargins() const;
+
+        // Validation rules match Approx::margin/Approx::epsilon;
+        // out-of-line to avoid including stdexcept in the header
+        void setMargin( double margin );
+        void setEpsilon( double epsilon );
+
+    public:
+        explicit ApproxRange( std::vector<double> values );
+
+        template <typename T, typename = typename std::enable_if<std::is_constructible<double, T>::value>::type>
+        explicit ApproxRange( std::vector<T> const& expected )
+        : ApproxRange( std::vector<double>( expected.begin(), expected.end() ) )
+        {}
+
+        template <typename T, typename = typename std::enable_if<std::is_constructible<double, T>::value>::type>
+        friend bool operator == ( std::vector<T> const& lhs, ApproxRange const& rhs ) {
+            if( lhs.size() != rhs.m_values.size() )
+                return rhs.recordSizeMismatch( lhs.size() );
+            auto const& margins = rhs.effectiveMargins();
+            for( std::size_t i = 0; i < lhs.size(); ++i ) {
+                auto lhs_v = static_cast<double>( lhs[i] );
+                if( !marginComparison( lhs_v, rhs.m_values[i], margins[i] ) )
+                    return rhs.recordMismatch( i, lhs_v );
+            }
+            return true;
+        }
+
+        template <typename T, typename = typename std::enable_if<std::is_constructible<double, T>::value>::type>
+        friend bool operator == ( ApproxRange const& lhs, std::vector<T> const& rhs ) {
+            return operator==( rhs, lhs );
+        }
+
+        template <typename T, typename = typename std::enable_if<std::is_constructible<double, T>::value>::type>
+        friend bool operator != ( std::vector<T> const& lhs, ApproxRange const& rhs ) {
+            return !operator==( lhs, rhs );
+        }
+
+        template <typename T, typename = typename std::enable_if<std::is_constructible<double, T>::value>::type>
+        friend bool operator != ( ApproxRange const& lhs, std::vector<T> const& rhs ) {
+            return !operator==( rhs, lhs );
+        }
+
+        template <typename T, typename = typename std::enable_if<std::is_constructible<double, T>::value>::type>
+        ApproxRange& epsilon( T const& newEpsilon ) {
+            setEpsilon( static_cast<double>(newEpsilon) );
+            return *this;
+        }
+
+        template <typename T, typename = typename std::enable_if<std::is_constructible<double, T>::value>::type>
+        ApproxRange& margin( T const& newMargin ) {
+            setMargin( static_cast<double>(newMargin) );
+            return *this;
+        }
+
+        template <typename T, typename = typename std::enable_if<std::is_constructible<double, T>::value>::type>
+        ApproxRange& scale( T const& newScale ) {
+            m_scale = static_cast<double>(newScale);
+            m_marginsDirty = true;
+            return *this;
+        }
+
+        std::string toString() const;
+
+    private:
+        double m_epsilon;
+        double m_margin;
+        double m_scale;
+        std::vector<double> m_values;
+        mutable std::vector<double> m_effectiveMargins;
+        mutable bool m_marginsDirty = true;
+        mutable std::string m_mismatch;
+    };
 } // end namespace Detail
 
 namespace literals {
@@ -126,6 +220,10 @@ template<>
 struct StringMaker<Catch::Detail::Approx> {
     static std::string convert(Catch::Detail::Approx const& value);
 };
+template<>
+struct StringMaker<Catch::Detail::ApproxRange> {
+    static std::string convert(Catch::Detail::ApproxRange const& value);
+};
 
 } // end namespace Catch
 
@@ -0,0 +1,62 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_arena.h"
+
+namespace Catch {
+
+    Arena::Arena( std::size_t blockSize )
+    :   m_blockSize( blockSize )
+    {}
+
+    Arena::~Arena() {
+        while( m_blocks ) {
+            Block* next = m_blocks->next;
+            delete[] m_blocks->data;
+            delete m_blocks;
+            m_blocks = next;
+        }
+    }
+
+    Arena::Block* Arena::addBlock( std::size_t minSize ) {
+        auto size = minSize > m_blockSize ? minSize : m_blockSize;
+        Block* block = new Block{ m_blocks, new unsigned char[size], size };
+        m_blocks = block;
+        return block;
+    }
+
+    void* Arena::allocate( std::size_t size, std::size_t alignment ) {
+        auto misalignment = reinterpret_cast<std::size_t>( m_cursor ) & ( alignment - 1 );
+        auto padding = misalignment ? alignment - misalignment : 0;
+
+        if( m_cursor == nullptr || m_cursor + padding + size > m_blockEnd ) {
+            Block* block = addBlock( size + alignment );
+            m_cursor = block->data;
+            m_blockEnd = block->data + block->size;
+            misalignment = reinterpret_cast<std::size_t>( m_cursor ) & ( alignment - 1 );
+            padding = misalignment ? alignment - misalignment : 0;
+        }
+
+        auto allocation = m_cursor + padding;
+        m_cursor = allocation + size;
+        return allocation;
+    }
+
+    void Arena::reset() {
+        // Keep the most recently added (largest seen) block for reuse
+        while( m_blocks && m_blocks->next ) {
+            Block* next = m_blocks->next;
+            delete[] next->data;
+            Block* afterNext = next->next;
+            delete next;
+            m_blocks->next = afterNext;
+        }
+        if( m_blocks ) {
+            m_cursor = m_blocks->data;
+            m_blockEnd = m_blocks->data + m_blocks->size;
+        }
+    }
+
+} // end namespace Catch
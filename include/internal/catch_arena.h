@@ -0,0 +1,71 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_ARENA_H_INCLUDED
+#define TWOBLUECUBES_CATCH_ARENA_H_INCLUDED
+
+#include <cstddef>
+
+namespace Catch {
+
+    // A bump allocator for transient, per-test-case objects. Allocations
+    // are satisfied by advancing a cursor through fixed-size blocks and are
+    // only ever released wholesale via reset(), which keeps the first block
+    // around - so once a few tests have run, the steady state performs no
+    // heap allocation at all and related objects stay cache-local.
+    class Arena {
+        struct Block {
+            Block* next;
+            unsigned char* data;
+            std::size_t size;
+        };
+
+        Block* m_blocks = nullptr;
+        unsigned char* m_cursor = nullptr;
+        unsigned char* m_blockEnd = nullptr;
+        std::size_t m_blockSize;
+
+        Block* addBlock( std::size_t minSize );
+
+    public:
+        explicit Arena( std::size_t blockSize = 4096 );
+        ~Arena();
+
+        Arena( Arena const& ) = delete;
+        Arena& operator =( Arena const& ) = delete;
+
+        void* allocate( std::size_t size, std::size_t alignment );
+
+        // Invalidates everything allocated so far; the most recently added
+        // block is retained for reuse
+        void reset();
+    };
+
+    // Minimal std-compatible allocator over an Arena. deallocate is a no-op:
+    // memory is reclaimed when the arena is reset, which must not happen
+    // before the last object allocated through this allocator is destroyed.
+    template<typename T>
+    class ArenaAllocator {
+        template<typename U> friend class ArenaAllocator;
+
+        Arena* m_arena;
+    public:
+        using value_type = T;
+
+        ArenaAllocator( Arena& arena ) : m_arena( &arena ) {}
+        template<typename U>
+        ArenaAllocator( ArenaAllocator<U> const& other ) : m_arena( other.m_arena ) {}
+
+        T* allocate( std::size_t count ) {
+            return static_cast<T*>( m_arena->allocate( count * sizeof(T), alignof(T) ) );
+        }
+        void deallocate( T*, std::size_t ) {}
+
+        bool operator ==( ArenaAllocator const& other ) const { return m_arena == other.m_arena; }
+        bool operator !=( ArenaAllocator const& other ) const { return m_arena != other.m_arena; }
+    };
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_ARENA_H_INCLUDED
@@ -0,0 +1,133 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_assertion_profile.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+namespace Catch {
+namespace AssertionProfile {
+
+    namespace {
+
+        // Bucket i counts assertions that took [2^i, 2^(i+1)) ns; the
+        // last bucket catches everything slower (~9 minutes up)
+        constexpr std::size_t bucketCount = 40;
+
+        struct LocationHistogram {
+            uint64_t count = 0;
+            uint64_t totalNs = 0;
+            uint64_t maxNs = 0;
+            uint32_t buckets[bucketCount] = {};
+
+            void add( uint64_t elapsedNs ) {
+                ++count;
+                totalNs += elapsedNs;
+                if( elapsedNs > maxNs )
+                    maxNs = elapsedNs;
+                std::size_t bucket = 0;
+                while( bucket < bucketCount-1 && ( elapsedNs >> ( bucket+1 ) ) != 0 )
+                    ++bucket;
+                ++buckets[bucket];
+            }
+
+            // Upper bound of the bucket holding the q-th quantile -
+            // within a factor of two of the true value, which is all the
+            // log2 buckets can promise
+            auto quantileNs( double q ) const -> uint64_t {
+                auto target = static_cast<uint64_t>( q * static_cast<double>( count ) );
+                uint64_t seen = 0;
+                for( std::size_t i = 0; i < bucketCount; ++i ) {
+                    seen += buckets[i];
+                    if( seen > target )
+                        return static_cast<uint64_t>( 1 ) << ( i+1 );
+                }
+                return maxNs;
+            }
+        };
+
+        // The same file/line always stringises the same __FILE__ literal,
+        // so pointer identity is a valid (and cheap) key component
+        struct LocationKey {
+            char const* file;
+            std::size_t line;
+
+            auto operator == ( LocationKey const& other ) const -> bool {
+                return file == other.file && line == other.line;
+            }
+        };
+        struct LocationKeyHash {
+            auto operator ()( LocationKey const& key ) const -> std::size_t {
+                return std::hash<char const*>()( key.file ) ^ ( key.line << 1 );
+            }
+        };
+
+        bool s_enabled = false;
+
+        // record() can be hit from worker threads under --jobs
+        std::mutex s_mutex;
+        auto histograms() -> std::unordered_map<LocationKey, LocationHistogram, LocationKeyHash>& {
+            static std::unordered_map<LocationKey, LocationHistogram, LocationKeyHash> s_histograms;
+            return s_histograms;
+        }
+
+    } // anon namespace
+
+    bool enabled() {
+        return s_enabled;
+    }
+    void setEnabled( bool enabled ) {
+        s_enabled = enabled;
+    }
+
+    void record( SourceLineInfo const& lineInfo, uint64_t elapsedNanoseconds ) {
+        std::lock_guard<std::mutex> lock( s_mutex );
+        histograms()[ LocationKey{ lineInfo.file, lineInfo.line } ].add( elapsedNanoseconds );
+    }
+
+    void report( std::ostream& os ) {
+        std::vector<std::pair<LocationKey, LocationHistogram const*>> sorted;
+        {
+            std::lock_guard<std::mutex> lock( s_mutex );
+            sorted.reserve( histograms().size() );
+            for( auto const& entry : histograms() )
+                sorted.push_back( { entry.first, &entry.second } );
+        }
+        if( sorted.empty() )
+            return;
+
+        std::sort( sorted.begin(), sorted.end(),
+            []( std::pair<LocationKey, LocationHistogram const*> const& lhs,
+                std::pair<LocationKey, LocationHistogram const*> const& rhs ) {
+                return lhs.second->totalNs > rhs.second->totalNs;
+            } );
+
+        os << "\nAssertion latency profile (ns; quantiles are log2-bucket upper bounds):\n"
+           << std::setw( 10 ) << "count"
+           << std::setw( 14 ) << "total"
+           << std::setw( 10 ) << "mean"
+           << std::setw( 12 ) << "p50"
+           << std::setw( 12 ) << "p99"
+           << std::setw( 12 ) << "max"
+           << "  location\n";
+        for( auto const& entry : sorted ) {
+            auto const& hist = *entry.second;
+            os << std::setw( 10 ) << hist.count
+               << std::setw( 14 ) << hist.totalNs
+               << std::setw( 10 ) << hist.totalNs / hist.count
+               << std::setw( 12 ) << hist.quantileNs( 0.5 )
+               << std::setw( 12 ) << hist.quantileNs( 0.99 )
+               << std::setw( 12 ) << hist.maxNs
+               << "  " << entry.first.file << ':' << entry.first.line << '\n';
+        }
+    }
+
+} // namespace AssertionProfile
+} // namespace Catch
@@ -0,0 +1,37 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_ASSERTION_PROFILE_H_INCLUDED
+#define TWOBLUECUBES_CATCH_ASSERTION_PROFILE_H_INCLUDED
+
+#include "catch_common.h"
+
+#include <cstdint>
+#include <iosfwd>
+
+namespace Catch {
+
+    // Opt-in (--assertion-profile) per-assertion latency histograms,
+    // keyed by source location. AssertionHandler timestamps each
+    // assertion from construction to completion - so the measured time
+    // covers expression evaluation, stringification, matchers and
+    // reporting - and records the elapsed time into log2 buckets, HDR
+    // style. The report names the most expensive assertion sites, to
+    // attack framework overhead with data rather than guesswork.
+    namespace AssertionProfile {
+
+        bool enabled();
+        void setEnabled( bool enabled );
+
+        void record( SourceLineInfo const& lineInfo, uint64_t elapsedNanoseconds );
+
+        // Writes the histogram table, most expensive location first.
+        // No-op if nothing was recorded.
+        void report( std::ostream& os );
+
+    } // namespace AssertionProfile
+
+} // namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_ASSERTION_PROFILE_H_INCLUDED
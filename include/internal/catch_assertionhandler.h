@@ -11,6 +11,7 @@
 #include "catch_assertioninfo.h"
 #include "catch_decomposer.h"
 #include "catch_interfaces_capture.h"
+#include "catch_timer.h"
 
 namespace Catch {
 
@@ -42,17 +43,20 @@ namespace Catch {
     };
 
     class AssertionHandler {
-        AssertionInfo m_assertionInfo;
+        // Owned by the callsite: the macros materialise the constant
+        // parts (macro name, source location, stringified expression,
+        // disposition) once, as a function-local static, so a REQUIRE in
+        // a loop does not rebuild them every iteration
+        AssertionInfo const& m_assertionInfo;
         AssertionReaction m_reaction;
         bool m_completed = false;
         IResultCapture& m_resultCapture;
+        // Only started under --assertion-profile; construction is a
+        // single zero-init otherwise
+        TickTimer m_profileTimer;
 
     public:
-        AssertionHandler
-            (   StringRef const& macroName,
-                SourceLineInfo const& lineInfo,
-                StringRef capturedExpression,
-                ResultDisposition::Flags resultDisposition );
+        AssertionHandler( AssertionInfo const& assertionInfo );
         ~AssertionHandler() {
             if ( !m_completed ) {
                 m_resultCapture.handleIncomplete( m_assertionInfo );
@@ -83,6 +87,22 @@ namespace Catch {
 
     void handleExceptionMatchExpr( AssertionHandler& handler, std::string const& str, StringRef const& matcherString );
 
+    // For REQUIRE_MAX_ALLOCATIONS; fails when the observed allocation
+    // count exceeds the budget, or when the binary was built without
+    // CATCH_CONFIG_ALLOC_METRICS and so could not count at all
+    void handleAllocationBudgetExpr( AssertionHandler& handler, uint64_t allocations, uint64_t budget );
+    // For REQUIRE_EVENTUALLY; fails when the condition never held within
+    // the timeout, reporting how long was polled either way
+    void handleEventuallyExpr( AssertionHandler& handler, bool conditionHeld, double elapsedSeconds, double timeoutSeconds );
+
 } // namespace Catch
 
+///////////////////////////////////////////////////////////////////////////////
+// Declares the callsite-constant part of an assertion as a function-local
+// static, initialised on the first pass only; the handler binds to it by
+// reference (each assertion macro opens its own scope, so the fixed name
+// cannot collide)
+#define INTERNAL_CATCH_ASSERTION_INFO( macroName, capturedExpression, resultDisposition ) \
+    static Catch::AssertionInfo const catch_internal_assertionInfo{ macroName##_catch_sr, CATCH_INTERNAL_LINEINFO, capturedExpression, resultDisposition };
+
 #endif // TWOBLUECUBES_CATCH_ASSERTIONHANDLER_H_INCLUDED
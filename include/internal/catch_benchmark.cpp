@@ -8,28 +8,283 @@
 
 #include "catch_benchmark.h"
 #include "catch_capture.hpp"
+#include "catch_enforce.h"
 #include "catch_interfaces_reporter.h"
 #include "catch_context.h"
 
+#include <cmath>
+
 namespace Catch {
 
+#if defined(_MSC_VER)
+    namespace Detail {
+        // Opaque across translation units, so the optimiser must assume the
+        // pointed-to value is read
+        void keepCharPointer( char const volatile* ) {}
+    }
+#endif
+
+    namespace {
+        auto benchmarkResolution() -> uint64_t {
+            auto config = getCurrentContext().getConfig();
+            // Under a sanitizer or valgrind the timings are meaningless
+            // anyway; a zero resolution stops the calibration loop from
+            // growing the iteration count, so the block runs once per
+            // sample as a smoke test
+            if( config->runningUnderInstrumentation() )
+                return 0;
+            setClockResolutionCacheFile( config->benchmarkResolutionCacheFile() );
+            return getEstimatedTickResolution() * config->benchmarkResolutionMultiple();
+        }
+
+        // Samples (or group rounds) to collect: one smoke sample under
+        // instrumentation, the configured count otherwise
+        auto benchmarkSamplesToCollect() -> std::size_t {
+            auto config = getCurrentContext().getConfig();
+            return config->runningUnderInstrumentation() ? 1 : config->benchmarkSamples();
+        }
+
+        thread_local BenchmarkGroup* s_currentGroup = nullptr;
+
+        // Two-sided normal quantile for a confidence level: solves
+        // erf( z / sqrt(2) ) == confidence by Newton iteration. erf is
+        // smooth and monotonic, so a handful of steps from z = 1
+        // converge to full double precision for any sensible level
+        auto normalQuantile( double confidence ) -> double {
+            constexpr double pi = 3.14159265358979323846;
+            double z = 1.0;
+            for( int i = 0; i < 32; ++i ) {
+                double error = std::erf( z / std::sqrt( 2.0 ) ) - confidence;
+                double derivative = std::sqrt( 2.0 / pi ) * std::exp( -z * z / 2.0 );
+                double step = error / derivative;
+                z -= step;
+                if( std::abs( step ) < 1e-12 )
+                    break;
+            }
+            return z;
+        }
+    }
+
     auto BenchmarkLooper::getResolution() -> uint64_t {
-        return getEstimatedClockResolution() * getCurrentContext().getConfig()->benchmarkResolutionMultiple();
+        return benchmarkResolution();
+    }
+    auto BenchmarkLooper::getSamplesToCollect() -> std::size_t {
+        return benchmarkSamplesToCollect();
+    }
+    auto BenchmarkLooper::getWarmupNanoseconds() -> uint64_t {
+        if( getCurrentContext().getConfig()->runningUnderInstrumentation() )
+            return 0;
+        return static_cast<uint64_t>( getCurrentContext().getConfig()->benchmarkWarmupSeconds() * 1000000000.0 );
+    }
+    auto BenchmarkLooper::getMaxNanoseconds() -> uint64_t {
+        return static_cast<uint64_t>( getCurrentContext().getConfig()->benchmarkMaxSeconds() * 1000000000.0 );
     }
 
     void BenchmarkLooper::reportStart() {
         getResultCapture().benchmarkStarting( { m_name } );
+        if( getCurrentContext().getConfig()->benchmarkPerfCounters() )
+            m_perfCounters.open();
+        m_allocMetrics.open();
     }
-    auto BenchmarkLooper::needsMoreIterations() -> bool {
+    auto BenchmarkLooper::completeSample() -> bool {
+        // Pause the counters so the bookkeeping below is not attributed to
+        // the measured code
+        m_perfCounters.stop();
+        m_allocMetrics.stop();
         auto elapsed = m_timer.getElapsedNanoseconds();
 
         // Exponentially increasing iterations until we're confident in our timer resolution
         if( elapsed < m_resolution ) {
-            m_iterationsToRun *= 10;
+            m_iterationsPerSample *= 10;
+            m_perfCounters.start();
+            // Calibration iterations are not reported, so their heap
+            // traffic is discarded along with their timing
+            m_allocMetrics.open();
+            m_allocMetrics.start();
             return true;
         }
 
-        getResultCapture().benchmarkEnded( { { m_name }, m_count, elapsed } );
+        // Samples taken during --benchmark-warmup are timed but discarded
+        if( m_warmupElapsedNanoseconds < m_warmupNanoseconds ) {
+            m_warmupElapsedNanoseconds += elapsed;
+            m_count = 0;
+            m_timer.start();
+            m_perfCounters.start();
+            m_allocMetrics.open();
+            m_allocMetrics.start();
+            return true;
+        }
+
+        m_sampleMeans.push_back( static_cast<double>( elapsed ) / static_cast<double>( m_count ) );
+        m_totalIterations += m_count;
+        m_totalElapsedNanoseconds += elapsed;
+
+        // --benchmark-max-time stops collection early once the recorded
+        // samples have used up the per-benchmark budget
+        if( m_sampleMeans.size() < m_samplesToCollect
+                && ( m_maxNanoseconds == 0 || m_totalElapsedNanoseconds < m_maxNanoseconds ) ) {
+            m_count = 0;
+            m_timer.start();
+            m_perfCounters.start();
+            m_allocMetrics.start();
+            return true;
+        }
+
+        double mean = 0;
+        double low = m_sampleMeans[0];
+        double high = m_sampleMeans[0];
+        for( auto sampleMean : m_sampleMeans ) {
+            mean += sampleMean;
+            if( sampleMean < low ) low = sampleMean;
+            if( sampleMean > high ) high = sampleMean;
+        }
+        mean /= static_cast<double>( m_sampleMeans.size() );
+
+        double variance = 0;
+        for( auto sampleMean : m_sampleMeans )
+            variance += ( sampleMean - mean ) * ( sampleMean - mean );
+        variance /= static_cast<double>( m_sampleMeans.size() );
+
+        getResultCapture().benchmarkEnded( { { m_name },
+                                             m_totalIterations,
+                                             m_totalElapsedNanoseconds,
+                                             m_sampleMeans.size(),
+                                             mean,
+                                             std::sqrt( variance ),
+                                             low,
+                                             high,
+                                             m_perfCounters.read(),
+                                             m_allocMetrics.read(),
+                                             false, 0, 0, 0,
+                                             currentCpuState( m_affinity.pinnedCore() ) } );
+        return false;
+    }
+
+    BenchmarkGroup::BenchmarkGroup( StringRef name )
+    :   m_name( name ),
+        m_roundsToRun( benchmarkSamplesToCollect() )
+    {
+        s_currentGroup = this;
+    }
+    BenchmarkGroup::~BenchmarkGroup() {
+        s_currentGroup = nullptr;
+    }
+    auto BenchmarkGroup::current() -> BenchmarkGroup* {
+        return s_currentGroup;
+    }
+
+    auto BenchmarkGroup::acquireVariant( StringRef name ) -> BenchmarkVariantSamples& {
+        // Variants are matched up across rounds by encounter order, so the
+        // set of variants must not change once the first round has run
+        if( m_nextVariantIndex == m_variants.size() ) {
+            CATCH_ENFORCE( m_round == 0,
+                "Benchmark group '" << m_name << "' gained variant '" << name << "' after the first round" );
+            m_variants.push_back( BenchmarkVariantSamples() );
+            m_variants.back().name = static_cast<std::string>( name );
+        }
+        auto& variant = m_variants[m_nextVariantIndex];
+        CATCH_ENFORCE( variant.name == static_cast<std::string>( name ),
+            "Benchmark group '" << m_name << "' expected variant '" << variant.name << "' but saw '" << name << "'" );
+        ++m_nextVariantIndex;
+        return variant;
+    }
+
+    void BenchmarkGroup::reportVariants() {
+        if( m_variants.empty() || m_variants[0].sampleMeans.empty() )
+            return;
+
+        struct VariantStats {
+            double mean;
+            double stdDev;
+            double low;
+            double high;
+            double relativeError;
+        };
+        std::vector<VariantStats> stats;
+        stats.reserve( m_variants.size() );
+        for( auto const& variant : m_variants ) {
+            VariantStats vs{ 0, 0, variant.sampleMeans[0], variant.sampleMeans[0], 0 };
+            for( auto sampleMean : variant.sampleMeans ) {
+                vs.mean += sampleMean;
+                if( sampleMean < vs.low ) vs.low = sampleMean;
+                if( sampleMean > vs.high ) vs.high = sampleMean;
+            }
+            vs.mean /= static_cast<double>( variant.sampleMeans.size() );
+
+            double variance = 0;
+            for( auto sampleMean : variant.sampleMeans )
+                variance += ( sampleMean - vs.mean ) * ( sampleMean - vs.mean );
+            variance /= static_cast<double>( variant.sampleMeans.size() );
+            vs.stdDev = std::sqrt( variance );
+
+            // Relative standard error of the mean, for the ratio interval
+            vs.relativeError = vs.stdDev / ( vs.mean * std::sqrt( static_cast<double>( variant.sampleMeans.size() ) ) );
+            stats.push_back( vs );
+        }
+
+        auto& capture = getResultCapture();
+        auto const& baseline = stats[0];
+        double confidenceLevel = getCurrentContext().getConfig()->benchmarkConfidence();
+        double z = normalQuantile( confidenceLevel );
+        for( std::size_t i = 0; i < m_variants.size(); ++i ) {
+            auto const& variant = m_variants[i];
+            auto const& vs = stats[i];
+
+            capture.benchmarkStarting( { m_name + " / " + variant.name } );
+
+            BenchmarkStats report{};
+            report.info = { m_name + " / " + variant.name };
+            report.iterations = variant.iterationsPerSample * variant.sampleMeans.size();
+            report.elapsedTimeInNanoseconds = static_cast<uint64_t>( vs.mean * static_cast<double>( report.iterations ) );
+            report.samples = variant.sampleMeans.size();
+            report.meanNs = vs.mean;
+            report.standardDeviationNs = vs.stdDev;
+            report.lowNs = vs.low;
+            report.highNs = vs.high;
+            report.comparative = true;
+            report.ratioToBaseline = vs.mean / baseline.mean;
+            // First-order error propagation for the ratio of two means,
+            // scaled to the configured confidence level (z = 1.96 for
+            // the default 95%)
+            report.ratioConfidence = z * report.ratioToBaseline
+                * std::sqrt( vs.relativeError * vs.relativeError
+                           + baseline.relativeError * baseline.relativeError );
+            report.confidenceLevel = confidenceLevel;
+            report.cpuState = currentCpuState( m_affinity.pinnedCore() );
+            capture.benchmarkEnded( report );
+        }
+    }
+
+    namespace {
+        auto acquireVariantState( StringRef name ) -> BenchmarkVariantSamples& {
+            auto group = BenchmarkGroup::current();
+            CATCH_ENFORCE( group, "BENCHMARK_VARIANT( \"" << name << "\" ) must be used inside a BENCHMARK_GROUP" );
+            return group->acquireVariant( name );
+        }
+    }
+
+    BenchmarkVariantLooper::BenchmarkVariantLooper( StringRef name )
+    :   m_state( acquireVariantState( name ) ),
+        m_resolution( benchmarkResolution() )
+    {
+        m_timer.start();
+    }
+
+    auto BenchmarkVariantLooper::completeSample() -> bool {
+        auto elapsed = m_timer.getElapsedNanoseconds();
+
+        if( !m_state.calibrated ) {
+            // Same exponential growth as BenchmarkLooper; the count that
+            // first comfortably exceeds the clock resolution is kept for
+            // all rounds
+            if( elapsed < m_resolution ) {
+                m_state.iterationsPerSample *= 10;
+                return true;
+            }
+            m_state.calibrated = true;
+        }
+
+        m_state.sampleMeans.push_back( static_cast<double>( elapsed ) / static_cast<double>( m_count ) );
         return false;
     }
 
@@ -8,37 +8,96 @@
 #ifndef TWOBLUECUBES_CATCH_BENCHMARK_H_INCLUDED
 #define TWOBLUECUBES_CATCH_BENCHMARK_H_INCLUDED
 
+#include "catch_alloc_metrics.h"
+#include "catch_cpu_affinity.h"
+#include "catch_perf_counters.h"
 #include "catch_stringref.h"
 #include "catch_timer.h"
 
 #include <cstdint>
 #include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h> // _ReadWriteBarrier
+#endif
 
 namespace Catch {
 
+    // Optimisation barriers for benchmarked blocks. keep() forces the
+    // compiler to materialise a value as if it escaped, so computing it
+    // cannot be hollowed out of the measured loop; clobber() acts as if all
+    // of memory were read and written, forcing pending stores to happen.
+    // Neither emits any code of its own, unlike a volatile sink.
+#if defined(_MSC_VER)
+    namespace Detail {
+        void keepCharPointer( char const volatile* );
+    }
+    template<typename T>
+    inline void keep( T const& value ) {
+        Detail::keepCharPointer( &reinterpret_cast<char const volatile&>( value ) );
+        _ReadWriteBarrier();
+    }
+    inline void clobber() {
+        _ReadWriteBarrier();
+    }
+#else
+    template<typename T>
+    inline void keep( T const& value ) {
+        asm volatile( "" : : "r,m"( value ) : "memory" );
+    }
+    inline void clobber() {
+        asm volatile( "" : : : "memory" );
+    }
+#endif
+
+    // Runs the benchmarked block in a number of equally sized, separately
+    // timed samples. The iteration count per sample grows exponentially
+    // until one sample comfortably exceeds the estimated clock resolution;
+    // the remaining samples reuse that calibrated count so the reported
+    // mean and standard deviation are computed over comparable samples.
     class BenchmarkLooper {
 
         std::string m_name;
         std::size_t m_count = 0;
-        std::size_t m_iterationsToRun = 1;
+        std::size_t m_iterationsPerSample = 1;
+        std::size_t m_samplesToCollect;
         uint64_t m_resolution;
-        Timer m_timer;
+
+        std::vector<double> m_sampleMeans;
+        std::size_t m_totalIterations = 0;
+        uint64_t m_totalElapsedNanoseconds = 0;
+        uint64_t m_warmupNanoseconds;
+        uint64_t m_warmupElapsedNanoseconds = 0;
+        uint64_t m_maxNanoseconds;
+        TickTimer m_timer;
+        PerfCounterSampler m_perfCounters;
+        AllocMetricsSampler m_allocMetrics;
+        CpuAffinityGuard m_affinity;
 
         static auto getResolution() -> uint64_t;
+        static auto getSamplesToCollect() -> std::size_t;
+        static auto getWarmupNanoseconds() -> uint64_t;
+        static auto getMaxNanoseconds() -> uint64_t;
     public:
         // Keep most of this inline as it's on the code path that is being timed
         BenchmarkLooper( StringRef name )
         :   m_name( name ),
-            m_resolution( getResolution() )
+            m_samplesToCollect( getSamplesToCollect() ),
+            m_resolution( getResolution() ),
+            m_warmupNanoseconds( getWarmupNanoseconds() ),
+            m_maxNanoseconds( getMaxNanoseconds() )
         {
             reportStart();
             m_timer.start();
+            m_perfCounters.start();
+            m_allocMetrics.start();
         }
 
         explicit operator bool() {
-            if( m_count < m_iterationsToRun )
+            if( m_count < m_iterationsPerSample )
                 return true;
-            return needsMoreIterations();
+            return completeSample();
         }
 
         void increment() {
@@ -46,7 +105,80 @@ namespace Catch {
         }
 
         void reportStart();
-        auto needsMoreIterations() -> bool;
+        auto completeSample() -> bool;
+    };
+
+    // One variant's accumulated samples within a BenchmarkGroup
+    struct BenchmarkVariantSamples {
+        std::string name;
+        std::size_t iterationsPerSample = 1;
+        bool calibrated = false;
+        std::vector<double> sampleMeans;
+    };
+
+    // Runs several named variants interleaved: each round takes one timed
+    // sample from every variant in turn, so slow drift in the machine's
+    // performance (thermal throttling, frequency scaling, noisy neighbours)
+    // hits all variants roughly equally instead of biasing whichever ran
+    // last. Once the rounds are done each variant is reported through the
+    // usual benchmark events, together with its mean normalised to the
+    // group's first variant.
+    class BenchmarkGroup {
+        std::string m_name;
+        std::size_t m_roundsToRun;
+        std::size_t m_round = 0;
+        std::size_t m_nextVariantIndex = 0;
+        std::vector<BenchmarkVariantSamples> m_variants;
+        // Pins the whole group, so every variant's rounds run on the
+        // same core
+        CpuAffinityGuard m_affinity;
+
+        void reportVariants();
+    public:
+        BenchmarkGroup( StringRef name );
+        BenchmarkGroup( BenchmarkGroup const& ) = delete;
+        BenchmarkGroup& operator = ( BenchmarkGroup const& ) = delete;
+        ~BenchmarkGroup();
+
+        explicit operator bool() {
+            if( m_round < m_roundsToRun )
+                return true;
+            reportVariants();
+            return false;
+        }
+
+        void nextRound() {
+            ++m_round;
+            m_nextVariantIndex = 0;
+        }
+
+        auto acquireVariant( StringRef name ) -> BenchmarkVariantSamples&;
+
+        static auto current() -> BenchmarkGroup*;
+    };
+
+    // Takes one timed sample of its block per group round. The iteration
+    // count is calibrated on the first round, exactly as BenchmarkLooper
+    // does, and reused by the rest so the samples are comparable.
+    class BenchmarkVariantLooper {
+        BenchmarkVariantSamples& m_state;
+        std::size_t m_count = 0;
+        uint64_t m_resolution;
+        TickTimer m_timer;
+
+        auto completeSample() -> bool;
+    public:
+        BenchmarkVariantLooper( StringRef name );
+
+        explicit operator bool() {
+            if( m_count < m_state.iterationsPerSample )
+                return true;
+            return completeSample();
+        }
+
+        void increment() {
+            ++m_count;
+        }
     };
 
 } // end namespace Catch
@@ -54,4 +186,9 @@ namespace Catch {
 #define BENCHMARK( name ) \
     for( Catch::BenchmarkLooper looper( name ); looper; looper.increment() )
 
+#define BENCHMARK_GROUP( name ) \
+    for( Catch::BenchmarkGroup benchmarkGroup( name ); benchmarkGroup; benchmarkGroup.nextRound() )
+#define BENCHMARK_VARIANT( name ) \
+    for( Catch::BenchmarkVariantLooper looper( name ); looper; looper.increment() )
+
 #endif // TWOBLUECUBES_CATCH_BENCHMARK_H_INCLUDED
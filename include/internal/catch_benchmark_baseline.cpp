@@ -0,0 +1,32 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_benchmark_baseline.h"
+
+#include <cstdlib>
+#include <fstream>
+
+namespace Catch {
+
+    BenchmarkBaselines loadBenchmarkBaselines( std::string const& baselineFile ) {
+        BenchmarkBaselines baselines;
+        std::ifstream f( baselineFile.c_str() );
+        std::string line;
+        while( std::getline( f, line ) ) {
+            auto tab = line.find( '\t' );
+            if( tab == std::string::npos )
+                continue;
+            baselines[line.substr( tab + 1 )] = std::strtod( line.c_str(), nullptr );
+        }
+        return baselines;
+    }
+
+    void saveBenchmarkBaselines( std::string const& baselineFile, BenchmarkBaselines const& baselines ) {
+        std::ofstream f( baselineFile.c_str() );
+        for( auto const& baseline : baselines )
+            f << baseline.second << '\t' << baseline.first << '\n';
+    }
+
+} // end namespace Catch
@@ -0,0 +1,26 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_BENCHMARK_BASELINE_H_INCLUDED
+#define TWOBLUECUBES_CATCH_BENCHMARK_BASELINE_H_INCLUDED
+
+#include <map>
+#include <string>
+
+namespace Catch {
+
+    // Maps benchmark names to their recorded mean runtime, in nanoseconds
+    // per iteration
+    using BenchmarkBaselines = std::map<std::string, double>;
+
+    // Reads a baseline file previously written by saveBenchmarkBaselines.
+    // Returns an empty map if the file does not exist or cannot be read.
+    BenchmarkBaselines loadBenchmarkBaselines( std::string const& baselineFile );
+
+    // Persists the baselines, one "<mean ns>\t<benchmark name>" pair per line
+    void saveBenchmarkBaselines( std::string const& baselineFile, BenchmarkBaselines const& baselines );
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_BENCHMARK_BASELINE_H_INCLUDED
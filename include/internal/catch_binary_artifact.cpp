@@ -0,0 +1,12 @@
+ /*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_binary_artifact.h"
+
+namespace Catch {
+
+    IBinaryOperandSink::~IBinaryOperandSink() = default;
+
+} // end namespace Catch
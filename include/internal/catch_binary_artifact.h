@@ -0,0 +1,80 @@
+ /*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_BINARY_ARTIFACT_H_INCLUDED
+#define TWOBLUECUBES_CATCH_BINARY_ARTIFACT_H_INCLUDED
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace Catch {
+
+    // Receives one operand's raw bytes during an artifact dump; the
+    // runner implements this over the sidecar files (--artifact-dir)
+    struct IBinaryOperandSink {
+        virtual ~IBinaryOperandSink();
+        // Starts the artifact for the named operand ("lhs" or "rhs");
+        // subsequent writeBytes calls append to it
+        virtual void beginOperand( char const* name ) = 0;
+        virtual void writeBytes( void const* data, std::size_t size ) = 0;
+    };
+
+    // StringMaker's binary-serialisation parallel. Where StringMaker
+    // formats a value for a human, BinaryMaker writes its raw bytes for a
+    // machine: with --artifact-dir, the operands of a failing comparison
+    // are dumped through this trait instead of being stringified at all,
+    // so a large numeric payload costs a write() rather than megabytes of
+    // formatting, and stays bit-exact for offline analysis. Specialise it
+    // (with supported = true) for your own contiguous types; arithmetic
+    // scalars and vectors of them are covered out of the box.
+    template<typename T, typename Enable = void>
+    struct BinaryMaker {
+        static const bool supported = false;
+        // Templated so an undecayed argument (e.g. a string literal's
+        // array type) still binds; never called for unsupported types
+        template<typename U>
+        static void write( U const&, IBinaryOperandSink& ) {}
+    };
+
+    template<typename T>
+    struct BinaryMaker<T, typename std::enable_if<std::is_arithmetic<T>::value>::type> {
+        static const bool supported = true;
+        static void write( T const& value, IBinaryOperandSink& sink ) {
+            sink.writeBytes( &value, sizeof( T ) );
+        }
+    };
+
+    template<typename T, typename Allocator>
+    struct BinaryMaker<std::vector<T, Allocator>, typename std::enable_if<std::is_arithmetic<T>::value>::type> {
+        static const bool supported = true;
+        static void write( std::vector<T, Allocator> const& value, IBinaryOperandSink& sink ) {
+            if( !value.empty() )
+                sink.writeBytes( value.data(), value.size() * sizeof( T ) );
+        }
+    };
+
+    namespace Detail {
+
+        // Dumps both operands of a BinaryExpr, or neither: a lone side
+        // would not be enough to reproduce the comparison offline.
+        // Returns false when either type has no BinaryMaker.
+        template<typename LhsT, typename RhsT>
+        bool writeBinaryOperandPair( LhsT const& lhs, RhsT const& rhs, IBinaryOperandSink& sink ) {
+            using Lhs = typename std::decay<LhsT>::type;
+            using Rhs = typename std::decay<RhsT>::type;
+            if( !BinaryMaker<Lhs>::supported || !BinaryMaker<Rhs>::supported )
+                return false;
+            sink.beginOperand( "lhs" );
+            BinaryMaker<Lhs>::write( lhs, sink );
+            sink.beginOperand( "rhs" );
+            BinaryMaker<Rhs>::write( rhs, sink );
+            return true;
+        }
+
+    } // namespace Detail
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_BINARY_ARTIFACT_H_INCLUDED
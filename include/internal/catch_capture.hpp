@@ -8,6 +8,8 @@
 #ifndef TWOBLUECUBES_CATCH_CAPTURE_HPP_INCLUDED
 #define TWOBLUECUBES_CATCH_CAPTURE_HPP_INCLUDED
 
+#include "catch_alloc_metrics.h"
+#include "catch_eventually.h"
 #include "catch_assertionhandler.h"
 #include "catch_interfaces_capture.h"
 #include "catch_message.h"
@@ -41,7 +43,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 #define INTERNAL_CATCH_TEST( macroName, resultDisposition, ... ) \
     do { \
-        Catch::AssertionHandler catchAssertionHandler( macroName##_catch_sr, CATCH_INTERNAL_LINEINFO, CATCH_INTERNAL_STRINGIFY(__VA_ARGS__), resultDisposition ); \
+        INTERNAL_CATCH_ASSERTION_INFO( macroName, CATCH_INTERNAL_STRINGIFY(__VA_ARGS__) ""_catch_sr, resultDisposition ) \
+        Catch::AssertionHandler catchAssertionHandler( catch_internal_assertionInfo ); \
         INTERNAL_CATCH_TRY { \
             CATCH_INTERNAL_SUPPRESS_PARENTHESES_WARNINGS \
             catchAssertionHandler.handleExpr( Catch::Decomposer() <= __VA_ARGS__ ); \
@@ -64,7 +67,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 #define INTERNAL_CATCH_NO_THROW( macroName, resultDisposition, ... ) \
     do { \
-        Catch::AssertionHandler catchAssertionHandler( macroName##_catch_sr, CATCH_INTERNAL_LINEINFO, CATCH_INTERNAL_STRINGIFY(__VA_ARGS__), resultDisposition ); \
+        INTERNAL_CATCH_ASSERTION_INFO( macroName, CATCH_INTERNAL_STRINGIFY(__VA_ARGS__) ""_catch_sr, resultDisposition ) \
+        Catch::AssertionHandler catchAssertionHandler( catch_internal_assertionInfo ); \
         try { \
             static_cast<void>(__VA_ARGS__); \
             catchAssertionHandler.handleExceptionNotThrownAsExpected(); \
@@ -78,7 +82,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 #define INTERNAL_CATCH_THROWS( macroName, resultDisposition, ... ) \
     do { \
-        Catch::AssertionHandler catchAssertionHandler( macroName##_catch_sr, CATCH_INTERNAL_LINEINFO, CATCH_INTERNAL_STRINGIFY(__VA_ARGS__), resultDisposition); \
+        INTERNAL_CATCH_ASSERTION_INFO( macroName, CATCH_INTERNAL_STRINGIFY(__VA_ARGS__) ""_catch_sr, resultDisposition ) \
+        Catch::AssertionHandler catchAssertionHandler( catch_internal_assertionInfo ); \
         if( catchAssertionHandler.allowThrows() ) \
             try { \
                 static_cast<void>(__VA_ARGS__); \
@@ -95,7 +100,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 #define INTERNAL_CATCH_THROWS_AS( macroName, exceptionType, resultDisposition, expr ) \
     do { \
-        Catch::AssertionHandler catchAssertionHandler( macroName##_catch_sr, CATCH_INTERNAL_LINEINFO, CATCH_INTERNAL_STRINGIFY(expr) ", " CATCH_INTERNAL_STRINGIFY(exceptionType), resultDisposition ); \
+        INTERNAL_CATCH_ASSERTION_INFO( macroName, CATCH_INTERNAL_STRINGIFY(expr) ", " CATCH_INTERNAL_STRINGIFY(exceptionType) ""_catch_sr, resultDisposition ) \
+        Catch::AssertionHandler catchAssertionHandler( catch_internal_assertionInfo ); \
         if( catchAssertionHandler.allowThrows() ) \
             try { \
                 static_cast<void>(expr); \
@@ -116,16 +122,32 @@
 ///////////////////////////////////////////////////////////////////////////////
 #define INTERNAL_CATCH_MSG( macroName, messageType, resultDisposition, ... ) \
     do { \
-        Catch::AssertionHandler catchAssertionHandler( macroName##_catch_sr, CATCH_INTERNAL_LINEINFO, Catch::StringRef(), resultDisposition ); \
+        INTERNAL_CATCH_ASSERTION_INFO( macroName, Catch::StringRef(), resultDisposition ) \
+        Catch::AssertionHandler catchAssertionHandler( catch_internal_assertionInfo ); \
         catchAssertionHandler.handleMessage( messageType, ( Catch::MessageStream() << __VA_ARGS__ + ::Catch::StreamEndStop() ).m_stream.str() ); \
         INTERNAL_CATCH_REACT( catchAssertionHandler ) \
     } while( false )
 
+///////////////////////////////////////////////////////////////////////////////
+// Arms a duration budget for the enclosing section; the runner checks the
+// section's measured duration (minus calibrated framework overhead) against
+// it at section end and reports the verdict as a CHECK-style assertion
+#define INTERNAL_CATCH_SECTION_BUDGET( macroName, ms ) \
+    do { \
+        INTERNAL_CATCH_ASSERTION_INFO( macroName, CATCH_INTERNAL_STRINGIFY(ms) ""_catch_sr, Catch::ResultDisposition::ContinueOnFailure ) \
+        Catch::getResultCapture().setSectionBudget( static_cast<double>( ms ) / 1000.0, catch_internal_assertionInfo ); \
+    } while( false )
+
 ///////////////////////////////////////////////////////////////////////////////
 #define INTERNAL_CATCH_CAPTURE( varName, macroName, ... ) \
     auto varName = Catch::Capturer( macroName, CATCH_INTERNAL_LINEINFO, Catch::ResultWas::Info, #__VA_ARGS__ ); \
     varName.captureValues( 0, __VA_ARGS__ )
 
+///////////////////////////////////////////////////////////////////////////////
+// Stores the value instead of stringifying it up front; see DeferredCapture
+#define INTERNAL_CATCH_CAPTURE_DEFERRED( varName, macroName, ... ) \
+    Catch::DeferredCapture<typename std::decay<decltype(__VA_ARGS__)>::type> varName( macroName, CATCH_INTERNAL_LINEINFO, #__VA_ARGS__, __VA_ARGS__ )
+
 ///////////////////////////////////////////////////////////////////////////////
 #define INTERNAL_CATCH_INFO( macroName, log ) \
     Catch::ScopedMessage INTERNAL_CATCH_UNIQUE_NAME( scopedMessage )( Catch::MessageBuilder( macroName##_catch_sr, CATCH_INTERNAL_LINEINFO, Catch::ResultWas::Info ) << log );
@@ -134,7 +156,8 @@
 // Although this is matcher-based, it can be used with just a string
 #define INTERNAL_CATCH_THROWS_STR_MATCHES( macroName, resultDisposition, matcher, ... ) \
     do { \
-        Catch::AssertionHandler catchAssertionHandler( macroName##_catch_sr, CATCH_INTERNAL_LINEINFO, CATCH_INTERNAL_STRINGIFY(__VA_ARGS__) ", " CATCH_INTERNAL_STRINGIFY(matcher), resultDisposition ); \
+        INTERNAL_CATCH_ASSERTION_INFO( macroName, CATCH_INTERNAL_STRINGIFY(__VA_ARGS__) ", " CATCH_INTERNAL_STRINGIFY(matcher) ""_catch_sr, resultDisposition ) \
+        Catch::AssertionHandler catchAssertionHandler( catch_internal_assertionInfo ); \
         if( catchAssertionHandler.allowThrows() ) \
             try { \
                 static_cast<void>(__VA_ARGS__); \
@@ -148,6 +171,44 @@
         INTERNAL_CATCH_REACT( catchAssertionHandler ) \
     } while( false )
 
+///////////////////////////////////////////////////////////////////////////////
+// Evaluates the expression with allocation counting forced on, then asserts
+// the count against the budget. Fails outright without CATCH_CONFIG_ALLOC_METRICS
+// rather than silently passing an unenforceable budget.
+#define INTERNAL_CATCH_MAX_ALLOCATIONS( macroName, resultDisposition, expr, budget ) \
+    do { \
+        INTERNAL_CATCH_ASSERTION_INFO( macroName, CATCH_INTERNAL_STRINGIFY(expr) ", " CATCH_INTERNAL_STRINGIFY(budget) ""_catch_sr, resultDisposition ) \
+        Catch::AssertionHandler catchAssertionHandler( catch_internal_assertionInfo ); \
+        INTERNAL_CATCH_TRY { \
+            uint64_t catchObservedAllocations; \
+            { \
+                Catch::AllocationCounter catchAllocationCounter; \
+                static_cast<void>( expr ); \
+                catchObservedAllocations = catchAllocationCounter.count(); \
+            } \
+            Catch::handleAllocationBudgetExpr( catchAssertionHandler, catchObservedAllocations, budget ); \
+        } INTERNAL_CATCH_CATCH( catchAssertionHandler ) \
+        INTERNAL_CATCH_REACT( catchAssertionHandler ) \
+    } while( false )
+
+///////////////////////////////////////////////////////////////////////////////
+// The condition is re-evaluated with exponential backoff (see
+// EventuallyPoller) and checked once more after the final wait, so a
+// condition that comes true just as the budget expires still passes
+#define INTERNAL_CATCH_EVENTUALLY( macroName, resultDisposition, expr, timeout ) \
+    do { \
+        INTERNAL_CATCH_ASSERTION_INFO( macroName, CATCH_INTERNAL_STRINGIFY(expr) ", " CATCH_INTERNAL_STRINGIFY(timeout) ""_catch_sr, resultDisposition ) \
+        Catch::AssertionHandler catchAssertionHandler( catch_internal_assertionInfo ); \
+        INTERNAL_CATCH_TRY { \
+            Catch::EventuallyPoller catchEventuallyPoller( timeout ); \
+            bool catchConditionHeld; \
+            while( !( catchConditionHeld = static_cast<bool>( expr ) ) && catchEventuallyPoller.wait() ) \
+                ; \
+            Catch::handleEventuallyExpr( catchAssertionHandler, catchConditionHeld, catchEventuallyPoller.elapsedSeconds(), timeout ); \
+        } INTERNAL_CATCH_CATCH( catchAssertionHandler ) \
+        INTERNAL_CATCH_REACT( catchAssertionHandler ) \
+    } while( false )
+
 #endif // CATCH_CONFIG_DISABLE
 
 #endif // TWOBLUECUBES_CATCH_CAPTURE_HPP_INCLUDED
@@ -12,10 +12,14 @@
 #include "catch_matchers.h"
 #include "catch_matchers_floating.h"
 #include "catch_matchers_generic.hpp"
+#include "catch_matchers_golden.h"
 #include "catch_matchers_string.h"
 #include "catch_matchers_vector.h"
 #include "catch_stringref.h"
 
+#include <type_traits>
+#include <utility>
+
 namespace Catch {
 
     template<typename ArgT, typename MatcherT>
@@ -24,10 +28,18 @@ namespace Catch {
         MatcherT m_matcher;
         StringRef m_matcherString;
     public:
-        MatchExpr( ArgT const& arg, MatcherT const& matcher, StringRef const& matcherString )
+        // The matcher is typically a temporary built inside the assertion
+        // macro; it is moved in rather than copied, so matchers owning
+        // state (strings, vectors) cost no extra allocation per
+        // assertion. The match itself runs first, in the base initialiser,
+        // before the move can disturb the operand. Description assembly
+        // stays in streamReconstructedExpression, which only runs when a
+        // result is actually shown.
+        template<typename M>
+        MatchExpr( ArgT const& arg, M&& matcher, StringRef const& matcherString )
         :   ITransientExpression{ true, matcher.match( arg ) },
             m_arg( arg ),
-            m_matcher( matcher ),
+            m_matcher( std::forward<M>( matcher ) ),
             m_matcherString( matcherString )
         {}
 
@@ -46,8 +58,10 @@ namespace Catch {
     void handleExceptionMatchExpr( AssertionHandler& handler, StringMatcher const& matcher, StringRef const& matcherString  );
 
     template<typename ArgT, typename MatcherT>
-    auto makeMatchExpr( ArgT const& arg, MatcherT const& matcher, StringRef const& matcherString  ) -> MatchExpr<ArgT, MatcherT> {
-        return MatchExpr<ArgT, MatcherT>( arg, matcher, matcherString );
+    auto makeMatchExpr( ArgT const& arg, MatcherT&& matcher, StringRef const& matcherString )
+    -> MatchExpr<ArgT, typename std::remove_const<typename std::remove_reference<MatcherT>::type>::type> {
+        return MatchExpr<ArgT, typename std::remove_const<typename std::remove_reference<MatcherT>::type>::type>(
+                arg, std::forward<MatcherT>( matcher ), matcherString );
     }
 
 } // namespace Catch
@@ -56,7 +70,8 @@ namespace Catch {
 ///////////////////////////////////////////////////////////////////////////////
 #define INTERNAL_CHECK_THAT( macroName, matcher, resultDisposition, arg ) \
     do { \
-        Catch::AssertionHandler catchAssertionHandler( macroName##_catch_sr, CATCH_INTERNAL_LINEINFO, CATCH_INTERNAL_STRINGIFY(arg) ", " CATCH_INTERNAL_STRINGIFY(matcher), resultDisposition ); \
+        INTERNAL_CATCH_ASSERTION_INFO( macroName, CATCH_INTERNAL_STRINGIFY(arg) ", " CATCH_INTERNAL_STRINGIFY(matcher) ""_catch_sr, resultDisposition ) \
+        Catch::AssertionHandler catchAssertionHandler( catch_internal_assertionInfo ); \
         INTERNAL_CATCH_TRY { \
             catchAssertionHandler.handleExpr( Catch::makeMatchExpr( arg, matcher, #matcher##_catch_sr ) ); \
         } INTERNAL_CATCH_CATCH( catchAssertionHandler ) \
@@ -67,7 +82,8 @@ namespace Catch {
 ///////////////////////////////////////////////////////////////////////////////
 #define INTERNAL_CATCH_THROWS_MATCHES( macroName, exceptionType, resultDisposition, matcher, ... ) \
     do { \
-        Catch::AssertionHandler catchAssertionHandler( macroName##_catch_sr, CATCH_INTERNAL_LINEINFO, CATCH_INTERNAL_STRINGIFY(__VA_ARGS__) ", " CATCH_INTERNAL_STRINGIFY(exceptionType) ", " CATCH_INTERNAL_STRINGIFY(matcher), resultDisposition ); \
+        INTERNAL_CATCH_ASSERTION_INFO( macroName, CATCH_INTERNAL_STRINGIFY(__VA_ARGS__) ", " CATCH_INTERNAL_STRINGIFY(exceptionType) ", " CATCH_INTERNAL_STRINGIFY(matcher) ""_catch_sr, resultDisposition ) \
+        Catch::AssertionHandler catchAssertionHandler( catch_internal_assertionInfo ); \
         if( catchAssertionHandler.allowThrows() ) \
             try { \
                 static_cast<void>(__VA_ARGS__ ); \
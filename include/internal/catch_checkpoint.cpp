@@ -0,0 +1,109 @@
+ /*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_checkpoint.h"
+#include "catch_platform.h"
+
+#include <cstring>
+#include <ostream>
+
+#if defined(CATCH_PLATFORM_WINDOWS)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace Catch {
+namespace {
+
+    // Power of two, so the ring index is a mask rather than a modulo on
+    // the hot path
+    constexpr std::size_t ringSize = 16;
+
+    struct CheckpointEntry {
+        char const* file;
+        std::size_t line;
+        std::int64_t value;
+    };
+
+    // Thread-local so that CHECKPOINT never synchronises: each --jobs
+    // worker (or test-spawned thread) leaves its own trail, and a fatal
+    // signal dumps the trail of the thread it arrived on
+    thread_local CheckpointEntry s_entries[ringSize];
+    thread_local std::size_t s_count = 0;
+
+    void writeRaw( char const* data, std::size_t count ) {
+#if defined(CATCH_PLATFORM_WINDOWS)
+        _write( 2, data, static_cast<unsigned int>( count ) );
+#else
+        static_cast<void>( write( 2, data, count ) );
+#endif
+    }
+    void writeRaw( char const* text ) {
+        writeRaw( text, std::strlen( text ) );
+    }
+    void writeRawNumber( std::int64_t value ) {
+        char digits[24];
+        std::size_t i = sizeof(digits);
+        bool negative = value < 0;
+        // Negate digit by digit, so INT64_MIN does not overflow
+        do {
+            auto digit = value % 10;
+            digits[--i] = static_cast<char>( '0' + ( digit < 0 ? -digit : digit ) );
+            value /= 10;
+        } while( value );
+        if( negative )
+            digits[--i] = '-';
+        writeRaw( digits + i, sizeof(digits) - i );
+    }
+
+} // end anonymous namespace
+
+    void noteCheckpoint( SourceLineInfo const& lineInfo, std::int64_t value ) noexcept {
+        auto& entry = s_entries[s_count & ( ringSize - 1 )];
+        entry.file = lineInfo.file;
+        entry.line = lineInfo.line;
+        entry.value = value;
+        ++s_count;
+    }
+
+    bool haveCheckpoints() noexcept {
+        return s_count > 0;
+    }
+
+    void clearCheckpoints() noexcept {
+        s_count = 0;
+    }
+
+    void writeCheckpoints( std::ostream& os ) {
+        auto first = s_count > ringSize ? s_count - ringSize : 0;
+        os << "Recent checkpoints, oldest first";
+        if( first > 0 )
+            os << " (" << first << " older overwritten)";
+        os << ":\n";
+        for( auto i = first; i < s_count; ++i ) {
+            auto const& entry = s_entries[i & ( ringSize - 1 )];
+            os << "  " << entry.file << ':' << entry.line << ": " << entry.value << '\n';
+        }
+    }
+
+    void writeCheckpointsRaw() {
+        if( s_count == 0 )
+            return;
+        auto first = s_count > ringSize ? s_count - ringSize : 0;
+        writeRaw( "  recent checkpoints, oldest first:\n" );
+        for( auto i = first; i < s_count; ++i ) {
+            auto const& entry = s_entries[i & ( ringSize - 1 )];
+            writeRaw( "    " );
+            writeRaw( entry.file );
+            writeRaw( ":" );
+            writeRawNumber( static_cast<std::int64_t>( entry.line ) );
+            writeRaw( ": " );
+            writeRawNumber( entry.value );
+            writeRaw( "\n" );
+        }
+    }
+
+} // end namespace Catch
@@ -0,0 +1,43 @@
+ /*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_CHECKPOINT_H_INCLUDED
+#define TWOBLUECUBES_CATCH_CHECKPOINT_H_INCLUDED
+
+#include "catch_common.h"
+
+#include <cstdint>
+#include <iosfwd>
+
+namespace Catch {
+
+    // Breadcrumbs cheap enough for hot loops. INFO/CAPTURE build a string
+    // per evaluation, which is too expensive to leave in code that runs
+    // millions of times; CHECKPOINT stores just the call site and one
+    // scalar into a fixed per-thread ring - three word-sized stores, no
+    // locks, no allocation - so it can stay in permanently. The ring is
+    // attached as a message when an assertion fails, and written with
+    // nothing but write(2) when a fatal signal arrives, so a crash deep
+    // in a loop reports where the loop had got to.
+    void noteCheckpoint( SourceLineInfo const& lineInfo, std::int64_t value ) noexcept;
+
+    // True when the current thread has recorded any checkpoints since the
+    // last clear
+    bool haveCheckpoints() noexcept;
+    void clearCheckpoints() noexcept;
+
+    // Formats the current thread's breadcrumbs, oldest surviving entry
+    // first, noting how many older ones the ring has overwritten
+    void writeCheckpoints( std::ostream& os );
+
+    // As writeCheckpoints, but to stderr using only async-signal-safe
+    // calls - for the fatal signal handler
+    void writeCheckpointsRaw();
+
+} // end namespace Catch
+
+#define INTERNAL_CATCH_CHECKPOINT( value ) \
+    Catch::noteCheckpoint( CATCH_INTERNAL_LINEINFO, static_cast<std::int64_t>( value ) )
+
+#endif // TWOBLUECUBES_CATCH_CHECKPOINT_H_INCLUDED
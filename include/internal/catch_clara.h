@@ -16,6 +16,13 @@
 #endif
 #define CATCH_CLARA_TEXTFLOW_CONFIG_CONSOLE_WIDTH CATCH_CONFIG_CONSOLE_WIDTH-1
 
+// With the minimal parser selected only Clara's TextFlow half is needed
+// (the reporters wrap output through it); the combinator parser - the
+// expensive part to compile - is left out entirely
+#if defined(CATCH_CONFIG_MINIMAL_CLI) && !defined(CATCH_CLARA_TEXTFLOW_ONLY)
+#define CATCH_CLARA_TEXTFLOW_ONLY
+#endif
+
 #ifdef __clang__
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wweak-vtables"
@@ -10,11 +10,15 @@
 
 #include "catch_string_manip.h"
 
-#include <fstream>
+#include <cstdlib>
 #include <ctime>
+#include <fstream>
+#include <ostream>
 
 namespace Catch {
 
+#if !defined(CATCH_CONFIG_MINIMAL_CLI)
+
     clara::Parser makeCommandLineParser( ConfigData& config ) {
 
         using namespace clara;
@@ -58,6 +62,10 @@ namespace Catch {
                     config.runOrder = RunTests::InLexicographicalOrder;
                 else if( startsWith( "random", order ) )
                     config.runOrder = RunTests::InRandomOrder;
+                else if( startsWith( "duration-balanced", order ) )
+                    config.runOrder = RunTests::InDurationBalancedOrder;
+                else if( startsWith( "source-locality", order ) )
+                    config.runOrder = RunTests::InSourceLocalityOrder;
                 else
                     return clara::ParserResult::runtimeError( "Unrecognised ordering: '" + order + "'" );
                 return ParserResult::ok( ParseResultType::Matched );
@@ -81,6 +89,19 @@ namespace Catch {
                         return ParserResult::runtimeError( "colour mode must be one of: auto, yes or no. '" + useColour + "' not recognised" );
                 return ParserResult::ok( ParseResultType::Matched );
             };
+        auto const setFlushPolicy = [&]( std::string const& policy ) {
+                    auto policyLc = toLower( policy );
+
+                    if( policyLc == "auto" )
+                        config.flushPolicy = FlushPolicy::Auto;
+                    else if( policyLc == "immediate" )
+                        config.flushPolicy = FlushPolicy::Immediate;
+                    else if( policyLc == "testcase" )
+                        config.flushPolicy = FlushPolicy::TestCaseEnd;
+                    else
+                        return ParserResult::runtimeError( "flush policy must be one of: auto, immediate or testcase. '" + policy + "' not recognised" );
+                return ParserResult::ok( ParseResultType::Matched );
+            };
         auto const setWaitForKeypress = [&]( std::string const& keypress ) {
                 auto keypressLc = toLower( keypress );
                 if( keypressLc == "start" )
@@ -93,6 +114,78 @@ namespace Catch {
                     return ParserResult::runtimeError( "keypress argument must be one of: start, exit or both. '" + keypress + "' not recognised" );
             return ParserResult::ok( ParseResultType::Matched );
             };
+        auto const setShardCount = [&]( int shardCount ) {
+                if( shardCount < 1 )
+                    return clara::ParserResult::runtimeError( "The shard count must be greater than 0" );
+                config.shardCount = static_cast<unsigned int>( shardCount );
+                return ParserResult::ok( ParseResultType::Matched );
+            };
+        auto const setShardIndex = [&]( int shardIndex ) {
+                if( shardIndex < 0 )
+                    return clara::ParserResult::runtimeError( "The shard index must not be negative" );
+                config.shardIndex = static_cast<unsigned int>( shardIndex );
+                return ParserResult::ok( ParseResultType::Matched );
+            };
+        auto const setJobs = [&]( int jobs ) {
+                if( jobs < 1 )
+                    return clara::ParserResult::runtimeError( "Number of jobs must be at least 1" );
+                config.jobs = static_cast<unsigned int>( jobs );
+                return ParserResult::ok( ParseResultType::Matched );
+            };
+        auto const setTimeout = [&]( double seconds ) {
+                if( seconds < 0 )
+                    return clara::ParserResult::runtimeError( "The timeout must not be negative" );
+                config.timeout = seconds;
+                return ParserResult::ok( ParseResultType::Matched );
+            };
+        auto const setMaxDuration = [&]( double seconds ) {
+                if( seconds < 0 )
+                    return clara::ParserResult::runtimeError( "The wall-clock budget must not be negative" );
+                config.maxDuration = seconds;
+                return ParserResult::ok( ParseResultType::Matched );
+            };
+        auto const setDiffDurationThreshold = [&]( double seconds ) {
+                if( seconds < 0 )
+                    return clara::ParserResult::runtimeError( "The duration threshold must not be negative" );
+                config.diffDurationThreshold = seconds;
+                return ParserResult::ok( ParseResultType::Matched );
+            };
+        auto const setBenchmarkSamples = [&]( int samples ) {
+                if( samples < 1 )
+                    return clara::ParserResult::runtimeError( "Number of benchmark samples must be at least 1" );
+                config.benchmarkSamples = static_cast<unsigned int>( samples );
+                return ParserResult::ok( ParseResultType::Matched );
+            };
+        auto const setBenchmarkTolerance = [&]( double tolerance ) {
+                if( tolerance < 0 )
+                    return clara::ParserResult::runtimeError( "The benchmark tolerance must not be negative" );
+                config.benchmarkTolerance = tolerance;
+                return ParserResult::ok( ParseResultType::Matched );
+            };
+        auto const setBenchmarkWarmup = [&]( double seconds ) {
+                if( seconds < 0 )
+                    return clara::ParserResult::runtimeError( "The benchmark warmup time must not be negative" );
+                config.benchmarkWarmupSeconds = seconds;
+                return ParserResult::ok( ParseResultType::Matched );
+            };
+        auto const setBenchmarkConfidence = [&]( double confidence ) {
+                if( confidence <= 0 || confidence >= 1 )
+                    return clara::ParserResult::runtimeError( "The benchmark confidence level must be between 0 and 1, exclusive" );
+                config.benchmarkConfidence = confidence;
+                return ParserResult::ok( ParseResultType::Matched );
+            };
+        auto const setBenchmarkMaxTime = [&]( double seconds ) {
+                if( seconds < 0 )
+                    return clara::ParserResult::runtimeError( "The benchmark time cap must not be negative" );
+                config.benchmarkMaxSeconds = seconds;
+                return ParserResult::ok( ParseResultType::Matched );
+            };
+        auto const setBenchmarkPinCore = [&]( int core ) {
+                if( core < 0 )
+                    return clara::ParserResult::runtimeError( "The benchmark core index must not be negative" );
+                config.benchmarkPinCore = core;
+                return ParserResult::ok( ParseResultType::Matched );
+            };
         auto const setVerbosity = [&]( std::string const& verbosity ) {
             auto lcVerbosity = toLower( verbosity );
             if( lcVerbosity == "quiet" )
@@ -142,12 +235,18 @@ namespace Catch {
             | Opt( [&]( int x ){ config.abortAfter = x; }, "no. failures" )
                 ["-x"]["--abortx"]
                 ( "abort after x failures" )
+            | Opt( config.abortFile, "filename" )
+                ["--abort-file"]
+                ( "coordinate aborts across processes via the given file" )
             | Opt( setWarning, "warning name" )
                 ["-w"]["--warn"]
                 ( "enable warnings" )
             | Opt( [&]( bool flag ) { config.showDurations = flag ? ShowDurations::Always : ShowDurations::Never; }, "yes|no" )
                 ["-d"]["--durations"]
                 ( "show test durations" )
+            | Opt( config.slowestDurations, "# of entries" )
+                ["--durations-top"]
+                ( "report only the n slowest tests/sections, at the end of the run" )
             | Opt( loadTestNamesFromFile, "filename" )
                 ["-f"]["--input-file"]
                 ( "load test names to run from a file" )
@@ -163,27 +262,183 @@ namespace Catch {
             | Opt( config.listTestNamesOnly )
                 ["--list-test-names-only"]
                 ( "list all/matching test cases names only" )
+            | Opt( config.listJson )
+                ["--list-json"]
+                ( "list all/matching test cases with tags and locations as JSON" )
             | Opt( config.listReporters )
                 ["--list-reporters"]
                 ( "list all reporters" )
-            | Opt( setTestOrder, "decl|lex|rand" )
+            | Opt( setTestOrder, "decl|lex|rand|duration-balanced|source-locality" )
                 ["--order"]
                 ( "test case order (defaults to decl)" )
+            | Opt( config.durationCacheFile, "filename" )
+                ["--duration-cache"]
+                ( "file to persist observed test durations in" )
+            | Opt( config.historyFile, "filename" )
+                ["--history-file"]
+                ( "record per-test results history in the given indexed store" )
+            | Opt( config.depsCacheFile, "filename" )
+                ["--deps-cache"]
+                ( "file to persist recorded test file dependencies in" )
+            | Opt( config.changedFiles, "path" )
+                ["--changed-files"]
+                ( "run only tests that depend on the given changed source file" )
+            | Opt( config.rerunFailuresFile, "filename" )
+                ["--rerun-failures"]
+                ( "run tests that failed last run first, tracking failures in the given file" )
+            | Opt( config.retryFailures, "no. of retries" )
+                ["--retry-failures"]
+                ( "re-run a failed test case in place up to N times" )
+            | Opt( config.quarantineFile, "filename" )
+                ["--quarantine-file"]
+                ( "record tests that only passed on a retry in the given file" )
+            | Opt( config.failFastTier )
+                ["--fail-fast-tier"]
+                ( "stop once a priority tier completes with failures in it" )
+            | Opt( setMaxDuration, "seconds" )
+                ["--max-duration"]
+                ( "stop launching new tests once the run has used this much wall-clock time" )
+            | Opt( config.stringifyMaxElements, "no. of elements" )
+                ["--stringify-max-elements"]
+                ( "container elements kept at each end when stringified (0 for all)" )
+            | Opt( config.diffBaselineFile, "filename" )
+                ["--diff-baseline"]
+                ( "previous run's binary report for the diff reporter to compare against" )
+            | Opt( setDiffDurationThreshold, "seconds" )
+                ["--diff-duration-threshold"]
+                ( "duration change the diff reporter treats as significant (0 to ignore durations)" )
+            | Opt( config.journalFile, "filename" )
+                ["--journal"]
+                ( "keep a write-ahead journal of test progress in the given file" )
+            | Opt( config.resumeFromJournal )
+                ["--resume"]
+                ( "skip tests the journal records as completed, quarantine a crasher" )
+            | Opt( config.manifestFile, "filename" )
+                ["--manifest"]
+                ( "run only the tests listed in the given binary manifest" )
+            | Opt( config.exportManifestFile, "filename" )
+                ["--export-manifest"]
+                ( "write a binary manifest of the matching tests and exit" )
+            | Opt( config.registrySnapshotFile, "filename" )
+                ["--registry-snapshot"]
+                ( "keep parsed test metadata in the given file across runs" )
+            | Opt( config.testPlugins, "filename" )
+                ["--load-plugin"]
+                ( "load tests from the given plugin (shared object)" )
+            | Opt( config.singlePassSections )
+                ["--single-pass-sections"]
+                ( "run all sections of a test case in one pass" )
+            | Opt( config.skipDuplicateCheck )
+                ["--skip-duplicate-check"]
+                ( "skip the check for duplicate test names" )
+            | Opt( config.reportResourceUsage )
+                ["--resource-usage"]
+                ( "report per-test CPU time, memory and page fault deltas" )
+            | Opt( config.reportStackUsage )
+                ["--stack-usage"]
+                ( "report per-test peak stack consumption" )
+            | Opt( config.profileAssertions )
+                ["--assertion-profile"]
+                ( "collect per-assertion latency histograms" )
+            | Opt( config.selfProfile )
+                ["--self-profile"]
+                ( "attribute run time to framework stages vs test bodies" )
+            | Opt( config.totalsOnly )
+                ["--totals-only"]
+                ( "only count successful assertions, never report them" )
+            | Opt( config.progressFd, "fd" )
+                ["--progress-fd"]
+                ( "file descriptor to write binary progress heartbeats to" )
             | Opt( setRngSeed, "'time'|number" )
                 ["--rng-seed"]
                 ( "set a specific seed for random numbers" )
+            | Opt( config.seedMatrix, "no. of seeds" )
+                ["--seed-matrix"]
+                ( "run the whole suite once per seed, in-process" )
             | Opt( setColourUsage, "yes|no" )
                 ["--use-colour"]
                 ( "should output be colourised" )
+            | Opt( setFlushPolicy, "auto|immediate|testcase" )
+                ["--flush-policy"]
+                ( "when to flush the output stream" )
+            | Opt( config.asyncOutput )
+                ["--async-output"]
+                ( "write output through a background thread" )
+            | Opt( config.saveConfigFile, "filename" )
+                ["--save-config"]
+                ( "save the parsed options as a binary snapshot" )
             | Opt( config.libIdentify )
                 ["--libidentify"]
                 ( "report name and version according to libidentify standard" )
             | Opt( setWaitForKeypress, "start|exit|both" )
                 ["--wait-for-keypress"]
                 ( "waits for a keypress before exiting" )
+            | Opt( setJobs, "no. of jobs" )
+                ["-j"]["--jobs"]
+                ( "run test cases on a pool of worker threads" )
+            | Opt( config.forkIsolation )
+                ["--fork"]
+                ( "run each test case in a forked child process (POSIX only)" )
+            | Opt( config.daemonSocket, "socket path" )
+                ["--daemon"]
+                ( "stay resident and serve test runs over the given local socket (POSIX only)" )
+            | Opt( config.bisectTest, "test name" )
+                ["--bisect"]
+                ( "binary-search the tests running before the given one for the one that makes it fail (POSIX only)" )
+            | Opt( setTimeout, "seconds" )
+                ["--timeout"]
+                ( "fail and move past a test case running longer than this many seconds" )
+            | Opt( config.snapshotFile, "filename" )
+                ["--snapshot-file"]
+                ( "store for snapshot assertions" )
+            | Opt( config.updateSnapshots )
+                ["--update-snapshots"]
+                ( "rewrite stored snapshots that no longer match" )
+            | Opt( config.artifactDir, "directory" )
+                ["--artifact-dir"]
+                ( "dump the raw operand bytes of failing comparisons into this directory" )
+            | Opt( setShardCount, "no. of shards" )
+                ["--shard-count"]
+                ( "split the tests to execute into this many groups" )
+            | Opt( setShardIndex, "shard index" )
+                ["--shard-index"]
+                ( "index of the group of tests to execute (see --shard-count)" )
+            | Opt( config.distributeWorkers, "transport command" )
+                ["--distribute-worker"]
+                ( "dispatch one shard of the tests through the given command and merge its results (repeatable)" )
+            | Opt( config.orchestrateBinaries, "test binary" )
+                ["--orchestrate"]
+                ( "schedule the given sibling test binary's tests from a shared queue (repeatable)" )
             | Opt( config.benchmarkResolutionMultiple, "multiplier" )
                 ["--benchmark-resolution-multiple"]
                 ( "multiple of clock resolution to run benchmarks" )
+            | Opt( setBenchmarkSamples, "samples" )
+                ["--benchmark-samples"]
+                ( "number of timed samples to collect per benchmark" )
+            | Opt( config.benchmarkBaselineFile, "filename" )
+                ["--benchmark-baseline"]
+                ( "file to record benchmark results in and compare them against" )
+            | Opt( setBenchmarkTolerance, "percent" )
+                ["--benchmark-tolerance"]
+                ( "allowed slowdown over the recorded baseline before a benchmark fails" )
+            | Opt( config.benchmarkResolutionCacheFile, "filename" )
+                ["--benchmark-resolution-cache"]
+                ( "file to cache the estimated clock resolution in between runs" )
+            | Opt( config.benchmarkPerfCounters )
+                ["--benchmark-perf-counters"]
+                ( "sample hardware performance counters around benchmarks" )
+            | Opt( setBenchmarkWarmup, "seconds" )
+                ["--benchmark-warmup"]
+                ( "time to run each benchmark before samples are recorded" )
+            | Opt( setBenchmarkConfidence, "level" )
+                ["--benchmark-confidence"]
+                ( "confidence level for comparative benchmark intervals (default 0.95)" )
+            | Opt( setBenchmarkMaxTime, "seconds" )
+                ["--benchmark-max-time"]
+                ( "cap on total measurement time per benchmark" )
+            | Opt( setBenchmarkPinCore, "core" )
+                ["--benchmark-pin-core"]
+                ( "pin benchmarks to the given CPU core while they run" )
 
             | Arg( config.testsOrTags, "test name|pattern|tags" )
                 ( "which test or tests to use" );
@@ -191,4 +446,248 @@ namespace Catch {
         return cli;
     }
 
+#else // CATCH_CONFIG_MINIMAL_CLI
+
+    namespace {
+
+        // One row per accepted option; hint is null for plain flags. The
+        // whole table is data, so adding an option costs a line rather
+        // than a combinator instantiation.
+        struct MinimalOpt {
+            char const* shortName;
+            char const* longName;
+            char const* hint;
+            char const* description;
+            std::string (*apply)( ConfigData&, std::string const& );
+        };
+
+        std::string intoUInt( std::string const& value, unsigned int& out ) {
+            char* end = nullptr;
+            auto parsed = std::strtoul( value.c_str(), &end, 10 );
+            if( end == value.c_str() || *end != '\0' )
+                return "Unable to convert '" + value + "' to a number";
+            out = static_cast<unsigned int>( parsed );
+            return std::string();
+        }
+        std::string intoInt( std::string const& value, int& out ) {
+            char* end = nullptr;
+            auto parsed = std::strtol( value.c_str(), &end, 10 );
+            if( end == value.c_str() || *end != '\0' )
+                return "Unable to convert '" + value + "' to a number";
+            out = static_cast<int>( parsed );
+            return std::string();
+        }
+
+        MinimalOpt const minimalOpts[] = {
+            { "-?", "--help", nullptr, "display usage information",
+              []( ConfigData& c, std::string const& ) { c.showHelp = true; return std::string(); } },
+            { "-l", "--list-tests", nullptr, "list all/matching test cases",
+              []( ConfigData& c, std::string const& ) { c.listTests = true; return std::string(); } },
+            { "-t", "--list-tags", nullptr, "list all/matching tags",
+              []( ConfigData& c, std::string const& ) { c.listTags = true; return std::string(); } },
+            { nullptr, "--list-test-names-only", nullptr, "list all/matching test cases names only",
+              []( ConfigData& c, std::string const& ) { c.listTestNamesOnly = true; return std::string(); } },
+            { nullptr, "--list-json", nullptr, "list all/matching test cases with tags and locations as JSON",
+              []( ConfigData& c, std::string const& ) { c.listJson = true; return std::string(); } },
+            { nullptr, "--list-reporters", nullptr, "list all reporters",
+              []( ConfigData& c, std::string const& ) { c.listReporters = true; return std::string(); } },
+            { "-s", "--success", nullptr, "include successful tests in output",
+              []( ConfigData& c, std::string const& ) { c.showSuccessfulTests = true; return std::string(); } },
+            { "-b", "--break", nullptr, "break into debugger on failure",
+              []( ConfigData& c, std::string const& ) { c.shouldDebugBreak = true; return std::string(); } },
+            { "-e", "--nothrow", nullptr, "skip exception tests",
+              []( ConfigData& c, std::string const& ) { c.noThrow = true; return std::string(); } },
+            { "-i", "--invisibles", nullptr, "show invisibles (tabs, newlines)",
+              []( ConfigData& c, std::string const& ) { c.showInvisibles = true; return std::string(); } },
+            { "-o", "--out", "filename", "output filename",
+              []( ConfigData& c, std::string const& value ) { c.outputFilename = value; return std::string(); } },
+            { "-r", "--reporter", "name", "reporter to use (defaults to console)",
+              []( ConfigData& c, std::string const& value ) { c.reporterName = value; return std::string(); } },
+            { "-n", "--name", "name", "suite name",
+              []( ConfigData& c, std::string const& value ) { c.name = value; return std::string(); } },
+            { "-a", "--abort", nullptr, "abort at first failure",
+              []( ConfigData& c, std::string const& ) { c.abortAfter = 1; return std::string(); } },
+            { "-x", "--abortx", "no. failures", "abort after x failures",
+              []( ConfigData& c, std::string const& value ) { return intoInt( value, c.abortAfter ); } },
+            { "-w", "--warn", "warning name", "enable warnings",
+              []( ConfigData& c, std::string const& value ) {
+                  if( value == "NoAssertions" )
+                      c.warnings = static_cast<WarnAbout::What>( c.warnings | WarnAbout::NoAssertions );
+                  else if( value == "NoTests" )
+                      c.warnings = static_cast<WarnAbout::What>( c.warnings | WarnAbout::NoTests );
+                  else
+                      return "Unrecognised warning: '" + value + "'";
+                  return std::string();
+              } },
+            { "-d", "--durations", "yes|no", "show test durations",
+              []( ConfigData& c, std::string const& value ) {
+                  auto mode = toLower( value );
+                  if( mode == "yes" )
+                      c.showDurations = ShowDurations::Always;
+                  else if( mode == "no" )
+                      c.showDurations = ShowDurations::Never;
+                  else
+                      return "Unrecognised durations mode: '" + value + "'";
+                  return std::string();
+              } },
+            { "-f", "--input-file", "filename", "load test names to run from a file",
+              []( ConfigData& c, std::string const& value ) {
+                  std::ifstream f( value.c_str() );
+                  if( !f.is_open() )
+                      return "Unable to load input file: '" + value + "'";
+                  std::string line;
+                  while( std::getline( f, line ) ) {
+                      line = trim( line );
+                      if( !line.empty() && !startsWith( line, '#' ) ) {
+                          if( !startsWith( line, '"' ) )
+                              line = '"' + line + '"';
+                          c.testsOrTags.push_back( line + ',' );
+                      }
+                  }
+                  return std::string();
+              } },
+            { "-#", "--filenames-as-tags", nullptr, "adds a tag for the filename",
+              []( ConfigData& c, std::string const& ) { c.filenamesAsTags = true; return std::string(); } },
+            { "-c", "--section", "section name", "specify section to run",
+              []( ConfigData& c, std::string const& value ) { c.sectionsToRun.push_back( value ); return std::string(); } },
+            { "-v", "--verbosity", "quiet|normal|high", "set output verbosity",
+              []( ConfigData& c, std::string const& value ) {
+                  auto mode = toLower( value );
+                  if( mode == "quiet" )
+                      c.verbosity = Verbosity::Quiet;
+                  else if( mode == "normal" )
+                      c.verbosity = Verbosity::Normal;
+                  else if( mode == "high" )
+                      c.verbosity = Verbosity::High;
+                  else
+                      return "Unrecognised verbosity, '" + value + "'";
+                  return std::string();
+              } },
+            { nullptr, "--order", "decl|lex|rand", "test case order (defaults to decl)",
+              []( ConfigData& c, std::string const& value ) {
+                  if( startsWith( "declared", value ) )
+                      c.runOrder = RunTests::InDeclarationOrder;
+                  else if( startsWith( "lexical", value ) )
+                      c.runOrder = RunTests::InLexicographicalOrder;
+                  else if( startsWith( "random", value ) )
+                      c.runOrder = RunTests::InRandomOrder;
+                  else
+                      return "Unrecognised ordering: '" + value + "'";
+                  return std::string();
+              } },
+            { nullptr, "--rng-seed", "'time'|number", "set a specific seed for random numbers",
+              []( ConfigData& c, std::string const& value ) {
+                  if( value != "time" )
+                      return intoUInt( value, c.rngSeed );
+                  c.rngSeed = static_cast<unsigned int>( std::time(nullptr) );
+                  return std::string();
+              } },
+            { nullptr, "--use-colour", "yes|no", "should output be colourised",
+              []( ConfigData& c, std::string const& value ) {
+                  auto mode = toLower( value );
+                  if( mode == "yes" )
+                      c.useColour = UseColour::Yes;
+                  else if( mode == "no" )
+                      c.useColour = UseColour::No;
+                  else if( mode == "auto" )
+                      c.useColour = UseColour::Auto;
+                  else
+                      return "colour mode must be one of: auto, yes or no. '" + value + "' not recognised";
+                  return std::string();
+              } },
+            { nullptr, "--libidentify", nullptr, "report name and version according to libidentify standard",
+              []( ConfigData& c, std::string const& ) { c.libIdentify = true; return std::string(); } },
+            { nullptr, "--wait-for-keypress", "start|exit|both", "waits for a keypress before exiting",
+              []( ConfigData& c, std::string const& value ) {
+                  auto mode = toLower( value );
+                  if( mode == "start" )
+                      c.waitForKeypress = WaitForKeypress::BeforeStart;
+                  else if( mode == "exit" )
+                      c.waitForKeypress = WaitForKeypress::BeforeExit;
+                  else if( mode == "both" )
+                      c.waitForKeypress = WaitForKeypress::BeforeStartAndExit;
+                  else
+                      return "keypress argument must be one of: start, exit or both. '" + value + "' not recognised";
+                  return std::string();
+              } },
+            { nullptr, "--save-config", "filename", "save the parsed options as a binary snapshot",
+              []( ConfigData& c, std::string const& value ) { c.saveConfigFile = value; return std::string(); } },
+        };
+
+    } // anonymous namespace
+
+    std::string parseMinimalCommandLine( ConfigData& config, int argc, char const* const* argv ) {
+        if( argc > 0 )
+            config.processName = argv[0];
+        for( int i = 1; i < argc; ++i ) {
+            std::string arg = argv[i];
+            if( arg.empty() )
+                continue;
+            // Positional arguments are test specs, exactly as with Clara
+            if( arg[0] != '-' ) {
+                config.testsOrTags.push_back( arg );
+                continue;
+            }
+            std::string name = arg, value;
+            bool haveValue = false;
+            auto equals = arg.find( '=' );
+            if( equals != std::string::npos ) {
+                name = arg.substr( 0, equals );
+                value = arg.substr( equals + 1 );
+                haveValue = true;
+            }
+            if( name == "-h" ) // Clara's Help accepts -h as well
+                name = "-?";
+            MinimalOpt const* match = nullptr;
+            for( auto const& opt : minimalOpts ) {
+                if( ( opt.shortName && name == opt.shortName ) || ( opt.longName && name == opt.longName ) ) {
+                    match = &opt;
+                    break;
+                }
+            }
+            if( !match )
+                return "Unrecognised token: " + arg +
+                    " (the minimal parser selected by CATCH_CONFIG_MINIMAL_CLI accepts the standard options only)";
+            if( match->hint ) {
+                if( !haveValue ) {
+                    if( i + 1 >= argc )
+                        return "Expected argument following " + name;
+                    value = argv[++i];
+                }
+            }
+            else if( haveValue ) {
+                return name + " does not take an argument";
+            }
+            auto error = match->apply( config, value );
+            if( !error.empty() )
+                return error;
+        }
+        return std::string();
+    }
+
+    void writeMinimalCliUsage( std::ostream& os ) {
+        os << "usage:\n  <executable> [<test name|pattern|tags> ... ] options\n\nwhere options are:\n";
+        for( auto const& opt : minimalOpts ) {
+            std::string left = "  ";
+            if( opt.shortName ) {
+                left += opt.shortName;
+                left += ", ";
+            }
+            left += opt.longName;
+            if( opt.hint ) {
+                left += " <";
+                left += opt.hint;
+                left += '>';
+            }
+            if( left.size() < 38 )
+                left.resize( 38, ' ' );
+            else
+                left += ' ';
+            os << left << opt.description << '\n';
+        }
+        os << "\nBuilt with CATCH_CONFIG_MINIMAL_CLI: the extended options need the full parser\n";
+    }
+
+#endif // CATCH_CONFIG_MINIMAL_CLI
+
 } // end namespace Catch
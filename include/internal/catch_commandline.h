@@ -9,6 +9,9 @@
 #define TWOBLUECUBES_CATCH_COMMANDLINE_HPP_INCLUDED
 
 #include "catch_config.hpp"
+
+#if !defined(CATCH_CONFIG_MINIMAL_CLI)
+
 #include "catch_clara.h"
 
 namespace Catch {
@@ -17,4 +20,25 @@ namespace Catch {
 
 } // end namespace Catch
 
+#else // CATCH_CONFIG_MINIMAL_CLI
+
+#include <iosfwd>
+#include <string>
+
+namespace Catch {
+
+    // Flat-table replacement for the Clara parser, selected by
+    // CATCH_CONFIG_MINIMAL_CLI. Covers the standard options only - no
+    // user extension point - in exchange for leaving Clara's combinator
+    // templates out of every test binary. Returns an empty string on
+    // success, the error message otherwise.
+    std::string parseMinimalCommandLine( ConfigData& config, int argc, char const* const* argv );
+
+    // Prints the usage text for the options the minimal parser accepts
+    void writeMinimalCliUsage( std::ostream& os );
+
+} // end namespace Catch
+
+#endif // CATCH_CONFIG_MINIMAL_CLI
+
 #endif // TWOBLUECUBES_CATCH_COMMANDLINE_HPP_INCLUDED
@@ -15,6 +15,7 @@
 // CATCH_CONFIG_WINDOWS_SEH : is Windows SEH supported?
 // CATCH_CONFIG_POSIX_SIGNALS : are POSIX signals supported?
 // CATCH_CONFIG_DISABLE_EXCEPTIONS : Are exceptions enabled?
+// CATCH_CONFIG_RTTI : is RTTI available?
 // ****************
 // Note to maintainers: if new toggles are added please document them
 // in configuration.md, too
@@ -144,6 +145,29 @@
 #  define CATCH_INTERNAL_CONFIG_EXCEPTIONS_ENABLED
 #endif
 
+////////////////////////////////////////////////////////////////////////////////
+// Check whether linker-section test registration would work here - it needs
+// the ELF __start_/__stop_ section symbols, and must not be combined with
+// AddressSanitizer, whose redzones between globals would break walking the
+// descriptor section as a contiguous array
+#if defined(__ELF__)
+#  if !defined(__SANITIZE_ADDRESS__)
+#    if defined(__has_feature)
+#      if !__has_feature(address_sanitizer)
+#        define CATCH_INTERNAL_CONFIG_SECTION_TEST_REGISTRY
+#      endif
+#    else
+#      define CATCH_INTERNAL_CONFIG_SECTION_TEST_REGISTRY
+#    endif
+#  endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Check if we are compiled with -fno-rtti or equivalent
+#if defined(__cpp_rtti) || defined(__GXX_RTTI) || defined(_CPPRTTI)
+#  define CATCH_INTERNAL_CONFIG_RTTI_ENABLED
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // DJGPP
 #ifdef __DJGPP__
@@ -161,6 +185,16 @@
     #define CATCH_INTERNAL_CONFIG_COUNTER
 #endif
 
+////////////////////////////////////////////////////////////////////////////////
+// Check if the CPU's own tick counter can be read directly (rdtsc on x86,
+// cntvct on ARM64). A tick read costs a few nanoseconds against tens for a
+// chrono call, which matters when BENCHMARK times sub-100ns operations.
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    define CATCH_INTERNAL_CONFIG_TSC_TIMER
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__) || defined(__aarch64__))
+#    define CATCH_INTERNAL_CONFIG_TSC_TIMER
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Check if string_view is available and usable
 // The check is split apart to work around v140 (VS2015) preprocessor issue...
@@ -170,6 +204,22 @@
 #endif
 #endif
 
+////////////////////////////////////////////////////////////////////////////////
+// Check if C++14 relaxed constexpr (loops and mutation inside constant
+// expressions) is available
+#if defined(__cpp_constexpr) && __cpp_constexpr >= 201304
+#    define CATCH_INTERNAL_CONFIG_CPP14_CONSTEXPR
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Check if to_chars is available for integer conversions (the floating point
+// overloads arrived much later in the implementations, so are not assumed)
+#if defined(__has_include)
+#if __has_include(<charconv>) && defined(CATCH_CPP17_OR_GREATER)
+#    define CATCH_INTERNAL_CONFIG_CPP17_CHARCONV
+#endif
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Check if variant is available and usable
 #if defined(__has_include)
@@ -187,7 +237,27 @@
 #  endif // __has_include(<variant>) && defined(CATCH_CPP17_OR_GREATER)
 #endif // __has_include
 
+////////////////////////////////////////////////////////////////////////////////
+// Check if SystemTap SDT probes are available, for the static
+// tracepoints at test/assertion boundaries
+#if defined(__linux__) && defined(__has_include)
+#  if __has_include(<sys/sdt.h>)
+#    define CATCH_INTERNAL_CONFIG_USDT
+#  endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Check if C++20 coroutines are available, for async test cases
+#if defined(__has_include)
+#  if __has_include(<coroutine>) && defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+#    define CATCH_INTERNAL_CONFIG_CXX20_COROUTINES
+#  endif
+#endif
+
 
+#if defined(CATCH_INTERNAL_CONFIG_TSC_TIMER) && !defined(CATCH_CONFIG_NO_TSC_TIMER) && !defined(CATCH_CONFIG_TSC_TIMER)
+#   define CATCH_CONFIG_TSC_TIMER
+#endif
 #if defined(CATCH_INTERNAL_CONFIG_COUNTER) && !defined(CATCH_CONFIG_NO_COUNTER) && !defined(CATCH_CONFIG_COUNTER)
 #   define CATCH_CONFIG_COUNTER
 #endif
@@ -215,10 +285,26 @@
 #  define CATCH_CONFIG_CPP17_STRING_VIEW
 #endif
 
+#if defined(CATCH_INTERNAL_CONFIG_CXX20_COROUTINES) && !defined(CATCH_CONFIG_NO_CXX20_COROUTINES) && !defined(CATCH_CONFIG_CXX20_COROUTINES)
+#  define CATCH_CONFIG_CXX20_COROUTINES
+#endif
+
 #if defined(CATCH_INTERNAL_CONFIG_CPP17_VARIANT) && !defined(CATCH_CONFIG_NO_CPP17_VARIANT) && !defined(CATCH_CONFIG_CPP17_VARIANT)
 #  define CATCH_CONFIG_CPP17_VARIANT
 #endif
 
+#if defined(CATCH_INTERNAL_CONFIG_CPP17_CHARCONV) && !defined(CATCH_CONFIG_NO_CPP17_CHARCONV) && !defined(CATCH_CONFIG_CPP17_CHARCONV)
+#  define CATCH_CONFIG_CPP17_CHARCONV
+#endif
+
+#if defined(CATCH_INTERNAL_CONFIG_CPP14_CONSTEXPR) && !defined(CATCH_CONFIG_NO_CPP14_CONSTEXPR) && !defined(CATCH_CONFIG_CPP14_CONSTEXPR)
+#  define CATCH_CONFIG_CPP14_CONSTEXPR
+#endif
+
+#if defined(CATCH_INTERNAL_CONFIG_USDT) && !defined(CATCH_CONFIG_NO_USDT) && !defined(CATCH_CONFIG_USDT)
+#  define CATCH_CONFIG_USDT
+#endif
+
 #if defined(CATCH_CONFIG_EXPERIMENTAL_REDIRECT)
 #  define CATCH_INTERNAL_CONFIG_NEW_CAPTURE
 #endif
@@ -231,6 +317,10 @@
 #  define CATCH_CONFIG_DISABLE_EXCEPTIONS
 #endif
 
+#if defined(CATCH_INTERNAL_CONFIG_RTTI_ENABLED) && !defined(CATCH_CONFIG_NO_RTTI) && !defined(CATCH_CONFIG_RTTI)
+#  define CATCH_CONFIG_RTTI
+#endif
+
 #if !defined(CATCH_INTERNAL_SUPPRESS_PARENTHESES_WARNINGS)
 #   define CATCH_INTERNAL_SUPPRESS_PARENTHESES_WARNINGS
 #   define CATCH_INTERNAL_UNSUPPRESS_PARENTHESES_WARNINGS
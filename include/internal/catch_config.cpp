@@ -7,6 +7,7 @@
 
 #include "catch_config.hpp"
 #include "catch_enforce.h"
+#include "catch_instrumentation.h"
 #include "catch_stringref.h"
 
 namespace Catch {
@@ -15,6 +16,10 @@ namespace Catch {
     :   m_data( data ),
         m_stream( openStream() )
     {
+        CATCH_ENFORCE( data.shardCount > 0, "The shard count must be greater than 0" );
+        CATCH_ENFORCE( data.shardIndex < data.shardCount,
+                       "The shard index (" << data.shardIndex << ") must be less than the shard count (" << data.shardCount << ')' );
+
         TestSpecParser parser(ITagAliasRegistry::get());
         if (data.testsOrTags.empty()) {
             parser.parse("~[.]"); // All not hidden tests
@@ -33,6 +38,7 @@ namespace Catch {
 
     bool Config::listTests() const          { return m_data.listTests; }
     bool Config::listTestNamesOnly() const  { return m_data.listTestNamesOnly; }
+    bool Config::listJson() const           { return m_data.listJson; }
     bool Config::listTags() const           { return m_data.listTags; }
     bool Config::listReporters() const      { return m_data.listReporters; }
 
@@ -41,11 +47,24 @@ namespace Catch {
 
     std::vector<std::string> const& Config::getTestsOrTags() const { return m_data.testsOrTags; }
     std::vector<std::string> const& Config::getSectionsToRun() const { return m_data.sectionsToRun; }
+    std::vector<std::string> const& Config::getTestPlugins() const { return m_data.testPlugins; }
+    std::vector<std::string> const& Config::getDistributeWorkers() const { return m_data.distributeWorkers; }
+    std::vector<std::string> const& Config::getOrchestrateBinaries() const { return m_data.orchestrateBinaries; }
 
     TestSpec const& Config::testSpec() const { return m_testSpec; }
     bool Config::hasTestFilters() const { return m_hasTestFilters; }
 
     bool Config::showHelp() const { return m_data.showHelp; }
+    unsigned int Config::jobs() const { return m_data.jobs; }
+    bool Config::forkIsolation() const { return m_data.forkIsolation; }
+    std::string Config::daemonSocket() const { return m_data.daemonSocket; }
+    std::string Config::bisectTest() const { return m_data.bisectTest; }
+    std::string Config::journalFile() const { return m_data.journalFile; }
+    bool Config::resumeFromJournal() const { return m_data.resumeFromJournal; }
+    bool Config::failFastTier() const { return m_data.failFastTier; }
+    std::string Config::quarantineFile() const { return m_data.quarantineFile; }
+    bool Config::asyncOutput() const { return m_data.asyncOutput; }
+    bool Config::selfProfile() const { return m_data.selfProfile; }
 
     // IConfig interface
     bool Config::allowThrows() const                   { return !m_data.noThrow; }
@@ -55,17 +74,60 @@ namespace Catch {
     bool Config::warnAboutMissingAssertions() const    { return !!(m_data.warnings & WarnAbout::NoAssertions); }
     bool Config::warnAboutNoTests() const              { return !!(m_data.warnings & WarnAbout::NoTests); }
     ShowDurations::OrNot Config::showDurations() const { return m_data.showDurations; }
+    unsigned int Config::slowestDurations() const      { return m_data.slowestDurations; }
     RunTests::InWhatOrder Config::runOrder() const     { return m_data.runOrder; }
     unsigned int Config::rngSeed() const               { return m_data.rngSeed; }
     int Config::benchmarkResolutionMultiple() const    { return m_data.benchmarkResolutionMultiple; }
+    unsigned int Config::benchmarkSamples() const      { return m_data.benchmarkSamples; }
+    double Config::benchmarkTolerance() const          { return m_data.benchmarkTolerance; }
+    bool Config::benchmarkPerfCounters() const         { return m_data.benchmarkPerfCounters; }
+    double Config::benchmarkWarmupSeconds() const      { return m_data.benchmarkWarmupSeconds; }
+    double Config::benchmarkConfidence() const         { return m_data.benchmarkConfidence; }
+    double Config::benchmarkMaxSeconds() const         { return m_data.benchmarkMaxSeconds; }
+    int Config::benchmarkPinCore() const               { return m_data.benchmarkPinCore; }
+    std::string Config::benchmarkBaselineFile() const  { return m_data.benchmarkBaselineFile; }
+    std::string Config::benchmarkResolutionCacheFile() const { return m_data.benchmarkResolutionCacheFile; }
     UseColour::YesOrNo Config::useColour() const       { return m_data.useColour; }
+    FlushPolicy Config::flushPolicy() const            { return m_data.flushPolicy; }
     bool Config::shouldDebugBreak() const              { return m_data.shouldDebugBreak; }
     int Config::abortAfter() const                     { return m_data.abortAfter; }
+    std::string Config::abortFile() const              { return m_data.abortFile; }
+    double Config::timeout() const                     { return m_data.timeout; }
+    std::string Config::snapshotFile() const           { return m_data.snapshotFile; }
+    bool Config::updateSnapshots() const               { return m_data.updateSnapshots; }
     bool Config::showInvisibles() const                { return m_data.showInvisibles; }
     Verbosity Config::verbosity() const                { return m_data.verbosity; }
+    unsigned int Config::shardCount() const            { return m_data.shardCount; }
+    unsigned int Config::shardIndex() const            { return m_data.shardIndex; }
+    std::string Config::durationCacheFile() const      { return m_data.durationCacheFile; }
+    std::string Config::historyFile() const            { return m_data.historyFile; }
+    std::string Config::rerunFailuresFile() const      { return m_data.rerunFailuresFile; }
+    std::string Config::manifestFile() const           { return m_data.manifestFile; }
+    std::string Config::exportManifestFile() const     { return m_data.exportManifestFile; }
+    std::string Config::registrySnapshotFile() const   { return m_data.registrySnapshotFile; }
+    bool Config::singlePassSections() const            { return m_data.singlePassSections; }
+    bool Config::skipDuplicateCheck() const            { return m_data.skipDuplicateCheck; }
+    bool Config::filenamesAsTags() const               { return m_data.filenamesAsTags; }
+    bool Config::reportResourceUsage() const           { return m_data.reportResourceUsage; }
+    bool Config::reportStackUsage() const              { return m_data.reportStackUsage; }
+    bool Config::profileAssertions() const             { return m_data.profileAssertions; }
+    bool Config::totalsOnly() const                    { return m_data.totalsOnly; }
+    int Config::progressFd() const                     { return m_data.progressFd; }
+    unsigned int Config::retryFailures() const         { return m_data.retryFailures; }
+    double Config::maxDuration() const                 { return m_data.maxDuration; }
+    unsigned int Config::stringifyMaxElements() const  { return m_data.stringifyMaxElements; }
+    std::string Config::diffBaselineFile() const       { return m_data.diffBaselineFile; }
+    double Config::diffDurationThreshold() const       { return m_data.diffDurationThreshold; }
+    std::string Config::depsCacheFile() const          { return m_data.depsCacheFile; }
+    std::vector<std::string> const& Config::changedFiles() const { return m_data.changedFiles; }
+    bool Config::runningUnderInstrumentation() const { return Catch::runningUnderInstrumentation(); }
+    std::string Config::artifactDir() const { return m_data.artifactDir; }
 
     IStream const* Config::openStream() {
-        return Catch::makeStream(m_data.outputFilename);
+        IStream const* stream = Catch::makeStream(m_data.outputFilename);
+        if (m_data.asyncOutput)
+            stream = Catch::makeAsyncStream(stream);
+        return stream;
     }
 
 } // end namespace Catch
@@ -31,6 +31,9 @@ namespace Catch {
         bool listTags = false;
         bool listReporters = false;
         bool listTestNamesOnly = false;
+        // One JSON document with names, tags and source locations, for
+        // machine consumers (see listTestsJson)
+        bool listJson = false;
 
         bool showSuccessfulTests = false;
         bool shouldDebugBreak = false;
@@ -39,21 +42,100 @@ namespace Catch {
         bool showInvisibles = false;
         bool filenamesAsTags = false;
         bool libIdentify = false;
+        bool singlePassSections = false;
+        bool skipDuplicateCheck = false;
+        bool reportResourceUsage = false;
+        bool reportStackUsage = false;
+        bool profileAssertions = false;
+        // Attribute the run's wall clock to framework stages versus test
+        // bodies and print the table at the end (see catch_self_profile.h)
+        bool selfProfile = false;
+        bool forkIsolation = false;
+        bool updateSnapshots = false;
+        bool resumeFromJournal = false;
+        // Quiet capture: successes only bump counters and are never
+        // delivered to reporters or listeners; failures are unaffected
+        bool totalsOnly = false;
+        // Stop scheduling new tests once a priority tier has completed
+        // with failures in it; later tiers are reported as skipped
+        bool failFastTier = false;
+        // Reporter output is written to the final sink by a background
+        // thread, double buffered with handoff on flush (see
+        // makeAsyncStream), so slow sinks do not stall the test thread
+        bool asyncOutput = false;
 
         int abortAfter = -1;
+        // File descriptor for binary progress heartbeats; -1 disables
+        int progressFd = -1;
         unsigned int rngSeed = 0;
+        // Number of seeds the whole suite is run under, in-process,
+        // starting from rngSeed; 0 disables
+        unsigned int seedMatrix = 0;
+        double timeout = 0;
         int benchmarkResolutionMultiple = 100;
+        unsigned int benchmarkSamples = 10;
+        double benchmarkTolerance = 10;
+        bool benchmarkPerfCounters = false;
+        // Per-benchmark time spent running the block before any sample is
+        // recorded, in seconds; 0 disables
+        double benchmarkWarmupSeconds = 0;
+        // Two-sided confidence level for comparative benchmark intervals
+        double benchmarkConfidence = 0.95;
+        // Cap on total measurement time per benchmark, in seconds; sample
+        // collection stops early when it is exceeded. 0 disables
+        double benchmarkMaxSeconds = 0;
+        // CPU core benchmarks are pinned to while they run; -1 disables
+        int benchmarkPinCore = -1;
+        unsigned int jobs = 1;
+        unsigned int shardCount = 1;
+        unsigned int shardIndex = 0;
+        unsigned int slowestDurations = 0;
+        // How many times a failed test case is re-run in place; 0 disables
+        unsigned int retryFailures = 0;
+        // Wall-clock budget for the whole run, in seconds; 0 disables
+        double maxDuration = 0;
+        // Elements kept at each end when stringifying a container; 0 keeps
+        // them all
+        unsigned int stringifyMaxElements = 64;
+        // Duration change, in seconds, the diff reporter treats as
+        // significant; 0 ignores durations entirely
+        double diffDurationThreshold = 0.5;
 
         Verbosity verbosity = Verbosity::Normal;
         WarnAbout::What warnings = WarnAbout::Nothing;
         ShowDurations::OrNot showDurations = ShowDurations::DefaultForReporter;
         RunTests::InWhatOrder runOrder = RunTests::InDeclarationOrder;
         UseColour::YesOrNo useColour = UseColour::Auto;
+        FlushPolicy flushPolicy = FlushPolicy::Auto;
         WaitForKeypress::When waitForKeypress = WaitForKeypress::Never;
 
         std::string outputFilename;
         std::string name;
         std::string processName;
+        std::string abortFile;
+        std::string daemonSocket;
+        // Test whose interference from earlier tests --bisect hunts down;
+        // empty disables
+        std::string bisectTest;
+        std::string snapshotFile = "catch_snapshots.bin";
+        // Directory failing assertions dump raw operand bytes into; empty
+        // disables (see catch_binary_artifact.h)
+        std::string artifactDir;
+        std::string durationCacheFile;
+        std::string historyFile;
+        std::string depsCacheFile;
+        std::string rerunFailuresFile;
+        std::string journalFile;
+        std::string quarantineFile;
+        std::string manifestFile;
+        std::string exportManifestFile;
+        // Parsed-registry snapshot file; empty disables (see
+        // catch_registry_snapshot.h)
+        std::string registrySnapshotFile;
+        std::string benchmarkBaselineFile;
+        std::string benchmarkResolutionCacheFile;
+        std::string diffBaselineFile;
+        std::string saveConfigFile;
 #ifndef CATCH_CONFIG_DEFAULT_REPORTER
 #define CATCH_CONFIG_DEFAULT_REPORTER "console"
 #endif
@@ -62,6 +144,14 @@ namespace Catch {
 
         std::vector<std::string> testsOrTags;
         std::vector<std::string> sectionsToRun;
+        std::vector<std::string> testPlugins;
+        std::vector<std::string> changedFiles;
+        // Transport commands for --distribute-worker; non-empty makes this
+        // process a coordinator (see catch_distributed.h)
+        std::vector<std::string> distributeWorkers;
+        // Sibling test binaries for --orchestrate; non-empty makes this
+        // process schedule their tests from one queue (catch_distributed.h)
+        std::vector<std::string> orchestrateBinaries;
     };
 
 
@@ -76,6 +166,7 @@ namespace Catch {
 
         bool listTests() const;
         bool listTestNamesOnly() const;
+        bool listJson() const;
         bool listTags() const;
         bool listReporters() const;
 
@@ -84,11 +175,24 @@ namespace Catch {
 
         std::vector<std::string> const& getTestsOrTags() const;
         std::vector<std::string> const& getSectionsToRun() const override;
+        std::vector<std::string> const& getTestPlugins() const;
+        std::vector<std::string> const& getDistributeWorkers() const;
+        std::vector<std::string> const& getOrchestrateBinaries() const;
 
         virtual TestSpec const& testSpec() const override;
         bool hasTestFilters() const override;
 
         bool showHelp() const;
+        unsigned int jobs() const;
+        bool forkIsolation() const;
+        std::string daemonSocket() const;
+        std::string bisectTest() const;
+        std::string journalFile() const;
+        bool resumeFromJournal() const;
+        bool failFastTier() const;
+        std::string quarantineFile() const;
+        bool asyncOutput() const;
+        bool selfProfile() const;
 
         // IConfig interface
         bool allowThrows() const override;
@@ -98,14 +202,54 @@ namespace Catch {
         bool warnAboutMissingAssertions() const override;
         bool warnAboutNoTests() const override;
         ShowDurations::OrNot showDurations() const override;
+        unsigned int slowestDurations() const override;
         RunTests::InWhatOrder runOrder() const override;
         unsigned int rngSeed() const override;
         int benchmarkResolutionMultiple() const override;
+        unsigned int benchmarkSamples() const override;
+        double benchmarkTolerance() const override;
+        bool benchmarkPerfCounters() const override;
+        double benchmarkWarmupSeconds() const override;
+        double benchmarkConfidence() const override;
+        double benchmarkMaxSeconds() const override;
+        int benchmarkPinCore() const override;
+        std::string benchmarkBaselineFile() const override;
+        std::string benchmarkResolutionCacheFile() const override;
         UseColour::YesOrNo useColour() const override;
+        FlushPolicy flushPolicy() const override;
         bool shouldDebugBreak() const override;
         int abortAfter() const override;
+        std::string abortFile() const override;
+        double timeout() const override;
+        std::string snapshotFile() const override;
+        bool updateSnapshots() const override;
         bool showInvisibles() const override;
         Verbosity verbosity() const override;
+        unsigned int shardCount() const override;
+        unsigned int shardIndex() const override;
+        std::string durationCacheFile() const override;
+        std::string historyFile() const override;
+        std::string rerunFailuresFile() const override;
+        std::string manifestFile() const override;
+        std::string exportManifestFile() const;
+        std::string registrySnapshotFile() const override;
+        bool singlePassSections() const override;
+        bool skipDuplicateCheck() const override;
+        bool filenamesAsTags() const override;
+        bool reportResourceUsage() const override;
+        bool reportStackUsage() const override;
+        bool profileAssertions() const override;
+        bool totalsOnly() const override;
+        int progressFd() const override;
+        unsigned int retryFailures() const override;
+        double maxDuration() const override;
+        unsigned int stringifyMaxElements() const override;
+        std::string diffBaselineFile() const override;
+        double diffDurationThreshold() const override;
+        std::string depsCacheFile() const override;
+        std::vector<std::string> const& changedFiles() const override;
+        bool runningUnderInstrumentation() const override;
+        std::string artifactDir() const override;
 
     private:
 
@@ -0,0 +1,204 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_config_snapshot.h"
+#include "catch_config.hpp"
+#include "catch_enforce.h"
+
+#include <cstdint>
+#include <fstream>
+#include <type_traits>
+
+namespace Catch {
+    namespace {
+
+        // "C2CF"
+        constexpr uint32_t snapshotMagic = 0x43324346;
+        constexpr uint32_t snapshotVersion = 23;
+
+        // Sanity bound on deserialized string/vector lengths - anything
+        // beyond this means the file is not a snapshot we wrote
+        constexpr uint32_t maxSnapshotLength = 1024 * 1024;
+
+        class SnapshotWriter {
+        public:
+            SnapshotWriter( std::ostream& os ) : m_os( os ) {}
+
+            template<typename T>
+            void raw( T value ) {
+                m_os.write( reinterpret_cast<char const*>( &value ), sizeof( value ) );
+            }
+            void operator()( bool value ) { raw( static_cast<uint8_t>( value ? 1 : 0 ) ); }
+            void operator()( int value ) { raw( value ); }
+            void operator()( unsigned int value ) { raw( value ); }
+            void operator()( double value ) { raw( value ); }
+            template<typename E, typename = typename std::enable_if<std::is_enum<E>::value>::type>
+            void operator()( E value ) { raw( static_cast<int32_t>( value ) ); }
+            void operator()( std::string const& value ) {
+                raw( static_cast<uint32_t>( value.size() ) );
+                m_os.write( value.data(), static_cast<std::streamsize>( value.size() ) );
+            }
+            void operator()( std::vector<std::string> const& value ) {
+                raw( static_cast<uint32_t>( value.size() ) );
+                for( auto const& element : value )
+                    (*this)( element );
+            }
+
+        private:
+            std::ostream& m_os;
+        };
+
+        class SnapshotReader {
+        public:
+            SnapshotReader( std::istream& is ) : m_is( is ) {}
+
+            template<typename T>
+            T raw() {
+                T value{};
+                m_is.read( reinterpret_cast<char*>( &value ), sizeof( value ) );
+                return value;
+            }
+            void operator()( bool& value ) { value = raw<uint8_t>() != 0; }
+            void operator()( int& value ) { value = raw<int>(); }
+            void operator()( unsigned int& value ) { value = raw<unsigned int>(); }
+            void operator()( double& value ) { value = raw<double>(); }
+            template<typename E, typename = typename std::enable_if<std::is_enum<E>::value>::type>
+            void operator()( E& value ) { value = static_cast<E>( raw<int32_t>() ); }
+            void operator()( std::string& value ) {
+                auto size = raw<uint32_t>();
+                CATCH_ENFORCE( size <= maxSnapshotLength, "Config snapshot is corrupt" );
+                value.resize( size );
+                if( size )
+                    m_is.read( &value[0], static_cast<std::streamsize>( size ) );
+            }
+            void operator()( std::vector<std::string>& value ) {
+                auto count = raw<uint32_t>();
+                CATCH_ENFORCE( count <= maxSnapshotLength, "Config snapshot is corrupt" );
+                value.clear();
+                value.reserve( count );
+                for( uint32_t i = 0; i < count; ++i ) {
+                    std::string element;
+                    (*this)( element );
+                    value.push_back( std::move( element ) );
+                }
+            }
+
+        private:
+            std::istream& m_is;
+        };
+
+        // One field list shared by both directions, so save and load can
+        // never drift apart. processName is taken from the live argv and
+        // saveConfigFile must not survive into a loaded snapshot, so
+        // neither is archived. Any change to this list, to field types, or
+        // to field meaning must bump snapshotVersion.
+        template<typename Archive, typename C>
+        void archiveFields( Archive& ar, C& config ) {
+            ar( config.listTests );
+            ar( config.listTags );
+            ar( config.listReporters );
+            ar( config.listTestNamesOnly );
+            ar( config.listJson );
+            ar( config.showSuccessfulTests );
+            ar( config.shouldDebugBreak );
+            ar( config.noThrow );
+            ar( config.showHelp );
+            ar( config.showInvisibles );
+            ar( config.filenamesAsTags );
+            ar( config.libIdentify );
+            ar( config.singlePassSections );
+            ar( config.skipDuplicateCheck );
+            ar( config.reportResourceUsage );
+            ar( config.reportStackUsage );
+            ar( config.profileAssertions );
+            ar( config.selfProfile );
+            ar( config.forkIsolation );
+            ar( config.updateSnapshots );
+            ar( config.resumeFromJournal );
+            ar( config.totalsOnly );
+            ar( config.failFastTier );
+            ar( config.asyncOutput );
+            ar( config.abortAfter );
+            ar( config.progressFd );
+            ar( config.rngSeed );
+            ar( config.seedMatrix );
+            ar( config.timeout );
+            ar( config.benchmarkResolutionMultiple );
+            ar( config.benchmarkSamples );
+            ar( config.benchmarkTolerance );
+            ar( config.benchmarkPerfCounters );
+            ar( config.benchmarkWarmupSeconds );
+            ar( config.benchmarkConfidence );
+            ar( config.benchmarkMaxSeconds );
+            ar( config.benchmarkPinCore );
+            ar( config.jobs );
+            ar( config.shardCount );
+            ar( config.shardIndex );
+            ar( config.slowestDurations );
+            ar( config.retryFailures );
+            ar( config.maxDuration );
+            ar( config.stringifyMaxElements );
+            ar( config.diffDurationThreshold );
+            ar( config.verbosity );
+            ar( config.warnings );
+            ar( config.showDurations );
+            ar( config.runOrder );
+            ar( config.useColour );
+            ar( config.flushPolicy );
+            ar( config.waitForKeypress );
+            ar( config.outputFilename );
+            ar( config.name );
+            ar( config.abortFile );
+            ar( config.daemonSocket );
+            ar( config.bisectTest );
+            ar( config.snapshotFile );
+            ar( config.artifactDir );
+            ar( config.durationCacheFile );
+            ar( config.historyFile );
+            ar( config.depsCacheFile );
+            ar( config.rerunFailuresFile );
+            ar( config.journalFile );
+            ar( config.quarantineFile );
+            ar( config.manifestFile );
+            ar( config.exportManifestFile );
+            ar( config.registrySnapshotFile );
+            ar( config.benchmarkBaselineFile );
+            ar( config.benchmarkResolutionCacheFile );
+            ar( config.diffBaselineFile );
+            ar( config.reporterName );
+            ar( config.testsOrTags );
+            ar( config.sectionsToRun );
+            ar( config.testPlugins );
+            ar( config.changedFiles );
+            ar( config.distributeWorkers );
+            ar( config.orchestrateBinaries );
+        }
+
+    } // anonymous namespace
+
+    void saveConfigSnapshot( std::string const& path, ConfigData const& config ) {
+        std::ofstream file( path, std::ios::binary | std::ios::trunc );
+        CATCH_ENFORCE( file, "Unable to open config snapshot file: '" << path << "' for writing" );
+        SnapshotWriter writer( file );
+        writer.raw( snapshotMagic );
+        writer.raw( snapshotVersion );
+        archiveFields( writer, config );
+        file.flush();
+        CATCH_ENFORCE( file, "Failed writing config snapshot to: '" << path << "'" );
+    }
+
+    void loadConfigSnapshot( std::string const& path, ConfigData& config ) {
+        std::ifstream file( path, std::ios::binary );
+        CATCH_ENFORCE( file, "Unable to open config snapshot file: '" << path << "'" );
+        SnapshotReader reader( file );
+        CATCH_ENFORCE( reader.raw<uint32_t>() == snapshotMagic,
+                      "File is not a config snapshot: '" << path << "'" );
+        CATCH_ENFORCE( reader.raw<uint32_t>() == snapshotVersion,
+                      "Config snapshot: '" << path << "' was written by a different version - regenerate it with --save-config" );
+        archiveFields( reader, config );
+        CATCH_ENFORCE( file, "Config snapshot is truncated: '" << path << "'" );
+    }
+
+} // end namespace Catch
@@ -0,0 +1,31 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_CONFIG_SNAPSHOT_H_INCLUDED
+#define TWOBLUECUBES_CATCH_CONFIG_SNAPSHOT_H_INCLUDED
+
+#include <string>
+
+namespace Catch {
+
+    struct ConfigData;
+
+    // Binary snapshots of a parsed ConfigData, so orchestrated harnesses
+    // that invoke the same binary with identical options thousands of
+    // times can pay for the Clara parse once (--save-config) and repopulate
+    // the config directly on later runs (--load-config). The snapshot is a
+    // local cache, not an interchange format: field widths are native and
+    // the version tag is bumped whenever ConfigData changes shape, so a
+    // stale or foreign file is rejected rather than misread.
+
+    // Throws on I/O failure
+    void saveConfigSnapshot( std::string const& path, ConfigData const& config );
+
+    // Throws if the file is missing, from a different version, or corrupt;
+    // config is not usable afterwards in that case
+    void loadConfigSnapshot( std::string const& path, ConfigData& config );
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_CONFIG_SNAPSHOT_H_INCLUDED
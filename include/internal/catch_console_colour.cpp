@@ -30,11 +30,27 @@ namespace Catch {
 
         struct IColourImpl {
             virtual ~IColourImpl() = default;
-            virtual void use( Colour::Code _colourCode ) = 0;
+
+            // The RAII guards in the reporters request colour changes far
+            // more often than the colour actually changes (every guard
+            // resets to None on destruction), so remember the current code
+            // and skip the no-op transitions - each one would otherwise be
+            // a small write, or on Windows a console call that flushes.
+            void use( Colour::Code _colourCode ) {
+                if( _colourCode == m_currentCode )
+                    return;
+                m_currentCode = _colourCode;
+                setColour( _colourCode );
+            }
+
+        private:
+            virtual void setColour( Colour::Code _colourCode ) = 0;
+
+            Colour::Code m_currentCode = Colour::None;
         };
 
         struct NoColourImpl : IColourImpl {
-            void use( Colour::Code ) {}
+            void setColour( Colour::Code ) override {}
 
             static IColourImpl* instance() {
                 static NoColourImpl s_instance;
@@ -69,7 +85,7 @@ namespace {
             originalBackgroundAttributes = csbiInfo.wAttributes & ~( FOREGROUND_GREEN | FOREGROUND_RED | FOREGROUND_BLUE | FOREGROUND_INTENSITY );
         }
 
-        virtual void use( Colour::Code _colourCode ) override {
+        void setColour( Colour::Code _colourCode ) override {
             switch( _colourCode ) {
                 case Colour::None:      return setTextAttribute( originalForegroundAttributes );
                 case Colour::White:     return setTextAttribute( FOREGROUND_GREEN | FOREGROUND_RED | FOREGROUND_BLUE );
@@ -105,7 +121,7 @@ namespace {
     IColourImpl* platformColourInstance() {
         static Win32ColourImpl s_instance;
 
-        IConfigPtr config = getCurrentContext().getConfig();
+        IConfig const* config = getCurrentContext().getConfig();
         UseColour::YesOrNo colourMode = config
             ? config->useColour()
             : UseColour::Auto;
@@ -132,35 +148,38 @@ namespace {
     // https://github.com/philsquared/Catch/pull/131
     class PosixColourImpl : public IColourImpl {
     public:
-        virtual void use( Colour::Code _colourCode ) override {
+        static IColourImpl* instance() {
+            static PosixColourImpl s_instance;
+            return &s_instance;
+        }
+
+    private:
+        void setColour( Colour::Code _colourCode ) override {
             switch( _colourCode ) {
                 case Colour::None:
-                case Colour::White:     return setColour( "[0m" );
-                case Colour::Red:       return setColour( "[0;31m" );
-                case Colour::Green:     return setColour( "[0;32m" );
-                case Colour::Blue:      return setColour( "[0;34m" );
-                case Colour::Cyan:      return setColour( "[0;36m" );
-                case Colour::Yellow:    return setColour( "[0;33m" );
-                case Colour::Grey:      return setColour( "[1;30m" );
-
-                case Colour::LightGrey:     return setColour( "[0;37m" );
-                case Colour::BrightRed:     return setColour( "[1;31m" );
-                case Colour::BrightGreen:   return setColour( "[1;32m" );
-                case Colour::BrightWhite:   return setColour( "[1;37m" );
-                case Colour::BrightYellow:  return setColour( "[1;33m" );
+                case Colour::White:     return writeEscape( "\033[0m" );
+                case Colour::Red:       return writeEscape( "\033[0;31m" );
+                case Colour::Green:     return writeEscape( "\033[0;32m" );
+                case Colour::Blue:      return writeEscape( "\033[0;34m" );
+                case Colour::Cyan:      return writeEscape( "\033[0;36m" );
+                case Colour::Yellow:    return writeEscape( "\033[0;33m" );
+                case Colour::Grey:      return writeEscape( "\033[1;30m" );
+
+                case Colour::LightGrey:     return writeEscape( "\033[0;37m" );
+                case Colour::BrightRed:     return writeEscape( "\033[1;31m" );
+                case Colour::BrightGreen:   return writeEscape( "\033[1;32m" );
+                case Colour::BrightWhite:   return writeEscape( "\033[1;37m" );
+                case Colour::BrightYellow:  return writeEscape( "\033[1;33m" );
 
                 case Colour::Bright: CATCH_INTERNAL_ERROR( "not a colour" );
                 default: CATCH_INTERNAL_ERROR( "Unknown colour requested" );
             }
         }
-        static IColourImpl* instance() {
-            static PosixColourImpl s_instance;
-            return &s_instance;
-        }
 
-    private:
-        void setColour( const char* _escapeCode ) {
-            Catch::cout() << '\033' << _escapeCode;
+        // The whole sequence in one insertion, rather than the escape
+        // character and the code separately
+        void writeEscape( const char* _escapeCode ) {
+            Catch::cout() << _escapeCode;
         }
     };
 
@@ -178,7 +197,7 @@ namespace {
     }
     IColourImpl* platformColourInstance() {
         ErrnoGuard guard;
-        IConfigPtr config = getCurrentContext().getConfig();
+        IConfig const* config = getCurrentContext().getConfig();
         UseColour::YesOrNo colourMode = config
             ? config->useColour()
             : UseColour::Auto;
@@ -224,6 +243,12 @@ namespace Catch {
         impl->use( _colourCode );
     }
 
+    bool colourIsDisabled() {
+        // Resolved once, like the impl cached in Colour::use
+        static bool disabled = platformColourInstance() == NoColourImpl::instance();
+        return disabled;
+    }
+
     std::ostream& operator << ( std::ostream& os, Colour const& ) {
         return os;
     }
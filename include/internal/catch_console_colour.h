@@ -64,6 +64,11 @@ namespace Catch {
 
     std::ostream& operator << ( std::ostream& os, Colour const& );
 
+    // True when colour output resolved to "off" for this run - the RAII
+    // guards are then no-ops, so reporters may take byte-for-byte
+    // equivalent formatting fast paths that bypass them
+    bool colourIsDisabled();
+
 } // end namespace Catch
 
 #endif // TWOBLUECUBES_CATCH_CONSOLE_COLOUR_HPP_INCLUDED
@@ -15,41 +15,54 @@ namespace Catch {
     struct IResultCapture;
     struct IRunner;
     struct IConfig;
-    struct IMutableContext;
 
     using IConfigPtr = std::shared_ptr<IConfig const>;
 
-    struct IContext
-    {
-        virtual ~IContext();
+    // Gives the assertion macros access to the active result capture and
+    // config. The accessors are deliberately non-virtual and inline, so a
+    // trip through the context on the assertion hot path costs a
+    // thread-local load and a member read rather than a virtual dispatch.
+    //
+    // The context holds only raw pointers and owns nothing: the RunContext
+    // that registers itself (and whose Session keeps the config alive past
+    // the run) is responsible for the lifetimes. That keeps the type
+    // trivially destructible with a constexpr constructor, which is what
+    // lets the accessor below avoid any initialization check.
+    class Context {
+    public:
+        Context( Context const& ) = delete;
+        Context& operator =( Context const& ) = delete;
 
-        virtual IResultCapture* getResultCapture() = 0;
-        virtual IRunner* getRunner() = 0;
-        virtual IConfigPtr const& getConfig() const = 0;
-    };
+        IResultCapture* getResultCapture() { return m_resultCapture; }
+        IRunner* getRunner() { return m_runner; }
+        IConfig const* getConfig() const { return m_config; }
 
-    struct IMutableContext : IContext
-    {
-        virtual ~IMutableContext();
-        virtual void setResultCapture( IResultCapture* resultCapture ) = 0;
-        virtual void setRunner( IRunner* runner ) = 0;
-        virtual void setConfig( IConfigPtr const& config ) = 0;
+        void setResultCapture( IResultCapture* resultCapture ) { m_resultCapture = resultCapture; }
+        void setRunner( IRunner* runner ) { m_runner = runner; }
+        void setConfig( IConfig const* config ) { m_config = config; }
 
     private:
-        static IMutableContext *currentContext;
-        friend IMutableContext& getCurrentMutableContext();
-        friend void cleanUpContext();
-        static void createContext();
+        constexpr Context() = default;
+        friend Context& getCurrentMutableContext();
+
+        IConfig const* m_config = nullptr;
+        IRunner* m_runner = nullptr;
+        IResultCapture* m_resultCapture = nullptr;
     };
 
-    inline IMutableContext& getCurrentMutableContext()
+    // Each thread gets its own context so that independent RunContexts can
+    // execute test cases concurrently (see the --jobs option). The object
+    // is constant-initialized and trivially destructible, so there is no
+    // guard branch and no lazy allocation behind this - access compiles
+    // down to a single thread-local address computation, and two threads
+    // racing to their first assertion is harmless.
+    inline Context& getCurrentMutableContext()
     {
-        if( !IMutableContext::currentContext )
-            IMutableContext::createContext();
-        return *IMutableContext::currentContext;
+        static thread_local Context context;
+        return context;
     }
 
-    inline IContext& getCurrentContext()
+    inline Context& getCurrentContext()
     {
         return getCurrentMutableContext();
     }
@@ -0,0 +1,125 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_cpu_affinity.h"
+#include "catch_context.h"
+#include "catch_interfaces_config.h"
+#include "catch_platform.h"
+
+#if defined(CATCH_PLATFORM_LINUX)
+#include <cstdio>
+#include <sched.h>
+#elif defined(CATCH_PLATFORM_WINDOWS)
+#include "catch_windows_h_proxy.h"
+#endif
+
+namespace Catch {
+
+#if defined(CATCH_PLATFORM_LINUX)
+
+    namespace {
+        // Reads the single-line contents of a sysfs file; empty when the
+        // file does not exist (e.g. cpufreq not compiled in)
+        auto readSysfsLine( std::string const& path ) -> std::string {
+            std::FILE* file = std::fopen( path.c_str(), "r" );
+            if( !file )
+                return {};
+            char line[64] = {};
+            if( !std::fgets( line, sizeof( line ), file ) )
+                line[0] = '\0';
+            std::fclose( file );
+            std::string value( line );
+            while( !value.empty() && ( value.back() == '\n' || value.back() == '\r' ) )
+                value.pop_back();
+            return value;
+        }
+    }
+
+    auto currentCpuState( int pinnedCore ) -> CpuState {
+        CpuState state;
+        state.pinnedCore = pinnedCore;
+        int cpu = pinnedCore >= 0 ? pinnedCore : sched_getcpu();
+        if( cpu < 0 )
+            return state;
+        state.governor = readSysfsLine(
+            "/sys/devices/system/cpu/cpu" + std::to_string( cpu ) + "/cpufreq/scaling_governor" );
+
+        // intel_pstate exposes turbo inverted; the generic cpufreq boost
+        // knob is direct. Whichever exists wins
+        std::string noTurbo = readSysfsLine( "/sys/devices/system/cpu/intel_pstate/no_turbo" );
+        if( !noTurbo.empty() )
+            state.turboEnabled = noTurbo == "0" ? 1 : 0;
+        else {
+            std::string boost = readSysfsLine( "/sys/devices/system/cpu/cpufreq/boost" );
+            if( !boost.empty() )
+                state.turboEnabled = boost == "1" ? 1 : 0;
+        }
+        return state;
+    }
+
+    CpuAffinityGuard::CpuAffinityGuard() {
+        static_assert( sizeof( cpu_set_t ) <= sizeof( m_previousMask ),
+                       "affinity mask storage is too small for cpu_set_t" );
+        int core = getCurrentContext().getConfig()->benchmarkPinCore();
+        if( core < 0 )
+            return;
+        auto previous = reinterpret_cast<cpu_set_t*>( m_previousMask );
+        if( sched_getaffinity( 0, sizeof( cpu_set_t ), previous ) != 0 )
+            return;
+        cpu_set_t pinned;
+        CPU_ZERO( &pinned );
+        CPU_SET( static_cast<unsigned>( core ), &pinned );
+        if( sched_setaffinity( 0, sizeof( cpu_set_t ), &pinned ) != 0 )
+            return;
+        m_core = core;
+        m_restore = true;
+    }
+
+    CpuAffinityGuard::~CpuAffinityGuard() {
+        if( m_restore )
+            sched_setaffinity( 0, sizeof( cpu_set_t ), reinterpret_cast<cpu_set_t*>( m_previousMask ) );
+    }
+
+#elif defined(CATCH_PLATFORM_WINDOWS)
+
+    auto currentCpuState( int pinnedCore ) -> CpuState {
+        CpuState state;
+        state.pinnedCore = pinnedCore;
+        return state;
+    }
+
+    CpuAffinityGuard::CpuAffinityGuard() {
+        static_assert( sizeof( DWORD_PTR ) <= sizeof( m_previousMask ),
+                       "affinity mask storage is too small for DWORD_PTR" );
+        int core = getCurrentContext().getConfig()->benchmarkPinCore();
+        if( core < 0 )
+            return;
+        DWORD_PTR previous = SetThreadAffinityMask( GetCurrentThread(), DWORD_PTR( 1 ) << core );
+        if( previous == 0 )
+            return;
+        *reinterpret_cast<DWORD_PTR*>( m_previousMask ) = previous;
+        m_core = core;
+        m_restore = true;
+    }
+
+    CpuAffinityGuard::~CpuAffinityGuard() {
+        if( m_restore )
+            SetThreadAffinityMask( GetCurrentThread(), *reinterpret_cast<DWORD_PTR*>( m_previousMask ) );
+    }
+
+#else
+
+    auto currentCpuState( int pinnedCore ) -> CpuState {
+        CpuState state;
+        state.pinnedCore = pinnedCore;
+        return state;
+    }
+
+    CpuAffinityGuard::CpuAffinityGuard() = default;
+    CpuAffinityGuard::~CpuAffinityGuard() = default;
+
+#endif
+
+} // end namespace Catch
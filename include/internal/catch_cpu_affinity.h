@@ -0,0 +1,54 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_CPU_AFFINITY_H_INCLUDED
+#define TWOBLUECUBES_CATCH_CPU_AFFINITY_H_INCLUDED
+
+#include <string>
+
+namespace Catch {
+
+    // Frequency-management state of the core a benchmark ran on, captured
+    // when the benchmark finishes and reported in its BenchmarkStats.
+    // Numbers taken under an on-demand governor or with turbo enabled can
+    // swing with the machine's thermal state, so consumers can use this to
+    // post-filter noisy results. Only populated on Linux; elsewhere
+    // governor stays empty and turboEnabled stays -1.
+    struct CpuState {
+        std::string governor;
+        int turboEnabled = -1;  // 1 enabled, 0 disabled, -1 unknown
+        int pinnedCore = -1;    // core the thread was pinned to; -1 if not pinned
+    };
+
+    auto currentCpuState( int pinnedCore ) -> CpuState;
+
+    // Pins the calling thread to the core given by --benchmark-pin-core
+    // for the guard's lifetime and restores the previous affinity mask on
+    // destruction, so core migration cannot perturb the timed region. A
+    // no-op when the option is not set, the pin fails, or the platform
+    // has no thread affinity API.
+    class CpuAffinityGuard {
+    public:
+        CpuAffinityGuard();
+        ~CpuAffinityGuard();
+
+        CpuAffinityGuard( CpuAffinityGuard const& ) = delete;
+        CpuAffinityGuard& operator = ( CpuAffinityGuard const& ) = delete;
+
+        auto pinnedCore() const -> int {
+            return m_core;
+        }
+
+    private:
+        int m_core = -1;
+        // Opaque storage for the platform's previous affinity mask
+        // (cpu_set_t or DWORD_PTR), kept here so the header does not
+        // drag in platform headers
+        unsigned char m_previousMask[128];
+        bool m_restore = false;
+    };
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_CPU_AFFINITY_H_INCLUDED
@@ -0,0 +1,104 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_crash_context.h"
+#include "catch_platform.h"
+
+#include <cstring>
+
+#if defined(CATCH_PLATFORM_WINDOWS)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace Catch {
+namespace {
+
+    // Sized so that a deeply sectioned test with long names still fits;
+    // anything beyond this is silently truncated rather than grown
+    constexpr std::size_t bufferSize = 4096;
+    constexpr std::size_t maxSectionDepth = 32;
+
+    // Thread-local so that the crashing thread's handler sees the test
+    // that thread was running, not whatever another --jobs worker was at
+    thread_local char s_buffer[bufferSize];
+    thread_local std::size_t s_length = 0;
+    thread_local std::size_t s_sectionStarts[maxSectionDepth];
+    thread_local std::size_t s_sectionDepth = 0;
+
+    void append( char const* text, std::size_t count ) {
+        if( count > bufferSize - s_length )
+            count = bufferSize - s_length;
+        std::memcpy( s_buffer + s_length, text, count );
+        s_length += count;
+    }
+    void append( char const* text ) {
+        append( text, std::strlen( text ) );
+    }
+    void append( std::string const& text ) {
+        append( text.c_str(), text.size() );
+    }
+    void appendNumber( std::size_t value ) {
+        char digits[24];
+        std::size_t i = sizeof(digits);
+        do {
+            digits[--i] = static_cast<char>( '0' + value % 10 );
+            value /= 10;
+        } while( value );
+        append( digits + i, sizeof(digits) - i );
+    }
+
+    void writeRaw( char const* data, std::size_t count ) {
+#if defined(CATCH_PLATFORM_WINDOWS)
+        _write( 2, data, static_cast<unsigned int>( count ) );
+#else
+        static_cast<void>( write( 2, data, count ) );
+#endif
+    }
+
+} // end anonymous namespace
+
+    void setCrashContextTestCase( std::string const& name, SourceLineInfo const& lineInfo ) {
+        s_length = 0;
+        s_sectionDepth = 0;
+        append( "  while running test case: '" );
+        append( name );
+        append( "' (" );
+        append( lineInfo.file );
+        append( ":" );
+        appendNumber( lineInfo.line );
+        append( ")\n" );
+    }
+
+    void pushCrashContextSection( std::string const& name ) {
+        if( s_sectionDepth < maxSectionDepth )
+            s_sectionStarts[s_sectionDepth] = s_length;
+        ++s_sectionDepth;
+        append( "  in section: '" );
+        append( name );
+        append( "'\n" );
+    }
+
+    void popCrashContextSection() {
+        if( s_sectionDepth == 0 )
+            return;
+        --s_sectionDepth;
+        if( s_sectionDepth < maxSectionDepth )
+            s_length = s_sectionStarts[s_sectionDepth];
+    }
+
+    void clearCrashContext() {
+        s_length = 0;
+        s_sectionDepth = 0;
+    }
+
+    void writeCrashContext( char const* signalName ) {
+        writeRaw( signalName, std::strlen( signalName ) );
+        writeRaw( "\n", 1 );
+        writeRaw( s_buffer, s_length );
+    }
+
+} // end namespace Catch
@@ -0,0 +1,33 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_CRASH_CONTEXT_H_INCLUDED
+#define TWOBLUECUBES_CATCH_CRASH_CONTEXT_H_INCLUDED
+
+#include "catch_common.h"
+
+#include <string>
+
+namespace Catch {
+
+    // Pre-formatted crash identification. The running test case and the
+    // open sections are formatted into a fixed thread-local buffer as
+    // they are entered - plain bounded copies, no allocation - so that
+    // when a fatal signal arrives the handler can identify the crash
+    // site with nothing but write(2). Everything else the handler does
+    // (running reporters, building strings) is best effort and may hang
+    // or recurse when the crash corrupted the heap; this line is the
+    // part that always gets out, immediately.
+    void setCrashContextTestCase( std::string const& name, SourceLineInfo const& lineInfo );
+    void pushCrashContextSection( std::string const& name );
+    void popCrashContextSection();
+    void clearCrashContext();
+
+    // Writes the signal name and the prepared context to stderr using
+    // only async-signal-safe calls
+    void writeCrashContext( char const* signalName );
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_CRASH_CONTEXT_H_INCLUDED
@@ -8,12 +8,26 @@
 
 #include "catch_decomposer.h"
 #include "catch_config.hpp"
+#include "catch_text_diff.h"
 
 namespace Catch {
 
     ITransientExpression::~ITransientExpression() = default;
-    
+
+    namespace {
+        // Above this combined size, a failed (in)equality is presented as
+        // a bounded diff: printing two large operands in full costs more
+        // (in Column wrapping alone) than the assertion did, and buries
+        // the one spot that differs
+        const std::size_t diffPresentationThreshold = 2048;
+    }
+
     void formatReconstructedExpression( std::ostream &os, std::string const& lhs, StringRef op, std::string const& rhs ) {
+        if( ( op == "=="_sr || op == "!="_sr ) && lhs.size() + rhs.size() >= diffPresentationThreshold ) {
+            os << "(operands elided: lhs is " << lhs.size() << " characters, rhs " << rhs.size() << ")\n";
+            formatTextDiff( os, lhs, rhs );
+            return;
+        }
         if( lhs.size() + rhs.size() < 40 &&
                 lhs.find('\n') == std::string::npos &&
                 rhs.find('\n') == std::string::npos )
@@ -21,4 +35,25 @@ namespace Catch {
         else
             os << lhs << "\n" << op << "\n" << rhs;
     }
+
+    // Matching definitions for the extern template declarations the header
+    // makes under CATCH_CONFIG_EXTERN_TEMPLATES. Compiled unconditionally,
+    // so the implementation always carries the symbols whether or not a
+    // given TU opts in.
+    template class ExprLhs<int const&>;
+    template class ExprLhs<bool>;
+    template class ExprLhs<unsigned long const&>;
+
+    template class UnaryExpr<int const&>;
+    template class UnaryExpr<bool>;
+
+    template class BinaryExpr<int const&, int const&>;
+    template class BinaryExpr<int const&, bool>;
+    template class BinaryExpr<bool, bool>;
+    template class BinaryExpr<unsigned long const&, unsigned long const&>;
+    template class BinaryExpr<unsigned long const&, int const&>;
+    template class BinaryExpr<std::string const&, std::string const&>;
+    template class BinaryExpr<std::string const&, char const* const&>;
+    template class BinaryExpr<char const* const&, std::string const&>;
+    template class BinaryExpr<char const* const&, char const* const&>;
 }
@@ -8,6 +8,7 @@
 #ifndef TWOBLUECUBES_CATCH_DECOMPOSER_H_INCLUDED
 #define TWOBLUECUBES_CATCH_DECOMPOSER_H_INCLUDED
 
+#include "catch_binary_artifact.h"
 #include "catch_tostring.h"
 #include "catch_stringref.h"
 
@@ -27,6 +28,9 @@ namespace Catch {
         auto isBinaryExpression() const -> bool { return m_isBinaryExpression; }
         auto getResult() const -> bool { return m_result; }
         virtual void streamReconstructedExpression( std::ostream &os ) const = 0;
+        // Writes both operands' raw bytes into the sink (see BinaryMaker);
+        // false when the expression has no binary-serialisable operand pair
+        virtual bool writeBinaryOperands( IBinaryOperandSink& ) const { return false; }
 
         ITransientExpression( bool isBinaryExpression, bool result )
         :   m_isBinaryExpression( isBinaryExpression ),
@@ -55,6 +59,10 @@ namespace Catch {
                     ( os, Catch::Detail::stringify( m_lhs ), m_op, Catch::Detail::stringify( m_rhs ) );
         }
 
+        bool writeBinaryOperands( IBinaryOperandSink& sink ) const override {
+            return Detail::writeBinaryOperandPair( m_lhs, m_rhs, sink );
+        }
+
     public:
         BinaryExpr( bool comparisonResult, LhsT lhs, StringRef op, RhsT rhs )
         :   ITransientExpression{ true, comparisonResult },
@@ -166,6 +174,34 @@ namespace Catch {
         }
     };
 
+#if defined(CATCH_CONFIG_EXTERN_TEMPLATES)
+    // The assertion macros instantiate the same handful of expression
+    // templates for common scalar and string comparisons in every TU that
+    // uses them. Opting in defers these instantiations to the
+    // implementation file, which always provides the definitions, so that
+    // template tax is paid once per binary instead of once per TU.
+    // ExprLhs is only instantiated for arithmetic types: its non-template
+    // members (comparison with bool, makeUnaryExpr) are ill-formed for
+    // strings and pointers, so a class-level instantiation would not compile
+    // for those. The BinaryExpr instantiations below still cover them.
+    extern template class ExprLhs<int const&>;
+    extern template class ExprLhs<bool>;
+    extern template class ExprLhs<unsigned long const&>;
+
+    extern template class UnaryExpr<int const&>;
+    extern template class UnaryExpr<bool>;
+
+    extern template class BinaryExpr<int const&, int const&>;
+    extern template class BinaryExpr<int const&, bool>;
+    extern template class BinaryExpr<bool, bool>;
+    extern template class BinaryExpr<unsigned long const&, unsigned long const&>;
+    extern template class BinaryExpr<unsigned long const&, int const&>;
+    extern template class BinaryExpr<std::string const&, std::string const&>;
+    extern template class BinaryExpr<std::string const&, char const* const&>;
+    extern template class BinaryExpr<char const* const&, std::string const&>;
+    extern template class BinaryExpr<char const* const&, char const* const&>;
+#endif // CATCH_CONFIG_EXTERN_TEMPLATES
+
 } // end namespace Catch
 
 #ifdef _MSC_VER
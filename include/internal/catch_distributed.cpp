@@ -0,0 +1,638 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_distributed.h"
+#include "catch_config.hpp"
+#include "catch_duration_cache.h"
+#include "catch_enforce.h"
+#include "catch_history_store.h"
+#include "catch_interfaces_reporter.h"
+#include "catch_platform.h"
+#include "catch_stream.h"
+#include "catch_string_intern.h"
+#include "catch_timer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Catch {
+
+    namespace {
+
+        // The transport command line goes through the shell, so the
+        // coordinator's test specs must survive one round of shell parsing
+        auto quoteShellArg( std::string const& arg ) -> std::string {
+#if defined(CATCH_PLATFORM_WINDOWS)
+            return '"' + arg + '"';
+#else
+            std::string quoted;
+            quoted.reserve( arg.size() + 2 );
+            quoted += '\'';
+            for( char c : arg ) {
+                if( c == '\'' )
+                    quoted += "'\\''";
+                else
+                    quoted += c;
+            }
+            quoted += '\'';
+            return quoted;
+#endif
+        }
+
+        auto openWorkerPipe( std::string const& command ) -> std::FILE* {
+#if defined(CATCH_PLATFORM_WINDOWS)
+            return _popen( command.c_str(), "rb" );
+#else
+            return popen( command.c_str(), "r" );
+#endif
+        }
+        void closeWorkerPipe( std::FILE* pipe ) {
+#if defined(CATCH_PLATFORM_WINDOWS)
+            _pclose( pipe );
+#else
+            pclose( pipe );
+#endif
+        }
+
+        // One worker's connection: the pump thread appends the raw stream
+        // bytes as they arrive and the coordinator thread drains them, so
+        // every worker keeps streaming while earlier ones are replayed
+        struct WorkerStream {
+            std::string command;
+            std::mutex mutex;
+            std::condition_variable produced;
+            std::string buffer;
+            bool closed = false;
+            bool failedToStart = false;
+        };
+
+        void pumpWorkerStream( WorkerStream& stream ) {
+            auto* pipe = openWorkerPipe( stream.command );
+            if( !pipe ) {
+                std::lock_guard<std::mutex> lock( stream.mutex );
+                stream.failedToStart = true;
+                stream.closed = true;
+                stream.produced.notify_all();
+                return;
+            }
+            char chunk[4096];
+            for(;;) {
+                auto bytes = std::fread( chunk, 1, sizeof(chunk), pipe );
+                if( bytes == 0 )
+                    break;
+                std::lock_guard<std::mutex> lock( stream.mutex );
+                stream.buffer.append( chunk, bytes );
+                stream.produced.notify_all();
+            }
+            closeWorkerPipe( pipe );
+            std::lock_guard<std::mutex> lock( stream.mutex );
+            stream.closed = true;
+            stream.produced.notify_all();
+        }
+
+        // Mirrors the constants and record layouts of the binary reporter
+        // (see catch_reporter_binary.cpp); the two must move together
+        constexpr std::size_t streamHeaderSize = 5; // "CBRS" + version byte
+        constexpr uint8_t binaryReportVersion = 1;
+
+        enum class RecordType : uint8_t {
+            TestRunStarting = 0x01,
+            TestGroupStarting = 0x02,
+            TestCaseStarting = 0x03,
+            SectionStarting = 0x04,
+            AssertionEnded = 0x05,
+            SectionEnded = 0x06,
+            TestCaseEnded = 0x07,
+            TestGroupEnded = 0x08,
+            TestRunEnded = 0x09
+        };
+
+        // Cursor over one record's payload. A read past the end sets the
+        // truncated flag and returns zeroes instead of faulting, so a
+        // corrupt stream degrades into a reported worker failure.
+        class RecordPayload {
+            char const* m_data;
+            std::size_t m_size;
+            std::size_t m_pos = 0;
+            bool m_truncated = false;
+
+            auto take( std::size_t count ) -> char const* {
+                if( m_size - m_pos < count ) {
+                    m_truncated = true;
+                    return nullptr;
+                }
+                auto* at = m_data + m_pos;
+                m_pos += count;
+                return at;
+            }
+        public:
+            RecordPayload( char const* data, std::size_t size )
+            :   m_data( data ), m_size( size )
+            {}
+
+            auto truncated() const -> bool { return m_truncated; }
+
+            auto read8() -> uint8_t {
+                auto* bytes = take( 1 );
+                return bytes ? static_cast<uint8_t>( bytes[0] ) : 0;
+            }
+            auto read32() -> uint32_t {
+                auto* bytes = take( 4 );
+                uint32_t value = 0;
+                if( bytes )
+                    for( int i = 0; i < 4; ++i )
+                        value |= static_cast<uint32_t>( static_cast<uint8_t>( bytes[i] ) ) << (i*8);
+                return value;
+            }
+            auto read64() -> uint64_t {
+                auto* bytes = take( 8 );
+                uint64_t value = 0;
+                if( bytes )
+                    for( int i = 0; i < 8; ++i )
+                        value |= static_cast<uint64_t>( static_cast<uint8_t>( bytes[i] ) ) << (i*8);
+                return value;
+            }
+            auto readDouble() -> double {
+                auto bits = read64();
+                double value;
+                std::memcpy( &value, &bits, sizeof(value) );
+                return value;
+            }
+            auto readString() -> std::string {
+                auto length = read32();
+                auto* bytes = take( length );
+                return bytes ? std::string( bytes, length ) : std::string();
+            }
+            auto readCounts() -> Counts {
+                Counts counts;
+                counts.passed = read64();
+                counts.failed = read64();
+                counts.failedButOk = read64();
+                return counts;
+            }
+        };
+
+        // Decodes one worker's record stream and replays the events into
+        // the coordinator's reporter. The workers' run and group framing
+        // records are dropped - the coordinator frames the consolidated
+        // run itself - and the worker's final Totals are captured from its
+        // TestRunEnded record. Strings that outlive the reporter call
+        // (names, expressions, source files) are interned, so reporters
+        // that hold on to assertion results see stable storage.
+        class BinaryStreamReplayer {
+        public:
+            BinaryStreamReplayer( IStreamingReporter& reporter )
+            :   m_reporter( reporter )
+            {}
+
+            // Consumes the complete records in buffer beyond offset,
+            // advancing offset past them. Returns false once the stream is
+            // known to be corrupt.
+            auto consume( std::string const& buffer, std::size_t& offset ) -> bool {
+                if( m_corrupt )
+                    return false;
+                if( !m_sawHeader ) {
+                    if( buffer.size() - offset < streamHeaderSize )
+                        return true;
+                    if( std::memcmp( buffer.data() + offset, "CBRS", 4 ) != 0 ||
+                            static_cast<uint8_t>( buffer[offset+4] ) != binaryReportVersion ) {
+                        m_corrupt = true;
+                        return false;
+                    }
+                    offset += streamHeaderSize;
+                    m_sawHeader = true;
+                }
+                while( buffer.size() - offset >= 5 ) {
+                    auto type = static_cast<uint8_t>( buffer[offset] );
+                    uint32_t length = 0;
+                    for( int i = 0; i < 4; ++i )
+                        length |= static_cast<uint32_t>( static_cast<uint8_t>( buffer[offset+1+i] ) ) << (i*8);
+                    if( buffer.size() - offset - 5 < length )
+                        break;
+                    dispatch( type, RecordPayload( buffer.data() + offset + 5, length ) );
+                    offset += 5 + static_cast<std::size_t>( length );
+                    if( m_corrupt )
+                        return false;
+                }
+                return true;
+            }
+
+            auto sawRunEnd() const -> bool { return m_sawRunEnd; }
+            auto corrupt() const -> bool { return m_corrupt; }
+            auto workerTotals() const -> Totals const& { return m_workerTotals; }
+
+        private:
+            auto internedLineInfo( std::string const& file, uint64_t line ) -> SourceLineInfo {
+                return SourceLineInfo( internString( file ).c_str(), static_cast<std::size_t>( line ) );
+            }
+
+            void dispatch( uint8_t type, RecordPayload payload ) {
+                switch( static_cast<RecordType>( type ) ) {
+                case RecordType::TestRunStarting:
+                case RecordType::TestGroupStarting:
+                case RecordType::TestGroupEnded:
+                    break;
+
+                case RecordType::TestCaseStarting: {
+                    auto name = payload.readString();
+                    auto className = payload.readString();
+                    auto file = payload.readString();
+                    auto line = payload.read64();
+                    if( checkTruncated( payload ) )
+                        return;
+                    m_activeTestCase.reset( new TestCaseInfo( name, className, std::string(),
+                                                              std::vector<std::string>(),
+                                                              internedLineInfo( file, line ) ) );
+                    m_reporter.testCaseStarting( *m_activeTestCase );
+                    break;
+                }
+
+                case RecordType::SectionStarting: {
+                    auto name = payload.readString();
+                    auto file = payload.readString();
+                    auto line = payload.read64();
+                    if( checkTruncated( payload ) )
+                        return;
+                    m_sectionStack.push_back( SectionInfo( internedLineInfo( file, line ), name ) );
+                    m_reporter.sectionStarting( m_sectionStack.back() );
+                    break;
+                }
+
+                case RecordType::AssertionEnded: {
+                    auto resultType = static_cast<ResultWas::OfType>( payload.read32() );
+                    bool resultOk = payload.read8() != 0;
+                    auto macroName = internString( payload.readString() );
+                    auto expression = internString( payload.readString() );
+                    auto expanded = payload.readString();
+                    auto messages = payload.readString();
+                    auto file = payload.readString();
+                    auto line = payload.read64();
+                    if( checkTruncated( payload ) )
+                        return;
+
+                    auto lineInfo = internedLineInfo( file, line );
+                    // A failed-but-ok result can only be reconstructed
+                    // through the disposition isOk() consults
+                    auto disposition = resultOk && resultType != ResultWas::Ok
+                        ? ResultDisposition::SuppressFail : ResultDisposition::Normal;
+                    AssertionInfo info{ macroName, lineInfo, expression, disposition };
+                    AssertionResultData data( resultType, LazyExpression( false ) );
+                    data.reconstructedExpression = expanded;
+                    data.message = messages.empty() || messages.back() != '\n'
+                        ? messages : messages.substr( 0, messages.size() - 1 );
+
+                    // The writer newline-joined the attached messages;
+                    // split them back into one entry per line
+                    std::vector<MessageInfo> infoMessages;
+                    std::size_t start = 0;
+                    while( start < messages.size() ) {
+                        auto end = messages.find( '\n', start );
+                        if( end == std::string::npos )
+                            end = messages.size();
+                        if( end > start ) {
+                            MessageInfo message( macroName, lineInfo, ResultWas::Info );
+                            message.message = messages.substr( start, end - start );
+                            infoMessages.push_back( std::move( message ) );
+                        }
+                        start = end + 1;
+                    }
+
+                    if( resultType == ResultWas::Ok )
+                        ++m_running.assertions.passed;
+                    else if( resultType & ResultWas::FailureBit ) {
+                        if( resultOk )
+                            ++m_running.assertions.failedButOk;
+                        else
+                            ++m_running.assertions.failed;
+                    }
+
+                    AssertionResult result( info, data );
+                    m_reporter.assertionEnded( AssertionStats( result, infoMessages, m_running ) );
+                    break;
+                }
+
+                case RecordType::SectionEnded: {
+                    auto name = payload.readString();
+                    auto assertions = payload.readCounts();
+                    auto duration = payload.readDouble();
+                    if( checkTruncated( payload ) )
+                        return;
+                    SectionInfo info = !m_sectionStack.empty()
+                        ? m_sectionStack.back()
+                        : SectionInfo( internedLineInfo( std::string(), 0 ), name );
+                    if( !m_sectionStack.empty() )
+                        m_sectionStack.pop_back();
+                    m_reporter.sectionEnded( SectionStats( info, assertions, duration, false ) );
+                    break;
+                }
+
+                case RecordType::TestCaseEnded: {
+                    auto name = payload.readString();
+                    auto assertions = payload.readCounts();
+                    auto stdOut = payload.readString();
+                    auto stdErr = payload.readString();
+                    if( checkTruncated( payload ) )
+                        return;
+                    Totals totals;
+                    totals.assertions = assertions;
+                    ( assertions.failed > 0 ? totals.testCases.failed : totals.testCases.passed ) = 1;
+                    ( assertions.failed > 0 ? ++m_running.testCases.failed : ++m_running.testCases.passed );
+                    if( !m_activeTestCase )
+                        m_activeTestCase.reset( new TestCaseInfo( name, std::string(), std::string(),
+                                                                  std::vector<std::string>(),
+                                                                  internedLineInfo( std::string(), 0 ) ) );
+                    m_reporter.testCaseEnded( TestCaseStats( *m_activeTestCase, totals, stdOut, stdErr, false ) );
+                    m_activeTestCase.reset();
+                    break;
+                }
+
+                case RecordType::TestRunEnded: {
+                    payload.readString(); // run name
+                    m_workerTotals.assertions = payload.readCounts();
+                    m_workerTotals.testCases = payload.readCounts();
+                    payload.read8(); // aborting
+                    if( checkTruncated( payload ) )
+                        return;
+                    m_sawRunEnd = true;
+                    break;
+                }
+
+                default:
+                    m_corrupt = true;
+                    break;
+                }
+            }
+
+            auto checkTruncated( RecordPayload const& payload ) -> bool {
+                if( payload.truncated() )
+                    m_corrupt = true;
+                return m_corrupt;
+            }
+
+            IStreamingReporter& m_reporter;
+            std::unique_ptr<TestCaseInfo> m_activeTestCase;
+            std::vector<SectionInfo> m_sectionStack;
+            Totals m_running;
+            Totals m_workerTotals;
+            bool m_sawHeader = false;
+            bool m_sawRunEnd = false;
+            bool m_corrupt = false;
+        };
+
+        auto buildWorkerArguments( Config const& config, std::size_t index, std::size_t count ) -> std::string {
+            ReusableStringStream args;
+            args << " --reporter binary"
+                 << " --shard-count " << count
+                 << " --shard-index " << index;
+            for( auto const& spec : config.getTestsOrTags() )
+                args << ' ' << quoteShellArg( spec );
+            return args.str();
+        }
+
+    } // anonymous namespace
+
+    Totals runTestsDistributed( std::shared_ptr<Config> const& config, IStreamingReporter& reporter ) {
+        auto const& commands = config->getDistributeWorkers();
+
+        std::vector<std::unique_ptr<WorkerStream>> streams;
+        streams.reserve( commands.size() );
+        for( std::size_t i = 0; i < commands.size(); ++i ) {
+            streams.push_back( std::unique_ptr<WorkerStream>( new WorkerStream() ) );
+            streams.back()->command = commands[i] + buildWorkerArguments( *config, i, commands.size() );
+        }
+
+        // All workers start at once; the coordinator replays their streams
+        // in worker order, the first one live and the rest from the bytes
+        // their pump threads collected in the meantime
+        std::vector<std::thread> pumps;
+        pumps.reserve( streams.size() );
+        for( auto& stream : streams )
+            pumps.emplace_back( [&stream] { pumpWorkerStream( *stream ); } );
+
+        Totals totals;
+        for( std::size_t i = 0; i < streams.size(); ++i ) {
+            auto& stream = *streams[i];
+            BinaryStreamReplayer replayer( reporter );
+            std::string pending;
+            std::size_t offset = 0;
+            std::size_t taken = 0;
+            bool done = false;
+            while( !done ) {
+                {
+                    std::unique_lock<std::mutex> lock( stream.mutex );
+                    stream.produced.wait( lock, [&] {
+                        return stream.closed || stream.buffer.size() > taken;
+                    } );
+                    pending.append( stream.buffer, taken, stream.buffer.size() - taken );
+                    taken = stream.buffer.size();
+                    done = stream.closed && stream.buffer.size() == taken;
+                }
+                // Replaying outside the lock keeps the pump threads of the
+                // other workers from stalling behind a slow reporter
+                if( !replayer.consume( pending, offset ) )
+                    break;
+                if( offset > 1024 * 1024 ) {
+                    pending.erase( 0, offset );
+                    offset = 0;
+                }
+            }
+
+            if( replayer.corrupt() || !replayer.sawRunEnd() ) {
+                // Charge the worker with one failure so a dead machine
+                // cannot silently shrink the run
+                ++totals.assertions.failed;
+                ++totals.testCases.failed;
+                Catch::cerr() << "Distributed worker " << i+1 << " of " << commands.size()
+                              << ( stream.failedToStart
+                                    ? " could not be started"
+                                    : replayer.corrupt()
+                                        ? " did not produce a valid binary event stream"
+                                        : " terminated before completing its run" )
+                              << ": '" << commands[i] << "'\n";
+            } else {
+                totals += replayer.workerTotals();
+            }
+        }
+
+        for( auto& pump : pumps )
+            pump.join();
+        return totals;
+    }
+
+    namespace {
+
+        auto readAllFromPipe( std::FILE* pipe ) -> std::string {
+            std::string contents;
+            char chunk[4096];
+            for(;;) {
+                auto bytes = std::fread( chunk, 1, sizeof(chunk), pipe );
+                if( bytes == 0 )
+                    break;
+                contents.append( chunk, bytes );
+            }
+            return contents;
+        }
+
+        // Pulls one sibling binary's test names through its registry
+        // listing. Names the listing wrapped in quotes (those starting
+        // with '#') are unwrapped again.
+        auto listBinaryTests( std::string const& binary ) -> std::vector<std::string> {
+            auto* pipe = openWorkerPipe( binary + " --list-test-names-only" );
+            CATCH_ENFORCE_PARTS( pipe, "Could not run the --orchestrate listing for '", binary, "'" );
+            auto output = readAllFromPipe( pipe );
+            closeWorkerPipe( pipe );
+
+            std::vector<std::string> names;
+            std::size_t start = 0;
+            while( start < output.size() ) {
+                auto end = output.find( '\n', start );
+                if( end == std::string::npos )
+                    end = output.size();
+                auto name = output.substr( start, end - start );
+                if( name.size() >= 2 && name.front() == '"' && name.back() == '"' )
+                    name = name.substr( 1, name.size() - 2 );
+                if( !name.empty() )
+                    names.push_back( std::move( name ) );
+                start = end + 1;
+            }
+            return names;
+        }
+
+        // A dispatched test name goes back through the spec parser, so
+        // the characters it treats as control characters are escaped
+        auto escapeTestSpec( std::string const& name ) -> std::string {
+            std::string spec;
+            spec.reserve( name.size() );
+            for( char c : name ) {
+                if( c == '\\' || c == ',' || c == '[' || c == ']' )
+                    spec += '\\';
+                spec += c;
+            }
+            return spec;
+        }
+
+        // One entry of the unified scheduling queue
+        struct OrchestratedTest {
+            std::size_t binaryIndex;
+            std::string name;
+            double cachedDuration;
+        };
+
+    } // anonymous namespace
+
+    Totals runTestsOrchestrated( std::shared_ptr<Config> const& config, IStreamingReporter& reporter ) {
+        auto const& binaries = config->getOrchestrateBinaries();
+
+        auto durations = loadSchedulingDurations( *config );
+
+        std::vector<OrchestratedTest> queue;
+        for( std::size_t i = 0; i < binaries.size(); ++i ) {
+            for( auto& name : listBinaryTests( binaries[i] ) ) {
+                auto it = durations.find( name );
+                queue.push_back( { i, std::move( name ), it != durations.end() ? it->second : 0.001 } );
+            }
+        }
+        // Longest first, so the long tail cannot start, alone, at the end
+        // of the run - the same dispatch order the in-process pool uses
+        std::stable_sort( queue.begin(), queue.end(),
+            []( OrchestratedTest const& lhs, OrchestratedTest const& rhs ) {
+                return lhs.cachedDuration > rhs.cachedDuration;
+            } );
+
+        auto slots = static_cast<std::size_t>( (std::max)( config->jobs(), 1u ) );
+        if( slots > queue.size() )
+            slots = (std::max)( queue.size(), std::size_t(1) );
+
+        // Slot threads run one test per process and hand the collected
+        // stream over for replay; only the coordinator thread touches the
+        // reporter, so reporters need no locking
+        struct FinishedTest {
+            std::size_t queueIndex;
+            std::string streamBytes;
+            double duration;
+        };
+        std::mutex mutex;
+        std::condition_variable finished;
+        std::deque<FinishedTest> ready;
+        std::atomic<std::size_t> nextTest( 0 );
+
+        std::vector<std::thread> workers;
+        workers.reserve( slots );
+        for( std::size_t slot = 0; slot < slots; ++slot ) {
+            workers.emplace_back( [&] {
+                for( auto index = nextTest++; index < queue.size(); index = nextTest++ ) {
+                    auto const& job = queue[index];
+                    auto command = binaries[job.binaryIndex]
+                        + ' ' + quoteShellArg( escapeTestSpec( job.name ) )
+                        + " --reporter binary";
+                    Timer timer;
+                    timer.start();
+                    std::string bytes;
+                    if( auto* pipe = openWorkerPipe( command ) ) {
+                        bytes = readAllFromPipe( pipe );
+                        closeWorkerPipe( pipe );
+                    }
+                    std::lock_guard<std::mutex> lock( mutex );
+                    ready.push_back( { index, std::move( bytes ), timer.getElapsedSeconds() } );
+                    finished.notify_one();
+                }
+            } );
+        }
+
+        Totals totals;
+        TestDurations observedDurations;
+        for( std::size_t processed = 0; processed < queue.size(); ++processed ) {
+            FinishedTest result;
+            {
+                std::unique_lock<std::mutex> lock( mutex );
+                finished.wait( lock, [&] { return !ready.empty(); } );
+                result = std::move( ready.front() );
+                ready.pop_front();
+            }
+            auto const& job = queue[result.queueIndex];
+
+            BinaryStreamReplayer replayer( reporter );
+            std::size_t offset = 0;
+            replayer.consume( result.streamBytes, offset );
+            if( replayer.corrupt() || !replayer.sawRunEnd() ) {
+                ++totals.assertions.failed;
+                ++totals.testCases.failed;
+                Catch::cerr() << "Orchestrated test '" << job.name << "' from '"
+                              << binaries[job.binaryIndex] << "' did not complete\n";
+            } else if( replayer.workerTotals().testCases.total() == 0 ) {
+                // The listing and the spec parse disagree about the name -
+                // surface it rather than quietly running nothing
+                ++totals.assertions.failed;
+                ++totals.testCases.failed;
+                Catch::cerr() << "Orchestrated test '" << job.name << "' matched nothing in '"
+                              << binaries[job.binaryIndex] << "'\n";
+            } else {
+                totals += replayer.workerTotals();
+                observedDurations[job.name] = result.duration;
+            }
+        }
+
+        for( auto& worker : workers )
+            worker.join();
+
+        // Fold the observed runtimes into the shared cache so the next
+        // orchestrated run schedules with fresh durations
+        if( !config->durationCacheFile().empty() && !observedDurations.empty() ) {
+            auto cached = loadTestDurations( config->durationCacheFile() );
+            for( auto const& observed : observedDurations )
+                cached[observed.first] = observed.second;
+            saveTestDurations( config->durationCacheFile(), cached );
+        }
+        return totals;
+    }
+
+} // end namespace Catch
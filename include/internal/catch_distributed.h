@@ -0,0 +1,40 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_DISTRIBUTED_H_INCLUDED
+#define TWOBLUECUBES_CATCH_DISTRIBUTED_H_INCLUDED
+
+#include "catch_totals.h"
+
+#include <memory>
+
+namespace Catch {
+
+    class Config;
+    struct IStreamingReporter;
+
+    // Coordinates a run distributed over the --distribute-worker transport
+    // commands: each command is launched with the worker's arguments
+    // appended (--reporter binary plus a --shard-index/--shard-count pair
+    // and the coordinator's test specs) and is expected to invoke the same
+    // test binary, typically on another machine. The workers' binary event
+    // streams are decoded as they arrive and replayed into the given
+    // reporter, so the coordinator produces one consolidated report with
+    // no merge step afterwards. The caller frames the run with its own
+    // testRunStarting/testRunEnded events.
+    Totals runTestsDistributed( std::shared_ptr<Config> const& config, IStreamingReporter& reporter );
+
+    // Orchestrates the --orchestrate sibling binaries as one suite: each
+    // binary's test listing is pulled up front, the union is ordered into
+    // a single duration-aware queue (longest first, from the shared
+    // --duration-cache) and dispatched test by test to --jobs process
+    // slots, so a long test in one binary overlaps short tests from the
+    // others instead of serialising behind its binary. Every dispatched
+    // test runs with --reporter binary and its stream is replayed into
+    // the given reporter, exactly as for runTestsDistributed.
+    Totals runTestsOrchestrated( std::shared_ptr<Config> const& config, IStreamingReporter& reporter );
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_DISTRIBUTED_H_INCLUDED
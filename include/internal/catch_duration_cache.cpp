@@ -0,0 +1,32 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_duration_cache.h"
+
+#include <cstdlib>
+#include <fstream>
+
+namespace Catch {
+
+    TestDurations loadTestDurations( std::string const& cacheFile ) {
+        TestDurations durations;
+        std::ifstream f( cacheFile.c_str() );
+        std::string line;
+        while( std::getline( f, line ) ) {
+            auto tab = line.find( '\t' );
+            if( tab == std::string::npos )
+                continue;
+            durations[line.substr( tab + 1 )] = std::strtod( line.c_str(), nullptr );
+        }
+        return durations;
+    }
+
+    void saveTestDurations( std::string const& cacheFile, TestDurations const& durations ) {
+        std::ofstream f( cacheFile.c_str() );
+        for( auto const& duration : durations )
+            f << duration.second << '\t' << duration.first << '\n';
+    }
+
+} // end namespace Catch
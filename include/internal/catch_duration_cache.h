@@ -0,0 +1,25 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_DURATION_CACHE_H_INCLUDED
+#define TWOBLUECUBES_CATCH_DURATION_CACHE_H_INCLUDED
+
+#include <map>
+#include <string>
+
+namespace Catch {
+
+    // Maps test case names to their last observed runtime, in seconds
+    using TestDurations = std::map<std::string, double>;
+
+    // Reads a duration cache previously written by saveTestDurations.
+    // Returns an empty map if the file does not exist or cannot be read.
+    TestDurations loadTestDurations( std::string const& cacheFile );
+
+    // Persists the durations, one "<seconds>\t<test name>" pair per line
+    void saveTestDurations( std::string const& cacheFile, TestDurations const& durations );
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_DURATION_CACHE_H_INCLUDED
@@ -16,4 +16,15 @@ namespace Catch {
         std::terminate();
     }
 #endif
+
+    std::string concatenateParts( std::initializer_list<StringRef> parts ) {
+        std::size_t totalSize = 0;
+        for( auto const& part : parts )
+            totalSize += part.size();
+        std::string message;
+        message.reserve( totalSize );
+        for( auto const& part : parts )
+            message.append( part.currentData(), part.size() );
+        return message;
+    }
 } // namespace Catch;
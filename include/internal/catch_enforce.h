@@ -10,8 +10,9 @@
 #include "catch_common.h"
 #include "catch_compiler_capabilities.h"
 #include "catch_stream.h"
+#include "catch_stringref.h"
 
-
+#include <initializer_list>
 #include <stdexcept>
 
 namespace Catch {
@@ -25,6 +26,14 @@ namespace Catch {
     [[noreturn]]
     void throw_exception(std::exception const& e);
 #endif
+
+    // Joins preformatted message parts into one string with a single,
+    // sized-up-front allocation - no stream machinery. The error paths
+    // in startup validation (spec parsing, config checks, duplicate
+    // detection) use this via the _PARTS macros below so they do not
+    // instantiate an ostringstream per expansion; the streaming macros
+    // remain for messages that genuinely need formatting.
+    std::string concatenateParts( std::initializer_list<StringRef> parts );
 } // namespace Catch;
 
 #define CATCH_PREPARE_EXCEPTION( type, msg ) \
@@ -38,5 +47,10 @@ namespace Catch {
 #define CATCH_ENFORCE( condition, msg ) \
     do{ if( !(condition) ) CATCH_ERROR( msg ); } while(false)
 
+#define CATCH_ERROR_PARTS( ... ) \
+    Catch::throw_exception( std::domain_error( Catch::concatenateParts( { __VA_ARGS__ } ) ) )
+#define CATCH_ENFORCE_PARTS( condition, ... ) \
+    do{ if( !(condition) ) CATCH_ERROR_PARTS( __VA_ARGS__ ); } while(false)
+
 
 #endif // TWOBLUECUBES_CATCH_ENFORCE_H_INCLUDED
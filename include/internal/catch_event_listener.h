@@ -0,0 +1,71 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_EVENT_LISTENER_H_INCLUDED
+#define TWOBLUECUBES_CATCH_EVENT_LISTENER_H_INCLUDED
+
+#include "catch_interfaces_reporter.h"
+#include "catch_reporter_registrars.hpp"
+
+namespace Catch {
+
+    // Base for passive instrumentation (CATCH_REGISTER_LISTENER): every
+    // event has an empty default, so a listener overrides only what it
+    // measures, and subscribeTo() narrows delivery to the chosen
+    // ListenerEvents groups - the multiplexing ListeningReporter then
+    // skips the listener entirely for everything else. Unlike the
+    // reporter bases there is no output stream, no lazily tracked run
+    // state and no verbosity check to pay for.
+    //
+    //     struct Timings : Catch::EventListenerBase {
+    //         Timings( Catch::ReporterConfig const& config )
+    //         :   EventListenerBase( config ) {
+    //             subscribeTo( Catch::ListenerEvents::TestCase );
+    //         }
+    //         void testCaseEnded( Catch::TestCaseStats const& stats ) override;
+    //     };
+    //     CATCH_REGISTER_LISTENER( Timings )
+    struct EventListenerBase : IStreamingReporter {
+        EventListenerBase( ReporterConfig const& ) {
+            // A listener overriding assertionStarting re-enables this in
+            // its own constructor
+            m_preferences.shouldReportAssertionStarting = false;
+            m_preferences.shouldReportAllAssertions = true;
+        }
+
+        ReporterPreferences getPreferences() const override {
+            return m_preferences;
+        }
+
+        void noMatchingTestCases( std::string const& ) override {}
+
+        void testRunStarting( TestRunInfo const& ) override {}
+        void testGroupStarting( GroupInfo const& ) override {}
+        void testCaseStarting( TestCaseInfo const& ) override {}
+        void sectionStarting( SectionInfo const& ) override {}
+
+        void assertionStarting( AssertionInfo const& ) override {}
+        bool assertionEnded( AssertionStats const& ) override {
+            return false;
+        }
+
+        void sectionEnded( SectionStats const& ) override {}
+        void testCaseEnded( TestCaseStats const& ) override {}
+        void testGroupEnded( TestGroupStats const& ) override {}
+        void testRunEnded( TestRunStats const& ) override {}
+
+        void skipTest( TestCaseInfo const& ) override {}
+
+    protected:
+        // Restricts delivery to the given ListenerEvents flags
+        void subscribeTo( unsigned int eventMask ) {
+            m_preferences.subscribedEvents = eventMask;
+        }
+
+        ReporterPreferences m_preferences;
+    };
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_EVENT_LISTENER_H_INCLUDED
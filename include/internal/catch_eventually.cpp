@@ -0,0 +1,40 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_eventually.h"
+
+#include <chrono>
+#include <thread>
+
+namespace Catch {
+
+    namespace {
+        constexpr double initialBackoffSeconds = 1e-6;
+        constexpr double maxBackoffSeconds = 1e-3;
+    }
+
+    EventuallyPoller::EventuallyPoller( double timeoutSeconds )
+    :   m_timeoutSeconds( timeoutSeconds ),
+        m_backoffSeconds( initialBackoffSeconds )
+    {
+        m_timer.start();
+    }
+
+    auto EventuallyPoller::wait() -> bool {
+        auto remaining = m_timeoutSeconds - m_timer.getElapsedSeconds();
+        if( remaining <= 0 )
+            return false;
+        auto sleepFor = m_backoffSeconds < remaining ? m_backoffSeconds : remaining;
+        std::this_thread::sleep_for( std::chrono::duration<double>( sleepFor ) );
+        if( m_backoffSeconds < maxBackoffSeconds )
+            m_backoffSeconds *= 2;
+        return true;
+    }
+
+    auto EventuallyPoller::elapsedSeconds() const -> double {
+        return m_timer.getElapsedSeconds();
+    }
+
+} // end namespace Catch
@@ -0,0 +1,34 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_EVENTUALLY_H_INCLUDED
+#define TWOBLUECUBES_CATCH_EVENTUALLY_H_INCLUDED
+
+#include "catch_timer.h"
+
+namespace Catch {
+
+    // Drives REQUIRE_EVENTUALLY's re-evaluation loop: each wait() sleeps
+    // with exponential backoff, starting at a microsecond and doubling up
+    // to a millisecond cap, and returns false once the timeout budget is
+    // spent. The condition is thus retried almost immediately at first -
+    // succeeding the moment it holds - while a genuinely slow condition
+    // costs at most ~a millisecond of overshoot per poll.
+    class EventuallyPoller {
+    public:
+        explicit EventuallyPoller( double timeoutSeconds );
+
+        // Sleeps before the next evaluation; false once the budget is spent
+        auto wait() -> bool;
+        auto elapsedSeconds() const -> double;
+
+    private:
+        Timer m_timer;
+        double m_timeoutSeconds;
+        double m_backoffSeconds;
+    };
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_EVENTUALLY_H_INCLUDED
@@ -22,6 +22,10 @@ namespace Catch {
 
     void ExceptionTranslatorRegistry::registerTranslator( const IExceptionTranslator* translator ) {
         m_translators.push_back( std::unique_ptr<const IExceptionTranslator>( translator ) );
+#if defined(CATCH_CONFIG_RTTI)
+        if( auto type = translator->translatedType() )
+            m_translatorsByType.emplace( std::type_index( *type ), translator );
+#endif
     }
 
 #if !defined(CATCH_CONFIG_DISABLE_EXCEPTIONS)
@@ -77,7 +81,25 @@ namespace Catch {
     std::string ExceptionTranslatorRegistry::tryTranslators() const {
         if( m_translators.empty() )
             std::rethrow_exception(std::current_exception());
-        else
-            return m_translators[0]->translate( m_translators.begin()+1, m_translators.end() );
+
+#if defined(CATCH_CONFIG_RTTI) && !defined(CATCH_CONFIG_DISABLE_EXCEPTIONS)
+        // Walking the chain costs a rethrow per registered translator, so
+        // look the exact dynamic type up first and go straight to its
+        // translator. Exceptions not derived from std::exception, and types
+        // only a base-class translator can handle, fall through to the chain.
+        if( !m_translatorsByType.empty() ) {
+            try {
+                std::rethrow_exception(std::current_exception());
+            }
+            catch( std::exception& ex ) {
+                auto it = m_translatorsByType.find( std::type_index( typeid( ex ) ) );
+                if( it != m_translatorsByType.end() )
+                    return it->second->translate( m_translators.end(), m_translators.end() );
+            }
+            catch( ... ) {}
+        }
+#endif
+
+        return m_translators[0]->translate( m_translators.begin()+1, m_translators.end() );
     }
 }
@@ -13,6 +13,11 @@
 #include <string>
 #include <memory>
 
+#if defined(CATCH_CONFIG_RTTI)
+#include <typeindex>
+#include <unordered_map>
+#endif
+
 namespace Catch {
 
     class ExceptionTranslatorRegistry : public IExceptionTranslatorRegistry {
@@ -24,6 +29,12 @@ namespace Catch {
 
     private:
         std::vector<std::unique_ptr<IExceptionTranslator const>> m_translators;
+#if defined(CATCH_CONFIG_RTTI)
+        // First-registered translator for each exact exception type, so
+        // translation of a std::exception-derived type is a hash lookup and
+        // a single rethrow rather than a rethrow per registered translator
+        std::unordered_map<std::type_index, IExceptionTranslator const*> m_translatorsByType;
+#endif
     };
 }
 
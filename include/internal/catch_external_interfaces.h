@@ -9,6 +9,7 @@
 
 #include "../reporters/catch_reporter_bases.hpp"
 #include "catch_console_colour.h"
+#include "catch_event_listener.h"
 #include "catch_reporter_registrars.hpp"
 
 // Allow users to base their work off existing reporters
@@ -0,0 +1,29 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_failure_cache.h"
+
+#include <fstream>
+
+namespace Catch {
+
+    FailedTests loadFailedTests( std::string const& cacheFile ) {
+        FailedTests failed;
+        std::ifstream f( cacheFile.c_str() );
+        std::string line;
+        while( std::getline( f, line ) ) {
+            if( !line.empty() )
+                failed.insert( line );
+        }
+        return failed;
+    }
+
+    void saveFailedTests( std::string const& cacheFile, FailedTests const& failed ) {
+        std::ofstream f( cacheFile.c_str() );
+        for( auto const& name : failed )
+            f << name << '\n';
+    }
+
+} // end namespace Catch
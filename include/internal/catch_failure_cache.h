@@ -0,0 +1,25 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_FAILURE_CACHE_H_INCLUDED
+#define TWOBLUECUBES_CATCH_FAILURE_CACHE_H_INCLUDED
+
+#include <set>
+#include <string>
+
+namespace Catch {
+
+    // Names of the test cases that failed on a previous run
+    using FailedTests = std::set<std::string>;
+
+    // Reads a failure cache previously written by saveFailedTests.
+    // Returns an empty set if the file does not exist or cannot be read.
+    FailedTests loadFailedTests( std::string const& cacheFile );
+
+    // Persists the failed test names, one per line
+    void saveFailedTests( std::string const& cacheFile, FailedTests const& failed );
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_FAILURE_CACHE_H_INCLUDED
@@ -9,9 +9,15 @@
 
 #include "catch_fatal_condition.h"
 
+#include "catch_checkpoint.h"
 #include "catch_context.h"
+#include "catch_crash_context.h"
 #include "catch_interfaces_capture.h"
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
+
 #if defined(__GNUC__)
 #    pragma GCC diagnostic push
 #    pragma GCC diagnostic ignored "-Wmissing-field-initializers"
@@ -20,8 +26,16 @@
 #if defined( CATCH_CONFIG_WINDOWS_SEH ) || defined( CATCH_CONFIG_POSIX_SIGNALS )
 
 namespace {
-    // Report the error condition
+    // Report the error condition. The crash site was pre-formatted at
+    // test case/section entry, so writing it needs nothing but write(2)
+    // and always gets out. Everything after that - reporters, string
+    // building, stream flushes - is best effort: it usually works, but
+    // a crash that corrupted the heap can hang or recurse in it.
     void reportFatal( char const * const message ) {
+        Catch::writeCrashContext( message );
+        // CHECKPOINT breadcrumbs are plain thread-local words too, so the
+        // crashing thread's trail also gets out with just write(2)
+        Catch::writeCheckpointsRaw();
         Catch::getCurrentContext().getResultCapture()->handleFatalErrorCondition( message );
     }
 }
@@ -54,24 +68,44 @@ namespace Catch {
         return EXCEPTION_CONTINUE_SEARCH;
     }
 
+    namespace {
+        // The vectored exception handler is process wide; it is installed
+        // by the first live FatalConditionHandler (workers under --jobs
+        // each construct one per test, concurrently) and removed by the
+        // last. The stack guarantee is per thread.
+        std::mutex g_installMutex;
+        int g_installCount = 0;
+        PVOID g_exceptionHandlerHandle = nullptr;
+        thread_local ULONG t_guaranteeSize = 0;
+    }
+
     FatalConditionHandler::FatalConditionHandler() {
-        isSet = true;
         // 32k seems enough for Catch to handle stack overflow,
         // but the value was found experimentally, so there is no strong guarantee
-        guaranteeSize = 32 * 1024;
-        exceptionHandlerHandle = nullptr;
-        // Register as first handler in current chain
-        exceptionHandlerHandle = AddVectoredExceptionHandler(1, handleVectoredException);
+        t_guaranteeSize = 32 * 1024;
         // Pass in guarantee size to be filled
-        SetThreadStackGuarantee(&guaranteeSize);
+        SetThreadStackGuarantee(&t_guaranteeSize);
+        {
+            std::lock_guard<std::mutex> lock(g_installMutex);
+            if (g_installCount++ == 0) {
+                // Register as first handler in current chain
+                g_exceptionHandlerHandle = AddVectoredExceptionHandler(1, handleVectoredException);
+            }
+        }
+        m_engaged = true;
     }
 
     void FatalConditionHandler::reset() {
-        if (isSet) {
-            RemoveVectoredExceptionHandler(exceptionHandlerHandle);
-            SetThreadStackGuarantee(&guaranteeSize);
-            exceptionHandlerHandle = nullptr;
-            isSet = false;
+        if (m_engaged) {
+            {
+                std::lock_guard<std::mutex> lock(g_installMutex);
+                if (--g_installCount == 0) {
+                    RemoveVectoredExceptionHandler(g_exceptionHandlerHandle);
+                    g_exceptionHandlerHandle = nullptr;
+                }
+            }
+            SetThreadStackGuarantee(&t_guaranteeSize);
+            m_engaged = false;
         }
     }
 
@@ -79,11 +113,6 @@ namespace Catch {
         reset();
     }
 
-bool FatalConditionHandler::isSet = false;
-ULONG FatalConditionHandler::guaranteeSize = 0;
-PVOID FatalConditionHandler::exceptionHandlerHandle = nullptr;
-
-
 } // namespace Catch
 
 #elif defined( CATCH_CONFIG_POSIX_SIGNALS )
@@ -97,7 +126,9 @@ namespace Catch {
     
     // 32kb for the alternate stack seems to be sufficient. However, this value
     // is experimentally determined, so that's not guaranteed.
-    constexpr static std::size_t sigStackSize = 32768 >= MINSIGSTKSZ ? 32768 : MINSIGSTKSZ;
+    // Since glibc 2.34, MINSIGSTKSZ is no longer a compile-time constant, so
+    // the stack size has to be determined (and allocated) at runtime.
+    constexpr static std::size_t minStackSizeForErrors = 32 * 1024;
 
     static SignalDefs signalDefs[] = {
         { SIGINT,  "SIGINT - Terminal interrupt signal" },
@@ -109,6 +140,23 @@ namespace Catch {
     };
 
 
+    namespace {
+        // Signal dispositions are process wide, so they are installed by
+        // the first live FatalConditionHandler (workers under --jobs each
+        // construct one per test, concurrently) and restored by the last
+        std::mutex g_installMutex;
+        int g_installCount = 0;
+        struct sigaction g_oldSigActions[sizeof(signalDefs)/sizeof(SignalDefs)] = {};
+
+        // The alternate signal stack, in contrast, is per thread: every
+        // thread that runs tests installs one of its own. The buffer is
+        // allocated once per thread and reused across tests; it is
+        // released when the thread exits.
+        thread_local std::unique_ptr<char[]> t_altStackMem;
+        thread_local std::size_t t_altStackSize = 0;
+        thread_local stack_t t_oldSigStack = {};
+    }
+
     void FatalConditionHandler::handleSignal( int sig ) {
         char const * name = "<unknown signal>";
         for (auto const& def : signalDefs) {
@@ -117,25 +165,40 @@ namespace Catch {
                 break;
             }
         }
-        reset();
+        // Restore the original dispositions and this thread's signal
+        // stack directly - no locking in a signal handler. The re-raise
+        // below ends the process, so the refcount no longer matters.
+        for (std::size_t i = 0; i < sizeof(signalDefs)/sizeof(SignalDefs); ++i) {
+            sigaction(signalDefs[i].id, &g_oldSigActions[i], nullptr);
+        }
+        sigaltstack(&t_oldSigStack, nullptr);
         reportFatal(name);
         raise( sig );
     }
 
     FatalConditionHandler::FatalConditionHandler() {
-        isSet = true;
+        if (t_altStackSize == 0) {
+            t_altStackSize = std::max(static_cast<std::size_t>(MINSIGSTKSZ), minStackSizeForErrors);
+        }
+        if (!t_altStackMem) {
+            t_altStackMem.reset(new char[t_altStackSize]());
+        }
         stack_t sigStack;
-        sigStack.ss_sp = altStackMem;
-        sigStack.ss_size = sigStackSize;
+        sigStack.ss_sp = t_altStackMem.get();
+        sigStack.ss_size = t_altStackSize;
         sigStack.ss_flags = 0;
-        sigaltstack(&sigStack, &oldSigStack);
-        struct sigaction sa = { };
-
-        sa.sa_handler = handleSignal;
-        sa.sa_flags = SA_ONSTACK;
-        for (std::size_t i = 0; i < sizeof(signalDefs)/sizeof(SignalDefs); ++i) {
-            sigaction(signalDefs[i].id, &sa, &oldSigActions[i]);
+        sigaltstack(&sigStack, &t_oldSigStack);
+
+        std::lock_guard<std::mutex> lock(g_installMutex);
+        if (g_installCount++ == 0) {
+            struct sigaction sa = { };
+            sa.sa_handler = handleSignal;
+            sa.sa_flags = SA_ONSTACK;
+            for (std::size_t i = 0; i < sizeof(signalDefs)/sizeof(SignalDefs); ++i) {
+                sigaction(signalDefs[i].id, &sa, &g_oldSigActions[i]);
+            }
         }
+        m_engaged = true;
     }
 
 
@@ -144,23 +207,22 @@ namespace Catch {
     }
 
     void FatalConditionHandler::reset() {
-        if( isSet ) {
-            // Set signals back to previous values -- hopefully nobody overwrote them in the meantime
-            for( std::size_t i = 0; i < sizeof(signalDefs)/sizeof(SignalDefs); ++i ) {
-                sigaction(signalDefs[i].id, &oldSigActions[i], nullptr);
+        if( m_engaged ) {
+            {
+                std::lock_guard<std::mutex> lock(g_installMutex);
+                if (--g_installCount == 0) {
+                    // Set signals back to previous values -- hopefully nobody overwrote them in the meantime
+                    for( std::size_t i = 0; i < sizeof(signalDefs)/sizeof(SignalDefs); ++i ) {
+                        sigaction(signalDefs[i].id, &g_oldSigActions[i], nullptr);
+                    }
+                }
             }
-            // Return the old stack
-            sigaltstack(&oldSigStack, nullptr);
-            isSet = false;
+            // Return this thread's old stack
+            sigaltstack(&t_oldSigStack, nullptr);
+            m_engaged = false;
         }
     }
 
-    bool FatalConditionHandler::isSet = false;
-    struct sigaction FatalConditionHandler::oldSigActions[sizeof(signalDefs)/sizeof(SignalDefs)] = {};
-    stack_t FatalConditionHandler::oldSigStack = {};
-    char FatalConditionHandler::altStackMem[sigStackSize] = {};
-
-
 } // namespace Catch
 
 #else
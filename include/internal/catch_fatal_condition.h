@@ -18,17 +18,20 @@
 
 namespace Catch {
 
+    // One handler is constructed per test per worker thread (see
+    // runCurrentTest), so the process-wide pieces - the vectored
+    // exception handler here, the signal dispositions on POSIX - are
+    // refcounted and installed only by the first live instance; each
+    // instance owns its per-thread state itself.
     struct FatalConditionHandler {
 
         static LONG CALLBACK handleVectoredException(PEXCEPTION_POINTERS ExceptionInfo);
         FatalConditionHandler();
-        static void reset();
+        void reset();
         ~FatalConditionHandler();
 
     private:
-        static bool isSet;
-        static ULONG guaranteeSize;
-        static PVOID exceptionHandlerHandle;
+        bool m_engaged = false;
     };
 
 } // namespace Catch
@@ -36,21 +39,26 @@ namespace Catch {
 #elif defined ( CATCH_CONFIG_POSIX_SIGNALS )
 
 #include <signal.h>
+#include <cstddef>
 
 namespace Catch {
 
+    // One handler is constructed per test per worker thread (see
+    // runCurrentTest). Signal dispositions are process wide, so they are
+    // refcounted and installed only by the first live instance; the
+    // alternate signal stack is per thread, so every instance installs
+    // one for its own thread (the buffer is thread local and reused
+    // across tests).
     struct FatalConditionHandler {
 
-        static bool isSet;
-        static struct sigaction oldSigActions[];
-        static stack_t oldSigStack;
-        static char altStackMem[];
-
         static void handleSignal( int sig );
 
         FatalConditionHandler();
         ~FatalConditionHandler();
-        static void reset();
+        void reset();
+
+    private:
+        bool m_engaged = false;
     };
 
 } // namespace Catch
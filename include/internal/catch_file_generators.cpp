@@ -0,0 +1,172 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_file_generators.h"
+#include "catch_enforce.h"
+#include "catch_platform.h"
+
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#if defined(CATCH_PLATFORM_LINUX) || defined(CATCH_PLATFORM_MAC)
+#define CATCH_INTERNAL_CONFIG_USE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Catch {
+namespace Generators {
+
+    namespace {
+
+        // One read-only mapping of a data file plus an index of its line
+        // boundaries, built once; every generator over the same path
+        // co-owns the same instance.
+        class FileDataSource {
+        public:
+            explicit FileDataSource( std::string const& path ) : m_path( path ) {
+                load();
+                indexLines();
+            }
+            ~FileDataSource() {
+                unmap();
+            }
+
+            FileDataSource( FileDataSource const& ) = delete;
+            FileDataSource& operator=( FileDataSource const& ) = delete;
+
+            auto lineCount() const -> std::size_t { return m_lines.size(); }
+            auto line( std::size_t index ) const -> StringRef { return m_lines[index]; }
+
+        private:
+            void load() {
+#if defined(CATCH_INTERNAL_CONFIG_USE_MMAP)
+                int fd = ::open( m_path.c_str(), O_RDONLY );
+                CATCH_ENFORCE( fd != -1, "Unable to open data file '" << m_path << "'" );
+                struct stat fileInfo;
+                CATCH_ENFORCE( ::fstat( fd, &fileInfo ) == 0, "Unable to stat data file '" << m_path << "'" );
+                if( fileInfo.st_size == 0 ) {
+                    ::close( fd );
+                    return;
+                }
+                auto size = static_cast<std::size_t>( fileInfo.st_size );
+                auto* mapping = ::mmap( nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+                ::close( fd );
+                CATCH_ENFORCE( mapping != MAP_FAILED, "Unable to map data file '" << m_path << "'" );
+                m_mapping = mapping;
+                m_data = static_cast<char const*>( mapping );
+                m_size = size;
+#else
+                std::ifstream file( m_path, std::ios::binary );
+                CATCH_ENFORCE( file, "Unable to open data file '" << m_path << "'" );
+                m_buffer.assign( std::istreambuf_iterator<char>( file ), std::istreambuf_iterator<char>() );
+                m_data = m_buffer.data();
+                m_size = m_buffer.size();
+#endif
+            }
+
+            void unmap() {
+#if defined(CATCH_INTERNAL_CONFIG_USE_MMAP)
+                if( m_mapping )
+                    ::munmap( m_mapping, m_size );
+                m_mapping = nullptr;
+#endif
+            }
+
+            // Lines exclude the terminator; a CR before the LF is dropped
+            // too so CRLF files index the same as LF ones. A trailing
+            // newline does not produce an empty final line.
+            void indexLines() {
+                std::size_t lineStart = 0;
+                for( std::size_t pos = 0; pos < m_size; ++pos ) {
+                    if( m_data[pos] == '\n' ) {
+                        auto lineEnd = pos;
+                        if( lineEnd > lineStart && m_data[lineEnd-1] == '\r' )
+                            --lineEnd;
+                        m_lines.push_back( StringRef( m_data + lineStart, lineEnd - lineStart ) );
+                        lineStart = pos + 1;
+                    }
+                }
+                if( lineStart < m_size )
+                    m_lines.push_back( StringRef( m_data + lineStart, m_size - lineStart ) );
+            }
+
+            std::string m_path;
+            char const* m_data = nullptr;
+            std::size_t m_size = 0;
+            std::vector<StringRef> m_lines;
+#if defined(CATCH_INTERNAL_CONFIG_USE_MMAP)
+            void* m_mapping = nullptr;
+#else
+            std::vector<char> m_buffer;
+#endif
+        };
+
+        // Mutexed because generator expressions run on concurrent --jobs
+        // workers; the map itself keeps each file mapped once per run
+        auto sourceFor( std::string const& path ) -> std::shared_ptr<FileDataSource> {
+            static std::mutex s_mutex;
+            static std::map<std::string, std::shared_ptr<FileDataSource>> s_sources;
+            std::lock_guard<std::mutex> lock( s_mutex );
+            auto& source = s_sources[path];
+            if( !source )
+                source = std::make_shared<FileDataSource>( path );
+            return source;
+        }
+
+        class FileLineGenerator : public IGenerator<StringRef> {
+            std::shared_ptr<FileDataSource> m_source;
+        public:
+            FileLineGenerator( std::shared_ptr<FileDataSource> source )
+            :   m_source( std::move( source ) )
+            {}
+
+            auto get( size_t index ) const -> StringRef override {
+                return m_source->line( index );
+            }
+        };
+
+        class CsvRowGenerator : public IGenerator<std::vector<StringRef>> {
+            std::shared_ptr<FileDataSource> m_source;
+        public:
+            CsvRowGenerator( std::shared_ptr<FileDataSource> source )
+            :   m_source( std::move( source ) )
+            {}
+
+            auto get( size_t index ) const -> std::vector<StringRef> override {
+                auto row = m_source->line( index );
+                std::vector<StringRef> fields;
+                std::size_t fieldStart = 0;
+                for( std::size_t pos = 0; pos < row.size(); ++pos ) {
+                    if( row[pos] == ',' ) {
+                        fields.push_back( row.substr( fieldStart, pos - fieldStart ) );
+                        fieldStart = pos + 1;
+                    }
+                }
+                fields.push_back( row.substr( fieldStart, row.size() - fieldStart ) );
+                return fields;
+            }
+        };
+
+    } // anon namespace
+
+    auto fileLines( std::string const& path ) -> Generator<StringRef> {
+        auto source = sourceFor( path );
+        auto size = source->lineCount();
+        return Generator<StringRef>( size, pf::make_unique<FileLineGenerator>( std::move( source ) ) );
+    }
+
+    auto csvRows( std::string const& path ) -> Generator<std::vector<StringRef>> {
+        auto source = sourceFor( path );
+        auto size = source->lineCount();
+        return Generator<std::vector<StringRef>>( size, pf::make_unique<CsvRowGenerator>( std::move( source ) ) );
+    }
+
+} // namespace Generators
+} // namespace Catch
@@ -0,0 +1,36 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_FILE_GENERATORS_H_INCLUDED
+#define TWOBLUECUBES_CATCH_FILE_GENERATORS_H_INCLUDED
+
+#include "catch_generators.hpp"
+#include "catch_stringref.h"
+
+#include <string>
+#include <vector>
+
+namespace Catch {
+namespace Generators {
+
+    // Data-driven generators backed by a file that is memory-mapped (read
+    // into one buffer on platforms without mmap) once per run, however many
+    // generators and section re-entries use it. The yielded values are
+    // views into the mapping, so megabyte data sets are never copied into
+    // test bodies. The mapping is co-owned by each generator, whose
+    // lifetime the generator tracker manages as usual.
+
+    // Yields one StringRef per line of the file, excluding the line
+    // terminator (LF or CRLF). No per-value allocation at all.
+    auto fileLines( std::string const& path ) -> Generator<StringRef>;
+
+    // Yields each line split on commas, one StringRef per field. Quoting is
+    // not interpreted. The vector of refs is the only per-value allocation;
+    // the field text itself is never copied.
+    auto csvRows( std::string const& path ) -> Generator<std::vector<StringRef>>;
+
+} // namespace Generators
+} // namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_FILE_GENERATORS_H_INCLUDED
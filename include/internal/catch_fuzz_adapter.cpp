@@ -0,0 +1,95 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_fuzz_adapter.h"
+#include "catch_config.hpp"
+#include "catch_context.h"
+#include "catch_enforce.h"
+#include "catch_interfaces_registry_hub.h"
+#include "catch_interfaces_testcase.h"
+#include "catch_run_context.h"
+#include "catch_stream.h"
+#include "catch_test_case_info.h"
+#include "../reporters/catch_reporter_bases.hpp"
+
+#include <cstdlib>
+#include <ostream>
+
+namespace Catch {
+
+    namespace {
+
+        FuzzInput currentInput = { nullptr, 0 };
+
+        // Discards everything except failed assertions, which go to
+        // stderr so a crashing input is triagable from the fuzzer log
+        struct FuzzReporter : TestEventListenerBase {
+            using TestEventListenerBase::TestEventListenerBase;
+
+            bool assertionEnded( AssertionStats const& stats ) override {
+                auto const& result = stats.assertionResult;
+                if( !result.isOk() ) {
+                    Catch::cerr() << result.getSourceInfo() << ": FAILED";
+                    if( result.hasExpression() )
+                        Catch::cerr() << ": " << result.getExpressionInMacro();
+                    if( result.hasMessage() )
+                        Catch::cerr() << " with message: '" << result.getMessage() << "'";
+                    Catch::cerr() << '\n';
+                }
+                return true;
+            }
+        };
+
+        struct NullBuf : std::streambuf {};
+
+        // One-time setup shared by every iteration: a default config and
+        // a persistent run context whose per-test tracking is reset by
+        // each runTest call
+        struct FuzzState {
+            std::shared_ptr<Config> config;
+            NullBuf nullBuf;
+            std::ostream nullStream;
+            RunContext runContext;
+
+            FuzzState()
+            :   config( std::make_shared<Config>( ConfigData() ) ),
+                nullStream( &nullBuf ),
+                runContext( config, IStreamingReporterPtr( new FuzzReporter( ReporterConfig( config, nullStream ) ) ) )
+            {}
+        };
+
+        TestCase const* findTest( char const* testName ) {
+            for( auto const& testCase : getRegistryHub().getTestCaseRegistry().getAllTests() )
+                if( testCase.name == testName )
+                    return &testCase;
+            CATCH_ENFORCE( false, "No test case named '" << testName << "' is registered" );
+            return nullptr;
+        }
+
+    } // end anonymous namespace
+
+    FuzzInput const& currentFuzzInput() {
+        return currentInput;
+    }
+
+    int fuzzTestCase( char const* testName, unsigned char const* data, std::size_t size ) {
+        static FuzzState state;
+        static TestCase const* testCase = nullptr;
+        if( !testCase || testCase->name != testName )
+            testCase = findTest( testName );
+
+        currentInput = { data, size };
+        auto totals = state.runContext.runTest( *testCase );
+        currentInput = { nullptr, 0 };
+
+        if( totals.testCases.failed > 0 ) {
+            Catch::cerr() << "Fuzzed test case '" << testName << "' failed for a "
+                          << size << " byte input" << std::endl;
+            std::abort(); // lets the fuzzer record the input
+        }
+        return 0;
+    }
+
+} // end namespace Catch
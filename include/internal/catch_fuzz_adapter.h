@@ -0,0 +1,31 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_FUZZ_ADAPTER_H_INCLUDED
+#define TWOBLUECUBES_CATCH_FUZZ_ADAPTER_H_INCLUDED
+
+#include <cstddef>
+
+namespace Catch {
+
+    // The bytes the fuzzer handed to the current iteration; only valid
+    // inside a test body being driven through fuzzTestCase
+    struct FuzzInput {
+        unsigned char const* data;
+        std::size_t size;
+    };
+    FuzzInput const& currentFuzzInput();
+
+    // Runs the named test case against one fuzzer-provided input, in
+    // process. The registry, config and run context are set up once, on
+    // the first call; each iteration only pays for the test run itself.
+    // Returns 0 so it can be called straight from an
+    // LLVMFuzzerTestOneInput entry point; a failed assertion prints the
+    // failure to stderr and aborts, which is how fuzzers record an
+    // interesting input.
+    int fuzzTestCase( char const* testName, unsigned char const* data, std::size_t size );
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_FUZZ_ADAPTER_H_INCLUDED
@@ -20,17 +20,23 @@ namespace Generators {
 
     GeneratorBase::~GeneratorBase() {}
 
+    auto nextGeneratorSeed() -> std::uint64_t {
+        static SimplePcg32 s_seedStream( rngSeed() );
+        return pcgNext64( s_seedStream );
+    }
+
     std::vector<size_t> randomiseIndices( size_t selectionSize, size_t sourceSize ) {
 
         assert( selectionSize <= sourceSize );
         std::vector<size_t> indices;
         indices.reserve( selectionSize );
-        std::uniform_int_distribution<size_t> uid( 0, sourceSize-1 );
+        SimplePcg32 pcg( nextGeneratorSeed() );
 
         std::set<size_t> seen;
         // !TBD: improve this algorithm
         while( indices.size() < selectionSize ) {
-            auto index = uid( rng() );
+            auto bits = pcgNext64( pcg );
+            auto index = static_cast<size_t>( bits % sourceSize ); // modulo bias is harmless for test data
             if( seen.insert( index ).second )
                 indices.push_back( index );
         }
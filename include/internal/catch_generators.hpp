@@ -10,10 +10,13 @@
 #include "catch_interfaces_generatortracker.h"
 #include "catch_common.h"
 #include "catch_enforce.h"
+#include "catch_random_number_generator.h"
 
 #include <memory>
 #include <vector>
 #include <cassert>
+#include <cstdint>
+#include <type_traits>
 
 #include <utility>
 
@@ -117,6 +120,109 @@ namespace Generators {
         }
     };
 
+    // Seeds for the random generators below, drawn from a shared PCG
+    // stream that is itself seeded from the run's --rng-seed
+    auto nextGeneratorSeed() -> std::uint64_t;
+
+    // The random generators derive value i purely from their seed and i:
+    // sequential access just advances the engine, while anything else
+    // (such as the tracker revisiting an index) reseeds and fast-forwards.
+    // Either way the same index always yields the same value, so a failing
+    // case replays exactly under the same --rng-seed.
+    template<typename Integer>
+    class RandomIntegerGenerator : public IGenerator<Integer> {
+        Integer m_lo, m_hi;
+        std::uint64_t m_seed;
+        mutable SimplePcg32 m_pcg;
+        mutable size_t m_nextIndex;
+    public:
+        RandomIntegerGenerator( Integer lo, Integer hi, std::uint64_t seed )
+        :   m_lo( lo ),
+            m_hi( hi ),
+            m_seed( seed ),
+            m_pcg( seed ),
+            m_nextIndex( 0 )
+        {}
+
+        auto get( size_t index ) const -> Integer override {
+            if( index < m_nextIndex ) {
+                m_pcg.seed( m_seed );
+                m_nextIndex = 0;
+            }
+            std::uint64_t bits = 0;
+            while( m_nextIndex <= index ) {
+                bits = pcgNext64( m_pcg );
+                ++m_nextIndex;
+            }
+            auto rangeSize = static_cast<std::uint64_t>( static_cast<std::int64_t>( m_hi ) - static_cast<std::int64_t>( m_lo ) ) + 1;
+            if( rangeSize == 0 ) // the full width of the type
+                return static_cast<Integer>( bits );
+            return static_cast<Integer>( m_lo + static_cast<Integer>( bits % rangeSize ) ); // modulo bias is harmless for test data
+        }
+    };
+
+    template<typename Float>
+    class RandomFloatingGenerator : public IGenerator<Float> {
+        Float m_lo, m_hi;
+        std::uint64_t m_seed;
+        mutable SimplePcg32 m_pcg;
+        mutable size_t m_nextIndex;
+    public:
+        RandomFloatingGenerator( Float lo, Float hi, std::uint64_t seed )
+        :   m_lo( lo ),
+            m_hi( hi ),
+            m_seed( seed ),
+            m_pcg( seed ),
+            m_nextIndex( 0 )
+        {}
+
+        auto get( size_t index ) const -> Float override {
+            if( index < m_nextIndex ) {
+                m_pcg.seed( m_seed );
+                m_nextIndex = 0;
+            }
+            std::uint64_t bits = 0;
+            while( m_nextIndex <= index ) {
+                bits = pcgNext64( m_pcg );
+                ++m_nextIndex;
+            }
+            auto unit = static_cast<double>( bits >> 11 ) * ( 1.0 / 9007199254740992.0 ); // [0,1)
+            return static_cast<Float>( m_lo + unit * ( m_hi - m_lo ) );
+        }
+    };
+
+    template<typename T>
+    class TakeGenerator : public IGenerator<T> {
+        Generator<T> m_baseGenerator;
+    public:
+        TakeGenerator( Generator<T>&& baseGenerator )
+        :   m_baseGenerator( std::move( baseGenerator ) )
+        {}
+
+        auto get( size_t index ) const -> T override {
+            return m_baseGenerator[index];
+        }
+    };
+
+    template<typename T>
+    class ChunkGenerator : public IGenerator<std::vector<T>> {
+        Generator<T> m_baseGenerator;
+        size_t m_chunkSize;
+    public:
+        ChunkGenerator( size_t chunkSize, Generator<T>&& baseGenerator )
+        :   m_baseGenerator( std::move( baseGenerator ) ),
+            m_chunkSize( chunkSize )
+        {}
+
+        auto get( size_t index ) const -> std::vector<T> override {
+            std::vector<T> chunk;
+            chunk.reserve( m_chunkSize );
+            for( size_t i = 0; i < m_chunkSize; ++i )
+                chunk.push_back( m_baseGenerator[index*m_chunkSize + i] );
+            return chunk;
+        }
+    };
+
     template<typename T>
     struct RequiresASpecialisationFor;
 
@@ -144,6 +250,31 @@ namespace Generators {
         return Generator<T>( size, pf::make_unique<GeneratorRandomiser<T>>( all<T>(), size ) );
     }
 
+    // Unlike the two argument form, which yields every value in the range
+    // once in shuffled order, this samples the (inclusive) range - values
+    // can repeat, and the range can be as wide as the type without any
+    // cost proportional to its width
+    template<typename T>
+    auto random( T lo, T hi, size_t size ) -> typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value, Generator<T>>::type {
+        return Generator<T>( size, pf::make_unique<RandomIntegerGenerator<T>>( lo, hi, nextGeneratorSeed() ) );
+    }
+    template<typename T>
+    auto random( T lo, T hi, size_t size ) -> typename std::enable_if<std::is_floating_point<T>::value, Generator<T>>::type {
+        return Generator<T>( size, pf::make_unique<RandomFloatingGenerator<T>>( lo, hi, nextGeneratorSeed() ) );
+    }
+
+    template<typename T>
+    auto take( size_t target, Generator<T>&& generator ) -> Generator<T> {
+        auto size = target < generator.size() ? target : generator.size();
+        return Generator<T>( size, pf::make_unique<TakeGenerator<T>>( std::move( generator ) ) );
+    }
+
+    template<typename T>
+    auto chunk( size_t chunkSize, Generator<T>&& generator ) -> Generator<std::vector<T>> {
+        assert( chunkSize > 0 );
+        return Generator<std::vector<T>>( generator.size() / chunkSize, pf::make_unique<ChunkGenerator<T>>( chunkSize, std::move( generator ) ) );
+    }
+
     template<typename T>
     auto values( std::initializer_list<T> values ) -> Generator<T> {
         return Generator<T>( values.size(), pf::make_unique<FixedValuesGenerator<T>>( values ) );
@@ -226,6 +357,33 @@ namespace Generators {
     }
 
 
+    // Yields successive batches of up to batchSize values from a whole
+    // generator expression, evaluating each batch lazily when its test
+    // entry asks for it. The last batch is shorter if the source does not
+    // divide evenly (unlike chunk, which drops the remainder).
+    template<typename T>
+    class BatchGenerator : public IGenerator<std::vector<T>> {
+        Generators<T> m_source;
+        size_t m_batchSize;
+    public:
+        BatchGenerator( Generators<T>&& source, size_t batchSize )
+        :   m_source( std::move( source ) ),
+            m_batchSize( batchSize )
+        {}
+
+        auto get( size_t index ) const -> std::vector<T> override {
+            auto from = index * m_batchSize;
+            auto to = from + m_batchSize;
+            if( to > m_source.size() )
+                to = m_source.size();
+            std::vector<T> batch;
+            batch.reserve( to - from );
+            for( auto i = from; i < to; ++i )
+                batch.push_back( m_source[i] );
+            return batch;
+        }
+    };
+
     auto acquireGeneratorTracker( SourceLineInfo const& lineInfo ) -> IGeneratorTracker&;
 
     template<typename L>
@@ -243,11 +401,107 @@ namespace Generators {
         return generator[tracker.getIndex()];
     }
 
+    // As generate(), but hands the body whole batches of values at once.
+    // Each advance of a generator replays the test body through a full
+    // tracker walk, so batching cuts that overhead by the batch factor -
+    // at the price that sections below no longer see one entry per value.
+    // A batchSize of 0 means everything in a single entry.
+    template<typename L>
+    auto generateBatched( SourceLineInfo const& lineInfo, size_t batchSize, L const& generatorExpression ) -> std::vector<typename decltype(generatorExpression())::type> {
+        using UnderlyingType = typename decltype(generatorExpression())::type;
+
+        IGeneratorTracker& tracker = acquireGeneratorTracker( lineInfo );
+        if( !tracker.hasGenerator() ) {
+            auto source = generatorExpression();
+            if( batchSize == 0 )
+                batchSize = source.size();
+            auto numberOfBatches = batchSize == 0 ? 0 : ( source.size() + batchSize - 1 ) / batchSize;
+            Generators<std::vector<UnderlyingType>> batched;
+            batched.populate( Generator<std::vector<UnderlyingType>>( numberOfBatches, pf::make_unique<BatchGenerator<UnderlyingType>>( std::move( source ), batchSize ) ) );
+            tracker.setGenerator( pf::make_unique<Generators<std::vector<UnderlyingType>>>( std::move( batched ) ) );
+        }
+
+        auto const& generator = static_cast<Generators<std::vector<UnderlyingType>> const&>( *tracker.getGenerator() );
+        return generator[tracker.getIndex()];
+    }
+
+    // Values materialised once into tracker-owned storage, then yielded
+    // by reference (see GENERATE_REF). The plain generate() path returns
+    // every value by copy, which is fine for ints but means a generator
+    // over multi-megabyte fixture objects copies one out per section
+    // pass. Here the whole value set is built exactly once, when the
+    // tracker first sees the generator, and each pass reads its element
+    // in place. The storage lives in the tracker, which outlives every
+    // pass through the test body, so the reference stays valid for the
+    // whole pass - but not beyond the test case, so don't stash it.
+    template<typename T>
+    class MaterialisedGenerators : public GeneratorBase {
+        std::vector<T> m_values;
+    public:
+        MaterialisedGenerators( Generators<T>&& source ) : GeneratorBase( source.size() ) {
+            m_values.reserve( m_size );
+            for( size_t i = 0; i < m_size; ++i )
+                m_values.push_back( source[i] ); // rvalue from operator[], so moved in
+        }
+
+        auto operator[]( size_t index ) const -> T const& {
+            assert( index < m_size );
+            return m_values[index];
+        }
+    };
+
+    // As generate(), but yields each value as a reference into storage
+    // owned by the tracker, so no copy is made per section pass
+    template<typename L>
+    auto generateByRef( SourceLineInfo const& lineInfo, L const& generatorExpression ) -> typename decltype(generatorExpression())::type const& {
+        using UnderlyingType = typename decltype(generatorExpression())::type;
+
+        IGeneratorTracker& tracker = acquireGeneratorTracker( lineInfo );
+        if( !tracker.hasGenerator() )
+            tracker.setGenerator( pf::make_unique<MaterialisedGenerators<UnderlyingType>>( generatorExpression() ) );
+
+        auto const& generator = static_cast<MaterialisedGenerators<UnderlyingType> const&>( *tracker.getGenerator() );
+        return generator[tracker.getIndex()];
+    }
+
+    // For value sets fully known at compile time there is nothing to
+    // allocate: the values sit in a static table and the tracker only
+    // carries the index through it (see GENERATE_STATIC)
+    template<typename T, std::size_t N>
+    auto generateFromTable( SourceLineInfo const& lineInfo, T const (&table)[N] ) -> T const& {
+        IGeneratorTracker& tracker = acquireGeneratorTracker( lineInfo );
+        if( !tracker.hasGenerator() )
+            tracker.setFixedSize( N );
+        return table[tracker.getIndex()];
+    }
+
 } // namespace Generators
 } // namespace Catch
 
 #define GENERATE( ... ) \
     Catch::Generators::generate( CATCH_INTERNAL_LINEINFO, []{ using namespace Catch::Generators; return makeGenerators( __VA_ARGS__ ); } )
 
+#define GENERATE_BATCHED( batchSize, ... ) \
+    Catch::Generators::generateBatched( CATCH_INTERNAL_LINEINFO, static_cast<size_t>( batchSize ), []{ using namespace Catch::Generators; return makeGenerators( __VA_ARGS__ ); } )
+
+// As GENERATE, but yields a reference to a value held by the tracker
+// instead of a copy - bind it with auto const&. For large element types
+// this makes parameterization free of per-pass copies.
+#define GENERATE_REF( ... ) \
+    Catch::Generators::generateByRef( CATCH_INTERNAL_LINEINFO, []{ using namespace Catch::Generators; return makeGenerators( __VA_ARGS__ ); } )
+
+#define GENERATE_ALL( ... ) \
+    Catch::Generators::generateBatched( CATCH_INTERNAL_LINEINFO, 0, []{ using namespace Catch::Generators; return makeGenerators( __VA_ARGS__ ); } )
+
+// As GENERATE( values({...}) ), but for literal data: the values become
+// a constexpr table in static storage, so iterating them allocates no
+// generator objects at all. The element type is spelled out because an
+// initializer list cannot deduce it through the macro.
+#define GENERATE_STATIC( Type, ... ) \
+    []( Catch::SourceLineInfo const& lineInfo ) -> Type const& { \
+        static constexpr Type generatorTable[] = { __VA_ARGS__ }; \
+        return Catch::Generators::generateFromTable( lineInfo, generatorTable ); \
+    }( CATCH_INTERNAL_LINEINFO )
+
 
 #endif // TWOBLUECUBES_CATCH_GENERATORS_HPP_INCLUDED
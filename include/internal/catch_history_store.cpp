@@ -0,0 +1,191 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_history_store.h"
+#include "catch_enforce.h"
+#include "catch_interfaces_config.h"
+#include "catch_platform.h"
+
+#include <cassert>
+#include <cstring>
+#include <ctime>
+#include <mutex>
+#include <vector>
+
+#if defined(CATCH_PLATFORM_LINUX) || defined(CATCH_PLATFORM_MAC)
+#define CATCH_INTERNAL_CONFIG_USE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Catch {
+
+    namespace {
+
+        std::uint64_t hashBytes( char const* data, std::size_t size ) {
+            // FNV-1a
+            std::uint64_t hash = 0xcbf29ce484222325ULL;
+            for( std::size_t i = 0; i < size; ++i ) {
+                hash ^= static_cast<unsigned char>( data[i] );
+                hash *= 0x100000001b3ULL;
+            }
+            return hash;
+        }
+
+        // The store is a single file: an 8 byte magic, then one record per
+        // completed test case run, back to back in native byte order. Each
+        // record is a fixed header followed by the test name bytes. The
+        // name travels with every record so the index can be rebuilt from
+        // the file alone; lookups go through the name hash, with the name
+        // bytes only compared on collision.
+        char const* const historyMagic = "CATCHHST";
+
+        struct RecordHeader {
+            std::uint64_t nameHash;
+            double durationSeconds;
+            std::int64_t timestamp;
+            std::uint32_t failed;
+            std::uint32_t nameSize;
+        };
+
+    } // end anonymous namespace
+
+    HistoryStore::HistoryStore( std::string const& path, OpenMode mode ) : m_path( path ) {
+        char const* data = nullptr;
+        std::size_t size = 0;
+#if defined(CATCH_INTERNAL_CONFIG_USE_MMAP)
+        void* mapping = nullptr;
+        int fd = ::open( m_path.c_str(), O_RDONLY );
+        if( fd != -1 ) {
+            struct stat fileInfo;
+            CATCH_ENFORCE( ::fstat( fd, &fileInfo ) == 0, "Unable to stat history store '" << m_path << "'" );
+            if( fileInfo.st_size > 0 ) {
+                size = static_cast<std::size_t>( fileInfo.st_size );
+                mapping = ::mmap( nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+                CATCH_ENFORCE( mapping != MAP_FAILED, "Unable to map history store '" << m_path << "'" );
+                data = static_cast<char const*>( mapping );
+            }
+            ::close( fd );
+        }
+#else
+        std::vector<char> buffer;
+        {
+            std::ifstream file( m_path, std::ios::binary );
+            if( file )
+                buffer.assign( std::istreambuf_iterator<char>( file ), std::istreambuf_iterator<char>() );
+        }
+        data = buffer.data();
+        size = buffer.size();
+#endif
+
+        if( size > 0 ) {
+            CATCH_ENFORCE( size >= 8 && std::memcmp( data, historyMagic, 8 ) == 0,
+                           "'" << m_path << "' is not a Catch history store" );
+            // Replay in file order so the newest record for each test wins
+            std::size_t pos = 8;
+            while( pos + sizeof( RecordHeader ) <= size ) {
+                RecordHeader header;
+                std::memcpy( &header, data + pos, sizeof( header ) );
+                pos += sizeof( header );
+                CATCH_ENFORCE( pos + header.nameSize <= size, "History store '" << m_path << "' is truncated" );
+                auto& history = m_index[header.nameHash];
+                history.name.assign( data + pos, header.nameSize );
+                history.lastDurationSeconds = header.durationSeconds;
+                history.lastRunTimestamp = header.timestamp;
+                ++history.runCount;
+                if( header.failed ) {
+                    ++history.consecutiveFailures;
+                    history.lastFailed = true;
+                }
+                else {
+                    history.consecutiveFailures = 0;
+                    history.lastFailed = false;
+                }
+                pos += header.nameSize;
+            }
+        }
+
+#if defined(CATCH_INTERNAL_CONFIG_USE_MMAP)
+        if( mapping )
+            ::munmap( mapping, size );
+#endif
+
+        if( mode == OpenMode::Append ) {
+            m_appender.open( m_path, std::ios::binary | std::ios::app );
+            CATCH_ENFORCE( m_appender, "Unable to open history store '" << m_path << "' for writing" );
+            // Several appenders can reach a fresh file at once (each
+            // --jobs worker appends through its own instance), so the file
+            // size is re-probed and the magic written under a lock - and
+            // flushed at once, so no later open can observe the file empty
+            // or with a buffered, unwritten magic
+            static std::mutex magicMutex;
+            std::lock_guard<std::mutex> lock( magicMutex );
+            std::ifstream probe( m_path, std::ios::binary | std::ios::ate );
+            if( !probe || probe.tellg() <= std::ifstream::pos_type( 0 ) ) {
+                m_appender.write( historyMagic, 8 );
+                m_appender.flush();
+                CATCH_ENFORCE( m_appender, "Unable to write to history store '" << m_path << "'" );
+            }
+        }
+    }
+
+    auto HistoryStore::find( std::string const& name ) const -> TestHistory const* {
+        auto it = m_index.find( hashBytes( name.data(), name.size() ) );
+        if( it == m_index.end() || it->second.name != name )
+            return nullptr;
+        return &it->second;
+    }
+
+    void HistoryStore::recordTestEnded( std::string const& name, double durationSeconds, bool failed ) {
+        assert( m_appender.is_open() && "recordTestEnded on a read-only history store" );
+        RecordHeader header = {
+            hashBytes( name.data(), name.size() ),
+            durationSeconds,
+            static_cast<std::int64_t>( std::time( nullptr ) ),
+            failed ? 1u : 0u,
+            static_cast<std::uint32_t>( name.size() )
+        };
+        // One buffered write per record, flushed immediately, so records
+        // from concurrently appending processes do not tear
+        std::vector<char> record( sizeof( header ) + name.size() );
+        std::memcpy( record.data(), &header, sizeof( header ) );
+        std::memcpy( record.data() + sizeof( header ), name.data(), name.size() );
+        m_appender.write( record.data(), static_cast<std::streamsize>( record.size() ) );
+        m_appender.flush();
+        CATCH_ENFORCE( m_appender, "Unable to write to history store '" << m_path << "'" );
+
+        auto& history = m_index[header.nameHash];
+        history.name = name;
+        history.lastDurationSeconds = durationSeconds;
+        history.lastRunTimestamp = header.timestamp;
+        ++history.runCount;
+        if( failed ) {
+            ++history.consecutiveFailures;
+            history.lastFailed = true;
+        }
+        else {
+            history.consecutiveFailures = 0;
+            history.lastFailed = false;
+        }
+    }
+
+    auto HistoryStore::testDurations() const -> TestDurations {
+        TestDurations durations;
+        for( auto const& entry : m_index )
+            durations[entry.second.name] = entry.second.lastDurationSeconds;
+        return durations;
+    }
+
+    TestDurations loadSchedulingDurations( IConfig const& config ) {
+        if( !config.durationCacheFile().empty() )
+            return loadTestDurations( config.durationCacheFile() );
+        if( !config.historyFile().empty() )
+            return HistoryStore( config.historyFile(), HistoryStore::OpenMode::ReadOnly ).testDurations();
+        return TestDurations();
+    }
+
+} // end namespace Catch
@@ -0,0 +1,75 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_HISTORY_STORE_H_INCLUDED
+#define TWOBLUECUBES_CATCH_HISTORY_STORE_H_INCLUDED
+
+#include "catch_duration_cache.h"
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+
+namespace Catch {
+
+    struct IConfig;
+
+    // What the store knows about one test case, folded over all of its
+    // recorded runs
+    struct TestHistory {
+        std::string name;
+        double lastDurationSeconds = 0;
+        std::int64_t lastRunTimestamp = 0; // seconds since the Unix epoch
+        std::uint32_t runCount = 0;
+        std::uint32_t consecutiveFailures = 0;
+        bool lastFailed = false;
+    };
+
+    // The shared home of per-test run history (--history-file): a single
+    // append-only file of binary records, one per completed test case run,
+    // indexed by a hash of the test name. RunContext appends a record as
+    // each test ends; at startup the whole file is mapped read-only and
+    // folded into the in-memory index in one pass, so history lookups for
+    // tens of thousands of tests stay at hash-map cost rather than text
+    // parsing cost. Records are fixed-layout except for the trailing name
+    // bytes - see the implementation file for the exact format.
+    class HistoryStore {
+    public:
+        // Whether this instance may append new records. Readers that only
+        // consult past runs (failed-last-run tier promotion, scheduling
+        // durations) open ReadOnly, which never writes - several instances
+        // can then share one file within a run without racing the appender
+        // over writing the magic into a fresh file.
+        enum class OpenMode { ReadOnly, Append };
+
+        explicit HistoryStore( std::string const& path, OpenMode mode = OpenMode::Append );
+
+        HistoryStore( HistoryStore const& ) = delete;
+        HistoryStore& operator = ( HistoryStore const& ) = delete;
+
+        auto find( std::string const& name ) const -> TestHistory const*;
+
+        // Appends one run record and folds it into the index. The append
+        // is a single small write, so records from concurrently running
+        // processes interleave whole
+        void recordTestEnded( std::string const& name, double durationSeconds, bool failed );
+
+        // The store's durations in the shape the schedulers consume
+        auto testDurations() const -> TestDurations;
+
+    private:
+        std::string m_path;
+        std::unordered_map<std::uint64_t, TestHistory> m_index;
+        std::ofstream m_appender;
+    };
+
+    // Last observed durations for scheduling (balanced ordering, shard
+    // slicing, --jobs dispatch): the explicit --duration-cache when given,
+    // otherwise the --history-file, otherwise empty
+    TestDurations loadSchedulingDurations( IConfig const& config );
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_HISTORY_STORE_H_INCLUDED
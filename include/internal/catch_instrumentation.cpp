@@ -0,0 +1,58 @@
+ /*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_instrumentation.h"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace Catch {
+
+    namespace {
+
+        // Sanitizers are baked in at compile time and announce themselves
+        // through predefined macros (GCC) or __has_feature (Clang)
+        auto compiledInSanitizer() -> char const* {
+#if defined(__SANITIZE_ADDRESS__)
+            return "AddressSanitizer";
+#elif defined(__SANITIZE_THREAD__)
+            return "ThreadSanitizer";
+#elif defined(__has_feature)
+#  if __has_feature(address_sanitizer)
+            return "AddressSanitizer";
+#  elif __has_feature(thread_sanitizer)
+            return "ThreadSanitizer";
+#  elif __has_feature(memory_sanitizer)
+            return "MemorySanitizer";
+#  else
+            return nullptr;
+#  endif
+#else
+            return nullptr;
+#endif
+        }
+
+        // Valgrind cannot be seen at compile time; its tools inject their
+        // vgpreload_* shims through LD_PRELOAD, which can be sniffed
+        // without taking a dependency on valgrind's own headers
+        bool preloadedValgrind() {
+            char const* preload = std::getenv( "LD_PRELOAD" );
+            return preload && std::strstr( preload, "vgpreload" ) != nullptr;
+        }
+
+    } // anon namespace
+
+    auto detectedInstrumentation() -> char const* {
+        if( char const* sanitizer = compiledInSanitizer() )
+            return sanitizer;
+        static const bool underValgrind = preloadedValgrind();
+        return underValgrind ? "valgrind" : nullptr;
+    }
+
+    bool runningUnderInstrumentation() {
+        return detectedInstrumentation() != nullptr;
+    }
+
+} // end namespace Catch
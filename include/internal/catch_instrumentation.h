@@ -0,0 +1,22 @@
+ /*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_INSTRUMENTATION_H_INCLUDED
+#define TWOBLUECUBES_CATCH_INSTRUMENTATION_H_INCLUDED
+
+namespace Catch {
+
+    // Name of the execution-slowing instrumentation this binary runs
+    // under - a sanitizer baked in at compile time, or valgrind detected
+    // at runtime - or nullptr when there is none. Everything that tunes
+    // itself to native execution speed (benchmark sample collection,
+    // timeout budgets) consults this through
+    // IConfig::runningUnderInstrumentation().
+    auto detectedInstrumentation() -> char const*;
+
+    bool runningUnderInstrumentation();
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_INSTRUMENTATION_H_INCLUDED
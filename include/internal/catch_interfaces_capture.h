@@ -29,15 +29,22 @@ namespace Catch {
     struct ITransientExpression;
     struct IGeneratorTracker;
 
+    class DeferredMessageBase;
+
     struct IResultCapture {
 
         virtual ~IResultCapture();
 
-        virtual bool sectionStarted(    SectionInfo const& sectionInfo,
-                                        Counts& assertions ) = 0;
+        virtual bool sectionStarted( SectionInfo const& sectionInfo ) = 0;
         virtual void sectionEnded( SectionEndInfo const& endInfo ) = 0;
         virtual void sectionEndedEarly( SectionEndInfo const& endInfo ) = 0;
 
+        // Arms a duration budget for the innermost open section; when it
+        // ends, its measured duration (minus calibrated framework
+        // overhead) is checked against the budget through the standard
+        // assertion path. See SECTION_BUDGET.
+        virtual void setSectionBudget( double budgetSeconds, AssertionInfo const& info ) = 0;
+
         virtual auto acquireGeneratorTracker( SourceLineInfo const& lineInfo ) -> IGeneratorTracker& = 0;
 
         virtual void benchmarkStarting( BenchmarkInfo const& info ) = 0;
@@ -46,6 +53,9 @@ namespace Catch {
         virtual void pushScopedMessage( MessageInfo const& message ) = 0;
         virtual void popScopedMessage( MessageInfo const& message ) = 0;
 
+        virtual void pushDeferredMessage( DeferredMessageBase const* message ) = 0;
+        virtual void popDeferredMessage( DeferredMessageBase const* message ) = 0;
+
         virtual void handleFatalErrorCondition( StringRef message ) = 0;
 
         virtual void handleExpr
@@ -37,13 +37,20 @@ namespace Catch {
     struct RunTests { enum InWhatOrder {
         InDeclarationOrder,
         InLexicographicalOrder,
-        InRandomOrder
+        InRandomOrder,
+        InDurationBalancedOrder,
+        InSourceLocalityOrder
     }; };
     struct UseColour { enum YesOrNo {
         Auto,
         Yes,
         No
     }; };
+    enum class FlushPolicy {
+        Auto = 0,       // leave the stream's own buffering alone
+        Immediate,      // flush after every assertion event
+        TestCaseEnd     // fully buffer, flush at test case boundaries (and on abort)
+    };
     struct WaitForKeypress { enum When {
         Never,
         BeforeStart = 1,
@@ -65,16 +72,62 @@ namespace Catch {
         virtual bool warnAboutMissingAssertions() const = 0;
         virtual bool warnAboutNoTests() const = 0;
         virtual int abortAfter() const = 0;
+        virtual std::string abortFile() const = 0;
+        virtual double timeout() const = 0;
+        virtual std::string snapshotFile() const = 0;
+        virtual bool updateSnapshots() const = 0;
         virtual bool showInvisibles() const = 0;
         virtual ShowDurations::OrNot showDurations() const = 0;
+        virtual unsigned int slowestDurations() const = 0;
         virtual TestSpec const& testSpec() const = 0;
         virtual bool hasTestFilters() const = 0;
         virtual RunTests::InWhatOrder runOrder() const = 0;
         virtual unsigned int rngSeed() const = 0;
         virtual int benchmarkResolutionMultiple() const = 0;
+        virtual unsigned int benchmarkSamples() const = 0;
+        virtual double benchmarkTolerance() const = 0;
+        virtual bool benchmarkPerfCounters() const = 0;
+        virtual double benchmarkWarmupSeconds() const = 0;
+        virtual double benchmarkConfidence() const = 0;
+        virtual double benchmarkMaxSeconds() const = 0;
+        virtual int benchmarkPinCore() const = 0;
+        virtual std::string benchmarkBaselineFile() const = 0;
+        virtual std::string benchmarkResolutionCacheFile() const = 0;
         virtual UseColour::YesOrNo useColour() const = 0;
+        virtual FlushPolicy flushPolicy() const = 0;
         virtual std::vector<std::string> const& getSectionsToRun() const = 0;
         virtual Verbosity verbosity() const = 0;
+        virtual unsigned int shardCount() const = 0;
+        virtual unsigned int shardIndex() const = 0;
+        virtual std::string durationCacheFile() const = 0;
+        virtual std::string historyFile() const = 0;
+        virtual std::string rerunFailuresFile() const = 0;
+        virtual std::string manifestFile() const = 0;
+        // Parsed-registry snapshot the registry rebuilds itself from when
+        // its digest matches; empty disables (see catch_registry_snapshot.h)
+        virtual std::string registrySnapshotFile() const = 0;
+        virtual bool singlePassSections() const = 0;
+        virtual bool skipDuplicateCheck() const = 0;
+        virtual bool filenamesAsTags() const = 0;
+        virtual bool reportResourceUsage() const = 0;
+        virtual bool reportStackUsage() const = 0;
+        virtual bool profileAssertions() const = 0;
+        virtual bool totalsOnly() const = 0;
+        virtual int progressFd() const = 0;
+        virtual unsigned int retryFailures() const = 0;
+        virtual double maxDuration() const = 0;
+        virtual unsigned int stringifyMaxElements() const = 0;
+        virtual std::string diffBaselineFile() const = 0;
+        virtual double diffDurationThreshold() const = 0;
+        virtual std::string depsCacheFile() const = 0;
+        virtual std::vector<std::string> const& changedFiles() const = 0;
+        // True when a sanitizer or valgrind slows this binary by an order
+        // of magnitude or more; benchmark sampling and timeout budgets
+        // adapt to it (see catch_instrumentation.h)
+        virtual bool runningUnderInstrumentation() const = 0;
+        // Directory failing assertions dump raw operand bytes into; empty
+        // disables (see catch_binary_artifact.h)
+        virtual std::string artifactDir() const = 0;
     };
 
     using IConfigPtr = std::shared_ptr<IConfig const>;
@@ -2,5 +2,6 @@
 
 namespace Catch {
     IExceptionTranslator::~IExceptionTranslator() = default;
+    std::type_info const* IExceptionTranslator::translatedType() const { return nullptr; }
     IExceptionTranslatorRegistry::~IExceptionTranslatorRegistry() = default;
 }
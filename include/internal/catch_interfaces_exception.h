@@ -17,6 +17,7 @@
 
 #include <exception>
 #include <string>
+#include <typeinfo>
 #include <vector>
 
 namespace Catch {
@@ -28,6 +29,10 @@ namespace Catch {
     struct IExceptionTranslator {
         virtual ~IExceptionTranslator();
         virtual std::string translate( ExceptionTranslators::const_iterator it, ExceptionTranslators::const_iterator itEnd ) const = 0;
+        // The exact type this translator handles, when it is known statically
+        // and RTTI is available - lets the registry dispatch straight to the
+        // right translator instead of rethrowing down the whole chain
+        virtual std::type_info const* translatedType() const;
     };
 
     struct IExceptionTranslatorRegistry {
@@ -57,6 +62,12 @@ namespace Catch {
                 }
             }
 
+#if defined(CATCH_CONFIG_RTTI)
+            std::type_info const* translatedType() const override {
+                return &typeid( T );
+            }
+#endif
+
         protected:
             std::string(*m_translateFunction)( T& );
         };
@@ -31,6 +31,9 @@ namespace Catch {
         virtual auto hasGenerator() const -> bool = 0;
         virtual auto getGenerator() const -> Generators::GeneratorBasePtr const& = 0;
         virtual void setGenerator( Generators::GeneratorBasePtr&& generator ) = 0;
+        // For value sets in static storage: the tracker only needs the
+        // count to drive its index, no generator object is allocated
+        virtual void setFixedSize( std::size_t size ) = 0;
         virtual auto getIndex() const -> std::size_t = 0;
     };
 
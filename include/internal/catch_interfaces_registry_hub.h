@@ -16,6 +16,9 @@
 namespace Catch {
 
     class TestCase;
+    class StringRef;
+    struct ITestInvoker;
+    struct NameAndTags;
     struct ITestCaseRegistry;
     struct IExceptionTranslatorRegistry;
     struct IExceptionTranslator;
@@ -44,6 +47,9 @@ namespace Catch {
         virtual void registerReporter( std::string const& name, IReporterFactoryPtr const& factory ) = 0;
         virtual void registerListener( IReporterFactoryPtr const& factory ) = 0;
         virtual void registerTest( TestCase const& testInfo ) = 0;
+        // Captures only the raw literals from the TEST_CASE macros; name
+        // and tag parsing is deferred until the registry is first queried
+        virtual void registerTest( ITestInvoker* invoker, SourceLineInfo const& lineInfo, StringRef const& classOrMethod, NameAndTags const& nameAndTags ) = 0;
         virtual void registerTranslator( const IExceptionTranslator* translator ) = 0;
         virtual void registerTagAlias( std::string const& alias, std::string const& tag, SourceLineInfo const& lineInfo ) = 0;
         virtual void registerStartupException() noexcept = 0;
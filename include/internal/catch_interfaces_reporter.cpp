@@ -31,10 +31,10 @@ namespace Catch {
     {}
 
      AssertionStats::AssertionStats( AssertionResult const& _assertionResult,
-                                     std::vector<MessageInfo> const& _infoMessages,
+                                     std::vector<MessageInfo> _infoMessages,
                                      Totals const& _totals )
     :   assertionResult( _assertionResult ),
-        infoMessages( _infoMessages ),
+        infoMessages( std::move( _infoMessages ) ),
         totals( _totals )
     {
         assertionResult.m_resultData.lazyExpression.m_transientExpression = _assertionResult.m_resultData.lazyExpression.m_transientExpression;
@@ -67,13 +67,13 @@ namespace Catch {
 
     TestCaseStats::TestCaseStats(  TestCaseInfo const& _testInfo,
                                    Totals const& _totals,
-                                   std::string const& _stdOut,
-                                   std::string const& _stdErr,
+                                   std::string _stdOut,
+                                   std::string _stdErr,
                                    bool _aborting )
     : testInfo( _testInfo ),
         totals( _totals ),
-        stdOut( _stdOut ),
-        stdErr( _stdErr ),
+        stdOut( std::move( _stdOut ) ),
+        stdErr( std::move( _stdErr ) ),
         aborting( _aborting )
     {}
 
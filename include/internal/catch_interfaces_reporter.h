@@ -16,6 +16,10 @@
 #include "catch_assertionresult.h"
 #include "catch_message.h"
 #include "catch_option.hpp"
+#include "catch_alloc_metrics.h"
+#include "catch_cpu_affinity.h"
+#include "catch_perf_counters.h"
+#include "catch_resource_usage.h"
 #include "catch_stringref.h"
 
 
@@ -40,9 +44,44 @@ namespace Catch {
         IConfigPtr m_fullConfig;
     };
 
+    // Event groups a listener can subscribe to (see EventListenerBase);
+    // flags cover both the Starting and the Ended side of each event
+    struct ListenerEvents {
+        enum Flags : unsigned int {
+            None      = 0,
+            TestRun   = 1 << 0, // also noMatchingTestCases
+            TestGroup = 1 << 1,
+            TestCase  = 1 << 2, // also skipTest
+            Section   = 1 << 3,
+            Assertion = 1 << 4,
+            Benchmark = 1 << 5,
+            All       = 0xffffffff
+        };
+    };
+
     struct ReporterPreferences {
         bool shouldRedirectStdOut = false;
         bool shouldReportAllAssertions = false;
+        // Opt-out for reporters whose assertionStarting is a no-op -
+        // lets the dispatch skip the call altogether
+        bool shouldReportAssertionStarting = true;
+        // Deliver only every Nth successful assertion event; failures
+        // are always delivered. 1 delivers every event. Lets passive
+        // listeners (metrics, tracing) sample assertion timings without
+        // the runner building stats objects nobody consumes.
+        unsigned int successfulAssertionSampleRate = 1;
+        // Deliver assertion results batched - one assertionsEnded call
+        // per section boundary instead of a virtual assertionEnded call
+        // per assertion. For reporters that only aggregate (or buffer
+        // anyway, like the cumulative bases) this collapses millions of
+        // calls into thousands. Batched results have their expression
+        // expanded eagerly, since delivery outlives the assertion.
+        bool shouldBatchAssertions = false;
+        // Bitmask of ListenerEvents flags the attached listener wants
+        // delivered; the multiplexing ListeningReporter never calls a
+        // listener for event groups outside its mask. Reporters are
+        // always delivered everything.
+        unsigned int subscribedEvents = ListenerEvents::All;
     };
 
     template<typename T>
@@ -75,7 +114,7 @@ namespace Catch {
 
     struct AssertionStats {
         AssertionStats( AssertionResult const& _assertionResult,
-                        std::vector<MessageInfo> const& _infoMessages,
+                        std::vector<MessageInfo> _infoMessages,
                         Totals const& _totals );
 
         AssertionStats( AssertionStats const& )              = default;
@@ -109,8 +148,8 @@ namespace Catch {
     struct TestCaseStats {
         TestCaseStats(  TestCaseInfo const& _testInfo,
                         Totals const& _totals,
-                        std::string const& _stdOut,
-                        std::string const& _stdErr,
+                        std::string _stdOut,
+                        std::string _stdErr,
                         bool _aborting );
 
         TestCaseStats( TestCaseStats const& )              = default;
@@ -123,6 +162,12 @@ namespace Catch {
         Totals totals;
         std::string stdOut;
         std::string stdErr;
+        // Only sampled when --resource-usage is given
+        ResourceUsage resourceUsage;
+        // Peak stack bytes the test body consumed; -1 unless
+        // --stack-usage was given. Saturates at the paint window size
+        // (see catch_stack_usage.h)
+        long long stackPeakBytes = -1;
         bool aborting;
     };
 
@@ -166,6 +211,28 @@ namespace Catch {
         BenchmarkInfo info;
         std::size_t iterations;
         uint64_t elapsedTimeInNanoseconds;
+        // Statistics over the individual samples, in nanoseconds per iteration
+        std::size_t samples;
+        double meanNs;
+        double standardDeviationNs;
+        double lowNs;
+        double highNs;
+        // Totals over all timed iterations; sampled only with
+        // --benchmark-perf-counters on a permitting kernel
+        PerfCounters perfCounters;
+        // Heap traffic over all timed iterations; sampled only when the
+        // binary is built with CATCH_CONFIG_ALLOC_METRICS
+        AllocMetrics allocMetrics;
+        // Set for BENCHMARK_GROUP variants: mean time relative to the
+        // group's first variant, with a confidence half-width at the
+        // --benchmark-confidence level (default 95%)
+        bool comparative;
+        double ratioToBaseline;
+        double ratioConfidence;
+        double confidenceLevel;
+        // Where and under what frequency management the benchmark ran;
+        // see catch_cpu_affinity.h
+        CpuState cpuState;
     };
 
     struct IStreamingReporter {
@@ -193,6 +260,11 @@ namespace Catch {
         // The return value indicates if the messages buffer should be cleared:
         virtual bool assertionEnded( AssertionStats const& assertionStats ) = 0;
 
+        // Batched delivery (see ReporterPreferences::shouldBatchAssertions):
+        // everything since the last section boundary, in order, delivered
+        // just before the enclosing sectionStarting/sectionEnded call
+        virtual void assertionsEnded( std::vector<AssertionStats> const& ) {}
+
         // *** experimental ***
         virtual void benchmarkEnded( BenchmarkStats const& ) {}
 
@@ -10,6 +10,10 @@
 
 #include <vector>
 #include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace Catch {
 
@@ -25,15 +29,35 @@ namespace Catch {
     class TestCase;
     struct IConfig;
 
+    // One entry of the registry's inverted tag index, keyed by the
+    // lower-cased tag
+    struct TagIndexEntry {
+        std::set<std::string> spellings;        // original casings, for listing
+        std::unordered_set<std::string> tests;  // names of the tests carrying the tag
+        // How many of those tests a default run would execute - kept in
+        // step at registration so tag listing needs no scan over tests
+        std::size_t visibleCount = 0;
+    };
+    using TagIndex = std::unordered_map<std::string, TagIndexEntry>;
+
+    // Inverted index from the lower-cased -# filename tag ("#stem" of the
+    // declaring file) to the names of the tests declared in that file,
+    // built at registration so single-file selections need no scan
+    using FilenameTagIndex = std::unordered_map<std::string, std::unordered_set<std::string>>;
+
     struct ITestCaseRegistry {
         virtual ~ITestCaseRegistry();
         virtual std::vector<TestCase> const& getAllTests() const = 0;
         virtual std::vector<TestCase> const& getAllTestsSorted( IConfig const& config ) const = 0;
+        virtual std::vector<TestCase> const& getAllTestsFiltered( TestSpec const& testSpec, IConfig const& config ) const = 0;
+        virtual TagIndex const& getTagIndex() const = 0;
+        virtual FilenameTagIndex const& getFilenameTagIndex() const = 0;
     };
 
     bool matchTest( TestCase const& testCase, TestSpec const& testSpec, IConfig const& config );
     std::vector<TestCase> filterTests( std::vector<TestCase> const& testCases, TestSpec const& testSpec, IConfig const& config );
     std::vector<TestCase> const& getAllTestCasesSorted( IConfig const& config );
+    std::vector<TestCase> const& getAllTestCasesFiltered( TestSpec const& testSpec, IConfig const& config );
 
 }
 
@@ -16,12 +16,15 @@
 #include "catch_text.h"
 
 #include "catch_console_colour.h"
+#include "catch_test_manifest.h"
 #include "catch_test_spec_parser.h"
 #include "catch_tostring.h"
 #include "catch_string_manip.h"
 
 #include <limits>
 #include <algorithm>
+#include <cstdio>
+#include <cstring>
 #include <iomanip>
 
 namespace Catch {
@@ -34,7 +37,7 @@ namespace Catch {
             Catch::cout() << "All available test cases:\n";
         }
 
-        auto matchedTestCases = filterTests( getAllTestCasesSorted( config ), testSpec, config );
+        auto const& matchedTestCases = getAllTestCasesFiltered( testSpec, config );
         for( auto const& testCaseInfo : matchedTestCases ) {
             Colour::Code colour = testCaseInfo.isHidden()
                 ? Colour::SecondaryText
@@ -62,19 +65,102 @@ namespace Catch {
 
     std::size_t listTestsNamesOnly( Config const& config ) {
         TestSpec testSpec = config.testSpec();
-        std::size_t matchedTests = 0;
-        std::vector<TestCase> matchedTestCases = filterTests( getAllTestCasesSorted( config ), testSpec, config );
+        std::vector<TestCase> const& matchedTestCases = getAllTestCasesFiltered( testSpec, config );
+
+        // Tooling invokes this listing constantly, so it is assembled in one
+        // contiguous buffer and written out in a single flush - per-test
+        // stream inserts (each previously ending in a std::endl flush)
+        // dominated the cost of listing large registries
+        std::size_t bufferSize = 0;
+        for( auto const& testCaseInfo : matchedTestCases )
+            bufferSize += testCaseInfo.name.size() + 3; // quotes + newline
+        std::string buffer;
+        buffer.reserve( bufferSize );
+
         for( auto const& testCaseInfo : matchedTestCases ) {
-            matchedTests++;
-            if( startsWith( testCaseInfo.name, '#' ) )
-               Catch::cout() << '"' << testCaseInfo.name << '"';
+            if( startsWith( testCaseInfo.name, '#' ) ) {
+                buffer += '"';
+                buffer += testCaseInfo.name;
+                buffer += '"';
+            }
             else
-               Catch::cout() << testCaseInfo.name;
-            if ( config.verbosity() >= Verbosity::High )
-                Catch::cout() << "\t@" << testCaseInfo.lineInfo;
-            Catch::cout() << std::endl;
+                buffer += testCaseInfo.name;
+            if ( config.verbosity() >= Verbosity::High ) {
+                ReusableStringStream rss;
+                rss << "\t@" << testCaseInfo.lineInfo;
+                buffer += rss.str();
+            }
+            buffer += '\n';
+        }
+        Catch::cout() << buffer << std::flush;
+        return matchedTestCases.size();
+    }
+
+    namespace {
+        void appendJsonString( std::string& buffer, char const* data, std::size_t size ) {
+            buffer += '"';
+            for( std::size_t i = 0; i < size; ++i ) {
+                unsigned char c = static_cast<unsigned char>( data[i] );
+                switch( c ) {
+                    case '"':  buffer += "\\\""; break;
+                    case '\\': buffer += "\\\\"; break;
+                    case '\n': buffer += "\\n"; break;
+                    case '\t': buffer += "\\t"; break;
+                    case '\r': buffer += "\\r"; break;
+                    default:
+                        if( c < 0x20 ) {
+                            char escaped[8];
+                            std::snprintf( escaped, sizeof(escaped), "\\u%04x", c );
+                            buffer += escaped;
+                        }
+                        else
+                            buffer += static_cast<char>( c );
+                }
+            }
+            buffer += '"';
+        }
+        void appendJsonString( std::string& buffer, std::string const& value ) {
+            appendJsonString( buffer, value.c_str(), value.size() );
+        }
+    }
+
+    // Everything a tool gets from --list-tests plus --list-tags, in one
+    // machine-readable document: no console-format parsing and a single
+    // process launch. Like listTestsNamesOnly, the document is assembled
+    // in one contiguous buffer and written with a single flush.
+    std::size_t listTestsJson( Config const& config ) {
+        TestSpec testSpec = config.testSpec();
+        std::vector<TestCase> const& matchedTestCases = getAllTestCasesFiltered( testSpec, config );
+
+        std::string buffer;
+        buffer.reserve( matchedTestCases.size() * 96 );
+
+        buffer += "{\"version\":1,\"tests\":[";
+        bool firstTest = true;
+        for( auto const& testCaseInfo : matchedTestCases ) {
+            if( !firstTest )
+                buffer += ',';
+            firstTest = false;
+            buffer += "{\"name\":";
+            appendJsonString( buffer, testCaseInfo.name );
+            buffer += ",\"tags\":[";
+            bool firstTag = true;
+            for( auto const& tag : testCaseInfo.tags ) {
+                if( !firstTag )
+                    buffer += ',';
+                firstTag = false;
+                appendJsonString( buffer, tag.currentData(), tag.size() );
+            }
+            buffer += "],\"filename\":";
+            appendJsonString( buffer, testCaseInfo.lineInfo.file, std::strlen( testCaseInfo.lineInfo.file ) );
+            buffer += ",\"line\":";
+            buffer += std::to_string( testCaseInfo.lineInfo.line );
+            buffer += '}';
         }
-        return matchedTests;
+        buffer += "]}\n";
+
+        Catch::cout() << buffer << std::flush;
+        return matchedTestCases.size();
     }
 
     void TagInfo::add( std::string const& spelling ) {
@@ -99,14 +185,30 @@ namespace Catch {
 
         std::map<std::string, TagInfo> tagCounts;
 
-        std::vector<TestCase> matchedTestCases = filterTests( getAllTestCasesSorted( config ), testSpec, config );
-        for( auto const& testCase : matchedTestCases ) {
-            for( auto const& tagName : testCase.getTestCaseInfo().tags ) {
-                std::string lcaseTagName = toLower( tagName );
-                auto countIt = tagCounts.find( lcaseTagName );
-                if( countIt == tagCounts.end() )
-                    countIt = tagCounts.insert( std::make_pair( lcaseTagName, TagInfo() ) ).first;
-                countIt->second.add( tagName );
+        if( !config.hasTestFilters() && config.allowThrows() && config.shardCount() == 1 ) {
+            // With no filters in play the counts come straight from the
+            // registry's inverted tag index, which tracks how many visible
+            // tests carry each tag as they register - all that remains is
+            // ordering the entries for display
+            for( auto const& tagIndexEntry : getRegistryHub().getTestCaseRegistry().getTagIndex() ) {
+                if( tagIndexEntry.second.visibleCount > 0 ) {
+                    TagInfo info;
+                    info.spellings = tagIndexEntry.second.spellings;
+                    info.count = tagIndexEntry.second.visibleCount;
+                    tagCounts.insert( std::make_pair( tagIndexEntry.first, std::move( info ) ) );
+                }
+            }
+        }
+        else {
+            std::vector<TestCase> const& matchedTestCases = getAllTestCasesFiltered( testSpec, config );
+            for( auto const& testCase : matchedTestCases ) {
+                for( auto const& tagName : testCase.getTestCaseInfo().tags ) {
+                    std::string lcaseTagName = toLower( tagName );
+                    auto countIt = tagCounts.find( lcaseTagName );
+                    if( countIt == tagCounts.end() )
+                        countIt = tagCounts.insert( std::make_pair( lcaseTagName, TagInfo() ) ).first;
+                    countIt->second.add( tagName );
+                }
             }
         }
 
@@ -124,6 +226,21 @@ namespace Catch {
         return tagCounts.size();
     }
 
+    std::size_t exportManifest( Config const& config ) {
+        TestSpec testSpec = config.testSpec();
+        std::vector<TestCase> const& matchedTestCases = getAllTestCasesFiltered( testSpec, config );
+
+        std::vector<std::string> names;
+        names.reserve( matchedTestCases.size() );
+        for( auto const& testCaseInfo : matchedTestCases )
+            names.push_back( testCaseInfo.name );
+        saveTestManifest( config.exportManifestFile(), names );
+
+        Catch::cout() << "Exported manifest of " << pluralise( names.size(), "test" )
+                      << " to '" << config.exportManifestFile() << "'" << std::endl;
+        return names.size();
+    }
+
     std::size_t listReporters( Config const& /*config*/ ) {
         Catch::cout() << "Available reporters:\n";
         IReporterRegistry::FactoryMap const& factories = getRegistryHub().getReporterRegistry().getFactories();
@@ -152,10 +269,14 @@ namespace Catch {
             listedCount = listedCount.valueOr(0) + listTests( config );
         if( config.listTestNamesOnly() )
             listedCount = listedCount.valueOr(0) + listTestsNamesOnly( config );
+        if( config.listJson() )
+            listedCount = listedCount.valueOr(0) + listTestsJson( config );
         if( config.listTags() )
             listedCount = listedCount.valueOr(0) + listTags( config );
         if( config.listReporters() )
             listedCount = listedCount.valueOr(0) + listReporters( config );
+        if( !config.exportManifestFile().empty() )
+            listedCount = listedCount.valueOr(0) + exportManifest( config );
         return listedCount;
     }
 
@@ -19,6 +19,8 @@ namespace Catch {
 
     std::size_t listTestsNamesOnly( Config const& config );
 
+    std::size_t listTestsJson( Config const& config );
+
     struct TagInfo {
         void add( std::string const& spelling );
         std::string all() const;
@@ -29,6 +31,8 @@ namespace Catch {
 
     std::size_t listTags( Config const& config );
 
+    std::size_t exportManifest( Config const& config );
+
     std::size_t listReporters( Config const& /*config*/ );
     
     Option<std::size_t> list( Config const& config );
@@ -10,15 +10,15 @@
 
 #include "catch_common.h"
 
+#include <array>
 #include <string>
-#include <vector>
 
 namespace Catch {
 namespace Matchers {
     namespace Impl {
 
-        template<typename ArgT> struct MatchAllOf;
-        template<typename ArgT> struct MatchAnyOf;
+        template<typename ArgT, std::size_t N> struct MatchAllOf;
+        template<typename ArgT, std::size_t N> struct MatchAnyOf;
         template<typename ArgT> struct MatchNotOf;
 
         class MatcherUntypedBase {
@@ -56,13 +56,30 @@ namespace Matchers {
         struct MatcherBase : MatcherUntypedBase, MatcherMethod<T> {
 
 
-            MatchAllOf<T> operator && ( MatcherBase const& other ) const;
-            MatchAnyOf<T> operator || ( MatcherBase const& other ) const;
+            MatchAllOf<T, 2> operator && ( MatcherBase const& other ) const;
+            MatchAnyOf<T, 2> operator || ( MatcherBase const& other ) const;
             MatchNotOf<T> operator ! () const;
         };
 
-        template<typename ArgT>
+        // Composed matchers hold their components by pointer in an inline
+        // array whose size is part of the type, so composing matchers with
+        // && and || never allocates. The components are typically
+        // temporaries, which is fine: the assertion macros evaluate the
+        // matcher within the same full expression that composed it.
+        template<typename ArgT, std::size_t N>
+        auto extendedWith( std::array<MatcherBase<ArgT> const*, N> const& matchers, MatcherBase<ArgT> const& other )
+        -> std::array<MatcherBase<ArgT> const*, N+1> {
+            std::array<MatcherBase<ArgT> const*, N+1> extended;
+            for( std::size_t i = 0; i < N; ++i )
+                extended[i] = matchers[i];
+            extended[N] = &other;
+            return extended;
+        }
+
+        template<typename ArgT, std::size_t N>
         struct MatchAllOf : MatcherBase<ArgT> {
+            MatchAllOf( std::array<MatcherBase<ArgT> const*, N> const& matchers ) : m_matchers( matchers ) {}
+
             bool match( ArgT const& arg ) const override {
                 for( auto matcher : m_matchers ) {
                     if (!matcher->match(arg))
@@ -86,15 +103,15 @@ namespace Matchers {
                 return description;
             }
 
-            MatchAllOf<ArgT>& operator && ( MatcherBase<ArgT> const& other ) {
-                m_matchers.push_back( &other );
-                return *this;
+            MatchAllOf<ArgT, N+1> operator && ( MatcherBase<ArgT> const& other ) const {
+                return MatchAllOf<ArgT, N+1>( extendedWith( m_matchers, other ) );
             }
 
-            std::vector<MatcherBase<ArgT> const*> m_matchers;
+            std::array<MatcherBase<ArgT> const*, N> m_matchers;
         };
-        template<typename ArgT>
+        template<typename ArgT, std::size_t N>
         struct MatchAnyOf : MatcherBase<ArgT> {
+            MatchAnyOf( std::array<MatcherBase<ArgT> const*, N> const& matchers ) : m_matchers( matchers ) {}
 
             bool match( ArgT const& arg ) const override {
                 for( auto matcher : m_matchers ) {
@@ -119,12 +136,11 @@ namespace Matchers {
                 return description;
             }
 
-            MatchAnyOf<ArgT>& operator || ( MatcherBase<ArgT> const& other ) {
-                m_matchers.push_back( &other );
-                return *this;
+            MatchAnyOf<ArgT, N+1> operator || ( MatcherBase<ArgT> const& other ) const {
+                return MatchAnyOf<ArgT, N+1>( extendedWith( m_matchers, other ) );
             }
 
-            std::vector<MatcherBase<ArgT> const*> m_matchers;
+            std::array<MatcherBase<ArgT> const*, N> m_matchers;
         };
 
         template<typename ArgT>
@@ -143,12 +159,12 @@ namespace Matchers {
         };
 
         template<typename T>
-        MatchAllOf<T> MatcherBase<T>::operator && ( MatcherBase const& other ) const {
-            return MatchAllOf<T>() && *this && other;
+        MatchAllOf<T, 2> MatcherBase<T>::operator && ( MatcherBase const& other ) const {
+            return MatchAllOf<T, 2>( std::array<MatcherBase<T> const*, 2>{{ this, &other }} );
         }
         template<typename T>
-        MatchAnyOf<T> MatcherBase<T>::operator || ( MatcherBase const& other ) const {
-            return MatchAnyOf<T>() || *this || other;
+        MatchAnyOf<T, 2> MatcherBase<T>::operator || ( MatcherBase const& other ) const {
+            return MatchAnyOf<T, 2>( std::array<MatcherBase<T> const*, 2>{{ this, &other }} );
         }
         template<typename T>
         MatchNotOf<T> MatcherBase<T>::operator ! () const {
@@ -79,10 +79,30 @@ bool almostEqualUlps(FP lhs, FP rhs, int maxUlpDiff) {
 namespace Catch {
 namespace Matchers {
 namespace Floating {
+
+    namespace Detail {
+        bool almostEqualUlps(float lhs, float rhs, int maxUlpDiff) {
+            return ::almostEqualUlps<float>(lhs, rhs, maxUlpDiff);
+        }
+        bool almostEqualUlps(double lhs, double rhs, int maxUlpDiff) {
+            return ::almostEqualUlps<double>(lhs, rhs, maxUlpDiff);
+        }
+        void enforceNonNegativeUlps(int ulps) {
+            CATCH_ENFORCE(ulps >= 0, "Invalid ULP setting: " << ulps << '.'
+                << " ULPs have to be non-negative.");
+        }
+        void enforceNonNegativeMargin(double margin) {
+            CATCH_ENFORCE(margin >= 0, "Invalid margin: " << margin << '.'
+                << " Margin has to be non-negative.");
+        }
+        std::string describeMismatchedSizes(std::size_t rangeSize, std::size_t expectedSize) {
+            return " (mismatched sizes: " + Catch::to_string(rangeSize) + " vs " + Catch::to_string(expectedSize) + ")";
+        }
+    } // namespace Detail
+
     WithinAbsMatcher::WithinAbsMatcher(double target, double margin)
         :m_target{ target }, m_margin{ margin } {
-        CATCH_ENFORCE(margin >= 0, "Invalid margin: " << margin << '.'
-            << " Margin has to be non-negative.");
+        Detail::enforceNonNegativeMargin(margin);
     }
 
     // Performs equivalent check of std::fabs(lhs - rhs) <= margin
@@ -98,8 +118,7 @@ namespace Floating {
 
     WithinUlpsMatcher::WithinUlpsMatcher(double target, int ulps, FloatingPointKind baseType)
         :m_target{ target }, m_ulps{ ulps }, m_type{ baseType } {
-        CATCH_ENFORCE(ulps >= 0, "Invalid ULP setting: " << ulps << '.'
-            << " ULPs have to be non-negative.");
+        Detail::enforceNonNegativeUlps(ulps);
     }
 
 #if defined(__clang__)
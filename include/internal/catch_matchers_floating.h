@@ -8,9 +8,12 @@
 #define TWOBLUECUBES_CATCH_MATCHERS_FLOATING_H_INCLUDED
 
 #include "catch_matchers.h"
+#include "catch_to_string.hpp"
+#include "catch_tostring.h"
 
 #include <type_traits>
 #include <cmath>
+#include <vector>
 
 namespace Catch {
 namespace Matchers {
@@ -38,6 +41,100 @@ namespace Matchers {
             FloatingPointKind m_type;
         };
 
+        namespace Detail {
+            // Out-of-line helpers so this header does not need the ULP
+            // bit-twiddling machinery or catch_enforce.h
+            bool almostEqualUlps(float lhs, float rhs, int maxUlpDiff);
+            bool almostEqualUlps(double lhs, double rhs, int maxUlpDiff);
+            void enforceNonNegativeUlps(int ulps);
+            void enforceNonNegativeMargin(double margin);
+            std::string describeMismatchedSizes(std::size_t rangeSize, std::size_t expectedSize);
+        }
+
+        // The range matchers below compare a whole buffer elementwise
+        // against an expected buffer in a single pass inside the matcher,
+        // instead of one REQUIRE_THAT per element. Only the first offending
+        // index is recorded and the expected buffer is never stringified,
+        // so they stay cheap for very large buffers.
+
+        template<typename FP>
+        struct WithinUlpsRangeMatcher : MatcherBase<std::vector<FP>> {
+            WithinUlpsRangeMatcher(std::vector<FP> const& expected, int ulps)
+            :   m_expected(expected),
+                m_ulps(ulps) {
+                Detail::enforceNonNegativeUlps(ulps);
+            }
+            bool match(std::vector<FP> const& range) const override {
+                if (range.size() != m_expected.size()) {
+                    m_mismatch = Detail::describeMismatchedSizes(range.size(), m_expected.size());
+                    return false;
+                }
+                for (std::size_t i = 0; i < range.size(); ++i) {
+                    if (!Detail::almostEqualUlps(range[i], m_expected[i], m_ulps)) {
+                        m_mismatch = " (first mismatch at index " + Catch::to_string(i) + ": "
+                            + ::Catch::Detail::stringify(range[i]) + " vs " + ::Catch::Detail::stringify(m_expected[i]) + ")";
+                        return false;
+                    }
+                }
+                return true;
+            }
+            std::string describe() const override {
+                return "is elementwise within " + Catch::to_string(m_ulps) + " ULPs of the expected buffer" + m_mismatch;
+            }
+        private:
+            std::vector<FP> const& m_expected;
+            int m_ulps;
+            mutable std::string m_mismatch;
+        };
+
+        template<typename FP>
+        struct WithinAbsRangeMatcher : MatcherBase<std::vector<FP>> {
+            WithinAbsRangeMatcher(std::vector<FP> const& expected, double margin)
+            :   m_expected(expected),
+                m_margin(margin) {
+                Detail::enforceNonNegativeMargin(margin);
+            }
+            bool match(std::vector<FP> const& range) const override {
+                if (range.size() != m_expected.size()) {
+                    m_mismatch = Detail::describeMismatchedSizes(range.size(), m_expected.size());
+                    return false;
+                }
+                // Checked in blocks: the inner loop is branchless so it can
+                // vectorise, while the block granularity still gives an
+                // early exit on the first bad block
+                std::size_t const blockSize = 256;
+                for (std::size_t start = 0; start < range.size(); start += blockSize) {
+                    auto end = (std::min)(start + blockSize, range.size());
+                    bool ok = true;
+                    for (std::size_t i = start; i < end; ++i)
+                        ok &= isWithinMargin(range[i], m_expected[i]);
+                    if (!ok) {
+                        for (std::size_t i = start; i < end; ++i) {
+                            if (!isWithinMargin(range[i], m_expected[i])) {
+                                m_mismatch = " (first mismatch at index " + Catch::to_string(i) + ": "
+                                    + ::Catch::Detail::stringify(range[i]) + " vs " + ::Catch::Detail::stringify(m_expected[i]) + ")";
+                                return false;
+                            }
+                        }
+                    }
+                }
+                return true;
+            }
+            std::string describe() const override {
+                return "is elementwise within " + ::Catch::Detail::stringify(m_margin) + " of the expected buffer" + m_mismatch;
+            }
+        private:
+            // Same margin check as WithinAbsMatcher: no subtraction, so
+            // INFINITY compares cleanly
+            bool isWithinMargin(FP lhs, FP rhs) const {
+                return (static_cast<double>(lhs) + m_margin >= static_cast<double>(rhs))
+                    & (static_cast<double>(rhs) + m_margin >= static_cast<double>(lhs));
+            }
+
+            std::vector<FP> const& m_expected;
+            double m_margin;
+            mutable std::string m_mismatch;
+        };
 
     } // namespace Floating
 
@@ -47,6 +144,15 @@ namespace Matchers {
     Floating::WithinUlpsMatcher WithinULP(float target, int maxUlpDiff);
     Floating::WithinAbsMatcher WithinAbs(double target, double margin);
 
+    template<typename FP>
+    Floating::WithinUlpsRangeMatcher<FP> AllWithinUlps(std::vector<FP> const& expected, int maxUlpDiff) {
+        return Floating::WithinUlpsRangeMatcher<FP>(expected, maxUlpDiff);
+    }
+    template<typename FP>
+    Floating::WithinAbsRangeMatcher<FP> AllWithinAbs(std::vector<FP> const& expected, double margin) {
+        return Floating::WithinAbsRangeMatcher<FP>(expected, margin);
+    }
+
 } // namespace Matchers
 } // namespace Catch
 
@@ -0,0 +1,248 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_matchers_golden.h"
+#include "catch_context.h"
+#include "catch_enforce.h"
+#include "catch_interfaces_config.h"
+#include "catch_stream.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <ostream>
+
+namespace Catch {
+namespace Matchers {
+namespace GoldenFile {
+
+    namespace {
+
+        // XXH64 (xxHash, public domain algorithm) - a fast chunked hash,
+        // fed incrementally so hashing never needs the whole input. Both
+        // sides of a comparison are hashed by the same process, so the
+        // native-endian reads below are not a portability concern.
+        class XxHash64 {
+            static const std::uint64_t P1 = 11400714785074694791ULL;
+            static const std::uint64_t P2 = 14029467366897019727ULL;
+            static const std::uint64_t P3 = 1609587929392839161ULL;
+            static const std::uint64_t P4 = 9650029242287828579ULL;
+            static const std::uint64_t P5 = 2870177450012600261ULL;
+
+            static std::uint64_t rotl( std::uint64_t x, int r ) {
+                return ( x << r ) | ( x >> ( 64 - r ) );
+            }
+            static std::uint64_t round( std::uint64_t acc, std::uint64_t input ) {
+                acc += input * P2;
+                acc = rotl( acc, 31 );
+                return acc * P1;
+            }
+            static std::uint64_t mergeRound( std::uint64_t hash, std::uint64_t acc ) {
+                hash ^= round( 0, acc );
+                return hash * P1 + P4;
+            }
+            static std::uint64_t read64( char const* p ) {
+                std::uint64_t value;
+                std::memcpy( &value, p, sizeof( value ) );
+                return value;
+            }
+            static std::uint32_t read32( char const* p ) {
+                std::uint32_t value;
+                std::memcpy( &value, p, sizeof( value ) );
+                return value;
+            }
+
+        public:
+            void update( char const* data, std::size_t size ) {
+                m_total += size;
+                if( m_bufferSize + size < 32 ) {
+                    std::memcpy( m_buffer + m_bufferSize, data, size );
+                    m_bufferSize += size;
+                    return;
+                }
+                char const* p = data;
+                char const* end = data + size;
+                if( m_bufferSize > 0 ) {
+                    auto fill = 32 - m_bufferSize;
+                    std::memcpy( m_buffer + m_bufferSize, p, fill );
+                    consumeStripe( m_buffer );
+                    p += fill;
+                    m_bufferSize = 0;
+                }
+                while( p + 32 <= end ) {
+                    consumeStripe( p );
+                    p += 32;
+                }
+                m_bufferSize = static_cast<std::size_t>( end - p );
+                std::memcpy( m_buffer, p, m_bufferSize );
+            }
+
+            std::uint64_t digest() const {
+                std::uint64_t hash;
+                if( m_total >= 32 ) {
+                    hash = rotl( m_v1, 1 ) + rotl( m_v2, 7 ) + rotl( m_v3, 12 ) + rotl( m_v4, 18 );
+                    hash = mergeRound( hash, m_v1 );
+                    hash = mergeRound( hash, m_v2 );
+                    hash = mergeRound( hash, m_v3 );
+                    hash = mergeRound( hash, m_v4 );
+                }
+                else {
+                    hash = P5;
+                }
+                hash += m_total;
+
+                char const* p = m_buffer;
+                char const* end = m_buffer + m_bufferSize;
+                while( p + 8 <= end ) {
+                    hash ^= round( 0, read64( p ) );
+                    hash = rotl( hash, 27 ) * P1 + P4;
+                    p += 8;
+                }
+                if( p + 4 <= end ) {
+                    hash ^= static_cast<std::uint64_t>( read32( p ) ) * P1;
+                    hash = rotl( hash, 23 ) * P2 + P3;
+                    p += 4;
+                }
+                while( p < end ) {
+                    hash ^= static_cast<unsigned char>( *p ) * P5;
+                    hash = rotl( hash, 11 ) * P1;
+                    ++p;
+                }
+
+                hash ^= hash >> 33;
+                hash *= P2;
+                hash ^= hash >> 29;
+                hash *= P3;
+                hash ^= hash >> 32;
+                return hash;
+            }
+
+            std::uint64_t total() const { return m_total; }
+
+        private:
+            void consumeStripe( char const* p ) {
+                m_v1 = round( m_v1, read64( p ) );
+                m_v2 = round( m_v2, read64( p + 8 ) );
+                m_v3 = round( m_v3, read64( p + 16 ) );
+                m_v4 = round( m_v4, read64( p + 24 ) );
+            }
+
+            std::uint64_t m_v1 = P1 + P2;
+            std::uint64_t m_v2 = P2;
+            std::uint64_t m_v3 = 0;
+            std::uint64_t m_v4 = 0 - P1;
+            std::uint64_t m_total = 0;
+            char m_buffer[32];
+            std::size_t m_bufferSize = 0;
+        };
+
+        // Hashes (and optionally tees to a file, when recording a golden)
+        // everything the producer writes, without storing any of it
+        class HashingStreamBuf : public std::streambuf {
+        public:
+            explicit HashingStreamBuf( std::ofstream* tee = nullptr ) : m_tee( tee ) {}
+
+            std::uint64_t digest() const { return m_hash.digest(); }
+            std::uint64_t size() const { return m_hash.total(); }
+
+        private:
+            std::streamsize xsputn( char const* data, std::streamsize size ) override {
+                m_hash.update( data, static_cast<std::size_t>( size ) );
+                if( m_tee )
+                    m_tee->write( data, size );
+                return size;
+            }
+            int overflow( int c ) override {
+                if( c != EOF ) {
+                    char byte = static_cast<char>( c );
+                    xsputn( &byte, 1 );
+                }
+                return c;
+            }
+
+            XxHash64 m_hash;
+            std::ofstream* m_tee;
+        };
+
+        struct FileDigest {
+            std::uint64_t digest;
+            std::uint64_t size;
+        };
+
+        // Each golden file is read (in chunks) at most once per process,
+        // however many iterations compare against it
+        bool lookupGoldenDigest( std::string const& path, FileDigest& out ) {
+            static std::map<std::string, FileDigest> s_cache;
+            auto it = s_cache.find( path );
+            if( it != s_cache.end() ) {
+                out = it->second;
+                return true;
+            }
+            std::ifstream file( path, std::ios::binary );
+            if( !file )
+                return false;
+            XxHash64 hash;
+            char chunk[65536];
+            while( file.read( chunk, sizeof( chunk ) ) || file.gcount() > 0 )
+                hash.update( chunk, static_cast<std::size_t>( file.gcount() ) );
+            out = FileDigest{ hash.digest(), hash.total() };
+            s_cache[path] = out;
+            return true;
+        }
+
+        FileDigest recordGolden( std::string const& path, StreamProducer const& producer ) {
+            std::ofstream file( path, std::ios::binary | std::ios::trunc );
+            CATCH_ENFORCE( file, "Unable to open golden file '" << path << "' for writing" );
+            HashingStreamBuf buf( &file );
+            std::ostream stream( &buf );
+            producer( stream );
+            CATCH_ENFORCE( file, "Unable to write golden file '" << path << "'" );
+            return FileDigest{ buf.digest(), buf.size() };
+        }
+
+    } // end anonymous namespace
+
+    WritesGoldenMatcher::WritesGoldenMatcher( std::string const& path ) : m_path( path ) {}
+
+    bool WritesGoldenMatcher::match( StreamProducer const& producer ) const {
+        FileDigest golden;
+        if( !lookupGoldenDigest( m_path, golden ) ) {
+            recordGolden( m_path, producer );
+            m_outcome = " (recorded)";
+            return true;
+        }
+
+        HashingStreamBuf buf;
+        std::ostream stream( &buf );
+        producer( stream );
+
+        if( buf.digest() == golden.digest && buf.size() == golden.size )
+            return true;
+
+        if( getCurrentContext().getConfig()->updateSnapshots() ) {
+            recordGolden( m_path, producer );
+            m_outcome = " (updated)";
+            return true;
+        }
+
+        ReusableStringStream rss;
+        rss << " (produced " << buf.size() << " bytes, golden has " << golden.size << " bytes)";
+        m_outcome = rss.str();
+        return false;
+    }
+
+    std::string WritesGoldenMatcher::describe() const {
+        return "writes output matching golden file '" + m_path + "'" + m_outcome;
+    }
+
+} // namespace GoldenFile
+
+    GoldenFile::WritesGoldenMatcher WritesGolden( std::string const& path ) {
+        return GoldenFile::WritesGoldenMatcher( path );
+    }
+
+} // namespace Matchers
+} // namespace Catch
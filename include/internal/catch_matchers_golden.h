@@ -0,0 +1,43 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_MATCHERS_GOLDEN_H_INCLUDED
+#define TWOBLUECUBES_CATCH_MATCHERS_GOLDEN_H_INCLUDED
+
+#include "catch_matchers.h"
+
+#include <functional>
+#include <iosfwd>
+#include <string>
+
+namespace Catch {
+namespace Matchers {
+
+    namespace GoldenFile {
+
+        using StreamProducer = std::function<void( std::ostream& )>;
+
+        struct WritesGoldenMatcher : MatcherBase<StreamProducer> {
+            WritesGoldenMatcher( std::string const& path );
+            bool match( StreamProducer const& producer ) const override;
+            std::string describe() const override;
+
+        private:
+            std::string m_path;
+            mutable std::string m_outcome; // detail filled in by match, reported by describe
+        };
+
+    } // namespace GoldenFile
+
+    // Matches a callable that writes its output to a std::ostream. The
+    // output is hashed incrementally as it is produced and the digest
+    // compared against the golden file's - neither side is ever held in
+    // memory whole. A missing golden file is recorded from the producer's
+    // output and matches; --update-snapshots rewrites one that differs.
+    GoldenFile::WritesGoldenMatcher WritesGolden( std::string const& path );
+
+} // namespace Matchers
+} // namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_MATCHERS_GOLDEN_H_INCLUDED
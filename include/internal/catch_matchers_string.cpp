@@ -10,6 +10,7 @@
 #include "catch_string_manip.h"
 #include "catch_tostring.h"
 
+#include <cctype>
 #include <regex>
 
 namespace Catch {
@@ -17,6 +18,20 @@ namespace Matchers {
 
     namespace StdString {
 
+        namespace {
+            char toLowerCh( char c ) {
+                return static_cast<char>( std::tolower( c ) );
+            }
+            // Compares a slice of the candidate against the already folded
+            // reference string, folding the candidate character-wise
+            bool foldedEqualAt( std::string const& source, std::size_t pos, std::string const& folded ) {
+                for( std::size_t i = 0; i < folded.size(); ++i )
+                    if( toLowerCh( source[pos + i] ) != folded[i] )
+                        return false;
+                return true;
+            }
+        }
+
         CasedString::CasedString( std::string const& str, CaseSensitive::Choice caseSensitivity )
         :   m_caseSensitivity( caseSensitivity ),
             m_str( adjustString( str ) )
@@ -32,6 +47,32 @@ namespace Matchers {
                    : std::string();
         }
 
+        bool CasedString::equals( std::string const& source ) const {
+            if( m_caseSensitivity == CaseSensitive::Yes )
+                return source == m_str;
+            return source.size() == m_str.size() && foldedEqualAt( source, 0, m_str );
+        }
+        bool CasedString::contains( std::string const& source ) const {
+            if( m_caseSensitivity == CaseSensitive::Yes )
+                return Catch::contains( source, m_str );
+            if( source.size() < m_str.size() )
+                return false;
+            for( std::size_t pos = 0; pos <= source.size() - m_str.size(); ++pos )
+                if( foldedEqualAt( source, pos, m_str ) )
+                    return true;
+            return false;
+        }
+        bool CasedString::startsWith( std::string const& source ) const {
+            if( m_caseSensitivity == CaseSensitive::Yes )
+                return Catch::startsWith( source, m_str );
+            return source.size() >= m_str.size() && foldedEqualAt( source, 0, m_str );
+        }
+        bool CasedString::endsWith( std::string const& source ) const {
+            if( m_caseSensitivity == CaseSensitive::Yes )
+                return Catch::endsWith( source, m_str );
+            return source.size() >= m_str.size() && foldedEqualAt( source, source.size() - m_str.size(), m_str );
+        }
+
 
         StringMatcherBase::StringMatcherBase( std::string const& operation, CasedString const& comparator )
         : m_comparator( comparator ),
@@ -53,28 +94,28 @@ namespace Matchers {
         EqualsMatcher::EqualsMatcher( CasedString const& comparator ) : StringMatcherBase( "equals", comparator ) {}
 
         bool EqualsMatcher::match( std::string const& source ) const {
-            return m_comparator.adjustString( source ) == m_comparator.m_str;
+            return m_comparator.equals( source );
         }
 
 
         ContainsMatcher::ContainsMatcher( CasedString const& comparator ) : StringMatcherBase( "contains", comparator ) {}
 
         bool ContainsMatcher::match( std::string const& source ) const {
-            return contains( m_comparator.adjustString( source ), m_comparator.m_str );
+            return m_comparator.contains( source );
         }
 
 
         StartsWithMatcher::StartsWithMatcher( CasedString const& comparator ) : StringMatcherBase( "starts with", comparator ) {}
 
         bool StartsWithMatcher::match( std::string const& source ) const {
-            return startsWith( m_comparator.adjustString( source ), m_comparator.m_str );
+            return m_comparator.startsWith( source );
         }
 
 
         EndsWithMatcher::EndsWithMatcher( CasedString const& comparator ) : StringMatcherBase( "ends with", comparator ) {}
 
         bool EndsWithMatcher::match( std::string const& source ) const {
-            return endsWith( m_comparator.adjustString( source ), m_comparator.m_str );
+            return m_comparator.endsWith( source );
         }
 
 
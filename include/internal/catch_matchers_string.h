@@ -23,6 +23,15 @@ namespace Matchers {
             std::string adjustString( std::string const& str ) const;
             std::string caseSensitivitySuffix() const;
 
+            // Comparisons against the reference string. The reference is
+            // folded once, at construction, and the candidate is folded a
+            // character at a time during the compare, so no temporary
+            // strings are built per match
+            bool equals( std::string const& source ) const;
+            bool contains( std::string const& source ) const;
+            bool startsWith( std::string const& source ) const;
+            bool endsWith( std::string const& source ) const;
+
             CaseSensitive::Choice m_caseSensitivity;
             std::string m_str;
         };
@@ -11,6 +11,12 @@
 #include "catch_matchers.h"
 
 #include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace Catch {
 namespace Matchers {
@@ -36,6 +42,17 @@ namespace Matchers {
                 }
                 return false;
             }
+
+            template <typename...>
+            struct Void { using type = void; };
+
+            // Detects whether std::hash<T> is usable, so UnorderedEquals
+            // can take the O(n) counting path and still work (quadratically)
+            // for types that only provide operator==
+            template <typename T, typename = void>
+            struct IsHashable : std::false_type {};
+            template <typename T>
+            struct IsHashable<T, typename Void<decltype(std::declval<std::hash<T>>()(std::declval<T const&>()))>::type> : std::true_type {};
         }
 
         template<typename T>
@@ -116,8 +133,56 @@ namespace Matchers {
         struct UnorderedEqualsMatcher : MatcherBase<std::vector<T>> {
             UnorderedEqualsMatcher(std::vector<T> const& target) : m_target(target) {}
             bool match(std::vector<T> const& vec) const override {
-                // Note: This is a reimplementation of std::is_permutation,
-                //       because I don't want to include <algorithm> inside the common path
+                m_difference.clear();
+                return matchCounted(vec, Detail::IsHashable<T>());
+            }
+
+            std::string describe() const override {
+                return "UnorderedEquals: " + ::Catch::Detail::stringify(m_target) + m_difference;
+            }
+        private:
+            // Hashable types: build a multiset of counts from the target
+            // and stream the other side through it - O(n) with a single
+            // allocation, and the leftover counts are exactly the symmetric
+            // difference to report on failure
+            bool matchCounted(std::vector<T> const& vec, std::true_type) const {
+                std::unordered_map<T, std::ptrdiff_t> counts;
+                counts.reserve(m_target.size());
+                for (auto const& el : m_target) {
+                    ++counts[el];
+                }
+                for (auto const& el : vec) {
+                    --counts[el];
+                }
+                // Walk the original sequences rather than the map so the
+                // reported differences come out in a deterministic order
+                std::vector<T> missing, extra;
+                for (auto const& el : m_target) {
+                    auto& count = counts[el];
+                    if (count > 0) {
+                        missing.push_back(el);
+                        --count;
+                    }
+                }
+                for (auto const& el : vec) {
+                    auto& count = counts[el];
+                    if (count < 0) {
+                        extra.push_back(el);
+                        ++count;
+                    }
+                }
+                if (missing.empty() && extra.empty()) {
+                    return true;
+                }
+                m_difference = " ( missing " + ::Catch::Detail::stringify(missing)
+                             + ", extra " + ::Catch::Detail::stringify(extra) + " )";
+                return false;
+            }
+
+            // Types with only operator==: a reimplementation of
+            // std::is_permutation, because I don't want to include
+            // <algorithm> inside the common path
+            bool matchCounted(std::vector<T> const& vec, std::false_type) const {
                 if (m_target.size() != vec.size()) {
                     return false;
                 }
@@ -145,11 +210,10 @@ namespace Matchers {
                 return true;
             }
 
-            std::string describe() const override {
-                return "UnorderedEquals: " + ::Catch::Detail::stringify(m_target);
-            }
-        private:
             std::vector<T> const& m_target;
+            // Written by match(), read by describe(); matchers are
+            // match-then-describe within one assertion
+            mutable std::string m_difference;
         };
 
     } // namespace Vector
@@ -89,4 +89,26 @@ namespace Catch {
         m_captured++;
     }
 
+
+    DeferredMessageBase::DeferredMessageBase( StringRef macroName,
+                                              SourceLineInfo const& lineInfo,
+                                              StringRef name )
+    :   m_info( macroName, lineInfo, ResultWas::Info ),
+        m_name( name )
+    {
+        getResultCapture().pushDeferredMessage( this );
+    }
+
+    DeferredMessageBase::~DeferredMessageBase() {
+        if ( !uncaught_exceptions() ){
+            getResultCapture().popDeferredMessage( this );
+        }
+    }
+
+    MessageInfo DeferredMessageBase::materialise() const {
+        MessageInfo info = m_info;
+        info.message = m_name + " := " + stringifyValue();
+        return info;
+    }
+
 } // end namespace Catch
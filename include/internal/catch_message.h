@@ -15,6 +15,7 @@
 #include "catch_tostring.h"
 
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace Catch {
@@ -91,6 +92,57 @@ namespace Catch {
         }
     };
 
+    // Deferred variant of CAPTURE: instead of stringifying the value at
+    // scope entry, only the value itself is held (small trivial values by
+    // copy, anything else by reference) and it is turned into text on
+    // demand, when an assertion in scope actually needs reporting. This
+    // keeps captures in tight loops nearly free along the passing path.
+    class DeferredMessageBase {
+    public:
+        DeferredMessageBase( StringRef macroName,
+                             SourceLineInfo const& lineInfo,
+                             StringRef name );
+        DeferredMessageBase( DeferredMessageBase const& ) = delete;
+        DeferredMessageBase& operator = ( DeferredMessageBase const& ) = delete;
+
+        MessageInfo materialise() const;
+
+    protected:
+        ~DeferredMessageBase();
+
+    private:
+        virtual std::string stringifyValue() const = 0;
+
+        MessageInfo m_info;
+        StringRef m_name;
+    };
+
+    template<typename T>
+    class DeferredCapture : public DeferredMessageBase {
+        // Arithmetic, pointer and enum values are copied; anything else is
+        // captured by reference and must outlive the capture's scope, just
+        // as its value must stay meaningful for the lifetime of an eager
+        // CAPTURE's text
+        using Storage = typename std::conditional<
+            std::is_arithmetic<T>::value || std::is_pointer<T>::value || std::is_enum<T>::value,
+            T,
+            T const&>::type;
+
+        Storage m_value;
+
+        std::string stringifyValue() const override {
+            return ::Catch::Detail::stringify( m_value );
+        }
+    public:
+        DeferredCapture( StringRef macroName,
+                         SourceLineInfo const& lineInfo,
+                         StringRef name,
+                         T const& value )
+        :   DeferredMessageBase( macroName, lineInfo, name ),
+            m_value( value )
+        {}
+    };
+
 } // end namespace Catch
 
 #endif // TWOBLUECUBES_CATCH_MESSAGE_H_INCLUDED
@@ -23,6 +23,9 @@
     #else
     #include <unistd.h>  // dup and dup2
     #endif
+    #if defined(CATCH_PLATFORM_LINUX)
+    #include <sys/syscall.h> // __NR_memfd_create
+    #endif
 #endif
 
 
@@ -67,7 +70,22 @@ namespace Catch {
     }
 #else
     TempFile::TempFile() {
-        m_file = std::tmpfile();
+#if defined(CATCH_PLATFORM_LINUX) && defined(__NR_memfd_create)
+        // Prefer an anonymous memory-backed file, so captured output never
+        // touches disk. Raw syscall, so we don't require the glibc 2.27
+        // wrapper at build time; on older kernels it fails with ENOSYS and
+        // we fall back to a temp file.
+        int fd = static_cast<int>(syscall(__NR_memfd_create, "catch2-capture", 1u /* MFD_CLOEXEC */));
+        if (fd != -1) {
+            m_file = fdopen(fd, "w+");
+            if (!m_file) {
+                close(fd);
+            }
+        }
+#endif
+        if (!m_file) {
+            m_file = std::tmpfile();
+        }
         if (!m_file) {
             CATCH_RUNTIME_ERROR("Could not create a temp file.");
         }
@@ -91,20 +109,72 @@ namespace Catch {
     }
 
     std::string TempFile::getContents() {
-        std::stringstream sstr;
-        char buffer[100] = {};
-        std::rewind(m_file);
-        while (std::fgets(buffer, sizeof(buffer), m_file)) {
-            sstr << buffer;
+        // Reads through the descriptor rather than the stream: the test
+        // wrote through a dup2'd copy of the descriptor, so the stream's
+        // buffer never saw the data (and could even hold stale bytes from
+        // a previous test when the file is reused)
+        int fd = fileno(m_file);
+#if defined(_MSC_VER)
+        auto size = _lseek(fd, 0, SEEK_END);
+        _lseek(fd, 0, SEEK_SET);
+#else
+        auto size = lseek(fd, 0, SEEK_END);
+        lseek(fd, 0, SEEK_SET);
+#endif
+        if (size < 0) {
+            CATCH_RUNTIME_ERROR("Could not size the captured output file");
+        }
+
+        // One sized read instead of a line-by-line loop - also keeps
+        // embedded NULs and unterminated last lines intact
+        std::string contents(static_cast<std::size_t>(size), '\0');
+        std::size_t pos = 0;
+        while (pos < contents.size()) {
+#if defined(_MSC_VER)
+            auto rc = _read(fd, &contents[pos], static_cast<unsigned>(contents.size() - pos));
+#else
+            auto rc = read(fd, &contents[pos], contents.size() - pos);
+#endif
+            if (rc <= 0) {
+                CATCH_RUNTIME_ERROR("Could not read back the captured output");
+            }
+            pos += static_cast<std::size_t>(rc);
+        }
+        return contents;
+    }
+
+    void TempFile::clear() {
+        // Truncate and reposition the descriptor itself - its offset is
+        // what the next dup2'd writes will continue from
+#if defined(_MSC_VER)
+        if (_chsize_s(fileno(m_file), 0)) {
+            CATCH_RUNTIME_ERROR("Could not truncate the captured output file");
+        }
+        _lseek(fileno(m_file), 0, SEEK_SET);
+#else
+        if (ftruncate(fileno(m_file), 0)) {
+            CATCH_RUNTIME_ERROR("Could not truncate the captured output file");
         }
-        return sstr.str();
+        lseek(fileno(m_file), 0, SEEK_SET);
+#endif
     }
 
-    OutputRedirect::OutputRedirect(std::string& stdout_dest, std::string& stderr_dest) :
+    OutputRedirect::OutputRedirect(TempFile& stdoutFile, TempFile& stderrFile, std::string& stdout_dest, std::string& stderr_dest) :
         m_originalStdout(dup(1)),
         m_originalStderr(dup(2)),
+        m_stdoutFile(stdoutFile),
+        m_stderrFile(stderrFile),
         m_stdoutDest(stdout_dest),
         m_stderrDest(stderr_dest) {
+        // Flush anything still buffered before swapping the descriptors,
+        // so earlier output (e.g. a reporter's preamble) is not captured
+        // as if the test had written it
+        Catch::cout() << std::flush;
+        fflush(stdout);
+        Catch::cerr() << std::flush;
+        Catch::clog() << std::flush;
+        fflush(stderr);
+
         dup2(fileno(m_stdoutFile.getFile()), 1);
         dup2(fileno(m_stderrFile.getFile()), 2);
     }
@@ -123,6 +193,8 @@ namespace Catch {
 
         m_stdoutDest += m_stdoutFile.getContents();
         m_stderrDest += m_stderrFile.getContents();
+        m_stdoutFile.clear();
+        m_stderrFile.clear();
     }
 
 #endif // CATCH_CONFIG_NEW_CAPTURE
@@ -7,6 +7,7 @@
 #ifndef TWOBLUECUBES_CATCH_OUTPUT_REDIRECT_H
 #define TWOBLUECUBES_CATCH_OUTPUT_REDIRECT_H
 
+#include "catch_compiler_capabilities.h"
 #include "catch_platform.h"
 #include "catch_stream.h"
 
@@ -52,7 +53,9 @@ namespace Catch {
     // Windows's implementation of std::tmpfile is terrible (it tries
     // to create a file inside system folder, thus requiring elevated
     // privileges for the binary), so we have to use tmpnam(_s) and
-    // create the file ourselves there.
+    // create the file ourselves there. On Linux the file is backed by
+    // anonymous memory (memfd_create) where available, so captured
+    // output never touches disk.
     class TempFile {
     public:
         TempFile(TempFile const&) = delete;
@@ -65,6 +68,9 @@ namespace Catch {
 
         std::FILE* getFile();
         std::string getContents();
+        // Truncates back to empty so the handle can be reused for the
+        // next test case instead of opening a fresh file
+        void clear();
 
     private:
         std::FILE* m_file = nullptr;
@@ -82,14 +88,16 @@ namespace Catch {
         OutputRedirect& operator=(OutputRedirect&&) = delete;
 
 
-        OutputRedirect(std::string& stdout_dest, std::string& stderr_dest);
+        // The capture files are owned by the caller (and cleared again on
+        // the way out), so their handles can be reused across test cases
+        OutputRedirect(TempFile& stdoutFile, TempFile& stderrFile, std::string& stdout_dest, std::string& stderr_dest);
         ~OutputRedirect();
 
     private:
         int m_originalStdout = -1;
         int m_originalStderr = -1;
-        TempFile m_stdoutFile;
-        TempFile m_stderrFile;
+        TempFile& m_stdoutFile;
+        TempFile& m_stderrFile;
         std::string& m_stdoutDest;
         std::string& m_stderrDest;
     };
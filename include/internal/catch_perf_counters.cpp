@@ -0,0 +1,105 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_perf_counters.h"
+#include "catch_platform.h"
+
+#if defined(CATCH_PLATFORM_LINUX)
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Catch {
+
+#if defined(CATCH_PLATFORM_LINUX)
+
+    namespace {
+        auto openCounter( uint32_t type, uint64_t eventConfig, int groupFd ) -> int {
+            perf_event_attr attr;
+            std::memset( &attr, 0, sizeof( attr ) );
+            attr.type = type;
+            attr.size = sizeof( attr );
+            attr.config = eventConfig;
+            // The group leader starts disabled and carries the others with it
+            attr.disabled = groupFd == -1 ? 1 : 0;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP;
+            return static_cast<int>( syscall( __NR_perf_event_open, &attr, 0, -1, groupFd, 0 ) );
+        }
+    }
+
+    PerfCounterSampler::~PerfCounterSampler() {
+        for( int fd : m_fds )
+            if( fd != -1 )
+                close( fd );
+    }
+
+    void PerfCounterSampler::open() {
+        // All four counters in one group, so they are scheduled onto the PMU
+        // together and a single read returns a consistent snapshot
+        m_fds[0] = openCounter( PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1 );
+        if( m_fds[0] == -1 )
+            return;
+        m_fds[1] = openCounter( PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, m_fds[0] );
+        m_fds[2] = openCounter( PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, m_fds[0] );
+        m_fds[3] = openCounter( PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, m_fds[0] );
+        for( int fd : m_fds ) {
+            if( fd == -1 ) {
+                // Partial groups would report misleading numbers; all or nothing
+                for( int& openFd : m_fds ) {
+                    if( openFd != -1 )
+                        close( openFd );
+                    openFd = -1;
+                }
+                return;
+            }
+        }
+    }
+
+    void PerfCounterSampler::start() {
+        if( m_fds[0] != -1 )
+            ioctl( m_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP );
+    }
+    void PerfCounterSampler::stop() {
+        if( m_fds[0] != -1 )
+            ioctl( m_fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP );
+    }
+
+    auto PerfCounterSampler::read() const -> PerfCounters {
+        PerfCounters counters;
+        if( m_fds[0] == -1 )
+            return counters;
+
+        // PERF_FORMAT_GROUP layout: the number of counters, then one value
+        // per counter in the order they were opened
+        uint64_t buffer[5];
+        if( ::read( m_fds[0], buffer, sizeof( buffer ) ) != sizeof( buffer ) || buffer[0] != 4 )
+            return counters;
+
+        counters.sampled = true;
+        counters.cycles = buffer[1];
+        counters.instructions = buffer[2];
+        counters.cacheMisses = buffer[3];
+        counters.branchMisses = buffer[4];
+        return counters;
+    }
+
+#else // ^^ CATCH_PLATFORM_LINUX / vv everything else
+
+    PerfCounterSampler::~PerfCounterSampler() {}
+    void PerfCounterSampler::open() {}
+    void PerfCounterSampler::start() {}
+    void PerfCounterSampler::stop() {}
+    auto PerfCounterSampler::read() const -> PerfCounters {
+        return PerfCounters();
+    }
+
+#endif // CATCH_PLATFORM_LINUX
+
+} // end namespace Catch
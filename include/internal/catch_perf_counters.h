@@ -0,0 +1,45 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_PERF_COUNTERS_H_INCLUDED
+#define TWOBLUECUBES_CATCH_PERF_COUNTERS_H_INCLUDED
+
+#include <cstdint>
+
+namespace Catch {
+
+    // Hardware performance counters accumulated over the timed region of a
+    // BENCHMARK when --benchmark-perf-counters is given. Only available on
+    // Linux via perf_event_open; elsewhere, or when the kernel denies access
+    // (see /proc/sys/kernel/perf_event_paranoid), sampled stays false and
+    // reporters skip the values.
+    struct PerfCounters {
+        bool sampled = false;
+        uint64_t cycles = 0;
+        uint64_t instructions = 0;
+        uint64_t cacheMisses = 0;
+        uint64_t branchMisses = 0;
+    };
+
+    // Owns the counter file descriptors. The counters only run between
+    // start() and stop(), so the benchmark bookkeeping between samples is
+    // not attributed to the measured code. All methods are no-ops until
+    // open() succeeds.
+    class PerfCounterSampler {
+        int m_fds[4] = { -1, -1, -1, -1 };
+    public:
+        PerfCounterSampler() = default;
+        PerfCounterSampler( PerfCounterSampler const& ) = delete;
+        PerfCounterSampler& operator = ( PerfCounterSampler const& ) = delete;
+        ~PerfCounterSampler();
+
+        void open();
+        void start();
+        void stop();
+        auto read() const -> PerfCounters;
+    };
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_PERF_COUNTERS_H_INCLUDED
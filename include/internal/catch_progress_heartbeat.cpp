@@ -0,0 +1,88 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_progress_heartbeat.h"
+#include "catch_platform.h"
+#include "catch_timer.h"
+
+#include <atomic>
+
+#if defined(CATCH_PLATFORM_WINDOWS)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace Catch {
+    namespace ProgressHeartbeat {
+        namespace {
+
+            // At most one record per interval however fast tests complete,
+            // so the monitor's read side costs nanoseconds per test case
+            // and the channel can never grow unboundedly
+            constexpr uint64_t minIntervalNanos = 100 * 1000 * 1000;
+
+            std::atomic<int> s_fd{ -1 };
+            std::atomic<uint32_t> s_started{ 0 };
+            std::atomic<uint32_t> s_completed{ 0 };
+            std::atomic<uint64_t> s_lastWriteNanos{ 0 };
+
+            void writeRecord( int fd, Record const& record ) {
+#if defined(CATCH_PLATFORM_WINDOWS)
+                auto written = _write( fd, &record, static_cast<unsigned int>( sizeof(record) ) );
+#else
+                auto written = ::write( fd, &record, sizeof(record) );
+#endif
+                // A dead monitor must not break the run - stop writing
+                // rather than fail on every subsequent test case
+                if( written != static_cast<decltype(written)>( sizeof(record) ) )
+                    s_fd.store( -1, std::memory_order_relaxed );
+            }
+
+            void maybeWrite( bool force ) {
+                int fd = s_fd.load( std::memory_order_relaxed );
+                if( fd < 0 )
+                    return;
+                uint64_t now = getCurrentNanosecondsSinceEpoch();
+                if( !force ) {
+                    uint64_t last = s_lastWriteNanos.load( std::memory_order_relaxed );
+                    if( now - last < minIntervalNanos )
+                        return;
+                    // Exactly one worker claims each interval
+                    if( !s_lastWriteNanos.compare_exchange_strong( last, now, std::memory_order_relaxed ) )
+                        return;
+                }
+                else {
+                    s_lastWriteNanos.store( now, std::memory_order_relaxed );
+                }
+                Record record;
+                record.timestampNanos = now;
+                record.testsCompleted = s_completed.load( std::memory_order_relaxed );
+                record.currentTestIndex = s_started.load( std::memory_order_relaxed );
+                writeRecord( fd, record );
+            }
+
+        } // anonymous namespace
+
+        void configure( int fd ) {
+            s_fd.store( fd, std::memory_order_relaxed );
+        }
+
+        void testCaseStarting() {
+            s_started.fetch_add( 1, std::memory_order_relaxed );
+            maybeWrite( false );
+        }
+
+        void testCaseEnded() {
+            s_completed.fetch_add( 1, std::memory_order_relaxed );
+            maybeWrite( false );
+        }
+
+        void runEnded() {
+            maybeWrite( true );
+        }
+
+    } // namespace ProgressHeartbeat
+} // namespace Catch
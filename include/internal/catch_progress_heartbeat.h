@@ -0,0 +1,41 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_PROGRESS_HEARTBEAT_H_INCLUDED
+#define TWOBLUECUBES_CATCH_PROGRESS_HEARTBEAT_H_INCLUDED
+
+#include <cstdint>
+
+namespace Catch {
+
+    // Liveness side-channel for external watchdogs (--progress-fd).
+    // Fixed-size binary records are written to a user-supplied file
+    // descriptor at a bounded rate, independently of any reporter, so a
+    // monitor can tell a live run from a hung one without forcing verbose
+    // console output. Counters are process-wide atomics, so heartbeats
+    // stay coherent when tests run on a --jobs worker pool.
+    namespace ProgressHeartbeat {
+
+        // One record per heartbeat, written with a single write() so
+        // records never interleave on a pipe
+        struct Record {
+            uint64_t timestampNanos;    // wall clock, since epoch
+            uint32_t testsCompleted;    // test cases finished so far
+            uint32_t currentTestIndex;  // 1-based count of test cases started
+        };
+
+        // fd < 0 disables (the default); called once at run start
+        void configure( int fd );
+
+        void testCaseStarting();
+        void testCaseEnded();
+
+        // Writes a final record regardless of the rate bound, so the
+        // monitor always observes the finished state
+        void runEnded();
+
+    } // namespace ProgressHeartbeat
+} // namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_PROGRESS_HEARTBEAT_H_INCLUDED
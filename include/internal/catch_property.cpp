@@ -0,0 +1,193 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_property.h"
+#include "catch_context.h"
+#include "catch_interfaces_config.h"
+#include "catch_stream.h"
+
+namespace Catch {
+
+    namespace {
+
+        // splitmix64 - small, fast and bit-identical on every platform, so
+        // a failing property reproduces from the same --rng-seed anywhere
+        std::uint64_t splitmix64( std::uint64_t& state ) {
+            std::uint64_t z = ( state += 0x9e3779b97f4a7c15ULL );
+            z = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+            z = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebULL;
+            return z ^ ( z >> 31 );
+        }
+
+        std::int64_t clampIntegral( std::int64_t value, std::int64_t lo, std::int64_t hi ) {
+            return value < lo ? lo : value > hi ? hi : value;
+        }
+        double clampFloat( double value, double lo, double hi ) {
+            return value < lo ? lo : value > hi ? hi : value;
+        }
+
+    } // end anonymous namespace
+
+    std::uint64_t PropertyContext::nextRandom() {
+        return splitmix64( m_rngState );
+    }
+
+    std::int64_t PropertyContext::drawIntegral( std::int64_t lo, std::int64_t hi ) {
+        if( m_replaying && m_replayIndex < m_draws.size() ) {
+            auto& draw = m_draws[m_replayIndex++];
+            // Bounds can differ between runs if earlier draws changed;
+            // clamping keeps the replayed value legal for this call site
+            return clampIntegral( draw.iValue, lo, hi );
+        }
+        auto range = static_cast<std::uint64_t>( hi - lo ) + 1;
+        auto value = range == 0
+            ? static_cast<std::int64_t>( nextRandom() )
+            : lo + static_cast<std::int64_t>( nextRandom() % range ); // modulo bias is harmless for test data
+        m_draws.push_back( Draw{ true, value, lo, hi, 0.0, 0.0, 0.0 } );
+        ++m_replayIndex;
+        return value;
+    }
+
+    double PropertyContext::drawFloat( double lo, double hi ) {
+        if( m_replaying && m_replayIndex < m_draws.size() ) {
+            auto& draw = m_draws[m_replayIndex++];
+            return clampFloat( draw.dValue, lo, hi );
+        }
+        auto unit = static_cast<double>( nextRandom() >> 11 ) * ( 1.0 / 9007199254740992.0 ); // [0,1)
+        auto value = lo + unit * ( hi - lo );
+        m_draws.push_back( Draw{ false, 0, 0, 0, value, lo, hi } );
+        ++m_replayIndex;
+        return value;
+    }
+
+    std::string PropertyResult::description() const {
+        ReusableStringStream rss;
+        if( failed )
+            rss << "Property failed for inputs " << counterexample
+                << " (case " << casesRun << ", " << shrinks << " shrinks)";
+        else
+            rss << "Property held for " << casesRun << " cases";
+        return rss.str();
+    }
+
+    // All access to PropertyContext's recorded draws goes through here; the
+    // context's public face stays limited to what a property may call
+    struct PropertyChecker {
+        using Draw = PropertyContext::Draw;
+
+        // Re-runs the property against a fixed set of draws. Extra draws
+        // beyond the recorded ones (data-dependent properties) fall back
+        // to fresh random values from the given state.
+        static bool replayFails( std::function<bool( PropertyContext& )> const& property,
+                                 std::vector<Draw> const& draws,
+                                 std::uint64_t rngState ) {
+            PropertyContext ctx;
+            ctx.m_draws = draws;
+            ctx.m_replaying = true;
+            ctx.m_rngState = rngState;
+            return !property( ctx );
+        }
+
+        static PropertyResult run( std::size_t cases, std::function<bool( PropertyContext& )> const& property ) {
+            PropertyResult result;
+
+            std::uint64_t baseSeed = 0;
+            if( auto config = getCurrentContext().getConfig() )
+                baseSeed = config->rngSeed();
+
+            for( std::size_t caseIndex = 0; caseIndex < cases; ++caseIndex ) {
+                auto caseState = ( baseSeed + 1 ) * 0x9e3779b97f4a7c15ULL + caseIndex;
+
+                PropertyContext ctx;
+                ctx.m_rngState = caseState;
+                bool held = property( ctx );
+                ++result.casesRun;
+                if( held )
+                    continue;
+
+                result.failed = true;
+                shrink( property, ctx.m_draws, caseState, result );
+                break;
+            }
+            return result;
+        }
+
+        // Repeatedly pulls each recorded draw towards zero (or its lower
+        // bound) and keeps any simplification that still fails, until
+        // nothing improves or the replay budget runs out
+        static void shrink( std::function<bool( PropertyContext& )> const& property,
+                            std::vector<Draw> draws,
+                            std::uint64_t caseState,
+                            PropertyResult& result ) {
+            std::size_t budget = 1000;
+            bool improved = true;
+            while( improved && budget > 0 ) {
+                improved = false;
+                for( std::size_t i = 0; i < draws.size() && budget > 0; ++i ) {
+                    auto& draw = draws[i];
+                    if( draw.isIntegral ) {
+                        auto target = clampIntegral( 0, draw.iLo, draw.iHi );
+                        std::int64_t candidates[] = {
+                            target,
+                            target + ( draw.iValue - target ) / 2,
+                            draw.iValue - ( draw.iValue > target ? 1 : -1 )
+                        };
+                        for( auto candidate : candidates ) {
+                            if( candidate == draw.iValue || budget == 0 )
+                                continue;
+                            auto previous = draw.iValue;
+                            draw.iValue = candidate;
+                            --budget;
+                            if( replayFails( property, draws, caseState ) ) {
+                                ++result.shrinks;
+                                improved = true;
+                                break;
+                            }
+                            draw.iValue = previous;
+                        }
+                    }
+                    else {
+                        auto target = clampFloat( 0.0, draw.dLo, draw.dHi );
+                        double candidates[] = {
+                            target,
+                            target + ( draw.dValue - target ) / 2
+                        };
+                        for( auto candidate : candidates ) {
+                            if( candidate == draw.dValue || budget == 0 )
+                                continue;
+                            auto previous = draw.dValue;
+                            draw.dValue = candidate;
+                            --budget;
+                            if( replayFails( property, draws, caseState ) ) {
+                                ++result.shrinks;
+                                improved = true;
+                                break;
+                            }
+                            draw.dValue = previous;
+                        }
+                    }
+                }
+            }
+
+            ReusableStringStream rss;
+            rss << "[";
+            for( std::size_t i = 0; i < draws.size(); ++i ) {
+                if( i > 0 )
+                    rss << ", ";
+                if( draws[i].isIntegral )
+                    rss << draws[i].iValue;
+                else
+                    rss << draws[i].dValue;
+            }
+            rss << "]";
+            result.counterexample = rss.str();
+        }
+    };
+
+    PropertyResult checkProperty( std::size_t cases, std::function<bool( PropertyContext& )> const& property ) {
+        return PropertyChecker::run( cases, property );
+    }
+
+} // end namespace Catch
@@ -0,0 +1,92 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_PROPERTY_H_INCLUDED
+#define TWOBLUECUBES_CATCH_PROPERTY_H_INCLUDED
+
+#include "catch_capture.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Catch {
+
+    // Hands random inputs to a property. While a property is being
+    // exercised each draw is recorded, so that when a case fails the
+    // engine can replay the property with systematically simplified
+    // inputs (shrinking) and report the smallest failure it finds.
+    class PropertyContext {
+        struct Draw {
+            bool isIntegral;
+            std::int64_t iValue, iLo, iHi;
+            double dValue, dLo, dHi;
+        };
+
+    public:
+        template<typename T>
+        T random( T lo, T hi ) {
+            return static_cast<T>( drawIntegral( static_cast<std::int64_t>( lo ), static_cast<std::int64_t>( hi ) ) );
+        }
+        double random( double lo, double hi ) {
+            return drawFloat( lo, hi );
+        }
+        bool randomBool() {
+            return drawIntegral( 0, 1 ) != 0;
+        }
+
+    private:
+        friend struct PropertyChecker;
+
+        std::int64_t drawIntegral( std::int64_t lo, std::int64_t hi );
+        double drawFloat( double lo, double hi );
+
+        std::uint64_t nextRandom();
+
+        std::uint64_t m_rngState = 0;
+        std::vector<Draw> m_draws;
+        std::size_t m_replayIndex = 0;
+        bool m_replaying = false;
+    };
+
+    struct PropertyResult {
+        bool failed = false;
+        std::size_t casesRun = 0;
+        std::size_t shrinks = 0;
+        std::string counterexample;
+
+        // The one-line outcome that backs the property's single assertion
+        std::string description() const;
+    };
+
+    // Runs the property against the given number of random cases and, on
+    // the first case that returns false, shrinks the recorded inputs
+    // before reporting. Exceptions thrown by the property propagate and
+    // are handled like any other unexpected exception.
+    PropertyResult checkProperty( std::size_t cases, std::function<bool( PropertyContext& )> const& property );
+
+} // end namespace Catch
+
+///////////////////////////////////////////////////////////////////////////////
+#define INTERNAL_CATCH_CHECK_PROPERTY( macroName, resultDisposition, cases, ... ) \
+    do { \
+        auto catch_internal_PropertyResult = Catch::checkProperty( static_cast<std::size_t>( cases ), __VA_ARGS__ ); \
+        if( catch_internal_PropertyResult.failed ) { \
+            INTERNAL_CATCH_MSG( macroName, Catch::ResultWas::ExplicitFailure, resultDisposition, catch_internal_PropertyResult.description() ); \
+        } \
+        else { \
+            INTERNAL_CATCH_MSG( macroName, Catch::ResultWas::Ok, Catch::ResultDisposition::ContinueOnFailure, catch_internal_PropertyResult.description() ); \
+        } \
+    } while( false )
+
+// A property is a predicate over random inputs, supplied as a callable
+// taking Catch::PropertyContext&. All cases run through one lightweight
+// inner loop and settle a single assertion, so large case counts do not
+// pay per-case assertion overhead.
+#define CHECK_PROPERTY( cases, ... ) INTERNAL_CATCH_CHECK_PROPERTY( "CHECK_PROPERTY", Catch::ResultDisposition::ContinueOnFailure, cases, __VA_ARGS__ )
+#define REQUIRE_PROPERTY( cases, ... ) INTERNAL_CATCH_CHECK_PROPERTY( "REQUIRE_PROPERTY", Catch::ResultDisposition::Normal, cases, __VA_ARGS__ )
+
+#endif // TWOBLUECUBES_CATCH_PROPERTY_H_INCLUDED
@@ -11,8 +11,27 @@
 
 namespace Catch {
 
+    namespace {
+
+        // Same seed-perturbed FNV-1a the random test ordering uses, so the
+        // derived value is stable across platforms and standard libraries
+        std::uint64_t perTestHash( std::string const& str, std::uint64_t seed ) {
+            std::uint64_t hash = 0xcbf29ce484222325ull ^ ( seed * 0x100000001b3ull );
+            for( char c : str ) {
+                hash ^= static_cast<std::uint64_t>( static_cast<unsigned char>( c ) );
+                hash *= 0x100000001b3ull;
+            }
+            return hash;
+        }
+
+        // Per worker thread, like the context: under --jobs each worker
+        // runs a different test, with its own derived seed
+        thread_local unsigned int s_currentTestSeed = 0;
+
+    } // anon namespace
+
     std::mt19937& rng() {
-        static std::mt19937 s_rng;
+        static thread_local std::mt19937 s_rng;
         return s_rng;
     }
 
@@ -26,4 +45,41 @@ namespace Catch {
     unsigned int rngSeed() {
         return getCurrentContext().getConfig()->rngSeed();
     }
+
+    void seedRngForTest( IConfig const& config, std::string const& testName ) {
+        if( config.rngSeed() == 0 )
+            return;
+        auto hash = perTestHash( testName, config.rngSeed() );
+        auto seed = static_cast<unsigned int>( hash ^ ( hash >> 32 ) );
+        if( seed == 0 )
+            seed = config.rngSeed();
+        s_currentTestSeed = seed;
+        std::srand( seed );
+        rng().seed( seed );
+    }
+
+    unsigned int rngSeedForCurrentTest() {
+        return s_currentTestSeed != 0 ? s_currentTestSeed : rngSeed();
+    }
+
+    void SimplePcg32::seed( std::uint64_t seedValue ) {
+        m_state = 0;
+        (*this)();
+        m_state += seedValue;
+        (*this)();
+    }
+
+    auto SimplePcg32::operator()() -> result_type {
+        auto oldState = m_state;
+        m_state = oldState * 6364136223846793005ULL + 1442695040888963407ULL;
+        auto xorShifted = static_cast<result_type>( ( ( oldState >> 18u ) ^ oldState ) >> 27u );
+        auto rot = static_cast<result_type>( oldState >> 59u );
+        return ( xorShifted >> rot ) | ( xorShifted << ( ( 32u - rot ) & 31u ) );
+    }
+
+    std::uint64_t pcgNext64( SimplePcg32& pcg ) {
+        auto high = pcg();
+        auto low = pcg();
+        return ( static_cast<std::uint64_t>( high ) << 32 ) | low;
+    }
 }
@@ -8,7 +8,9 @@
 #define TWOBLUECUBES_CATCH_RANDOM_NUMBER_GENERATOR_H_INCLUDED
 
 #include <algorithm>
+#include <cstdint>
 #include <random>
+#include <string>
 
 namespace Catch {
 
@@ -18,6 +20,43 @@ namespace Catch {
     void seedRng( IConfig const& config );
     unsigned int rngSeed();
 
+    // Reseeds rng() (and std::srand) with a seed derived from the run seed
+    // and the test name, so a test draws the same values wherever it lands
+    // in a randomised order - rerunning it alone with the same --rng-seed
+    // reproduces it exactly, without replaying the shuffled prefix
+    void seedRngForTest( IConfig const& config, std::string const& testName );
+
+    // The derived seed of the test currently running on this thread, or
+    // the run seed if no per-test seed is in effect
+    unsigned int rngSeedForCurrentTest();
+
+    // A small, fast URBG based on PCG (XSH RR 32/64). Unlike the standard
+    // library engines its output is pinned down here, bit for bit, so the
+    // same seed produces the same values on every platform and standard
+    // library implementation
+    class SimplePcg32 {
+    public:
+        using result_type = std::uint32_t;
+
+        static constexpr result_type (min)() { return 0; }
+        static constexpr result_type (max)() { return static_cast<result_type>( -1 ); }
+
+        explicit SimplePcg32( std::uint64_t seedValue = 0x853c49e6748fea9bULL ) {
+            seed( seedValue );
+        }
+
+        void seed( std::uint64_t seedValue );
+        result_type operator()();
+
+    private:
+        std::uint64_t m_state;
+    };
+
+    // Two sequenced draws widened to 64 bits - written out as a function
+    // because the evaluation order of two calls in one expression is
+    // unspecified before C++17, which would undo the engine's determinism
+    std::uint64_t pcgNext64( SimplePcg32& pcg );
+
 }
 
 #endif // TWOBLUECUBES_CATCH_RANDOM_NUMBER_GENERATOR_H_INCLUDED
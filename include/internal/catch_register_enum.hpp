@@ -0,0 +1,103 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_REGISTER_ENUM_HPP_INCLUDED
+#define TWOBLUECUBES_CATCH_REGISTER_ENUM_HPP_INCLUDED
+
+#include "catch_compiler_capabilities.h"
+#include "catch_tostring.h"
+
+#include <cstdint>
+#include <initializer_list>
+
+// With C++14 relaxed constexpr the whole table - enumerator values and
+// the offsets of their names inside the stringised enumerator list - is
+// laid out at compile time. Without it the same constructor runs once,
+// on first use, as an ordinary function-local static.
+#if defined(CATCH_CONFIG_CPP14_CONSTEXPR)
+#  define CATCH_INTERNAL_ENUM_CONSTEXPR constexpr
+#else
+#  define CATCH_INTERNAL_ENUM_CONSTEXPR
+#endif
+
+namespace Catch {
+    namespace Detail {
+
+        // Number of entries in a stringised enumerator list - one more
+        // than its commas. Enumerator lists cannot be empty.
+        constexpr std::size_t enumeratorCount( char const* names, std::size_t count = 1 ) {
+            return *names == '\0' ? count
+                 : enumeratorCount( names + 1, *names == ',' ? count + 1 : count );
+        }
+
+        // Name table for one registered enum: each entry holds an
+        // enumerator value and the [begin, end) slice of the stringised
+        // enumerator list where its unqualified name lives. The list
+        // itself is the string literal the macro produced, so nothing is
+        // copied and lookup never formats - it returns a slice.
+        template<typename E, std::size_t N>
+        struct EnumTable {
+            struct Entry {
+                E value;
+                std::uint16_t begin;
+                std::uint16_t end;
+            };
+
+            char const* m_names;
+            Entry m_entries[N];
+
+            CATCH_INTERNAL_ENUM_CONSTEXPR EnumTable( char const* names, std::initializer_list<E> values )
+            :   m_names( names ),
+                m_entries{} {
+                std::size_t pos = 0;
+                std::size_t i = 0;
+                for( E value : values ) {
+                    while( names[pos] == ' ' || names[pos] == ',' || names[pos] == '(' || names[pos] == ')' )
+                        ++pos;
+                    std::size_t begin = pos;
+                    while( names[pos] != '\0' && names[pos] != ',' && names[pos] != ' ' && names[pos] != ')' )
+                        ++pos;
+                    std::size_t end = pos;
+                    // Strip any qualification - only the enumerator itself
+                    // is worth reading in a failure message
+                    for( std::size_t j = end; j > begin; --j ) {
+                        if( names[j - 1] == ':' ) {
+                            begin = j;
+                            break;
+                        }
+                    }
+                    m_entries[i].value = value;
+                    m_entries[i].begin = static_cast<std::uint16_t>( begin );
+                    m_entries[i].end = static_cast<std::uint16_t>( end );
+                    ++i;
+                }
+            }
+
+            std::string lookup( E value ) const {
+                // Registered enums have a handful of enumerators, so a
+                // linear scan of the (cache-resident) table beats the
+                // bookkeeping of anything cleverer
+                for( auto const& entry : m_entries )
+                    if( entry.value == value )
+                        return std::string( m_names + entry.begin, entry.end - entry.begin );
+                return convertUnknownEnumToString( value );
+            }
+        };
+
+    } // namespace Detail
+} // namespace Catch
+
+#define CATCH_REGISTER_ENUM( enumName, ... ) \
+    namespace Catch { \
+        template<> struct StringMaker<enumName> { \
+            static std::string convert( enumName value ) { \
+                static CATCH_INTERNAL_ENUM_CONSTEXPR Detail::EnumTable<enumName, \
+                        Detail::enumeratorCount( #__VA_ARGS__ )> \
+                    table( #__VA_ARGS__, { __VA_ARGS__ } ); \
+                return table.lookup( value ); \
+            } \
+        }; \
+    }
+
+#endif // TWOBLUECUBES_CATCH_REGISTER_ENUM_HPP_INCLUDED
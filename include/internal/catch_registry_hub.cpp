@@ -51,6 +51,9 @@ namespace Catch {
             void registerTest( TestCase const& testInfo ) override {
                 m_testCaseRegistry.registerTest( testInfo );
             }
+            void registerTest( ITestInvoker* invoker, SourceLineInfo const& lineInfo, StringRef const& classOrMethod, NameAndTags const& nameAndTags ) override {
+                m_testCaseRegistry.registerTest( invoker, lineInfo, classOrMethod, nameAndTags );
+            }
             void registerTranslator( const IExceptionTranslator* translator ) override {
                 m_exceptionTranslatorRegistry.registerTranslator( translator );
             }
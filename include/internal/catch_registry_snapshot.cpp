@@ -0,0 +1,206 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_registry_snapshot.h"
+#include "catch_platform.h"
+#include "catch_test_case_info.h"
+
+#include <cstring>
+#include <fstream>
+
+#if defined(CATCH_PLATFORM_LINUX) || defined(CATCH_PLATFORM_MAC)
+#define CATCH_INTERNAL_CONFIG_USE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Catch {
+
+    namespace {
+        // "CatchRS" plus a format version byte
+        const char snapshotMagic[8] = { 'C','a','t','c','h','R','S','2' };
+
+        void writeUInt64( std::ostream& os, std::uint64_t value ) {
+            char bytes[8];
+            for( int i = 0; i < 8; ++i )
+                bytes[i] = static_cast<char>( ( value >> ( 8 * i ) ) & 0xffu );
+            os.write( bytes, 8 );
+        }
+
+        void writeString( std::ostream& os, char const* data, std::size_t size ) {
+            writeUInt64( os, size );
+            os.write( data, static_cast<std::streamsize>( size ) );
+        }
+
+        // The whole file, mapped read-only where the platform allows and
+        // read into a buffer elsewhere; either way records parse as
+        // cursored reads over one contiguous block
+        class SnapshotBuffer {
+        public:
+            explicit SnapshotBuffer( std::string const& path ) {
+#if defined(CATCH_INTERNAL_CONFIG_USE_MMAP)
+                int fd = ::open( path.c_str(), O_RDONLY );
+                if( fd == -1 )
+                    return;
+                struct stat fileInfo;
+                if( ::fstat( fd, &fileInfo ) != 0 || fileInfo.st_size == 0 ) {
+                    ::close( fd );
+                    return;
+                }
+                auto size = static_cast<std::size_t>( fileInfo.st_size );
+                auto* mapping = ::mmap( nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+                ::close( fd );
+                if( mapping == MAP_FAILED )
+                    return;
+                m_mapping = mapping;
+                m_data = static_cast<char const*>( mapping );
+                m_size = size;
+#else
+                std::ifstream file( path.c_str(), std::ios::binary );
+                if( !file )
+                    return;
+                m_buffer.assign( std::istreambuf_iterator<char>( file ), std::istreambuf_iterator<char>() );
+                m_data = m_buffer.data();
+                m_size = m_buffer.size();
+#endif
+            }
+            ~SnapshotBuffer() {
+#if defined(CATCH_INTERNAL_CONFIG_USE_MMAP)
+                if( m_mapping )
+                    ::munmap( m_mapping, m_size );
+#endif
+            }
+
+            SnapshotBuffer( SnapshotBuffer const& ) = delete;
+            SnapshotBuffer& operator=( SnapshotBuffer const& ) = delete;
+
+            bool readBytes( char* out, std::size_t count ) {
+                if( count > m_size - m_pos )
+                    return false;
+                std::memcpy( out, m_data + m_pos, count );
+                m_pos += count;
+                return true;
+            }
+
+            bool readUInt64( std::uint64_t& value ) {
+                char bytes[8];
+                if( !readBytes( bytes, 8 ) )
+                    return false;
+                value = 0;
+                for( int i = 0; i < 8; ++i )
+                    value |= static_cast<std::uint64_t>( static_cast<unsigned char>( bytes[i] ) ) << ( 8 * i );
+                return true;
+            }
+
+            bool readString( std::string& value ) {
+                std::uint64_t size;
+                if( !readUInt64( size ) || size > m_size - m_pos )
+                    return false;
+                value.assign( m_data + m_pos, static_cast<std::size_t>( size ) );
+                m_pos += static_cast<std::size_t>( size );
+                return true;
+            }
+
+        private:
+            char const* m_data = nullptr;
+            std::size_t m_size = 0;
+            std::size_t m_pos = 0;
+#if defined(CATCH_INTERNAL_CONFIG_USE_MMAP)
+            void* m_mapping = nullptr;
+#else
+            std::vector<char> m_buffer;
+#endif
+        };
+    }
+
+    void RegistryDigest::add( StringRef const& str ) {
+        add( static_cast<std::uint64_t>( str.size() ) );
+        for( std::size_t i = 0; i < str.size(); ++i ) {
+            m_hash ^= static_cast<std::uint64_t>( static_cast<unsigned char>( str[i] ) );
+            m_hash *= 0x100000001b3ull;
+        }
+    }
+    void RegistryDigest::add( char const* str ) {
+        add( StringRef( str ) );
+    }
+    void RegistryDigest::add( std::uint64_t value ) {
+        for( int i = 0; i < 8; ++i ) {
+            m_hash ^= ( value >> ( 8 * i ) ) & 0xffu;
+            m_hash *= 0x100000001b3ull;
+        }
+    }
+    std::uint64_t RegistryDigest::value() const {
+        return m_hash;
+    }
+
+    bool loadRegistrySnapshot( std::string const& path, std::uint64_t digest, std::vector<RegistrySnapshotRecord>& records ) {
+        SnapshotBuffer buffer( path );
+        char magic[8];
+        if( !buffer.readBytes( magic, 8 ) || std::memcmp( magic, snapshotMagic, 8 ) != 0 )
+            return false;
+        std::uint64_t storedDigest, count;
+        if( !buffer.readUInt64( storedDigest ) || storedDigest != digest || !buffer.readUInt64( count ) )
+            return false;
+
+        std::vector<RegistrySnapshotRecord> loaded;
+        loaded.reserve( static_cast<std::size_t>( count ) );
+        for( std::uint64_t i = 0; i < count; ++i ) {
+            RegistrySnapshotRecord record;
+            std::uint64_t line, properties, timeoutBits, priorityTier, tagCount;
+            if( !buffer.readString( record.name ) ||
+                !buffer.readString( record.className ) ||
+                !buffer.readString( record.description ) ||
+                !buffer.readString( record.file ) ||
+                !buffer.readUInt64( line ) ||
+                !buffer.readUInt64( properties ) ||
+                !buffer.readUInt64( timeoutBits ) ||
+                !buffer.readUInt64( priorityTier ) ||
+                !buffer.readUInt64( tagCount ) )
+                return false;
+            record.line = static_cast<std::size_t>( line );
+            record.properties = static_cast<unsigned int>( properties );
+            std::memcpy( &record.timeoutSeconds, &timeoutBits, sizeof( double ) );
+            record.priorityTier = static_cast<int>( priorityTier );
+            record.tags.resize( static_cast<std::size_t>( tagCount ) );
+            for( auto& tag : record.tags )
+                if( !buffer.readString( tag.first ) || !buffer.readString( tag.second ) )
+                    return false;
+            loaded.push_back( std::move( record ) );
+        }
+        records = std::move( loaded );
+        return true;
+    }
+
+    void saveRegistrySnapshot( std::string const& path, std::uint64_t digest, std::vector<TestCase> const& testCases, std::size_t first ) {
+        std::ofstream f( path.c_str(), std::ios::binary );
+        if( !f )
+            return;
+        f.write( snapshotMagic, 8 );
+        writeUInt64( f, digest );
+        writeUInt64( f, testCases.size() - first );
+        for( std::size_t i = first; i < testCases.size(); ++i ) {
+            auto const& info = testCases[i].getTestCaseInfo();
+            writeString( f, info.name.data(), info.name.size() );
+            writeString( f, info.className.currentData(), info.className.size() );
+            writeString( f, info.description.data(), info.description.size() );
+            writeString( f, info.lineInfo.file, std::strlen( info.lineInfo.file ) );
+            writeUInt64( f, info.lineInfo.line );
+            writeUInt64( f, static_cast<std::uint64_t>( info.properties ) );
+            std::uint64_t timeoutBits;
+            std::memcpy( &timeoutBits, &info.timeoutSeconds, sizeof( double ) );
+            writeUInt64( f, timeoutBits );
+            writeUInt64( f, static_cast<std::uint64_t>( info.priorityTier ) );
+            writeUInt64( f, info.tags.size() );
+            // tags and lcaseTags run in parallel (see setTags)
+            for( std::size_t t = 0; t < info.tags.size(); ++t ) {
+                writeString( f, info.tags[t].currentData(), info.tags[t].size() );
+                writeString( f, info.lcaseTags[t].currentData(), info.lcaseTags[t].size() );
+            }
+        }
+    }
+
+} // end namespace Catch
@@ -0,0 +1,65 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_REGISTRY_SNAPSHOT_H_INCLUDED
+#define TWOBLUECUBES_CATCH_REGISTRY_SNAPSHOT_H_INCLUDED
+
+#include "catch_stringref.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Catch {
+
+    class TestCase;
+
+    // A registry snapshot (--registry-snapshot) persists the fully parsed
+    // test case metadata - names, class names, tags with their lowered
+    // spellings, special properties, timeouts - so later runs of the same
+    // binary rebuild the registry from the file instead of re-parsing
+    // every registration. The file is keyed by a digest of the raw
+    // registration inputs: any rebuild that adds, removes or edits a test
+    // changes the digest and the stale snapshot is ignored and rewritten.
+
+    // Accumulates the digest over the raw registration inputs. FNV-1a,
+    // length-delimited per field, deliberately not std::hash so a snapshot
+    // survives across platforms and standard libraries (see
+    // catch_test_manifest.h for the same reasoning).
+    class RegistryDigest {
+    public:
+        void add( StringRef const& str );
+        void add( char const* str );
+        void add( std::uint64_t value );
+        std::uint64_t value() const;
+    private:
+        std::uint64_t m_hash = 0xcbf29ce484222325ull;
+    };
+
+    // One test case's parsed metadata as stored in the snapshot. The tag
+    // spellings and their lowered forms are parallel, as in TestCaseInfo.
+    struct RegistrySnapshotRecord {
+        std::string name;
+        std::string className;
+        std::string description;
+        std::string file;
+        std::size_t line;
+        unsigned int properties;
+        double timeoutSeconds;
+        int priorityTier;
+        std::vector<std::pair<std::string, std::string>> tags;
+    };
+
+    // Reads a snapshot previously written by saveRegistrySnapshot, mapping
+    // the file read-only where the platform allows. Returns false - and
+    // leaves records untouched - if the file is missing, malformed, or its
+    // digest does not match the given one.
+    bool loadRegistrySnapshot( std::string const& path, std::uint64_t digest, std::vector<RegistrySnapshotRecord>& records );
+
+    // Writes the snapshot for the given (already materialised) test cases
+    void saveRegistrySnapshot( std::string const& path, std::uint64_t digest, std::vector<TestCase> const& testCases, std::size_t first );
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_REGISTRY_SNAPSHOT_H_INCLUDED
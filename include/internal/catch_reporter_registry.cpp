@@ -6,11 +6,86 @@
  */
 #include "catch_reporter_registry.h"
 
+#include "../reporters/catch_reporter_console.h"
+
+#if !defined(CATCH_CONFIG_MINIMAL_RUNTIME)
+#include "../reporters/catch_reporter_binary.h"
+#include "../reporters/catch_reporter_compact.h"
+#include "../reporters/catch_reporter_diff.h"
+#include "../reporters/catch_reporter_jsonl.h"
+#include "../reporters/catch_reporter_junit.h"
+#include "../reporters/catch_reporter_progress.h"
+#include "../reporters/catch_reporter_trace.h"
+#include "../reporters/catch_reporter_xml.h"
+#endif
+
 namespace Catch {
 
+    namespace {
+        template<typename T>
+        class BuiltInReporterFactory : public IReporterFactory {
+            IStreamingReporterPtr create( ReporterConfig const& config ) const override {
+                return IStreamingReporterPtr( new T( config ) );
+            }
+            std::string getDescription() const override {
+                return T::getDescription();
+            }
+        };
+
+        template<typename T>
+        IReporterFactoryPtr makeFactory() {
+            return std::make_shared<BuiltInReporterFactory<T>>();
+        }
+
+        template<typename T>
+        IStreamingReporterPtr createReporter( ReporterConfig const& config ) {
+            return IStreamingReporterPtr( new T( config ) );
+        }
+
+        // The bundled reporters live in this flat table instead of being
+        // registered through the self-registration macro: when the
+        // implementation is built into a static library, the linker only
+        // extracts archive members that resolve a referenced symbol,
+        // which a self-registering global in an otherwise unreferenced TU
+        // never provides. A table of function pointers also costs nothing
+        // at startup - no factory objects exist until a reporter is
+        // actually requested or listed.
+        // Under CATCH_CONFIG_MINIMAL_RUNTIME only the default console
+        // reporter is built in, so none of the others is ever referenced
+        // and their code can be stripped from the binary entirely
+        struct BuiltInReporterEntry {
+            char const* name;
+            IStreamingReporterPtr (*create)( ReporterConfig const& );
+            IReporterFactoryPtr (*makeFactory)();
+        };
+        BuiltInReporterEntry const builtInReporters[] = {
+            { "console",      &createReporter<ConsoleReporter>,        &makeFactory<ConsoleReporter> },
+#if !defined(CATCH_CONFIG_MINIMAL_RUNTIME)
+            { "binary",       &createReporter<BinaryReporter>,         &makeFactory<BinaryReporter> },
+            { "compact",      &createReporter<CompactReporter>,        &makeFactory<CompactReporter> },
+            { "diff",         &createReporter<DiffReporter>,           &makeFactory<DiffReporter> },
+            { "jsonl",        &createReporter<JsonlReporter>,          &makeFactory<JsonlReporter> },
+            { "junit",        &createReporter<JunitReporter>,          &makeFactory<JunitReporter> },
+            { "junit-stream", &createReporter<JunitStreamingReporter>, &makeFactory<JunitStreamingReporter> },
+            { "progress",     &createReporter<ProgressReporter>,       &makeFactory<ProgressReporter> },
+            { "trace",        &createReporter<TraceReporter>,          &makeFactory<TraceReporter> },
+            { "xml",          &createReporter<XmlReporter>,            &makeFactory<XmlReporter> },
+            { "xml-slim",     &createReporter<XmlSlimReporter>,        &makeFactory<XmlSlimReporter> },
+#endif
+        };
+    } // anonymous namespace
+
+    ReporterRegistry::ReporterRegistry() = default;
     ReporterRegistry::~ReporterRegistry() = default;
 
     IStreamingReporterPtr ReporterRegistry::create( std::string const& name, IConfigPtr const& config ) const {
+        // Built-ins first, matching the old registration order (a user
+        // factory never shadowed a bundled name). A scan over a handful
+        // of c-strings beats the tree walk the factory map would cost.
+        for( auto const& entry : builtInReporters )
+            if( name == entry.name )
+                return entry.create( ReporterConfig( config ) );
+
         auto it =  m_factories.find( name );
         if( it == m_factories.end() )
             return nullptr;
@@ -25,6 +100,14 @@ namespace Catch {
     }
 
     IReporterRegistry::FactoryMap const& ReporterRegistry::getFactories() const {
+        // Listing is the one path that needs factory objects for the
+        // bundled reporters (for the descriptions) - build them on first
+        // use rather than at startup
+        if( !m_builtInFactoriesAdded ) {
+            m_builtInFactoriesAdded = true;
+            for( auto const& entry : builtInReporters )
+                m_factories.emplace( entry.name, entry.makeFactory() );
+        }
         return m_factories;
     }
     IReporterRegistry::Listeners const& ReporterRegistry::getListeners() const {
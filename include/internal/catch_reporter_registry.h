@@ -18,6 +18,7 @@ namespace Catch {
 
     public:
 
+        ReporterRegistry();
         ~ReporterRegistry() override;
 
         IStreamingReporterPtr create( std::string const& name, IConfigPtr const& config ) const override;
@@ -29,7 +30,11 @@ namespace Catch {
         Listeners const& getListeners() const override;
 
     private:
-        FactoryMap m_factories;
+        // The bundled reporters are created straight from a static table;
+        // the factory map only holds user-registered factories until a
+        // listing forces factories for the bundled ones into existence too
+        mutable FactoryMap m_factories;
+        mutable bool m_builtInFactoriesAdded = false;
         Listeners m_listeners;
     };
 }
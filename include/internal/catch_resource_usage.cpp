@@ -0,0 +1,83 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_resource_usage.h"
+#include "catch_platform.h"
+
+#if defined(CATCH_PLATFORM_WINDOWS)
+#include "catch_windows_h_proxy.h"
+#elif defined(CATCH_PLATFORM_LINUX) || defined(CATCH_PLATFORM_MAC)
+#include <sys/resource.h>
+#endif
+
+namespace Catch {
+
+#if defined(CATCH_PLATFORM_WINDOWS)
+
+    namespace {
+        double fileTimeToSeconds( FILETIME const& ft ) {
+            auto ticks = ( static_cast<unsigned long long>( ft.dwHighDateTime ) << 32 )
+                       | ft.dwLowDateTime;
+            // FILETIME counts 100ns intervals
+            return static_cast<double>( ticks ) / 10000000.0;
+        }
+    }
+
+    ResourceUsage ResourceUsage::sample() {
+        ResourceUsage usage;
+        FILETIME creation, exit, kernel, user;
+        if( GetProcessTimes( GetCurrentProcess(), &creation, &exit, &kernel, &user ) ) {
+            usage.sampled = true;
+            usage.userCpuSeconds = fileTimeToSeconds( user );
+            usage.systemCpuSeconds = fileTimeToSeconds( kernel );
+            // Memory counters would need GetProcessMemoryInfo, which pulls in
+            // a psapi link dependency we don't want to impose - left at zero
+        }
+        return usage;
+    }
+
+#elif defined(CATCH_PLATFORM_LINUX) || defined(CATCH_PLATFORM_MAC)
+
+    ResourceUsage ResourceUsage::sample() {
+        ResourceUsage usage;
+        rusage ru;
+        if( getrusage( RUSAGE_SELF, &ru ) == 0 ) {
+            usage.sampled = true;
+            usage.userCpuSeconds = static_cast<double>( ru.ru_utime.tv_sec )
+                                 + static_cast<double>( ru.ru_utime.tv_usec ) / 1000000.0;
+            usage.systemCpuSeconds = static_cast<double>( ru.ru_stime.tv_sec )
+                                   + static_cast<double>( ru.ru_stime.tv_usec ) / 1000000.0;
+#if defined(CATCH_PLATFORM_MAC)
+            // ru_maxrss is in bytes on Darwin, kilobytes elsewhere
+            usage.peakRssKb = static_cast<long long>( ru.ru_maxrss ) / 1024;
+#else
+            usage.peakRssKb = static_cast<long long>( ru.ru_maxrss );
+#endif
+            usage.minorPageFaults = static_cast<long long>( ru.ru_minflt );
+            usage.majorPageFaults = static_cast<long long>( ru.ru_majflt );
+        }
+        return usage;
+    }
+
+#else
+
+    ResourceUsage ResourceUsage::sample() {
+        return ResourceUsage();
+    }
+
+#endif
+
+    ResourceUsage ResourceUsage::delta( ResourceUsage const& prev ) const {
+        ResourceUsage diff;
+        diff.sampled = sampled && prev.sampled;
+        diff.userCpuSeconds = userCpuSeconds - prev.userCpuSeconds;
+        diff.systemCpuSeconds = systemCpuSeconds - prev.systemCpuSeconds;
+        diff.peakRssKb = peakRssKb - prev.peakRssKb;
+        diff.minorPageFaults = minorPageFaults - prev.minorPageFaults;
+        diff.majorPageFaults = majorPageFaults - prev.majorPageFaults;
+        return diff;
+    }
+
+} // end namespace Catch
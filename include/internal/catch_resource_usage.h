@@ -0,0 +1,29 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_RESOURCE_USAGE_H_INCLUDED
+#define TWOBLUECUBES_CATCH_RESOURCE_USAGE_H_INCLUDED
+
+namespace Catch {
+
+    // Process resource counters, sampled around each test case when
+    // --resource-usage is given. Values are cumulative for the process;
+    // reporters are handed the delta() of the samples taken before and
+    // after the test. Note that peak RSS is a process-wide high-water
+    // mark, so its delta is the growth a test caused, not its footprint.
+    struct ResourceUsage {
+        bool sampled = false;
+        double userCpuSeconds = 0;
+        double systemCpuSeconds = 0;
+        long long peakRssKb = 0;
+        long long minorPageFaults = 0;
+        long long majorPageFaults = 0;
+
+        static ResourceUsage sample();
+        ResourceUsage delta( ResourceUsage const& prev ) const;
+    };
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_RESOURCE_USAGE_H_INCLUDED
@@ -1,14 +1,28 @@
 #include "catch_run_context.h"
+#include "catch_binary_artifact.h"
+#include "catch_checkpoint.h"
 #include "catch_compiler_capabilities.h"
 #include "catch_context.h"
+#include "catch_crash_context.h"
 #include "catch_enforce.h"
 #include "catch_random_number_generator.h"
 #include "catch_stream.h"
 #include "catch_output_redirect.h"
+#include "catch_progress_heartbeat.h"
+#include "catch_suite_fixture.h"
+#include "catch_stack_usage.h"
+#include "catch_suspend_timing.h"
+#include "catch_thread_output.h"
+#include "catch_test_abort.h"
+#include "catch_tracepoints.h"
 
 #include <cassert>
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
 #include <sstream>
+#include <thread>
 
 namespace Catch {
 
@@ -16,6 +30,7 @@ namespace Catch {
         struct GeneratorTracker : TestCaseTracking::TrackerBase, IGeneratorTracker {
             size_t m_index = static_cast<size_t>( -1 );
             GeneratorBasePtr m_generator;
+            size_t m_fixedSize = 0;
 
             GeneratorTracker( TestCaseTracking::NameAndLocation const& nameAndLocation, TrackerContext& ctx, ITracker* parent )
             :   TrackerBase( nameAndLocation, ctx, parent )
@@ -47,17 +62,18 @@ namespace Catch {
 
             void moveNext() {
                 m_index++;
-                m_children.clear();
+                clearChildren();
             }
 
             // TrackerBase interface
             bool isIndexTracker() const override { return true; }
             auto hasGenerator() const -> bool override {
-                return !!m_generator;
+                return m_generator || m_fixedSize > 0;
             }
             void close() override {
                 TrackerBase::close();
-                if( m_runState == CompletedSuccessfully && m_index < m_generator->size()-1 )
+                auto size = m_generator ? m_generator->size() : m_fixedSize;
+                if( m_runState == CompletedSuccessfully && m_index < size-1 )
                     m_runState = Executing;
             }
 
@@ -68,6 +84,9 @@ namespace Catch {
             void setGenerator( GeneratorBasePtr&& generator ) override {
                 m_generator = std::move( generator );
             }
+            void setFixedSize( size_t size ) override {
+                m_fixedSize = size;
+            }
             auto getIndex() const -> size_t override {
                 return m_index;
             }
@@ -75,6 +94,143 @@ namespace Catch {
         GeneratorTracker::~GeneratorTracker() {}
     }
 
+    namespace {
+        // The context is thread local (see the parallel runner), so threads
+        // spawned inside a test body have no result capture of their own.
+        // As long as exactly one RunContext is alive their assertions are
+        // routed to it; with several (--jobs > 1) the owner is ambiguous
+        // and worker-thread assertions stay unsupported.
+        std::mutex g_fallbackCaptureMutex;
+        int g_activeRunContexts = 0;
+        std::atomic<IResultCapture*> g_fallbackCapture{ nullptr };
+
+        void pushFallbackCapture(IResultCapture* capture) {
+            std::lock_guard<std::mutex> lock(g_fallbackCaptureMutex);
+            ++g_activeRunContexts;
+            g_fallbackCapture.store(g_activeRunContexts == 1 ? capture : nullptr);
+        }
+        void popFallbackCapture() {
+            std::lock_guard<std::mutex> lock(g_fallbackCaptureMutex);
+            --g_activeRunContexts;
+            g_fallbackCapture.store(nullptr);
+        }
+
+        IResultCapture* fallbackResultCapture() {
+            return g_fallbackCapture.load();
+        }
+
+        // Last resort for assertions from threads that have no capture at
+        // all - user-spawned threads while several RunContexts are alive
+        // (--jobs without [!exclusive]). Such results cannot be attributed
+        // to any test, but aborting the process from a foreign thread is
+        // worse: they are counted here and the session summarises them
+        // after the run, failing it if any of them failed. The reaction is
+        // never populated, so REQUIRE behaves like CHECK - the same rule
+        // that already applies on captured worker threads.
+        class OrphanResultCapture : public IResultCapture {
+        public:
+            bool sectionStarted( SectionInfo const& ) override { return false; }
+            void sectionEnded( SectionEndInfo const& ) override {}
+            void sectionEndedEarly( SectionEndInfo const& ) override {}
+            void setSectionBudget( double, AssertionInfo const& ) override {}
+
+            // Generators need a tracker tree, which only a RunContext has;
+            // GENERATE from an unattributed thread stays unsupported
+            auto acquireGeneratorTracker( SourceLineInfo const& ) -> IGeneratorTracker& override {
+                CATCH_INTERNAL_ERROR("No result capture instance");
+            }
+
+            void benchmarkStarting( BenchmarkInfo const& ) override {}
+            void benchmarkEnded( BenchmarkStats const& ) override {}
+
+            void pushScopedMessage( MessageInfo const& ) override {}
+            void popScopedMessage( MessageInfo const& ) override {}
+            void pushDeferredMessage( DeferredMessageBase const* ) override {}
+            void popDeferredMessage( DeferredMessageBase const* ) override {}
+
+            void handleFatalErrorCondition( StringRef ) override {}
+
+            void handleExpr( AssertionInfo const& info, ITransientExpression const& expr, AssertionReaction& ) override {
+                record( info, expr.getResult() );
+            }
+            void handleMessage( AssertionInfo const& info, ResultWas::OfType resultType, StringRef const&, AssertionReaction& ) override {
+                record( info, isOk( resultType ) );
+            }
+            void handleUnexpectedExceptionNotThrown( AssertionInfo const& info, AssertionReaction& ) override {
+                record( info, false );
+            }
+            void handleUnexpectedInflightException( AssertionInfo const& info, std::string const&, AssertionReaction& ) override {
+                record( info, false );
+            }
+            void handleIncomplete( AssertionInfo const& info ) override {
+                record( info, false );
+            }
+            void handleNonExpr( AssertionInfo const& info, ResultWas::OfType resultType, AssertionReaction& ) override {
+                record( info, isOk( resultType ) );
+            }
+
+            bool lastAssertionPassed() override { return m_lastPassed.load(); }
+            void assertionPassed() override {
+                ++m_total;
+                m_lastPassed.store( true );
+            }
+
+            std::string getCurrentTestName() const override { return std::string(); }
+            const AssertionResult* getLastResult() const override { return nullptr; }
+            void exceptionEarlyReported() override {}
+
+            OrphanAssertionStats stats() const {
+                std::lock_guard<std::mutex> lock( m_mutex );
+                return { m_total.load(), m_failed.load(), m_firstFile, m_firstLine };
+            }
+
+        private:
+            void record( AssertionInfo const& info, bool passed ) {
+                ++m_total;
+                if( !passed )
+                    ++m_failed;
+                m_lastPassed.store( passed );
+                std::lock_guard<std::mutex> lock( m_mutex );
+                if( !m_firstFile ) {
+                    m_firstFile = info.lineInfo.file;
+                    m_firstLine = info.lineInfo.line;
+                }
+            }
+
+            std::atomic<std::size_t> m_total{ 0 };
+            std::atomic<std::size_t> m_failed{ 0 };
+            std::atomic<bool> m_lastPassed{ false };
+            mutable std::mutex m_mutex;
+            char const* m_firstFile = nullptr;
+            std::size_t m_firstLine = 0;
+        };
+
+        OrphanResultCapture& orphanResultCapture() {
+            static OrphanResultCapture instance;
+            return instance;
+        }
+
+        // Suspends the --self-profile "test bodies" scope while a
+        // framework stage borrowed from the body runs, so the stage's
+        // own bucket is not double counted as body time. Re-entrant: an
+        // inner guard finds the scope already paused and leaves the
+        // resume to the outer one.
+        class PausedProfileScope {
+            SelfProfile::ScopedTimer* m_scope;
+        public:
+            PausedProfileScope( SelfProfile::ScopedTimer* scope )
+            :   m_scope( scope && scope->running() ? scope : nullptr )
+            {
+                if( m_scope )
+                    m_scope->pause();
+            }
+            ~PausedProfileScope() {
+                if( m_scope )
+                    m_scope->resume();
+            }
+        };
+    }
+
 
     RunContext::RunContext(IConfigPtr const& _config, IStreamingReporterPtr&& reporter)
     :   m_runInfo(_config->name()),
@@ -82,15 +238,28 @@ namespace Catch {
         m_config(_config),
         m_reporter(std::move(reporter)),
         m_lastAssertionInfo{ StringRef(), SourceLineInfo("",0), StringRef(), ResultDisposition::Normal },
-        m_includeSuccessfulResults( m_config->includeSuccessfulResults() || m_reporter->getPreferences().shouldReportAllAssertions )
+        m_testThread( std::this_thread::get_id() ),
+        m_totalsOnly( m_config->totalsOnly() ),
+        m_includeSuccessfulResults( !m_totalsOnly && ( m_config->includeSuccessfulResults() || m_reporter->getPreferences().shouldReportAllAssertions ) ),
+        m_singlePassSections( m_config->singlePassSections() ),
+        m_reportAssertionStarting( !m_totalsOnly && m_reporter->getPreferences().shouldReportAssertionStarting ),
+        m_batchAssertions( m_reporter->getPreferences().shouldBatchAssertions ),
+        m_successfulAssertionSampleRate( m_reporter->getPreferences().successfulAssertionSampleRate )
     {
         m_context.setRunner(this);
-        m_context.setConfig(m_config);
+        m_context.setConfig(m_config.get());
         m_context.setResultCapture(this);
+        pushFallbackCapture(this);
+        m_trackerContext.setAllocationArena(m_arena);
+        if (!m_config->benchmarkBaselineFile().empty())
+            m_benchmarkBaselines = loadBenchmarkBaselines(m_config->benchmarkBaselineFile());
+        if (!m_config->historyFile().empty())
+            m_historyStore.reset(new HistoryStore(m_config->historyFile()));
         m_reporter->testRunStarting(m_runInfo);
     }
 
     RunContext::~RunContext() {
+        popFallbackCapture();
         m_reporter->testRunEnded(TestRunStats(m_runInfo, m_totals, aborting()));
     }
 
@@ -103,43 +272,121 @@ namespace Catch {
     }
 
     Totals RunContext::runTest(TestCase const& testCase) {
+        pollAbortFile();
+
+        Timer testCaseTimer;
+        testCaseTimer.start();
         Totals prevTotals = m_totals;
 
-        std::string redirectedCout;
-        std::string redirectedCerr;
+        m_redirectedCout.clear();
+        m_redirectedCerr.clear();
 
         auto const& testInfo = testCase.getTestCaseInfo();
 
-        m_reporter->testCaseStarting(testInfo);
+        suiteFixturesTestStarting(testInfo);
+
+        {
+            SelfProfile::ScopedTimer reporterScope( SelfProfile::Bucket::ReporterDispatch );
+            m_reporter->testCaseStarting(testInfo);
+        }
+        CATCH_TRACE_TEST_CASE_STARTING( testInfo.name.c_str() );
+        ProgressHeartbeat::testCaseStarting();
 
         m_activeTestCase = &testCase;
+        setCrashContextTestCase(testInfo.name, testInfo.lineInfo);
+        publishRunStatus(testInfo.name, m_totals);
+        // Breadcrumbs from the previous test case would only mislead
+        clearCheckpoints();
+
+        std::set<std::string> recordedDependencies;
+        setDependencyRecorder(&recordedDependencies);
 
+        ResourceUsage usageBefore;
+        if (m_config->reportResourceUsage())
+            usageBefore = ResourceUsage::sample();
 
-        ITracker& rootTracker = m_trackerContext.startRun();
-        assert(rootTracker.isSectionTracker());
-        static_cast<SectionTracker&>(rootTracker).addInitialFilters(m_config->getSectionsToRun());
-        do {
-            m_trackerContext.startCycle();
-            m_testCaseTracker = &SectionTracker::acquire(m_trackerContext, TestCaseTracking::NameAndLocation(testInfo.name, testInfo.lineInfo));
-            runCurrentTest(redirectedCout, redirectedCerr);
-        } while (!m_testCaseTracker->isSuccessfullyCompleted() && !aborting());
+        m_stackPeakBytes = -1;
 
-        Totals deltaTotals = m_totals.delta(prevTotals);
+        // A failed test case is re-run in place up to --retry-failures
+        // times; each failed attempt is rolled out of the running totals
+        // so only the final attempt counts
+        unsigned int retriesLeft = m_config->retryFailures();
+        bool retried = false;
+        Totals deltaTotals;
+        for (;;) {
+            ITracker& rootTracker = m_trackerContext.startRun();
+            assert(rootTracker.isSectionTracker());
+            static_cast<SectionTracker&>(rootTracker).addInitialFilters(m_config->getSectionsToRun());
+
+            do {
+                {
+                    SelfProfile::ScopedTimer trackerScope( SelfProfile::Bucket::TrackerBookkeeping );
+                    m_trackerContext.startCycle();
+                    m_testCaseTracker = &SectionTracker::acquire(m_trackerContext, TestCaseTracking::NameAndLocation(testInfo.name, testInfo.lineInfo));
+                }
+                runCurrentTest(m_redirectedCout, m_redirectedCerr);
+            } while (!m_testCaseTracker->isSuccessfullyCompleted() && !aborting());
+
+            deltaTotals = m_totals.delta(prevTotals);
+            if (deltaTotals.testCases.failed == 0 || retriesLeft == 0 || aborting())
+                break;
+            --retriesLeft;
+            retried = true;
+            m_totals = prevTotals;
+            m_redirectedCout.clear();
+            m_redirectedCerr.clear();
+            m_trackerContext.endRun();
+        }
+        if (retried && deltaTotals.testCases.failed == 0)
+            deltaTotals.testCases.passedOnRetry = 1;
         if (testInfo.expectedToFail() && deltaTotals.testCases.passed > 0) {
             deltaTotals.assertions.failed++;
             deltaTotals.testCases.passed--;
             deltaTotals.testCases.failed++;
         }
         m_totals.testCases += deltaTotals.testCases;
-        m_reporter->testCaseEnded(TestCaseStats(testInfo,
-                                  deltaTotals,
-                                  redirectedCout,
-                                  redirectedCerr,
-                                  aborting()));
+        clearRunStatusTestCase(m_totals);
+        // The redirected output is cleared at the start of the next test
+        // case, so it can be moved rather than copied - it can be
+        // arbitrarily large
+        TestCaseStats testCaseStats(testInfo,
+                                    deltaTotals,
+                                    std::move(m_redirectedCout),
+                                    std::move(m_redirectedCerr),
+                                    aborting());
+        if (m_config->reportResourceUsage())
+            testCaseStats.resourceUsage = ResourceUsage::sample().delta(usageBefore);
+        testCaseStats.stackPeakBytes = m_stackPeakBytes;
+        CATCH_TRACE_TEST_CASE_ENDED( testInfo.name.c_str(), deltaTotals.assertions.failed );
+        {
+            SelfProfile::ScopedTimer reporterScope( SelfProfile::Bucket::ReporterDispatch );
+            m_reporter->testCaseEnded(testCaseStats);
+        }
+        ProgressHeartbeat::testCaseEnded();
+
+        suiteFixturesTestEnded(testInfo);
+
+        if (currentFlushPolicy() != FlushPolicy::Auto)
+            flushOutputStreams();
 
+        setDependencyRecorder(nullptr);
+        if (!recordedDependencies.empty())
+            m_testDependencies[testInfo.name] = std::move(recordedDependencies);
+
+        if (m_historyStore)
+            m_historyStore->recordTestEnded(testInfo.name,
+                                            testCaseTimer.getElapsedSeconds(),
+                                            deltaTotals.testCases.failed > 0);
+
+        clearCrashContext();
         m_activeTestCase = nullptr;
         m_testCaseTracker = nullptr;
 
+        // Tear down this test case's tracker tree, then reclaim its arena
+        // storage in one go
+        m_trackerContext.endRun();
+        m_arena.reset();
+
         return deltaTotals;
     }
 
@@ -151,50 +398,207 @@ namespace Catch {
         return *m_reporter;
     }
 
+    namespace {
+        // Per source location and test case attempt; enough repeats to
+        // show a pattern without letting a looping failure flood the
+        // reporters
+        constexpr std::size_t maxReportedFailuresPerSite = 10;
+    }
+
     void RunContext::assertionEnded(AssertionResult const & result) {
+        // Recording an assertion is framework work, not test body time
+        PausedProfileScope pausedBody( m_bodyProfileScope );
+        // The innermost open section's delta slot; assertions outside any
+        // test case (e.g. fatal error teardown) only touch the run totals
+        Counts* sectionDelta = m_sectionDeltas.empty() ? nullptr : &m_sectionDeltas.back();
         if (result.getResultType() == ResultWas::Ok) {
             m_totals.assertions.passed++;
+            if (sectionDelta)
+                sectionDelta->passed++;
             m_lastAssertionPassed = true;
         } else if (!result.isOk()) {
             m_lastAssertionPassed = false;
-            if( m_activeTestCase->getTestCaseInfo().okToFail() )
+            if( m_activeTestCase->getTestCaseInfo().okToFail() ) {
                 m_totals.assertions.failedButOk++;
-            else
+                if (sectionDelta)
+                    sectionDelta->failedButOk++;
+            }
+            else {
                 m_totals.assertions.failed++;
+                if (sectionDelta)
+                    sectionDelta->failed++;
+            }
+            CATCH_TRACE_ASSERTION_FAILED( result.getSourceInfo().file, result.getSourceInfo().line );
         }
         else {
             m_lastAssertionPassed = true;
         }
 
+        // A failure inside a tight loop would otherwise emit one event per
+        // iteration and explode the report. After the cap, failures from
+        // the same source location are only counted; the count is emitted
+        // as a warning when the test case ends.
+        if (!result.isOk()) {
+            auto& seen = m_failuresPerSite[std::make_pair(result.getSourceInfo().file, result.getSourceInfo().line)];
+            if (++seen > maxReportedFailuresPerSite) {
+                resetAssertionInfo();
+                m_lastResult = result;
+                return;
+            }
+        }
+
+        // A sampling reporter only wants every Nth successful assertion
+        // event - skip building the stats it would not consume. Failures
+        // are never sampled out.
+        if (result.getResultType() == ResultWas::Ok && m_successfulAssertionSampleRate > 1) {
+            if (++m_successfulAssertionsSeen % m_successfulAssertionSampleRate != 0) {
+                resetAssertionInfo();
+                m_lastResult = result;
+                return;
+            }
+        }
+
         // We have no use for the return value (whether messages should be cleared), because messages were made scoped
         // and should be let to clear themselves out.
-        static_cast<void>(m_reporter->assertionEnded(AssertionStats(result, m_messages, m_totals)));
+        bool materialiseDeferred = !m_deferredMessages.empty()
+            && (result.getResultType() != ResultWas::Ok || m_includeSuccessfulResults);
+        bool attachCheckpoints = !result.isOk() && haveCheckpoints();
+        if (materialiseDeferred || attachCheckpoints) {
+            SelfProfile::ScopedTimer stringifyScope( SelfProfile::Bucket::Stringification );
+            std::vector<MessageInfo> messages = m_messages;
+            if (materialiseDeferred) {
+                // Deferred captures are only turned into text now that the
+                // result is actually being shown; merged with the eager
+                // messages in capture order
+                messages.reserve(messages.size() + m_deferredMessages.size());
+                for (auto deferred : m_deferredMessages)
+                    messages.push_back(deferred->materialise());
+                std::sort(messages.begin(), messages.end());
+            }
+            if (attachCheckpoints) {
+                // CHECKPOINT breadcrumbs are formatted only now that a
+                // failure actually shows them; appended after the sort so
+                // the trail comes last
+                MessageInfo info("CHECKPOINT"_sr, result.getSourceInfo(), ResultWas::Info);
+                ReusableStringStream rss;
+                writeCheckpoints(rss.get());
+                info.message = rss.str();
+                messages.push_back(info);
+            }
+            stringifyScope.pause();
+            deliverAssertionStats(AssertionStats(result, std::move(messages), m_totals));
+        } else {
+            deliverAssertionStats(AssertionStats(result, m_messages, m_totals));
+        }
+
+        if (currentFlushPolicy() == FlushPolicy::Immediate)
+            flushOutputStreams();
 
         // Reset working state
         resetAssertionInfo();
         m_lastResult = result;
     }
+    void RunContext::reportCollapsedFailures() {
+        for (auto const& site : m_failuresPerSite) {
+            if (site.second <= maxReportedFailuresPerSite)
+                continue;
+            ReusableStringStream msg;
+            msg << "Suppressed " << (site.second - maxReportedFailuresPerSite)
+                << " further failures from this assertion ("
+                << site.second << " in all)";
+            // Faked up the same way as a fatal error result; the failures
+            // themselves are already in the totals
+            AssertionResultData data(ResultWas::Warning, { false });
+            data.message = msg.str();
+            AssertionInfo info{ StringRef(), SourceLineInfo(site.first.first, site.first.second), StringRef(), ResultDisposition::ContinueOnFailure };
+            AssertionResult result(info, data);
+            deliverAssertionStats(AssertionStats(result, std::vector<MessageInfo>(), m_totals));
+        }
+        m_failuresPerSite.clear();
+    }
+
+    void RunContext::deliverAssertionStats(AssertionStats&& stats) {
+        if (m_batchAssertions) {
+            // Delivery outlives the assertion, so the expression must be
+            // reconstructed now, while the decomposed operands still exist
+            // (getExpandedExpression caches its result)
+            {
+                SelfProfile::ScopedTimer stringifyScope( SelfProfile::Bucket::Stringification );
+                stats.assertionResult.getExpandedExpression();
+            }
+            m_assertionBatch.push_back(std::move(stats));
+        } else {
+            SelfProfile::ScopedTimer reporterScope( SelfProfile::Bucket::ReporterDispatch );
+            static_cast<void>(m_reporter->assertionEnded(stats));
+        }
+    }
+
+    void RunContext::flushAssertionBatch() {
+        if (m_assertionBatch.empty())
+            return;
+        PausedProfileScope pausedBody( m_bodyProfileScope );
+        SelfProfile::ScopedTimer reporterScope( SelfProfile::Bucket::ReporterDispatch );
+        m_reporter->assertionsEnded(m_assertionBatch);
+        m_assertionBatch.clear();
+    }
+
     void RunContext::resetAssertionInfo() {
         m_lastAssertionInfo.macroName = StringRef();
         m_lastAssertionInfo.capturedExpression = "{Unknown expression after the reported line}"_sr;
     }
 
-    bool RunContext::sectionStarted(SectionInfo const & sectionInfo, Counts & assertions) {
+    bool RunContext::sectionStarted(SectionInfo const & sectionInfo) {
+        PausedProfileScope pausedBody( m_bodyProfileScope );
+        // In single-pass mode every section is entered unconditionally, so
+        // all leaves execute in one invocation of the test body and shared
+        // setup only runs once. The section tracker is bypassed entirely.
+        if (m_singlePassSections) {
+            m_lastAssertionInfo.lineInfo = sectionInfo.lineInfo;
+            // Results since the last boundary belong to the enclosing
+            // section, not the one about to open
+            flushAssertionBatch();
+            {
+                SelfProfile::ScopedTimer reporterScope( SelfProfile::Bucket::ReporterDispatch );
+                m_reporter->sectionStarting(sectionInfo);
+            }
+            CATCH_TRACE_SECTION_STARTING( sectionInfo.name.c_str() );
+            pushCrashContextSection(sectionInfo.name);
+            m_sectionDeltas.push_back(Counts());
+#if defined(CATCH_CONFIG_DISABLE_EXCEPTIONS)
+            m_abortSectionStack.push_back(SectionEndInfo{sectionInfo, Counts(), 0});
+#endif
+            return true;
+        }
+
+        SelfProfile::ScopedTimer trackerScope( SelfProfile::Bucket::TrackerBookkeeping );
         ITracker& sectionTracker = SectionTracker::acquire(m_trackerContext, TestCaseTracking::NameAndLocation(sectionInfo.name, sectionInfo.lineInfo));
         if (!sectionTracker.isOpen())
             return false;
         m_activeSections.push_back(&sectionTracker);
+        trackerScope.pause();
 
         m_lastAssertionInfo.lineInfo = sectionInfo.lineInfo;
 
-        m_reporter->sectionStarting(sectionInfo);
+        // As above: the batch so far belongs to the enclosing section
+        flushAssertionBatch();
+        {
+            SelfProfile::ScopedTimer reporterScope( SelfProfile::Bucket::ReporterDispatch );
+            m_reporter->sectionStarting(sectionInfo);
+        }
+        CATCH_TRACE_SECTION_STARTING( sectionInfo.name.c_str() );
+        pushCrashContextSection(sectionInfo.name);
 
-        assertions = m_totals.assertions;
+        m_sectionDeltas.push_back(Counts());
+#if defined(CATCH_CONFIG_DISABLE_EXCEPTIONS)
+        m_abortSectionStack.push_back(SectionEndInfo{sectionInfo, Counts(), 0});
+#endif
 
         return true;
     }
     auto RunContext::acquireGeneratorTracker( SourceLineInfo const& lineInfo ) -> IGeneratorTracker& {
         using namespace Generators;
+        PausedProfileScope pausedBody( m_bodyProfileScope );
+        SelfProfile::ScopedTimer trackerScope( SelfProfile::Bucket::TrackerBookkeeping );
         GeneratorTracker& tracker = GeneratorTracker::acquire( m_trackerContext, TestCaseTracking::NameAndLocation( "generator", lineInfo ) );
         assert( tracker.isOpen() );
         m_lastAssertionInfo.lineInfo = lineInfo;
@@ -213,33 +617,169 @@ namespace Catch {
         return true;
     }
 
+    namespace {
+        // The fixed cost the section machinery itself contributes inside
+        // the timed window - the timer calls and suspended-time lookups
+        // between Section construction and destruction. Measured once, on
+        // the first budget check, by cycling the same calls with an empty
+        // payload and taking the best of several runs.
+        double sectionTimingOverheadSeconds() {
+            static double overhead = [] {
+                auto best = (std::numeric_limits<std::uint64_t>::max)();
+                for( int i = 0; i < 256; ++i ) {
+                    Timer outer;
+                    outer.start();
+                    Timer inner;
+                    inner.start();
+                    (void)suspendedTimeNanoseconds();
+                    (void)inner.getElapsedNanoseconds();
+                    auto ns = outer.getElapsedNanoseconds();
+                    if( ns < best )
+                        best = ns;
+                }
+                return static_cast<double>( best ) / 1000000000.0;
+            }();
+            return overhead;
+        }
+    }
+
+    void RunContext::setSectionBudget( double budgetSeconds, AssertionInfo const& info ) {
+        // Keyed to the innermost open section; setting a budget twice in
+        // the same section keeps the later one
+        PendingSectionBudget budget{ budgetSeconds, &info, m_sectionDeltas.size() };
+        if( !m_sectionBudgets.empty() && m_sectionBudgets.back().depth == budget.depth )
+            m_sectionBudgets.back() = budget;
+        else
+            m_sectionBudgets.push_back( budget );
+    }
+
+    void RunContext::checkSectionBudget( SectionEndInfo const& endInfo ) {
+        if( m_sectionBudgets.empty() || m_sectionBudgets.back().depth != m_sectionDeltas.size() )
+            return;
+        auto budget = m_sectionBudgets.back();
+        m_sectionBudgets.pop_back();
+
+        auto corrected = endInfo.durationInSeconds - sectionTimingOverheadSeconds();
+        if( corrected < 0 )
+            corrected = 0;
+
+        // Through the standard assertion path, so the verdict counts and
+        // reports like any CHECK; the callsite's disposition is
+        // ContinueOnFailure, so a violation cannot throw mid-teardown
+        AssertionHandler handler( *budget.info );
+        if( corrected <= budget.budgetSeconds )
+            handler.handleMessage( ResultWas::Ok, StringRef() );
+        else {
+            ReusableStringStream rss;
+            rss << "Section took " << corrected * 1000.0 << "ms, over its budget of "
+                << budget.budgetSeconds * 1000.0 << "ms (framework overhead of "
+                << sectionTimingOverheadSeconds() * 1000.0 << "ms calibrated out)";
+            handler.handleMessage( ResultWas::ExplicitFailure, rss.str() );
+        }
+        handler.complete();
+    }
+
+    Counts RunContext::popSectionDelta() {
+        Counts delta = m_sectionDeltas.back();
+        m_sectionDeltas.pop_back();
+        // Fold into the enclosing slot, so outer sections and the test
+        // case report nested results as their own - as they always have
+        if (!m_sectionDeltas.empty())
+            m_sectionDeltas.back() += delta;
+        return delta;
+    }
+
     void RunContext::sectionEnded(SectionEndInfo const & endInfo) {
-        Counts assertions = m_totals.assertions - endInfo.prevAssertions;
+        // While the section's delta slot is still the top of the stack,
+        // so the verdict is attributed to the section it budgets
+        checkSectionBudget(endInfo);
+
+        // Attribute any worker-thread assertions to the section that
+        // spawned them (the workers must have been joined by now)
+        drainConcurrentAssertions();
+
+        sectionEndedImpl(endInfo, popSectionDelta());
+    }
+
+    void RunContext::sectionEndedImpl(SectionEndInfo const & endInfo, Counts assertions) {
+        PausedProfileScope pausedBody( m_bodyProfileScope );
         bool missingAssertions = testForMissingAssertions(assertions);
+        // The synthetic failure must show up in the enclosing sections'
+        // counts too; their slots are still on the stack
+        if (missingAssertions && !m_sectionDeltas.empty())
+            m_sectionDeltas.back().failed++;
 
         if (!m_activeSections.empty()) {
+            SelfProfile::ScopedTimer trackerScope( SelfProfile::Bucket::TrackerBookkeeping );
             m_activeSections.back()->close();
             m_activeSections.pop_back();
         }
+#if defined(CATCH_CONFIG_DISABLE_EXCEPTIONS)
+        if (!m_abortSectionStack.empty())
+            m_abortSectionStack.pop_back();
+#endif
 
-        m_reporter->sectionEnded(SectionStats(endInfo.sectionInfo, assertions, endInfo.durationInSeconds, missingAssertions));
+        flushAssertionBatch();
+        {
+            SelfProfile::ScopedTimer reporterScope( SelfProfile::Bucket::ReporterDispatch );
+            m_reporter->sectionEnded(SectionStats(endInfo.sectionInfo, assertions, endInfo.durationInSeconds, missingAssertions));
+        }
+        popCrashContextSection();
         m_messages.clear();
     }
 
     void RunContext::sectionEndedEarly(SectionEndInfo const & endInfo) {
-        if (m_unfinishedSections.empty())
-            m_activeSections.back()->fail();
-        else
-            m_activeSections.back()->close();
-        m_activeSections.pop_back();
+        // There are no active trackers to unwind in single-pass mode
+        if (!m_activeSections.empty()) {
+            if (m_unfinishedSections.empty())
+                m_activeSections.back()->fail();
+            else
+                m_activeSections.back()->close();
+            m_activeSections.pop_back();
+        }
+#if defined(CATCH_CONFIG_DISABLE_EXCEPTIONS)
+        if (!m_abortSectionStack.empty())
+            m_abortSectionStack.pop_back();
+#endif
 
         m_unfinishedSections.push_back(endInfo);
+        // The section's delta slot deliberately stays on the stack: a
+        // failure recorded after the unwind (the exception that caused it)
+        // must still be attributed to the sections it escaped from. The
+        // slots are popped in runCurrentTest, once the failure is in.
     }
     void RunContext::benchmarkStarting( BenchmarkInfo const& info ) {
         m_reporter->benchmarkStarting( info );
     }
     void RunContext::benchmarkEnded( BenchmarkStats const& stats ) {
         m_reporter->benchmarkEnded( stats );
+
+        if( m_config->benchmarkBaselineFile().empty() )
+            return;
+        m_benchmarkResults[stats.info.name] = stats.meanNs;
+
+        auto baseline = m_benchmarkBaselines.find( stats.info.name );
+        if( baseline == m_benchmarkBaselines.end() )
+            return;
+        auto allowed = baseline->second * ( 1.0 + m_config->benchmarkTolerance() / 100.0 );
+        if( stats.meanNs > allowed ) {
+            ReusableStringStream msg;
+            msg << "Benchmark '" << stats.info.name << "' regressed: "
+                << stats.meanNs << " ns per iteration against a baseline of "
+                << baseline->second << " ns (tolerance: "
+                << m_config->benchmarkTolerance() << "%)";
+            AssertionInfo info{ "BENCHMARK"_sr, m_lastAssertionInfo.lineInfo, StringRef(), ResultDisposition::ContinueOnFailure };
+            AssertionReaction reaction;
+            handleMessage( info, ResultWas::ExplicitFailure, msg.str(), reaction );
+        }
+    }
+
+    BenchmarkBaselines const& RunContext::benchmarkResults() const {
+        return m_benchmarkResults;
+    }
+
+    TestDependencies const& RunContext::testDependencies() const {
+        return m_testDependencies;
     }
 
     void RunContext::pushScopedMessage(MessageInfo const & message) {
@@ -250,6 +790,14 @@ namespace Catch {
         m_messages.erase(std::remove(m_messages.begin(), m_messages.end(), message), m_messages.end());
     }
 
+    void RunContext::pushDeferredMessage(DeferredMessageBase const* message) {
+        m_deferredMessages.push_back(message);
+    }
+
+    void RunContext::popDeferredMessage(DeferredMessageBase const* message) {
+        m_deferredMessages.erase(std::remove(m_deferredMessages.begin(), m_deferredMessages.end(), message), m_deferredMessages.end());
+    }
+
     std::string RunContext::getCurrentTestName() const {
         return m_activeTestCase
             ? m_activeTestCase->getTestCaseInfo().name
@@ -285,6 +833,7 @@ namespace Catch {
         Counts assertions;
         assertions.failed = 1;
         SectionStats testCaseSectionStats(testCaseSection, assertions, 0, false);
+        flushAssertionBatch();
         m_reporter->sectionEnded(testCaseSectionStats);
 
         auto const& testInfo = m_activeTestCase->getTestCaseInfo();
@@ -300,6 +849,10 @@ namespace Catch {
         m_totals.testCases.failed++;
         testGroupEnded(std::string(), m_totals, 1, 1);
         m_reporter->testRunEnded(TestRunStats(m_runInfo, m_totals, false));
+
+        // We are about to die - push everything still sitting in the
+        // output buffers out, whatever the flush policy
+        flushOutputStreams();
     }
 
     bool RunContext::lastAssertionPassed() {
@@ -309,39 +862,74 @@ namespace Catch {
     void RunContext::assertionPassed() {
         m_lastAssertionPassed = true;
         ++m_totals.assertions.passed;
+        if (!m_sectionDeltas.empty())
+            ++m_sectionDeltas.back().passed;
         resetAssertionInfo();
     }
 
     bool RunContext::aborting() const {
-        return m_totals.assertions.failed >= static_cast<std::size_t>(m_config->abortAfter());
+        if (m_totals.assertions.failed >= static_cast<std::size_t>(m_config->abortAfter())) {
+            // Tell any other processes watching the same abort file
+            if (!m_abortFileSignalled && !m_config->abortFile().empty()) {
+                m_abortFileSignalled = true;
+                std::ofstream touch(m_config->abortFile().c_str());
+            }
+            return true;
+        }
+        return m_abortFileObserved;
+    }
+
+    void RunContext::pollAbortFile() {
+        // One existence check per test case; once seen, the answer is cached
+        // so the remaining drain does not touch the filesystem at all
+        if (m_abortFileObserved || m_config->abortFile().empty())
+            return;
+        m_abortFileObserved = std::ifstream(m_config->abortFile().c_str()).good();
     }
 
     void RunContext::runCurrentTest(std::string & redirectedCout, std::string & redirectedCerr) {
         auto const& testCaseInfo = m_activeTestCase->getTestCaseInfo();
         SectionInfo testCaseSection(testCaseInfo.lineInfo, testCaseInfo.name);
-        m_reporter->sectionStarting(testCaseSection);
-        Counts prevAssertions = m_totals.assertions;
+        {
+            SelfProfile::ScopedTimer reporterScope( SelfProfile::Bucket::ReporterDispatch );
+            m_reporter->sectionStarting(testCaseSection);
+        }
+        // Base slot of the delta stack: everything the body does that is
+        // not inside a deeper section lands here
+        m_sectionDeltas.assign(1, Counts());
+        // Budgets of sections an earlier attempt unwound out of must not
+        // leak into this one
+        m_sectionBudgets.clear();
         double duration = 0;
         m_shouldReportUnexpected = true;
         m_lastAssertionInfo = { "TEST_CASE"_sr, testCaseInfo.lineInfo, StringRef(), ResultDisposition::Normal };
 
-        seedRng(*m_config);
+        seedRngForTest(*m_config, testCaseInfo.name);
 
+        auto suspendedOnEntry = suspendedTimeNanoseconds();
         Timer timer;
         CATCH_TRY {
             if (m_reporter->getPreferences().shouldRedirectStdOut) {
+                // Declared before the redirects so its destructor runs
+                // after theirs and the teardown is timed too; paused
+                // while the body itself runs
+                SelfProfile::ScopedTimer redirectScope( SelfProfile::Bucket::OutputRedirection );
 #if !defined(CATCH_CONFIG_EXPERIMENTAL_REDIRECT)
                 RedirectedStdOut redirectedStdOut;
                 RedirectedStdErr redirectedStdErr;
+                redirectScope.pause();
 
                 timer.start();
                 invokeActiveTestCase();
+                redirectScope.resume();
                 redirectedCout += redirectedStdOut.str();
                 redirectedCerr += redirectedStdErr.str();
 #else
-                OutputRedirect r(redirectedCout, redirectedCerr);
+                OutputRedirect r(m_stdoutCapture, m_stderrCapture, redirectedCout, redirectedCerr);
+                redirectScope.pause();
                 timer.start();
                 invokeActiveTestCase();
+                redirectScope.resume();
 #endif
             } else {
                 timer.start();
@@ -358,21 +946,193 @@ namespace Catch {
                 handleUnexpectedInflightException( m_lastAssertionInfo, translateActiveException(), dummyReaction );
             }
         }
-        Counts assertions = m_totals.assertions - prevAssertions;
+        drainConcurrentAssertions();
+
+        // Everything the body wrote through Catch::tout() on this thread
+        // belongs to this test case, whatever the redirect mode - this is
+        // what keeps output attribution exact under the parallel runner,
+        // where each worker thread runs whole test cases
+        redirectedCout += drainThreadOutput();
+
+        // Time the body spent in SuspendTiming scopes is excluded from
+        // the test case's duration, like it is from each section's
+        auto suspended = static_cast<double>( suspendedTimeNanoseconds() - suspendedOnEntry ) / 1000000000.0;
+        duration = duration > suspended ? duration - suspended : 0;
+
+        // Sections the body unwound out of left their slots on the stack
+        // (see sectionEndedEarly); pop them innermost-first so each folds
+        // into its parent, and keep the delta for the deferred report
+        for (auto& unfinished : m_unfinishedSections)
+            unfinished.assertions = popSectionDelta();
+
+        Counts assertions = popSectionDelta();
         bool missingAssertions = testForMissingAssertions(assertions);
 
         m_testCaseTracker->close();
         handleUnfinishedSections();
         m_messages.clear();
+        // The owning scopes are gone by now; drop any pointers left behind
+        // by an exception unwinding past a deferred capture
+        m_deferredMessages.clear();
+
+        // While the test case section is still open, so reporters have a
+        // header to attach the warnings to
+        reportCollapsedFailures();
 
         SectionStats testCaseSectionStats(testCaseSection, assertions, duration, missingAssertions);
+        flushAssertionBatch();
+        SelfProfile::ScopedTimer reporterScope( SelfProfile::Bucket::ReporterDispatch );
         m_reporter->sectionEnded(testCaseSectionStats);
     }
 
+    namespace {
+        // Budgets are tuned against native execution speed; under a
+        // sanitizer or valgrind everything runs 10-100x slower and an
+        // unscaled budget would fail healthy tests
+        constexpr double instrumentationTimeoutScale = 20.0;
+    }
+
+    // Valgrind treats writes below the stack pointer as errors and
+    // sanitizers keep redzones there, so the stack is only painted on
+    // native runs
+    bool RunContext::shouldMeasureStackUsage() const {
+        return m_config->reportStackUsage() && !m_config->runningUnderInstrumentation();
+    }
+
     void RunContext::invokeActiveTestCase() {
+        // Everything in here is the user's time except the framework
+        // stages the body calls back into, which pause this scope for
+        // their duration (see PausedProfileScope)
+        struct BodyProfileBinding {
+            SelfProfile::ScopedTimer scope{ SelfProfile::Bucket::TestBody };
+            SelfProfile::ScopedTimer*& slot;
+            BodyProfileBinding( SelfProfile::ScopedTimer*& s ) : slot( s ) { slot = &scope; }
+            ~BodyProfileBinding() { slot = nullptr; }
+        } bodyScope( m_bodyProfileScope );
+
+        double timeout = m_activeTestCase->getTestCaseInfo().timeoutSeconds;
+        if (timeout <= 0)
+            timeout = m_config->timeout();
+        if (timeout > 0) {
+            if (m_config->runningUnderInstrumentation())
+                timeout *= instrumentationTimeoutScale;
+            invokeActiveTestCaseWithTimeout(timeout);
+            return;
+        }
+        if (shouldMeasureStackUsage())
+            paintStack();
         FatalConditionHandler fatalConditionHandler; // Handle signals
+#if !defined(CATCH_CONFIG_DISABLE_EXCEPTIONS)
         m_activeTestCase->invoke();
+#else
+        // The longjmp-based analogue of catching TestFailureException:
+        // a REQUIRE-family abort lands back here with the skipped
+        // Section bookkeeping replayed, and the run carries on
+        if (setjmp(testAbortTarget()) == 0) {
+            armTestAbort();
+            m_activeTestCase->invoke();
+        } else {
+            unwindAbortedSections();
+        }
+        disarmTestAbort();
+#endif
         fatalConditionHandler.reset();
+        if (shouldMeasureStackUsage())
+            m_stackPeakBytes = static_cast<long long>(stackHighWaterBytes());
+    }
+
+#if defined(CATCH_CONFIG_DISABLE_EXCEPTIONS)
+    void RunContext::unwindAbortedSections() {
+        // Innermost first, exactly as the destructors would have run.
+        // sectionEndedEarly pops the entry it consumes; durations are
+        // lost with the Section objects and reported as zero.
+        while (!m_abortSectionStack.empty())
+            sectionEndedEarly(SectionEndInfo(m_abortSectionStack.back()));
+    }
+#endif
+
+    // Runs the test body on a watchdog-supervised thread. A body that does
+    // not finish within its budget is failed and abandoned: the thread is
+    // detached and the run moves on to the next test, so a hang costs its
+    // budget rather than the rest of the run. The abandoned thread keeps
+    // running in the background - combine --timeout with --fork where that
+    // leak matters, as a forked child's exit cleans it up.
+    void RunContext::invokeActiveTestCaseWithTimeout(double timeoutSeconds) {
+        // Shared with (and kept alive by) the body thread in case the
+        // watchdog abandons it
+        struct Watchdog {
+            std::mutex mutex;
+            std::condition_variable signal;
+            bool started = false;
+            bool done = false;
+            std::exception_ptr exception;
+        };
+        auto watchdog = std::make_shared<Watchdog>();
+
+        std::thread body([this, watchdog] {
+            {
+                // Hold the body back until our id is recorded as the test
+                // thread, so its assertions are not deferred as concurrent
+                std::unique_lock<std::mutex> lock(watchdog->mutex);
+                watchdog->signal.wait(lock, [&] { return watchdog->started; });
+            }
+            // The body thread has its own stack, so it paints its own
+            // (thread local) window
+            if (shouldMeasureStackUsage())
+                paintStack();
+            FatalConditionHandler fatalConditionHandler; // Handle signals
+#if !defined(CATCH_CONFIG_DISABLE_EXCEPTIONS)
+            try {
+                m_activeTestCase->invoke();
+            } catch (...) {
+                watchdog->exception = std::current_exception();
+            }
+#else
+            // The abort target is thread local, so the body thread arms
+            // its own; the failed assertion is already recorded by the
+            // time the longjmp lands
+            if (setjmp(testAbortTarget()) == 0) {
+                armTestAbort();
+                m_activeTestCase->invoke();
+            } else {
+                unwindAbortedSections();
+            }
+            disarmTestAbort();
+#endif
+            fatalConditionHandler.reset();
+            if (shouldMeasureStackUsage())
+                m_stackPeakBytes = static_cast<long long>(stackHighWaterBytes());
+            {
+                std::lock_guard<std::mutex> lock(watchdog->mutex);
+                watchdog->done = true;
+            }
+            watchdog->signal.notify_one();
+        });
+
+        auto previousTestThread = m_testThread;
+        m_testThread = body.get_id();
+        {
+            std::lock_guard<std::mutex> lock(watchdog->mutex);
+            watchdog->started = true;
+        }
+        watchdog->signal.notify_one();
+
+        bool finished;
+        {
+            std::unique_lock<std::mutex> lock(watchdog->mutex);
+            finished = watchdog->signal.wait_for(lock, std::chrono::duration<double>(timeoutSeconds),
+                                                 [&] { return watchdog->done; });
+        }
+        m_testThread = previousTestThread;
+
+        if (finished) {
+            body.join();
+            if (watchdog->exception)
+                std::rethrow_exception(watchdog->exception);
+            return;
+        }
+        body.detach();
+        CATCH_RUNTIME_ERROR("Test case exceeded its time budget of " << timeoutSeconds << " seconds and was abandoned");
     }
 
     void RunContext::handleUnfinishedSections() {
@@ -382,16 +1142,86 @@ namespace Catch {
              itEnd = m_unfinishedSections.rend();
              it != itEnd;
              ++it)
-            sectionEnded(*it);
+            sectionEndedImpl(*it, it->assertions);
         m_unfinishedSections.clear();
     }
 
+    bool RunContext::deferConcurrentAssertion(
+            AssertionInfo const& info,
+            ITransientExpression const* expr,
+            ResultWas::OfType resultType,
+            StringRef const& message ) {
+        if( std::this_thread::get_id() == m_testThread )
+            return false;
+
+        bool passed;
+        if( expr ) {
+            bool negated = isFalseTest( info.resultDisposition );
+            passed = expr->getResult() != negated;
+            resultType = passed ? ResultWas::Ok : ResultWas::ExpressionFailed;
+        }
+        else {
+            passed = resultType == ResultWas::Ok;
+        }
+
+        if( passed ) {
+            m_concurrentPasses.fetch_add( 1, std::memory_order_relaxed );
+            return true;
+        }
+
+        DeferredAssertion deferred{ info, resultType, std::string(), message };
+        if( expr ) {
+            // The transient expression dies with the worker's stack frame,
+            // so reconstruct it now. ReusableStringStream's pool is not
+            // thread safe - use a local stream.
+            std::ostringstream oss;
+            expr->streamReconstructedExpression( oss );
+            deferred.expansion = oss.str();
+        }
+        {
+            std::lock_guard<std::mutex> lock( m_concurrentMutex );
+            m_concurrentFailures.push_back( std::move( deferred ) );
+        }
+        return true;
+    }
+
+    void RunContext::drainConcurrentAssertions() {
+        auto passes = m_concurrentPasses.exchange( 0, std::memory_order_relaxed );
+        m_totals.assertions.passed += passes;
+        if( passes > 0 && !m_sectionDeltas.empty() )
+            m_sectionDeltas.back().passed += passes;
+
+        std::vector<DeferredAssertion> failures;
+        {
+            std::lock_guard<std::mutex> lock( m_concurrentMutex );
+            failures.swap( m_concurrentFailures );
+        }
+        for( auto const& deferred : failures ) {
+            if( m_reportAssertionStarting )
+                m_reporter->assertionStarting( deferred.info );
+            m_lastAssertionInfo = deferred.info;
+
+            AssertionResultData data( deferred.resultType, LazyExpression( isFalseTest( deferred.info.resultDisposition ) ) );
+            data.reconstructedExpression = deferred.expansion;
+            data.message = deferred.message;
+            AssertionResult assertionResult{ deferred.info, data };
+            assertionEnded( assertionResult );
+        }
+    }
+
     void RunContext::handleExpr(
         AssertionInfo const& info,
         ITransientExpression const& expr,
         AssertionReaction& reaction
     ) {
-        m_reporter->assertionStarting( info );
+        // Assertions from worker threads are queued and drained on the test
+        // thread; the reaction is left untouched, so a failing REQUIRE does
+        // not unwind a worker's stack (it behaves like CHECK there)
+        if( deferConcurrentAssertion( info, &expr, ResultWas::Unknown, StringRef() ) )
+            return;
+
+        if( m_reportAssertionStarting )
+            m_reporter->assertionStarting( info );
 
         bool negated = isFalseTest( info.resultDisposition );
         bool result = expr.getResult() != negated;
@@ -409,6 +1239,38 @@ namespace Catch {
             populateReaction( reaction );
         }
     }
+    namespace {
+        // Names artifact files uniquely across --jobs workers
+        std::atomic<std::size_t> artifactSequence{ 0 };
+
+        // Writes each operand into its own sidecar file,
+        // <dir>/assertion-<seq>-<lhs|rhs>.bin, raw bytes only, so the
+        // payload loads offline (e.g. numpy.fromfile) bit-exactly
+        class BinaryArtifactFileSink : public IBinaryOperandSink {
+        public:
+            BinaryArtifactFileSink( std::string const& dir, std::size_t sequence )
+            :   m_basePath( dir + "/assertion-" + std::to_string( sequence ) ) {}
+
+            void beginOperand( char const* name ) override {
+                if( m_file.is_open() )
+                    m_file.close();
+                auto path = m_basePath + "-" + name + ".bin";
+                m_file.open( path, std::ios::binary | std::ios::trunc );
+                CATCH_ENFORCE( m_file.is_open(), "Unable to open artifact file: '" << path << "'" );
+                m_paths.push_back( std::move( path ) );
+            }
+            void writeBytes( void const* data, std::size_t size ) override {
+                m_file.write( static_cast<char const*>( data ), static_cast<std::streamsize>( size ) );
+            }
+            std::vector<std::string> const& paths() const { return m_paths; }
+
+        private:
+            std::string m_basePath;
+            std::ofstream m_file;
+            std::vector<std::string> m_paths;
+        };
+    }
+
     void RunContext::reportExpr(
             AssertionInfo const &info,
             ResultWas::OfType resultType,
@@ -421,6 +1283,17 @@ namespace Catch {
         AssertionResult assertionResult{ info, data };
         assertionResult.m_resultData.lazyExpression.m_transientExpression = expr;
 
+        // With --artifact-dir the operands of a failing comparison are
+        // dumped raw through BinaryMaker and never stringified: pre-setting
+        // the reconstructed expression short-circuits the lazy
+        // stringification, and the report references the files instead
+        if( resultType == ResultWas::ExpressionFailed && !m_config->artifactDir().empty() ) {
+            BinaryArtifactFileSink sink( m_config->artifactDir(), artifactSequence++ );
+            if( expr->writeBinaryOperands( sink ) )
+                assertionResult.m_resultData.reconstructedExpression =
+                    "(operand bytes written to '" + sink.paths()[0] + "' and '" + sink.paths()[1] + "')";
+        }
+
         assertionEnded( assertionResult );
     }
 
@@ -430,10 +1303,21 @@ namespace Catch {
             StringRef const& message,
             AssertionReaction& reaction
     ) {
-        m_reporter->assertionStarting( info );
+        if( deferConcurrentAssertion( info, nullptr, resultType, message ) )
+            return;
+
+        if( m_reportAssertionStarting )
+            m_reporter->assertionStarting( info );
 
         m_lastAssertionInfo = info;
 
+        // Successes that will not be reported anywhere only bump the
+        // counters - no AssertionResult (or its strings) is materialised
+        if( resultType == ResultWas::Ok && !m_includeSuccessfulResults ) {
+            assertionPassed();
+            return;
+        }
+
         AssertionResultData data( resultType, LazyExpression( false ) );
         data.message = message;
         AssertionResult assertionResult{ m_lastAssertionInfo, data };
@@ -482,8 +1366,18 @@ namespace Catch {
             ResultWas::OfType resultType,
             AssertionReaction &reaction
     ) {
+        if( deferConcurrentAssertion( info, nullptr, resultType, StringRef() ) )
+            return;
+
         m_lastAssertionInfo = info;
 
+        // Passing REQUIRE_NOTHROW and friends take the same allocation-free
+        // path as passing expressions when successes are not reported
+        if( resultType == ResultWas::Ok && !m_includeSuccessfulResults ) {
+            assertionPassed();
+            return;
+        }
+
         AssertionResultData data( resultType, LazyExpression( false ) );
         AssertionResult assertionResult{ info, data };
         assertionEnded( assertionResult );
@@ -496,7 +1390,13 @@ namespace Catch {
     IResultCapture& getResultCapture() {
         if (auto* capture = getCurrentContext().getResultCapture())
             return *capture;
+        else if (auto* fallback = fallbackResultCapture())
+            return *fallback;
         else
-            CATCH_INTERNAL_ERROR("No result capture instance");
+            return orphanResultCapture();
+    }
+
+    OrphanAssertionStats orphanAssertionStats() {
+        return orphanResultCapture().stats();
     }
 }
@@ -18,16 +18,28 @@
 #include "catch_capture.hpp"
 #include "catch_totals.h"
 #include "catch_test_spec.h"
+#include "catch_arena.h"
 #include "catch_test_case_tracker.h"
+#include "catch_benchmark_baseline.h"
+#include "catch_history_store.h"
+#include "catch_test_dependencies.h"
 #include "catch_timer.h"
+#include "catch_self_profile.h"
 #include "catch_assertionhandler.h"
 #include "catch_fatal_condition.h"
+#include "catch_status_signal.h"
+#include "catch_output_redirect.h"
 
+#include <atomic>
+#include <map>
+#include <mutex>
 #include <string>
+#include <utility>
+#include <thread>
 
 namespace Catch {
 
-    struct IMutableContext;
+    class Context;
 
     ///////////////////////////////////////////////////////////////////////////
 
@@ -49,6 +61,14 @@ namespace Catch {
         IConfigPtr config() const;
         IStreamingReporter& reporter() const;
 
+        // Mean runtimes observed for each benchmark run so far, in
+        // nanoseconds per iteration (see --benchmark-baseline)
+        BenchmarkBaselines const& benchmarkResults() const;
+
+        // File dependencies each test recorded via
+        // Catch::addTestFileDependency (see --deps-cache)
+        TestDependencies const& testDependencies() const;
+
     public: // IResultCapture
 
         // Assertion handlers
@@ -75,11 +95,13 @@ namespace Catch {
                     ResultWas::OfType resultType,
                     AssertionReaction &reaction ) override;
 
-        bool sectionStarted( SectionInfo const& sectionInfo, Counts& assertions ) override;
+        bool sectionStarted( SectionInfo const& sectionInfo ) override;
 
         void sectionEnded( SectionEndInfo const& endInfo ) override;
         void sectionEndedEarly( SectionEndInfo const& endInfo ) override;
 
+        void setSectionBudget( double budgetSeconds, AssertionInfo const& info ) override;
+
         auto acquireGeneratorTracker( SourceLineInfo const& lineInfo ) -> IGeneratorTracker& override;
 
         void benchmarkStarting( BenchmarkInfo const& info ) override;
@@ -88,6 +110,9 @@ namespace Catch {
         void pushScopedMessage( MessageInfo const& message ) override;
         void popScopedMessage( MessageInfo const& message ) override;
 
+        void pushDeferredMessage( DeferredMessageBase const* message ) override;
+        void popDeferredMessage( DeferredMessageBase const* message ) override;
+
         std::string getCurrentTestName() const override;
 
         const AssertionResult* getLastResult() const override;
@@ -107,12 +132,34 @@ namespace Catch {
     private:
 
         void runCurrentTest( std::string& redirectedCout, std::string& redirectedCerr );
+        bool shouldMeasureStackUsage() const;
         void invokeActiveTestCase();
+        void invokeActiveTestCaseWithTimeout( double timeoutSeconds );
 
         void resetAssertionInfo();
         bool testForMissingAssertions( Counts& assertions );
 
+        // Section accounting is a stack of per-section deltas: a zeroed
+        // slot is pushed when a section opens, assertions bump the top
+        // slot (alongside the run totals), and popping folds the slot
+        // into its parent. No Totals snapshots or subtraction involved.
+        Counts popSectionDelta();
+        // The tail of sectionEnded, shared with handleUnfinishedSections,
+        // which carries deltas popped during unwinding instead
+        void sectionEndedImpl( SectionEndInfo const& endInfo, Counts assertions );
+        // Resolves a pending SECTION_BUDGET against the ending section's
+        // measured duration, reporting pass or failure as an assertion
+        void checkSectionBudget( SectionEndInfo const& endInfo );
+
         void assertionEnded( AssertionResult const& result );
+        // Hands the stats to the reporter, or parks them in the batch for
+        // the next section boundary when the reporter opted into batched
+        // delivery (see ReporterPreferences::shouldBatchAssertions)
+        void deliverAssertionStats( AssertionStats&& stats );
+        void flushAssertionBatch();
+        // Emits a warning per source location whose failure count exceeded
+        // the reporting cap, then forgets the counts
+        void reportCollapsedFailures();
         void reportExpr
                 (   AssertionInfo const &info,
                     ResultWas::OfType resultType,
@@ -121,12 +168,38 @@ namespace Catch {
 
         void populateReaction( AssertionReaction& reaction );
 
+        // Concurrent assertion capture. Assertions arriving from threads
+        // other than the one running the test body cannot touch the totals,
+        // messages or reporter directly; passes bump a relaxed atomic
+        // counter and failures are queued under a mutex, both drained on
+        // the test thread at section and test case end. Returns false on
+        // the test thread, where the normal path applies.
+        bool deferConcurrentAssertion
+                (   AssertionInfo const& info,
+                    ITransientExpression const* expr,
+                    ResultWas::OfType resultType,
+                    StringRef const& message );
+        void drainConcurrentAssertions();
+
+        // Cross-process abort coordination (--abort-file): an aborting run
+        // touches the file, other runs poll for it once per test case
+        void pollAbortFile();
+
     private:
 
         void handleUnfinishedSections();
 
+#if defined(CATCH_CONFIG_DISABLE_EXCEPTIONS)
+        // Replays the bookkeeping the Section destructors between a
+        // longjmp abort and the test body's entry frame would have done
+        void unwindAbortedSections();
+#endif
+
         TestRunInfo m_runInfo;
-        IMutableContext& m_context;
+        // Answers kill -USR1 with the current test and totals for as long
+        // as this run exists (see catch_status_signal.h)
+        StatusSignalHandler m_statusSignalHandler;
+        Context& m_context;
         TestCase const* m_activeTestCase = nullptr;
         ITracker* m_testCaseTracker;
         Option<AssertionResult> m_lastResult;
@@ -135,14 +208,102 @@ namespace Catch {
         Totals m_totals;
         IStreamingReporterPtr m_reporter;
         std::vector<MessageInfo> m_messages;
+        // Active DEFERRED_CAPTUREs, owned by their scopes; stringified
+        // only when a result is actually reported
+        std::vector<DeferredMessageBase const*> m_deferredMessages;
         AssertionInfo m_lastAssertionInfo;
+        // Peak stack bytes of the last test body invocation; -1 unless
+        // --stack-usage sampled it
+        long long m_stackPeakBytes = -1;
         std::vector<SectionEndInfo> m_unfinishedSections;
         std::vector<ITracker*> m_activeSections;
+        // One slot per open section plus a base slot for the test case
+        // itself; see popSectionDelta
+        std::vector<Counts> m_sectionDeltas;
+        // Budgets armed by SECTION_BUDGET, keyed to the depth of the
+        // section they were set in; the info points at the callsite's
+        // static AssertionInfo (see INTERNAL_CATCH_ASSERTION_INFO)
+        struct PendingSectionBudget {
+            double budgetSeconds;
+            AssertionInfo const* info;
+            std::size_t depth;
+        };
+        std::vector<PendingSectionBudget> m_sectionBudgets;
+        // The --self-profile scope timing the running test body, so the
+        // framework stages it calls into can carve themselves out of it
+        // (see PausedProfileScope in the implementation); null outside
+        // invokeActiveTestCase
+        SelfProfile::ScopedTimer* m_bodyProfileScope = nullptr;
+#if defined(CATCH_CONFIG_DISABLE_EXCEPTIONS)
+        // One entry per Section currently on the stack, so a longjmp
+        // abort (which skips their destructors) can still end them
+        std::vector<SectionEndInfo> m_abortSectionStack;
+#endif
+        // Backs the per-test-case tracker tree; reset wholesale after each
+        // test case, once the last tracker has been destroyed
+        Arena m_arena;
         TrackerContext m_trackerContext;
+        BenchmarkBaselines m_benchmarkBaselines;
+        BenchmarkBaselines m_benchmarkResults;
+        TestDependencies m_testDependencies;
+        // Only opened when --history-file is given (see catch_history_store.h)
+        std::unique_ptr<HistoryStore> m_historyStore;
+        // Failures seen per source location in the current test case
+        // attempt; once a site passes the reporting cap its further
+        // failures are only counted here (see reportCollapsedFailures)
+        std::map<std::pair<char const*, std::size_t>, std::size_t> m_failuresPerSite;
+        struct DeferredAssertion {
+            AssertionInfo info;
+            ResultWas::OfType resultType;
+            std::string expansion;
+            std::string message;
+        };
+#if defined(CATCH_CONFIG_NEW_CAPTURE)
+        // Capture files are opened once per run and truncated after each
+        // test case, rather than opened fresh per test
+        TempFile m_stdoutCapture;
+        TempFile m_stderrCapture;
+#endif
+        // Reused across test cases so their capacity is only grown once
+        std::string m_redirectedCout;
+        std::string m_redirectedCerr;
+        // Assertion stats awaiting batched delivery; cleared, not shrunk,
+        // at each section boundary so its capacity is only grown once
+        std::vector<AssertionStats> m_assertionBatch;
+        std::thread::id m_testThread;
+        std::atomic<std::size_t> m_concurrentPasses{ 0 };
+        std::mutex m_concurrentMutex;
+        std::vector<DeferredAssertion> m_concurrentFailures;
         bool m_lastAssertionPassed = false;
         bool m_shouldReportUnexpected = true;
+        mutable bool m_abortFileSignalled = false;
+        bool m_abortFileObserved = false;
+        // Totals-only capture (--totals-only): successful assertions are
+        // pure counter bumps - no AssertionStats, no reporter calls - even
+        // when a reporter or listener asks for all assertions. Failures
+        // still take the full recording branch. Must be initialised before
+        // the preference-derived flags below, which it overrides.
+        bool m_totalsOnly;
         bool m_includeSuccessfulResults;
+        bool m_singlePassSections;
+        bool m_reportAssertionStarting;
+        bool m_batchAssertions;
+        unsigned int m_successfulAssertionSampleRate;
+        std::size_t m_successfulAssertionsSeen = 0;
+    };
+
+    // Assertions made from threads with no capture at all (user-spawned
+    // threads while several RunContexts are alive, see [!exclusive]) are
+    // swallowed by a process-wide null capture instead of aborting. The
+    // session reads this summary after the run to warn about them and to
+    // fail the run if any of them failed.
+    struct OrphanAssertionStats {
+        std::size_t total;
+        std::size_t failed;
+        char const* firstFile;
+        std::size_t firstLine;
     };
+    OrphanAssertionStats orphanAssertionStats();
 
 } // end namespace Catch
 
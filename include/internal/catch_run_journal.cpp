@@ -0,0 +1,57 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_run_journal.h"
+#include "catch_enforce.h"
+
+namespace Catch {
+
+    // One record per line: "S <name>" when a test starts, "E <name>" when
+    // it completes. Line-based like the -f input file and the failure
+    // cache, so a journal can be inspected - or edited - with ordinary
+    // text tools.
+    RunJournalState loadRunJournal( std::string const& journalFile ) {
+        RunJournalState state;
+        std::ifstream file( journalFile );
+        if( !file )
+            return state;
+
+        std::set<std::string> started;
+        std::string line;
+        while( std::getline( file, line ) ) {
+            if( line.size() < 3 || line[1] != ' ' )
+                continue;
+            if( line[0] == 'S' )
+                started.insert( line.substr( 2 ) );
+            else if( line[0] == 'E' )
+                state.completed.insert( line.substr( 2 ) );
+        }
+        for( auto const& name : started )
+            if( !state.completed.count( name ) )
+                state.crashed.insert( name );
+        return state;
+    }
+
+    RunJournal::RunJournal( std::string const& journalFile, bool append )
+    : m_stream( journalFile, append ? std::ios::app : std::ios::trunc )
+    {
+        CATCH_ENFORCE( m_stream, "Unable to open journal file: '" << journalFile << "'" );
+    }
+
+    void RunJournal::testStarted( std::string const& name ) {
+        write( 'S', name );
+    }
+    void RunJournal::testEnded( std::string const& name ) {
+        write( 'E', name );
+    }
+
+    void RunJournal::write( char tag, std::string const& name ) {
+        // Flushed through to the kernel immediately - the journal must
+        // survive the process dying at any point afterwards
+        m_stream << tag << ' ' << name << '\n';
+        m_stream.flush();
+    }
+
+} // end namespace Catch
@@ -0,0 +1,49 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_RUN_JOURNAL_H_INCLUDED
+#define TWOBLUECUBES_CATCH_RUN_JOURNAL_H_INCLUDED
+
+#include <fstream>
+#include <set>
+#include <string>
+
+namespace Catch {
+
+    // Write-ahead journal of test progress (--journal). A start record is
+    // flushed to disk before each test runs and an end record after it
+    // completes, so if the process dies mid-test the journal names every
+    // test that finished and the one that was running. A --resume run
+    // then skips the finished tests, quarantines the crasher and carries
+    // on from where the crashed run stopped.
+
+    // What a previous run's journal says: tests that completed (pass or
+    // fail - they already reported), and tests that started but never
+    // finished
+    struct RunJournalState {
+        std::set<std::string> completed;
+        std::set<std::string> crashed;
+    };
+
+    // Returns an empty state if the file does not exist or cannot be read
+    RunJournalState loadRunJournal( std::string const& journalFile );
+
+    class RunJournal {
+    public:
+        // Appends when resuming, starts afresh otherwise. Throws if the
+        // file cannot be opened.
+        RunJournal( std::string const& journalFile, bool append );
+
+        void testStarted( std::string const& name );
+        void testEnded( std::string const& name );
+
+    private:
+        void write( char tag, std::string const& name );
+
+        std::ofstream m_stream;
+    };
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_RUN_JOURNAL_H_INCLUDED
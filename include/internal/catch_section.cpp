@@ -8,20 +8,27 @@
 
 #include "catch_section.h"
 #include "catch_capture.hpp"
+#include "catch_suspend_timing.h"
 #include "catch_uncaught_exceptions.h"
 
 namespace Catch {
 
     Section::Section( SectionInfo const& info )
     :   m_info( info ),
-        m_sectionIncluded( getResultCapture().sectionStarted( m_info, m_assertions ) )
+        m_sectionIncluded( getResultCapture().sectionStarted( m_info ) )
     {
+        m_suspendedOnEntry = suspendedTimeNanoseconds();
         m_timer.start();
     }
 
     Section::~Section() {
         if( m_sectionIncluded ) {
-            SectionEndInfo endInfo{ m_info, m_assertions, m_timer.getElapsedSeconds() };
+            // Time spent in SuspendTiming scopes does not count towards
+            // the section's duration
+            auto elapsed = m_timer.getElapsedNanoseconds();
+            auto suspended = suspendedTimeNanoseconds() - m_suspendedOnEntry;
+            auto measured = elapsed > suspended ? elapsed - suspended : 0;
+            SectionEndInfo endInfo{ m_info, Counts(), static_cast<double>( measured ) / 1000000000.0 };
             if( uncaught_exceptions() )
                 getResultCapture().sectionEndedEarly( endInfo );
             else
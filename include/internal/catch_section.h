@@ -29,9 +29,11 @@ namespace Catch {
         SectionInfo m_info;
 
         std::string m_name;
-        Counts m_assertions;
         bool m_sectionIncluded;
         Timer m_timer;
+        // This thread's suspended-time total when the section was entered
+        // (see SuspendTiming)
+        uint64_t m_suspendedOnEntry = 0;
     };
 
 } // end namespace Catch
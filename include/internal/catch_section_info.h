@@ -33,7 +33,10 @@ namespace Catch {
 
     struct SectionEndInfo {
         SectionInfo sectionInfo;
-        Counts prevAssertions;
+        // Only meaningful for sections that ended early: the section's own
+        // assertion counts, popped from the delta stack during unwinding
+        // so they can be reported once the unwind is over
+        Counts assertions;
         double durationInSeconds;
     };
 
@@ -0,0 +1,93 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_self_profile.h"
+
+#include <atomic>
+#include <iomanip>
+#include <ostream>
+
+namespace Catch {
+namespace SelfProfile {
+
+    namespace {
+
+        struct BucketTotals {
+            std::atomic<uint64_t> totalNs{ 0 };
+            std::atomic<uint64_t> count{ 0 };
+        };
+
+        char const* bucketNames[bucketCount] = {
+            "test bodies",
+            "stringification",
+            "reporter dispatch",
+            "tracker bookkeeping",
+            "output redirection",
+        };
+
+        bool s_enabled = false;
+        // add() is hit from worker threads under --jobs; relaxed atomic
+        // adds keep it contention- and lock-free
+        BucketTotals s_buckets[bucketCount];
+        Timer s_wallClock;
+
+    } // anon namespace
+
+    bool enabled() {
+        return s_enabled;
+    }
+    void setEnabled( bool enabled ) {
+        s_enabled = enabled;
+        if( enabled )
+            s_wallClock.start();
+    }
+
+    void add( Bucket bucket, uint64_t elapsedNanoseconds ) {
+        auto& totals = s_buckets[static_cast<std::size_t>( bucket )];
+        totals.totalNs.fetch_add( elapsedNanoseconds, std::memory_order_relaxed );
+        totals.count.fetch_add( 1, std::memory_order_relaxed );
+    }
+
+    void report( std::ostream& os ) {
+        uint64_t attributedNs = 0;
+        uint64_t anyCount = 0;
+        for( auto const& bucket : s_buckets ) {
+            attributedNs += bucket.totalNs.load();
+            anyCount += bucket.count.load();
+        }
+        if( anyCount == 0 )
+            return;
+
+        auto wallNs = s_wallClock.getElapsedNanoseconds();
+        auto percent = [wallNs]( uint64_t ns ) {
+            return wallNs ? 100.0 * static_cast<double>( ns ) / static_cast<double>( wallNs ) : 0.0;
+        };
+
+        os << "\nSelf-overhead attribution ("
+           << static_cast<double>( wallNs ) / 1000000.0 << " ms wall clock):\n"
+           << std::setw( 22 ) << "stage"
+           << std::setw( 14 ) << "total ms"
+           << std::setw( 9 ) << "% wall"
+           << std::setw( 12 ) << "count" << '\n';
+        os << std::fixed << std::setprecision( 2 );
+        for( std::size_t i = 0; i < bucketCount; ++i ) {
+            auto ns = s_buckets[i].totalNs.load();
+            os << std::setw( 22 ) << bucketNames[i]
+               << std::setw( 14 ) << static_cast<double>( ns ) / 1000000.0
+               << std::setw( 9 ) << percent( ns )
+               << std::setw( 12 ) << s_buckets[i].count.load() << '\n';
+        }
+        // Scheduling, result bookkeeping, and everything else between
+        // the timed windows
+        auto unattributedNs = wallNs > attributedNs ? wallNs - attributedNs : 0;
+        os << std::setw( 22 ) << "unattributed"
+           << std::setw( 14 ) << static_cast<double>( unattributedNs ) / 1000000.0
+           << std::setw( 9 ) << percent( unattributedNs ) << '\n';
+        os.unsetf( std::ios::floatfield );
+        os << std::setprecision( 6 );
+    }
+
+} // namespace SelfProfile
+} // namespace Catch
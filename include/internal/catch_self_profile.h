@@ -0,0 +1,84 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_SELF_PROFILE_H_INCLUDED
+#define TWOBLUECUBES_CATCH_SELF_PROFILE_H_INCLUDED
+
+#include "catch_timer.h"
+
+#include <cstdint>
+#include <iosfwd>
+
+namespace Catch {
+
+    // Opt-in (--self-profile) attribution of the run's wall clock to
+    // the framework's own stages versus the user's test bodies.
+    // RunContext brackets each stage with a ScopedTimer; the report at
+    // the end of the run answers "how much of this run was Catch?"
+    // with numbers instead of argument. The buckets are disjoint by
+    // construction (an enclosing scope is paused around a nested one),
+    // so their total plus the unattributed remainder is the wall clock.
+    //
+    // Stringification that reporters trigger lazily while formatting
+    // (getExpandedExpression inside assertionEnded) is counted as
+    // reporter dispatch - only the eagerly materialised text (deferred
+    // captures, batched expansion) lands in the stringification bucket.
+    namespace SelfProfile {
+
+        enum class Bucket : std::size_t {
+            TestBody,           // inside invokeActiveTestCase
+            Stringification,    // materialising messages and expansions
+            ReporterDispatch,   // calls into the reporter chain
+            TrackerBookkeeping, // section/generator tracker operations
+            OutputRedirection,  // stdout/stderr capture setup and drain
+        };
+        constexpr std::size_t bucketCount = 5;
+
+        bool enabled();
+        // Enabling also starts the wall clock the report is relative to
+        void setEnabled( bool enabled );
+
+        void add( Bucket bucket, uint64_t elapsedNanoseconds );
+
+        // Times one stage. Free when disabled (a single bool test);
+        // pause() around a nested stage keeps the buckets disjoint.
+        class ScopedTimer {
+            Bucket m_bucket;
+            Timer m_timer;
+            bool m_running = false;
+        public:
+            ScopedTimer( Bucket bucket ) : m_bucket( bucket ) {
+                resume();
+            }
+            ~ScopedTimer() {
+                pause();
+            }
+            void pause() {
+                if( m_running ) {
+                    add( m_bucket, m_timer.getElapsedNanoseconds() );
+                    m_running = false;
+                }
+            }
+            void resume() {
+                if( enabled() ) {
+                    m_timer.start();
+                    m_running = true;
+                }
+            }
+            bool running() const {
+                return m_running;
+            }
+
+            ScopedTimer( ScopedTimer const& ) = delete;
+            ScopedTimer& operator = ( ScopedTimer const& ) = delete;
+        };
+
+        // Writes the attribution table. No-op if nothing was recorded.
+        void report( std::ostream& os );
+
+    } // namespace SelfProfile
+
+} // namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_SELF_PROFILE_H_INCLUDED
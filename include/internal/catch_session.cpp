@@ -6,12 +6,27 @@
  */
 
 #include "catch_session.h"
+#include "catch_assertion_profile.h"
 #include "catch_commandline.h"
+#include "catch_config_snapshot.h"
 #include "catch_console_colour.h"
+#include "catch_benchmark_baseline.h"
+#include "catch_distributed.h"
+#include "catch_duration_cache.h"
 #include "catch_enforce.h"
+#include "catch_failure_cache.h"
+#include "catch_history_store.h"
 #include "catch_list.h"
+#include "catch_platform.h"
+#include "catch_progress_heartbeat.h"
 #include "catch_run_context.h"
+#include "catch_run_journal.h"
+#include "catch_self_profile.h"
 #include "catch_stream.h"
+#include "catch_string_manip.h"
+#include "catch_suite_fixture.h"
+#include "catch_test_dependencies.h"
+#include "catch_test_plugin.h"
 #include "catch_test_spec.h"
 #include "catch_version.h"
 #include "catch_interfaces_reporter.h"
@@ -19,11 +34,30 @@
 #include "catch_startup_exception_registry.h"
 #include "catch_text.h"
 #include "catch_stream.h"
+#include "catch_timer.h"
 #include "catch_windows_h_proxy.h"
 #include "../reporters/catch_reporter_listening.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
+#include <cstring>
+#include <ctime>
 #include <iomanip>
+#include <sstream>
+#include <thread>
+
+#if defined(CATCH_PLATFORM_LINUX) || defined(CATCH_PLATFORM_MAC)
+#define CATCH_INTERNAL_CONFIG_USE_FORK
+#define CATCH_INTERNAL_CONFIG_USE_DAEMON
+#include <cerrno>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 namespace Catch {
 
@@ -32,11 +66,19 @@ namespace Catch {
 
         IStreamingReporterPtr createReporter(std::string const& reporterName, IConfigPtr const& config) {
             auto reporter = Catch::getRegistryHub().getReporterRegistry().create(reporterName, config);
-            CATCH_ENFORCE(reporter, "No reporter registered with name: '" << reporterName << "'");
+            CATCH_ENFORCE_PARTS(reporter, "No reporter registered with name: '", reporterName, "'");
 
             return reporter;
         }
 
+        IStreamingReporterPtr createReporter(std::string const& reporterName, IConfigPtr const& config, std::ostream& stream) {
+            auto const& factories = Catch::getRegistryHub().getReporterRegistry().getFactories();
+            auto factory = factories.find(reporterName);
+            CATCH_ENFORCE_PARTS(factory != factories.end(), "No reporter registered with name: '", reporterName, "'");
+
+            return factory->second->create(ReporterConfig(config, stream));
+        }
+
         IStreamingReporterPtr makeReporter(std::shared_ptr<Config> const& config) {
             if (Catch::getRegistryHub().getReporterRegistry().getListeners().empty()) {
                 return createReporter(config->getReporterName(), config);
@@ -49,11 +91,791 @@ namespace Catch {
                 multi->addListener(listener->create(Catch::ReporterConfig(config)));
             }
             multi->addReporter(createReporter(config->getReporterName(), config));
-            return std::move(multi);
+            return multi;
+        }
+
+
+        // Folds the durations observed in this run into the on-disk duration
+        // cache, keeping the last observed runtime of tests that did not run
+        // this time around (e.g. tests belonging to other shards)
+        void persistTestDurations(Config const& config, TestDurations const& observed) {
+            if (config.durationCacheFile().empty() || observed.empty())
+                return;
+
+            auto durations = loadTestDurations(config.durationCacheFile());
+            for (auto const& observedDuration : observed)
+                durations[observedDuration.first] = observedDuration.second;
+            saveTestDurations(config.durationCacheFile(), durations);
+        }
+
+        // Updates the failure cache with this run's outcomes: tests that
+        // failed are added, tests that ran and passed are removed, and
+        // cached failures of tests that did not run (filtered out, or
+        // belonging to another shard) are kept
+        void persistFailedTests(Config const& config, FailedTests const& nowFailed, FailedTests const& nowPassed) {
+            if (config.rerunFailuresFile().empty() || (nowFailed.empty() && nowPassed.empty()))
+                return;
+
+            auto failed = loadFailedTests(config.rerunFailuresFile());
+            for (auto const& name : nowPassed)
+                failed.erase(name);
+            failed.insert(nowFailed.begin(), nowFailed.end());
+            saveFailedTests(config.rerunFailuresFile(), failed);
+        }
+
+        // As persistFailedTests, but for the quarantine file: tests that
+        // only passed on a --retry-failures attempt are added, tests that
+        // passed first time are removed, and entries for tests that did
+        // not run are kept
+        void persistQuarantinedTests(Config const& config, FailedTests const& nowFlaky, FailedTests const& nowPassed) {
+            if (config.quarantineFile().empty() || (nowFlaky.empty() && nowPassed.empty()))
+                return;
+
+            auto quarantined = loadFailedTests(config.quarantineFile());
+            for (auto const& name : nowPassed)
+                if (!nowFlaky.count(name))
+                    quarantined.erase(name);
+            quarantined.insert(nowFlaky.begin(), nowFlaky.end());
+            saveFailedTests(config.quarantineFile(), quarantined);
+        }
+
+        // As persistTestDurations, but for the file-dependency cache: a
+        // test that recorded dependencies this run replaces its own entry;
+        // entries of tests that recorded nothing are kept
+        void persistTestDependencies(Config const& config, TestDependencies const& observed) {
+            if (config.depsCacheFile().empty() || observed.empty())
+                return;
+
+            auto dependencies = loadTestDependencies(config.depsCacheFile());
+            for (auto const& observedEntry : observed)
+                dependencies[observedEntry.first] = observedEntry.second;
+            saveTestDependencies(config.depsCacheFile(), dependencies);
+        }
+
+        // As persistTestDurations, but for the benchmark baseline file. New
+        // results overwrite the recorded baselines of the benchmarks that ran;
+        // other entries are left untouched.
+        void persistBenchmarkBaselines(Config const& config, BenchmarkBaselines const& observed) {
+            if (config.benchmarkBaselineFile().empty() || observed.empty())
+                return;
+
+            auto baselines = loadBenchmarkBaselines(config.benchmarkBaselineFile());
+            for (auto const& observedBaseline : observed)
+                baselines[observedBaseline.first] = observedBaseline.second;
+            saveBenchmarkBaselines(config.benchmarkBaselineFile(), baselines);
+        }
+
+        // Every --jobs worker writes through its own reporter, so a document
+        // reporter such as JUnit produces one complete document per worker
+        // and plain concatenation would emit several XML prologs and roots.
+        // Instead the per-worker documents are stitched into one: the first
+        // worker's prolog and <testsuites> root are kept, the <testsuite>
+        // fragments of each worker are lifted out with a single linear scan
+        // per buffer, and the root is closed once. Returns false if any
+        // buffer does not have the expected shape, in which case the caller
+        // falls back to concatenating the buffers as-is.
+        bool stitchJUnitDocuments(std::ostream& out, std::vector<std::ostringstream> const& workerOutput) {
+            static const std::string openTag = "<testsuites>";
+            static const std::string closeTag = "</testsuites>";
+
+            std::vector<std::string> documents;
+            documents.reserve(workerOutput.size());
+            for (auto const& output : workerOutput)
+                documents.push_back(output.str());
+
+            std::vector<std::pair<std::size_t, std::size_t>> fragments;
+            fragments.reserve(documents.size());
+            for (auto const& document : documents) {
+                auto open = document.find(openTag);
+                auto close = document.rfind(closeTag);
+                if (open == std::string::npos || close == std::string::npos || close < open)
+                    return false;
+                fragments.emplace_back(open + openTag.size(), close);
+            }
+
+            out << documents.front().substr(0, fragments.front().first);
+            for (std::size_t i = 0; i < documents.size(); ++i)
+                out.write(documents[i].data() + fragments[i].first,
+                          static_cast<std::streamsize>(fragments[i].second - fragments[i].first));
+            out << documents.front().substr(fragments.front().second);
+            return true;
+        }
+
+        // Runs the matched test cases on a pool of worker threads, each with
+        // its own RunContext (contexts are thread local). Every worker writes
+        // through its own reporter into a private buffer; the buffers are
+        // flushed to the real output stream once all workers have joined, so
+        // the output of different workers is never interleaved.
+        Catch::Totals runTestsInParallel(std::shared_ptr<Config> const& config, std::size_t jobs) {
+            TestSpec testSpec = config->testSpec();
+
+            auto const& allTestCases = getAllTestCasesSorted(*config);
+            auto const& filtered = getAllTestCasesFiltered(testSpec, *config);
+            std::vector<TestCase const*> selected;
+            std::vector<TestCase const*> skipped;
+            auto filteredIt = filtered.begin();
+            for (auto const& testCase : allTestCases) {
+                if (filteredIt != filtered.end() && testCase == *filteredIt) {
+                    selected.push_back(&testCase);
+                    ++filteredIt;
+                } else {
+                    skipped.push_back(&testCase);
+                }
+            }
+            // Workers pull from a single shared queue below, so an idle
+            // worker always takes the next pending test - dispatching
+            // longest-first (when cached runtimes are available) then keeps
+            // the long tail from starting, alone, at the end of the run.
+            // The duration-balanced order has already arranged this. A
+            // --max-duration budget takes precedence: its priority order
+            // (failed and never-run tests first) must survive to dispatch.
+            if ((!config->durationCacheFile().empty() || !config->historyFile().empty()) &&
+                    config->maxDuration() == 0 &&
+                    config->runOrder() != RunTests::InDurationBalancedOrder) {
+                auto durations = loadSchedulingDurations(*config);
+                auto cachedDuration = [&durations](TestCase const* testCase) {
+                    auto it = durations.find(testCase->name);
+                    return it != durations.end() ? it->second : 0.001;
+                };
+                // Longest-first within each priority tier - the tier
+                // grouping sortTests produced must survive to dispatch
+                std::stable_sort(selected.begin(), selected.end(),
+                    [&](TestCase const* lhs, TestCase const* rhs) {
+                        if (lhs->priorityTier != rhs->priorityTier)
+                            return lhs->priorityTier < rhs->priorityTier;
+                        return cachedDuration(lhs) > cachedDuration(rhs);
+                    });
+            }
+
+            primeSuiteFixtures(selected);
+
+            // Tests tagged [!exclusive] assert from threads they spawn,
+            // which only works while exactly one RunContext is alive (the
+            // fallback capture is disarmed as soon as ownership would be
+            // ambiguous). They are pulled out of the pool here and run
+            // serially once the workers have drained.
+            std::vector<TestCase const*> exclusive;
+            {
+                auto firstExclusive = std::stable_partition(selected.begin(), selected.end(),
+                    [](TestCase const* testCase) { return !testCase->exclusive(); });
+                exclusive.assign(firstExclusive, selected.end());
+                selected.erase(firstExclusive, selected.end());
+            }
+
+            if (jobs > selected.size())
+                jobs = (std::max)(selected.size(), std::size_t(1));
+            auto const groupCount = jobs + (exclusive.empty() ? std::size_t(0) : std::size_t(1));
+
+            std::atomic<std::size_t> nextTest(0);
+            std::atomic<bool> aborted(false);
+            std::vector<Totals> workerTotals(groupCount);
+            std::vector<std::ostringstream> workerOutput(groupCount);
+            std::vector<TestDurations> workerDurations(groupCount);
+            std::vector<BenchmarkBaselines> workerBenchmarks(groupCount);
+            std::vector<TestDependencies> workerDependencies(groupCount);
+            std::vector<FailedTests> workerFailed(groupCount);
+            std::vector<FailedTests> workerPassed(groupCount);
+            std::vector<FailedTests> workerFlaky(groupCount);
+
+            // Shared by all workers: once the --max-duration budget is
+            // spent, remaining tests are claimed but only counted, not run
+            Timer budgetTimer;
+            budgetTimer.start();
+            std::atomic<std::size_t> notRunForBudget(0);
+
+            // --fail-fast-tier across workers: the lowest tier a failure
+            // has been seen in. Tests of strictly later tiers are claimed
+            // but not started; tests of the failing tier itself - some
+            // already running on other workers - finish normally
+            std::atomic<int> lowestFailedTier(TestCaseInfo::unprioritisedTier);
+            std::atomic<std::size_t> notRunForTier(0);
+
+            auto runWorker = [&](std::size_t i, std::vector<TestCase const*> const& tests,
+                                 std::atomic<std::size_t>& next) {
+                auto reporter = createReporter(config->getReporterName(), config, workerOutput[i]);
+                RunContext context(config, std::move(reporter));
+
+                Totals totals;
+                context.testGroupStarting(config->name(), i + 1, groupCount);
+                if (i == 0) {
+                    for (auto skippedTest : skipped)
+                        context.reporter().skipTest(*skippedTest);
+                }
+                for (std::size_t test = next++; test < tests.size(); test = next++) {
+                    if (aborted)
+                        break;
+                    if (config->maxDuration() > 0 && budgetTimer.getElapsedSeconds() >= config->maxDuration()) {
+                        ++notRunForBudget;
+                        context.reporter().skipTest(*tests[test]);
+                        continue;
+                    }
+                    if (config->failFastTier() && tests[test]->priorityTier > lowestFailedTier.load()) {
+                        ++notRunForTier;
+                        context.reporter().skipTest(*tests[test]);
+                        continue;
+                    }
+                    Timer timer;
+                    timer.start();
+                    auto testTotals = context.runTest(*tests[test]);
+                    totals += testTotals;
+                    workerDurations[i][tests[test]->name] = timer.getElapsedSeconds();
+                    if (config->failFastTier() && testTotals.testCases.failed > 0) {
+                        auto tier = tests[test]->priorityTier;
+                        auto seen = lowestFailedTier.load();
+                        while (tier < seen && !lowestFailedTier.compare_exchange_weak(seen, tier))
+                            ;
+                    }
+                    (testTotals.testCases.failed > 0 ? workerFailed : workerPassed)[i].insert(tests[test]->name);
+                    if (testTotals.testCases.passedOnRetry > 0)
+                        workerFlaky[i].insert(tests[test]->name);
+                    if (context.aborting())
+                        aborted = true;
+                }
+                context.testGroupEnded(config->name(), totals, i + 1, groupCount);
+                workerTotals[i] = totals;
+                workerBenchmarks[i] = context.benchmarkResults();
+                workerDependencies[i] = context.testDependencies();
+            };
+
+            std::vector<std::thread> workers;
+            workers.reserve(jobs);
+            for (std::size_t i = 0; i < jobs; ++i)
+                workers.emplace_back([&runWorker, &selected, &nextTest, i] { runWorker(i, selected, nextTest); });
+            for (auto& worker : workers)
+                worker.join();
+
+            // With the pool drained exactly one RunContext is alive per
+            // exclusive test, so the fallback capture arms and their worker
+            // thread assertions are attributed like in a serial run
+            if (!exclusive.empty()) {
+                std::atomic<std::size_t> nextExclusive(0);
+                runWorker(jobs, exclusive, nextExclusive);
+            }
+
+            teardownSuiteFixtures();
+
+            Totals totals;
+            for (auto const& workerTotal : workerTotals)
+                totals += workerTotal;
+            auto const& reporterName = config->getReporterName();
+            bool stitched = (reporterName == "junit" || reporterName == "junit-stream")
+                && stitchJUnitDocuments(config->stream(), workerOutput);
+            if (!stitched)
+                for (auto const& output : workerOutput)
+                    config->stream() << output.str();
+
+            if (notRunForBudget > 0)
+                Catch::cerr() << "Wall-clock budget of " << config->maxDuration() << "s exhausted: "
+                              << pluralise(notRunForBudget, "test case") << " not run\n";
+
+            TestDurations observedDurations;
+            for (auto& durations : workerDurations)
+                observedDurations.insert(durations.begin(), durations.end());
+            persistTestDurations(*config, observedDurations);
+
+            FailedTests nowFailed, nowPassed;
+            for (auto& failed : workerFailed)
+                nowFailed.insert(failed.begin(), failed.end());
+            for (auto& passed : workerPassed)
+                nowPassed.insert(passed.begin(), passed.end());
+            persistFailedTests(*config, nowFailed, nowPassed);
+
+            FailedTests nowFlaky;
+            for (auto& flaky : workerFlaky)
+                nowFlaky.insert(flaky.begin(), flaky.end());
+            persistQuarantinedTests(*config, nowFlaky, nowPassed);
+
+            BenchmarkBaselines observedBenchmarks;
+            for (auto& benchmarks : workerBenchmarks)
+                observedBenchmarks.insert(benchmarks.begin(), benchmarks.end());
+            persistBenchmarkBaselines(*config, observedBenchmarks);
+
+            TestDependencies observedDependencies;
+            for (auto& dependencies : workerDependencies)
+                observedDependencies.insert(dependencies.begin(), dependencies.end());
+            persistTestDependencies(*config, observedDependencies);
+
+            if (config->warnAboutNoTests() && totals.testCases.total() == 0)
+                totals.error = -1;
+            return totals;
+        }
+
+#if defined(CATCH_INTERNAL_CONFIG_USE_FORK)
+        void writeAllToPipe(int fd, char const* data, std::size_t size) {
+            while (size > 0) {
+                auto written = ::write(fd, data, size);
+                if (written < 0 && errno == EINTR)
+                    continue;
+                if (written <= 0)
+                    break;
+                data += written;
+                size -= static_cast<std::size_t>(written);
+            }
+        }
+
+        std::string readAllFromPipe(int fd) {
+            std::string contents;
+            char buffer[4096];
+            for (;;) {
+                auto bytes = ::read(fd, buffer, sizeof(buffer));
+                if (bytes < 0 && errno == EINTR)
+                    continue;
+                if (bytes <= 0)
+                    break;
+                contents.append(buffer, static_cast<std::size_t>(bytes));
+            }
+            return contents;
+        }
+
+        // One slot of the shared results segment, mirroring the Counts
+        // layout of Totals. Children store their results here directly;
+        // the atomics make each field's write visible to the parent as-is,
+        // and the flag (written last) marks the slot as complete.
+        struct SharedTotalsSlot {
+            std::atomic<std::size_t> assertionsPassed{0}, assertionsFailed{0}, assertionsFailedButOk{0};
+            std::atomic<std::size_t> testCasesPassed{0}, testCasesFailed{0}, testCasesFailedButOk{0};
+            std::atomic<int> error{0};
+            std::atomic<bool> complete{false};
+
+            void store(Totals const& totals) {
+                assertionsPassed.store(totals.assertions.passed);
+                assertionsFailed.store(totals.assertions.failed);
+                assertionsFailedButOk.store(totals.assertions.failedButOk);
+                testCasesPassed.store(totals.testCases.passed);
+                testCasesFailed.store(totals.testCases.failed);
+                testCasesFailedButOk.store(totals.testCases.failedButOk);
+                error.store(totals.error);
+                complete.store(true, std::memory_order_release);
+            }
+            Totals load() const {
+                Totals totals;
+                totals.assertions.passed = assertionsPassed.load();
+                totals.assertions.failed = assertionsFailed.load();
+                totals.assertions.failedButOk = assertionsFailedButOk.load();
+                totals.testCases.passed = testCasesPassed.load();
+                totals.testCases.failed = testCasesFailed.load();
+                totals.testCases.failedButOk = testCasesFailedButOk.load();
+                totals.error = error.load();
+                return totals;
+            }
+        };
+
+        // Maps a zero-initialised shared segment with one slot per test.
+        // MAP_SHARED means forked children write the parent's very pages -
+        // results need no serialising or copying at all.
+        SharedTotalsSlot* mapSharedTotals(std::size_t slots) {
+            auto* segment = ::mmap(nullptr, slots * sizeof(SharedTotalsSlot),
+                                   PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+            CATCH_ENFORCE(segment != MAP_FAILED, "Could not map a shared results segment for --fork");
+            auto* slotArray = static_cast<SharedTotalsSlot*>(segment);
+            for (std::size_t i = 0; i < slots; ++i)
+                new (&slotArray[i]) SharedTotalsSlot();
+            return slotArray;
+        }
+
+        // The child's half of runTestsForked: runs one test case through a
+        // private reporter, stores the Totals into its shared-memory slot,
+        // streams the reporter's output back through the pipe and exits
+        // without running static destructors
+        void runForkedChild(std::shared_ptr<Config> const& config, TestCase const& testCase,
+                            SharedTotalsSlot* slot, int fd) {
+            std::ostringstream output;
+            Totals totals;
+            {
+                auto reporter = createReporter(config->getReporterName(), config, output);
+                RunContext context(config, std::move(reporter));
+                context.testGroupStarting(config->name(), 1, 1);
+                totals = context.runTest(testCase);
+                context.testGroupEnded(config->name(), totals, 1, 1);
+            }
+            slot->store(totals);
+            auto text = output.str();
+            writeAllToPipe(fd, text.data(), text.size());
+            ::close(fd);
+            ::_exit(totals.testCases.failed > 0 ? 1 : 0);
+        }
+
+        // Runs every selected test case in a forked child process. The
+        // registry, configuration and reporter factories are all set up
+        // before the first fork, so an isolated test pays for a fork and an
+        // exit rather than a full process start. Each child stores its
+        // Totals into a per-test slot of a shared-memory segment - only the
+        // reporter's output travels through the pipe - and the parent
+        // aggregates the slots, forwarding the output of children that
+        // failed or died; a child that crashes takes out only its own test,
+        // which is recorded as a failure.
+        Catch::Totals runTestsForked(std::shared_ptr<Config> const& config) {
+            auto reporter = makeReporter(config);
+            TestRunInfo runInfo(config->name());
+            reporter->testRunStarting(runInfo);
+            reporter->testGroupStarting(GroupInfo(config->name(), 1, 1));
+
+            TestSpec testSpec = config->testSpec();
+            auto const& allTestCases = getAllTestCasesSorted(*config);
+            auto const& filtered = getAllTestCasesFiltered(testSpec, *config);
+
+            auto* slots = mapSharedTotals((std::max)(filtered.size(), std::size_t(1)));
+            std::size_t slotIndex = 0;
+
+            Totals totals;
+            TestDurations observedDurations;
+            FailedTests nowFailed, nowPassed;
+            bool aborting = false;
+            auto filteredIt = filtered.begin();
+            for (auto const& testCase : allTestCases) {
+                bool isSelected = filteredIt != filtered.end() && testCase == *filteredIt;
+                if (isSelected)
+                    ++filteredIt;
+                if (!isSelected || aborting) {
+                    reporter->skipTest(testCase);
+                    continue;
+                }
+                auto* slot = &slots[slotIndex++];
+
+                int fds[2];
+                CATCH_ENFORCE(::pipe(fds) == 0, "Could not create a pipe for --fork");
+                auto pid = ::fork();
+                CATCH_ENFORCE(pid >= 0, "Could not fork a child process for --fork");
+                if (pid == 0) {
+                    ::close(fds[0]);
+                    runForkedChild(config, testCase, slot, fds[1]);
+                }
+                ::close(fds[1]);
+
+                Timer timer;
+                timer.start();
+                auto output = readAllFromPipe(fds[0]);
+                ::close(fds[0]);
+                int status = 0;
+                while (::waitpid(pid, &status, 0) < 0 && errno == EINTR)
+                    ;
+                observedDurations[testCase.name] = timer.getElapsedSeconds();
+
+                Totals childTotals;
+                bool childReported = slot->complete.load(std::memory_order_acquire) && WIFEXITED(status);
+                if (childReported) {
+                    childTotals = slot->load();
+                    totals += childTotals;
+                    if (childTotals.testCases.failed > 0)
+                        config->stream() << output;
+                } else {
+                    // The child died before it could report - charge the
+                    // test with one failed assertion and show whatever
+                    // output it managed to produce
+                    ++totals.assertions.failed;
+                    ++totals.testCases.failed;
+                    config->stream() << output;
+                    config->stream() << "Test case '" << testCase.name << "' terminated unexpectedly";
+                    if (WIFSIGNALED(status))
+                        config->stream() << " (signal " << WTERMSIG(status) << ')';
+                    config->stream() << '\n';
+                }
+                bool testFailed = !childReported || childTotals.testCases.failed > 0;
+                (testFailed ? nowFailed : nowPassed).insert(testCase.name);
+
+                if (config->abortAfter() > 0 &&
+                        totals.assertions.failed >= static_cast<std::size_t>(config->abortAfter()))
+                    aborting = true;
+            }
+            ::munmap(slots, (std::max)(filtered.size(), std::size_t(1)) * sizeof(SharedTotalsSlot));
+            persistTestDurations(*config, observedDurations);
+            persistFailedTests(*config, nowFailed, nowPassed);
+
+            if (config->warnAboutNoTests() && totals.testCases.total() == 0)
+                totals.error = -1;
+            reporter->testGroupEnded(TestGroupStats(GroupInfo(config->name(), 1, 1), totals, aborting));
+            reporter->testRunEnded(TestRunStats(runInfo, totals, aborting));
+            return totals;
+        }
+        // Runs the given predecessor subset and then the victim in a forked
+        // child, quietly, and reports whether the victim failed. Forking
+        // matters here: the shared-state leakage being hunted would
+        // otherwise leak across probes and corrupt the search itself. A
+        // probe that crashes counts as interfering - the leaked state took
+        // the whole process down.
+        bool bisectProbeFails(std::shared_ptr<Config> const& config,
+                              std::vector<TestCase const*> const& predecessors,
+                              TestCase const& victim) {
+            auto pid = ::fork();
+            CATCH_ENFORCE(pid >= 0, "Could not fork a child process for --bisect");
+            if (pid == 0) {
+                std::ostringstream output;
+                Totals victimTotals;
+                {
+                    auto reporter = createReporter(config->getReporterName(), config, output);
+                    RunContext context(config, std::move(reporter));
+                    context.testGroupStarting(config->name(), 1, 1);
+                    for (auto predecessor : predecessors)
+                        static_cast<void>(context.runTest(*predecessor));
+                    victimTotals = context.runTest(victim);
+                    context.testGroupEnded(config->name(), victimTotals, 1, 1);
+                }
+                ::_exit(victimTotals.testCases.failed > 0 ? 1 : 0);
+            }
+            int status = 0;
+            while (::waitpid(pid, &status, 0) < 0 && errno == EINTR)
+                ;
+            return !WIFEXITED(status) || WEXITSTATUS(status) != 0;
+        }
+
+        // Implements --bisect: binary-searches the tests that run before the
+        // victim for the predecessor whose shared-state leakage makes it
+        // fail. Each halving step probes the first half of the remaining
+        // candidates, so the culprit is found in O(log n) forked runs
+        // instead of a manual O(n) hunt - assuming, as bisection always
+        // does, that a single test is responsible.
+        int runBisect(std::shared_ptr<Config> const& config) {
+            CATCH_ENFORCE_PARTS(config->jobs() == 1 && !config->forkIsolation(),
+                                "--bisect requires a serial, single-process run");
+
+            TestSpec testSpec = config->testSpec();
+            auto const& allTestCases = getAllTestCasesSorted(*config);
+            auto const& filtered = getAllTestCasesFiltered(testSpec, *config);
+
+            std::string const& victimName = config->bisectTest();
+            TestCase const* victim = nullptr;
+            std::vector<TestCase const*> predecessors;
+            auto filteredIt = filtered.begin();
+            for (auto const& testCase : allTestCases) {
+                if (filteredIt == filtered.end())
+                    break;
+                if (!(testCase == *filteredIt))
+                    continue;
+                ++filteredIt;
+                if (testCase.name == victimName) {
+                    victim = &testCase;
+                    break;
+                }
+                predecessors.push_back(&testCase);
+            }
+            CATCH_ENFORCE_PARTS(victim, "--bisect: no selected test case is named '", victimName, "'");
+
+            auto& out = Catch::cout();
+            std::size_t probes = 1;
+            if (bisectProbeFails(config, {}, *victim)) {
+                out << "--bisect: '" << victimName << "' fails on its own - there is no interference to bisect" << std::endl;
+                return 1;
+            }
+            ++probes;
+            if (!bisectProbeFails(config, predecessors, *victim)) {
+                out << "--bisect: '" << victimName << "' still passes after all "
+                    << pluralise(predecessors.size(), "predecessor") << " - nothing to bisect" << std::endl;
+                return 1;
+            }
+
+            // Invariant: the victim fails after predecessors[first, last)
+            std::size_t first = 0, last = predecessors.size();
+            while (last - first > 1) {
+                auto mid = first + (last - first) / 2;
+                out << "--bisect: " << (last - first) << " candidates, probing the first "
+                    << (mid - first) << std::endl;
+                std::vector<TestCase const*> firstHalf(predecessors.begin() + static_cast<std::ptrdiff_t>(first),
+                                                       predecessors.begin() + static_cast<std::ptrdiff_t>(mid));
+                ++probes;
+                if (bisectProbeFails(config, firstHalf, *victim))
+                    last = mid;
+                else
+                    first = mid;
+            }
+
+            auto culprit = predecessors[first];
+            ++probes;
+            if (!bisectProbeFails(config, { culprit }, *victim)) {
+                out << "--bisect: no single predecessor makes '" << victimName
+                    << "' fail - the interference needs several tests combined" << std::endl;
+                return 1;
+            }
+            out << "--bisect: minimal interfering set found after " << pluralise(probes, "probe run") << ":\n"
+                << "  \"" << culprit->name << "\" \"" << victimName << "\"" << std::endl;
+            return 0;
         }
+#endif // CATCH_INTERNAL_CONFIG_USE_FORK
 
+#if defined(CATCH_INTERNAL_CONFIG_USE_DAEMON)
+
+// Sending into a socket whose peer has gone away must surface as a write
+// error, not a SIGPIPE that takes the daemon down. Platforms without
+// MSG_NOSIGNAL (macOS) deliver no signal for send() on a SO_NOSIGPIPE
+// socket instead.
+#if !defined(MSG_NOSIGNAL)
+#define MSG_NOSIGNAL 0
+#endif
+
+        // Streams reporter output to the connected client as it is
+        // produced, so a watch tool sees results while the run is still
+        // going rather than one blob at the end
+        class SocketStreamBuf : public std::streambuf {
+            int m_fd;
+        public:
+            SocketStreamBuf(int fd) : m_fd(fd) {}
+        private:
+            std::streamsize xsputn(char const* data, std::streamsize size) override {
+                std::streamsize written = 0;
+                while (written < size) {
+                    auto sent = ::send(m_fd, data + written, static_cast<std::size_t>(size - written), MSG_NOSIGNAL);
+                    if (sent < 0 && errno == EINTR)
+                        continue;
+                    if (sent <= 0)
+                        break;
+                    written += sent;
+                }
+                return written;
+            }
+            int_type overflow(int_type ch) override {
+                if (ch == traits_type::eof())
+                    return traits_type::not_eof(ch);
+                auto c = static_cast<char>(ch);
+                return xsputn(&c, 1) == 1 ? ch : traits_type::eof();
+            }
+        };
+
+        std::string readRequestLine(int fd) {
+            std::string line;
+            char buffer[256];
+            for (;;) {
+                auto count = ::recv(fd, buffer, sizeof(buffer), 0);
+                if (count < 0 && errno == EINTR)
+                    continue;
+                if (count <= 0)
+                    break;
+                line.append(buffer, static_cast<std::size_t>(count));
+                auto newline = line.find('\n');
+                if (newline != std::string::npos) {
+                    line.erase(newline);
+                    break;
+                }
+            }
+            return line;
+        }
+
+        // Stays resident and serves test runs over a local stream socket,
+        // amortising process startup (static initialisation, registry
+        // sorting, configuration parsing) across any number of runs. One
+        // request per connection: a single line holding a test spec, as it
+        // would appear on the command line, answered with the reporter's
+        // output for the matching tests. The line "--shutdown" stops the
+        // daemon.
+        int runDaemon(ConfigData const& configData) {
+            std::string const& path = configData.daemonSocket;
+            sockaddr_un address{};
+            CATCH_ENFORCE_PARTS(path.size() < sizeof(address.sun_path), "The --daemon socket path is too long: '", path, "'");
+
+            int listenFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            CATCH_ENFORCE(listenFd >= 0, "Could not create a socket for --daemon");
+            ::unlink(path.c_str());
+            address.sun_family = AF_UNIX;
+            std::copy(path.begin(), path.end(), address.sun_path);
+            CATCH_ENFORCE(::bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0,
+                          "Could not bind the --daemon socket '" << path << "'");
+            CATCH_ENFORCE(::listen(listenFd, 4) == 0, "Could not listen on the --daemon socket '" << path << "'");
+            Catch::cout() << "Serving test runs on '" << path << "'" << std::endl;
+
+            for (;;) {
+                int clientFd = ::accept(listenFd, nullptr, nullptr);
+                if (clientFd < 0 && errno == EINTR)
+                    continue;
+                if (clientFd < 0)
+                    break;
+#if defined(SO_NOSIGPIPE)
+                int noSigPipe = 1;
+                ::setsockopt(clientFd, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+                auto request = trim(readRequestLine(clientFd));
+                if (request == "--shutdown") {
+                    ::close(clientFd);
+                    break;
+                }
+
+                SocketStreamBuf streamBuf(clientFd);
+                std::ostream stream(&streamBuf);
+                CATCH_TRY {
+                    ConfigData requestData = configData;
+                    requestData.daemonSocket.clear();
+                    requestData.testsOrTags.clear();
+                    if (!request.empty())
+                        requestData.testsOrTags.push_back(request);
+                    auto config = std::make_shared<Config>(requestData);
+
+                    auto reporter = createReporter(config->getReporterName(), config, stream);
+                    RunContext context(config, std::move(reporter));
+                    context.testGroupStarting(config->name(), 1, 1);
+
+                    Totals totals;
+                    TestSpec testSpec = config->testSpec();
+                    auto const& allTestCases = getAllTestCasesSorted(*config);
+                    auto const& filtered = getAllTestCasesFiltered(testSpec, *config);
+                    auto filteredIt = filtered.begin();
+                    primeSuiteFixtures(filtered);
+                    for (auto const& testCase : allTestCases) {
+                        bool isSelected = filteredIt != filtered.end() && testCase == *filteredIt;
+                        if (isSelected)
+                            ++filteredIt;
+                        if (!context.aborting() && isSelected)
+                            totals += context.runTest(testCase);
+                        else
+                            context.reporter().skipTest(testCase);
+                    }
+                    teardownSuiteFixtures();
+                    context.testGroupEnded(config->name(), totals, 1, 1);
+                }
+                CATCH_CATCH_ALL {
+                    // e.g. an unparsable test spec - answer with the error
+                    // rather than taking the daemon down
+                    stream << translateActiveException() << '\n';
+                }
+                ::close(clientFd);
+            }
+            ::close(listenFd);
+            ::unlink(path.c_str());
+            return 0;
+        }
+#endif // CATCH_INTERNAL_CONFIG_USE_DAEMON
+
+        // Frames a coordinator-style run (--distribute-worker or
+        // --orchestrate), which drives the reporter directly instead of
+        // through a RunContext
+        Catch::Totals runCoordinated(std::shared_ptr<Config> const& config,
+                                     Totals (*run)(std::shared_ptr<Config> const&, IStreamingReporter&)) {
+            auto reporter = makeReporter(config);
+            TestRunInfo runInfo(config->name());
+            reporter->testRunStarting(runInfo);
+            reporter->testGroupStarting(GroupInfo(config->name(), 1, 1));
+            auto totals = run(config, *reporter);
+            if (config->warnAboutNoTests() && totals.testCases.total() == 0)
+                totals.error = -1;
+            reporter->testGroupEnded(TestGroupStats(GroupInfo(config->name(), 1, 1), totals, false));
+            reporter->testRunEnded(TestRunStats(runInfo, totals, false));
+            return totals;
+        }
 
         Catch::Totals runTests(std::shared_ptr<Config> const& config) {
+            CATCH_ENFORCE_PARTS(config->journalFile().empty() || (config->jobs() == 1 && !config->forkIsolation()),
+                                "--journal requires a serial, single-process run");
+            CATCH_ENFORCE_PARTS(!config->resumeFromJournal() || !config->journalFile().empty(),
+                                "--resume requires --journal");
+            if (!config->getDistributeWorkers().empty()) {
+                CATCH_ENFORCE_PARTS(config->jobs() == 1 && !config->forkIsolation(),
+                                    "--distribute-worker cannot be combined with --jobs or --fork");
+                CATCH_ENFORCE_PARTS(config->getOrchestrateBinaries().empty(),
+                                    "--distribute-worker cannot be combined with --orchestrate");
+                return runCoordinated(config, &runTestsDistributed);
+            }
+            if (!config->getOrchestrateBinaries().empty()) {
+                CATCH_ENFORCE_PARTS(!config->forkIsolation(),
+                                    "--orchestrate cannot be combined with --fork");
+                return runCoordinated(config, &runTestsOrchestrated);
+            }
+#if defined(CATCH_INTERNAL_CONFIG_USE_FORK)
+            if (config->forkIsolation()) {
+                CATCH_ENFORCE_PARTS(config->jobs() == 1, "--fork cannot be combined with --jobs");
+                return runTestsForked(config);
+            }
+#else
+            CATCH_ENFORCE_PARTS(!config->forkIsolation(), "--fork is only supported on POSIX platforms");
+#endif
+            if (config->jobs() > 1)
+                return runTestsInParallel(config, config->jobs());
+
             // FixMe: Add listeners in order first, then add reporters.
 
             auto reporter = makeReporter(config);
@@ -67,12 +889,99 @@ namespace Catch {
             TestSpec testSpec = config->testSpec();
 
             auto const& allTestCases = getAllTestCasesSorted(*config);
+            auto const& filtered = getAllTestCasesFiltered(testSpec, *config);
+            auto filteredIt = filtered.begin();
+            TestDurations observedDurations;
+            FailedTests nowFailed, nowPassed, nowFlaky;
+
+            // With --journal every test's start and completion is written
+            // ahead to disk; a --resume run skips what a crashed run
+            // already finished and quarantines the test it died in
+            RunJournalState journal;
+            std::unique_ptr<RunJournal> journalWriter;
+            if (!config->journalFile().empty()) {
+                if (config->resumeFromJournal())
+                    journal = loadRunJournal(config->journalFile());
+                journalWriter.reset(new RunJournal(config->journalFile(), config->resumeFromJournal()));
+            }
+
+            // With --max-duration, tests that would start after the budget
+            // is spent are skipped - partial results beat a killed run
+            Timer budgetTimer;
+            budgetTimer.start();
+            std::size_t notRunForBudget = 0;
+
+            // With --fail-fast-tier the run stops at the first priority
+            // tier boundary crossed with failures on the board: the broken
+            // tier runs to completion, later tiers never start
+            bool haveTier = false;
+            bool tierAborted = false;
+            int currentTier = 0;
+            std::size_t notRunForTier = 0;
+
+            primeSuiteFixtures(filtered);
+
             for (auto const& testCase : allTestCases) {
-                if (!context.aborting() && matchTest(testCase, testSpec, *config))
-                    totals += context.runTest(testCase);
-                else
+                bool isSelected = filteredIt != filtered.end() && testCase == *filteredIt;
+                if (isSelected)
+                    ++filteredIt;
+                if (!context.aborting() && isSelected) {
+                    if (config->failFastTier()) {
+                        if (haveTier && testCase.priorityTier != currentTier && totals.testCases.failed > 0)
+                            tierAborted = true;
+                        haveTier = true;
+                        currentTier = testCase.priorityTier;
+                        if (tierAborted) {
+                            ++notRunForTier;
+                            context.reporter().skipTest(testCase);
+                            continue;
+                        }
+                    }
+                    if (config->maxDuration() > 0 && budgetTimer.getElapsedSeconds() >= config->maxDuration()) {
+                        ++notRunForBudget;
+                        context.reporter().skipTest(testCase);
+                        continue;
+                    }
+                    if (journal.completed.count(testCase.name)) {
+                        context.reporter().skipTest(testCase);
+                        continue;
+                    }
+                    if (journal.crashed.count(testCase.name)) {
+                        Catch::cerr() << "Quarantined (did not finish in the journalled run): "
+                                      << testCase.name << '\n';
+                        context.reporter().skipTest(testCase);
+                        continue;
+                    }
+                    if (journalWriter)
+                        journalWriter->testStarted(testCase.name);
+                    Timer timer;
+                    timer.start();
+                    auto testTotals = context.runTest(testCase);
+                    if (journalWriter)
+                        journalWriter->testEnded(testCase.name);
+                    totals += testTotals;
+                    observedDurations[testCase.name] = timer.getElapsedSeconds();
+                    (testTotals.testCases.failed > 0 ? nowFailed : nowPassed).insert(testCase.name);
+                    if (testTotals.testCases.passedOnRetry > 0)
+                        nowFlaky.insert(testCase.name);
+                } else {
                     context.reporter().skipTest(testCase);
+                }
             }
+            teardownSuiteFixtures();
+
+            if (notRunForBudget > 0)
+                Catch::cerr() << "Wall-clock budget of " << config->maxDuration() << "s exhausted: "
+                              << pluralise(notRunForBudget, "test case") << " not run\n";
+            if (notRunForTier > 0)
+                Catch::cerr() << "Priority tier completed with failures: "
+                              << pluralise(notRunForTier, "test case") << " in later tiers not run\n";
+
+            persistTestDurations(*config, observedDurations);
+            persistFailedTests(*config, nowFailed, nowPassed);
+            persistQuarantinedTests(*config, nowFlaky, nowPassed);
+            persistBenchmarkBaselines(*config, context.benchmarkResults());
+            persistTestDependencies(*config, context.testDependencies());
 
             if (config->warnAboutNoTests() && totals.testCases.total() == 0) {
                 ReusableStringStream testConfig;
@@ -92,24 +1001,37 @@ namespace Catch {
             return totals;
         }
 
+        // Runs the whole suite once per seed without leaving the process,
+        // so registration, plugin loading and static initialisation are
+        // paid once instead of once per seed. Each pass gets its own
+        // Config (the registry's sort cache keys on the seed, so random
+        // orderings genuinely differ) and reports as its own run, with
+        // the seed in the run name.
+        Catch::Totals runSeedMatrix(ConfigData configData) {
+            auto seeds = configData.seedMatrix;
+            auto baseSeed = configData.rngSeed != 0
+                ? configData.rngSeed
+                : static_cast<unsigned int>(std::time(nullptr));
+            auto baseName = configData.name;
+            configData.seedMatrix = 0;
+            Totals totals;
+            for (unsigned int i = 0; i < seeds; ++i) {
+                configData.rngSeed = baseSeed + i;
+                ReusableStringStream name;
+                name << baseName << " [seed=" << configData.rngSeed << "]";
+                configData.name = name.str();
+                auto config = std::make_shared<Config>(configData);
+                seedRng(*config);
+                totals += runTests(config);
+            }
+            return totals;
+        }
+
         void applyFilenamesAsTags(Catch::IConfig const& config) {
             auto& tests = const_cast<std::vector<TestCase>&>(getAllTestCasesSorted(config));
             for (auto& testCase : tests) {
-                auto tags = testCase.tags;
-
-                std::string filename = testCase.lineInfo.file;
-                auto lastSlash = filename.find_last_of("\\/");
-                if (lastSlash != std::string::npos) {
-                    filename.erase(0, lastSlash);
-                    filename[0] = '#';
-                }
-
-                auto lastDot = filename.find_last_of('.');
-                if (lastDot != std::string::npos) {
-                    filename.erase(lastDot);
-                }
-
-                tags.push_back(std::move(filename));
+                std::vector<std::string> tags( testCase.tags.begin(), testCase.tags.end() );
+                tags.push_back(filenameTagFromPath(testCase.lineInfo.file));
                 setTags(testCase, tags);
             }
         }
@@ -142,7 +1064,9 @@ namespace Catch {
 #endif
 
         alreadyInstantiated = true;
+#if !defined(CATCH_CONFIG_MINIMAL_CLI)
         m_cli = makeCommandLineParser( m_configData );
+#endif
     }
     Session::~Session() {
         Catch::cleanUp();
@@ -150,9 +1074,14 @@ namespace Catch {
 
     void Session::showHelp() const {
         Catch::cout()
-                << "\nCatch v" << libraryVersion() << "\n"
-                << m_cli << std::endl
-                << "For more detailed usage please see the project docs\n" << std::endl;
+                << "\nCatch v" << libraryVersion() << "\n";
+#if !defined(CATCH_CONFIG_MINIMAL_CLI)
+        Catch::cout() << m_cli << std::endl;
+#else
+        writeMinimalCliUsage( Catch::cout() );
+        Catch::cout() << std::endl;
+#endif
+        Catch::cout() << "For more detailed usage please see the project docs\n" << std::endl;
     }
     void Session::libIdentify() {
         Catch::cout()
@@ -162,20 +1091,65 @@ namespace Catch {
                 << std::left << std::setw(16) << "version: " << libraryVersion() << std::endl;
     }
 
-    int Session::applyCommandLine( int argc, char const * const * argv ) {
-        if( m_startupExceptions )
-            return 1;
-
-        auto result = m_cli.parse( clara::Args( argc, argv ) );
-        if( !result ) {
+    namespace {
+        int reportInputError( std::string const& message ) {
             Catch::cerr()
                 << Colour( Colour::Red )
                 << "\nError(s) in input:\n"
-                << Column( result.errorMessage() ).indent( 2 )
+                << Column( message ).indent( 2 )
                 << "\n\n";
             Catch::cerr() << "Run with -? for usage\n" << std::endl;
             return MaxExitCode;
         }
+    } // anonymous namespace
+
+    int Session::applyCommandLine( int argc, char const * const * argv ) {
+        if( m_startupExceptions )
+            return 1;
+
+        // A snapshot written by --save-config repopulates ConfigData
+        // directly, so orchestrated harnesses re-issuing an identical
+        // invocation skip the Clara parse entirely
+        if( argc >= 2 && std::strcmp( argv[1], "--load-config" ) == 0 ) {
+            if( argc != 3 )
+                return reportInputError( "--load-config expects a snapshot filename and no other options" );
+#if !defined(CATCH_CONFIG_DISABLE_EXCEPTIONS)
+            try {
+                loadConfigSnapshot( argv[2], m_configData );
+            }
+            catch( std::exception& ex ) {
+                return reportInputError( ex.what() );
+            }
+#else
+            // A corrupt snapshot terminates via throw_exception instead
+            loadConfigSnapshot( argv[2], m_configData );
+#endif
+            m_configData.processName = argv[0];
+        }
+        else {
+#if !defined(CATCH_CONFIG_MINIMAL_CLI)
+            auto result = m_cli.parse( clara::Args( argc, argv ) );
+            if( !result )
+                return reportInputError( result.errorMessage() );
+#else
+            auto error = parseMinimalCommandLine( m_configData, argc, argv );
+            if( !error.empty() )
+                return reportInputError( error );
+#endif
+
+            if( !m_configData.saveConfigFile.empty() ) {
+#if !defined(CATCH_CONFIG_DISABLE_EXCEPTIONS)
+                try {
+                    saveConfigSnapshot( m_configData.saveConfigFile, m_configData );
+                }
+                catch( std::exception& ex ) {
+                    return reportInputError( ex.what() );
+                }
+#else
+                saveConfigSnapshot( m_configData.saveConfigFile, m_configData );
+#endif
+            }
+        }
 
         if( m_configData.showHelp )
             showHelp();
@@ -235,12 +1209,14 @@ namespace Catch {
         return exitCode;
     }
 
+#if !defined(CATCH_CONFIG_MINIMAL_CLI)
     clara::Parser const& Session::cli() const {
         return m_cli;
     }
     void Session::cli( clara::Parser const& newParser ) {
         m_cli = newParser;
     }
+#endif
     ConfigData& Session::configData() {
         return m_configData;
     }
@@ -261,8 +1237,18 @@ namespace Catch {
         CATCH_TRY {
             config(); // Force config to be constructed
 
+            for( auto const& plugin : m_config->getTestPlugins() )
+                loadTestPlugin( plugin );
+
             seedRng( *m_config );
 
+            // Must precede any output for the buffering change to be portable
+            configureOutputBuffering( m_config->flushPolicy() );
+
+            AssertionProfile::setEnabled( m_config->profileAssertions() );
+            SelfProfile::setEnabled( m_config->selfProfile() );
+            ProgressHeartbeat::configure( m_config->progressFd() );
+
             if( m_configData.filenamesAsTags )
                 applyFilenamesAsTags( *m_config );
 
@@ -270,7 +1256,45 @@ namespace Catch {
             if( Option<std::size_t> listed = list( config() ) )
                 return static_cast<int>( *listed );
 
-            auto totals = runTests( m_config );
+#if defined(CATCH_INTERNAL_CONFIG_USE_DAEMON)
+            if( !m_configData.daemonSocket.empty() )
+                return runDaemon( m_configData );
+#else
+            CATCH_ENFORCE_PARTS( m_configData.daemonSocket.empty(), "--daemon is only supported on POSIX platforms" );
+#endif
+
+#if defined(CATCH_INTERNAL_CONFIG_USE_FORK)
+            if( !m_configData.bisectTest.empty() )
+                return runBisect( m_config );
+#else
+            CATCH_ENFORCE_PARTS( m_configData.bisectTest.empty(), "--bisect is only supported on POSIX platforms" );
+#endif
+
+            auto totals = m_configData.seedMatrix > 0
+                ? runSeedMatrix( m_configData )
+                : runTests( m_config );
+
+            ProgressHeartbeat::runEnded();
+
+            if( m_config->profileAssertions() )
+                AssertionProfile::report( m_config->stream() );
+            if( m_config->selfProfile() )
+                SelfProfile::report( m_config->stream() );
+
+            // Assertions that reached no capture (threads spawned by a test
+            // while several RunContexts were alive) were counted instead of
+            // aborting the process; surface them now and fail the run if
+            // any of them failed
+            auto orphans = orphanAssertionStats();
+            if( orphans.total > 0 ) {
+                Catch::cerr() << "warning: " << pluralise( orphans.total, "assertion" )
+                    << " (" << orphans.failed << " failed) made from spawned threads could not be"
+                    << " attributed to a test case; first at " << orphans.firstFile << ':' << orphans.firstLine << ".\n"
+                    << "Tag test cases that assert from threads they spawn [!exclusive] so they run serially under --jobs.\n";
+                if( orphans.failed > 0 )
+                    totals.error = (std::max)( totals.error, 1 );
+            }
+
             // Note that on unices only the lower 8 bits are usually used, clamping
             // the return value to 255 prevents false negative when some multiple
             // of 256 tests has failed
@@ -35,14 +35,18 @@ namespace Catch {
     #endif
         int run();
 
+#if !defined(CATCH_CONFIG_MINIMAL_CLI)
         clara::Parser const& cli() const;
         void cli( clara::Parser const& newParser );
+#endif
         ConfigData& configData();
         Config& config();
     private:
         int runInternal();
 
+#if !defined(CATCH_CONFIG_MINIMAL_CLI)
         clara::Parser m_cli;
+#endif
         ConfigData m_configData;
         std::shared_ptr<Config> m_config;
         bool m_startupExceptions = false;
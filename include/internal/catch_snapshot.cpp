@@ -0,0 +1,214 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_snapshot.h"
+#include "catch_context.h"
+#include "catch_enforce.h"
+#include "catch_interfaces_config.h"
+#include "catch_platform.h"
+#include "catch_stream.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <vector>
+
+#if defined(CATCH_PLATFORM_LINUX) || defined(CATCH_PLATFORM_MAC)
+#define CATCH_INTERNAL_CONFIG_USE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Catch {
+namespace Snapshots {
+
+    namespace {
+
+        std::uint64_t hashBytes( char const* data, std::size_t size ) {
+            // FNV-1a
+            std::uint64_t hash = 0xcbf29ce484222325ULL;
+            for( std::size_t i = 0; i < size; ++i ) {
+                hash ^= static_cast<unsigned char>( data[i] );
+                hash *= 0x100000001b3ULL;
+            }
+            return hash;
+        }
+
+        // The store is a single file: an 8 byte magic, then records of
+        // [name hash][content hash][size][data bytes] back to back, in
+        // native byte order. Later records for the same name win, so
+        // updating a snapshot is a plain append.
+        char const* const snapshotMagic = "CATCHSNP";
+
+        struct RecordHeader {
+            std::uint64_t nameHash;
+            std::uint64_t contentHash;
+            std::uint64_t size;
+        };
+
+        class SnapshotStore {
+        public:
+            struct Entry {
+                std::uint64_t contentHash;
+                std::size_t size;
+                std::size_t offset; // of the data bytes within the store
+            };
+
+            explicit SnapshotStore( std::string const& path ) : m_path( path ) {
+                reload();
+            }
+            ~SnapshotStore() {
+                unmap();
+            }
+
+            auto find( std::uint64_t nameHash ) const -> Entry const* {
+                auto it = m_index.find( nameHash );
+                return it == m_index.end() ? nullptr : &it->second;
+            }
+            // Valid until the next append; comparisons read the mapped
+            // file directly, with no copy into the heap
+            auto dataAt( std::size_t offset ) const -> char const* {
+                return m_data + offset;
+            }
+            auto path() const -> std::string const& { return m_path; }
+
+            void append( std::uint64_t nameHash, std::string const& data ) {
+                std::ofstream file( m_path, std::ios::binary | std::ios::app );
+                CATCH_ENFORCE( file, "Unable to open snapshot store '" << m_path << "' for writing" );
+                if( m_size == 0 )
+                    file.write( snapshotMagic, 8 );
+                RecordHeader header = { nameHash, hashBytes( data.data(), data.size() ), data.size() };
+                file.write( reinterpret_cast<char const*>( &header ), sizeof( header ) );
+                file.write( data.data(), static_cast<std::streamsize>( data.size() ) );
+                CATCH_ENFORCE( file, "Unable to write to snapshot store '" << m_path << "'" );
+                file.close();
+                reload();
+            }
+
+        private:
+            void unmap() {
+#if defined(CATCH_INTERNAL_CONFIG_USE_MMAP)
+                if( m_mapping )
+                    ::munmap( m_mapping, m_size );
+                m_mapping = nullptr;
+#else
+                m_buffer.clear();
+#endif
+                m_data = nullptr;
+                m_size = 0;
+            }
+
+            void reload() {
+                unmap();
+                m_index.clear();
+#if defined(CATCH_INTERNAL_CONFIG_USE_MMAP)
+                int fd = ::open( m_path.c_str(), O_RDONLY );
+                if( fd == -1 )
+                    return; // no store yet - snapshots will be recorded
+                struct stat fileInfo;
+                CATCH_ENFORCE( ::fstat( fd, &fileInfo ) == 0, "Unable to stat snapshot store '" << m_path << "'" );
+                if( fileInfo.st_size == 0 ) {
+                    ::close( fd );
+                    return;
+                }
+                auto size = static_cast<std::size_t>( fileInfo.st_size );
+                auto* mapping = ::mmap( nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+                ::close( fd );
+                CATCH_ENFORCE( mapping != MAP_FAILED, "Unable to map snapshot store '" << m_path << "'" );
+                m_mapping = mapping;
+                m_data = static_cast<char const*>( mapping );
+                m_size = size;
+#else
+                std::ifstream file( m_path, std::ios::binary );
+                if( !file )
+                    return; // no store yet - snapshots will be recorded
+                m_buffer.assign( std::istreambuf_iterator<char>( file ), std::istreambuf_iterator<char>() );
+                if( m_buffer.empty() )
+                    return;
+                m_data = m_buffer.data();
+                m_size = m_buffer.size();
+#endif
+                parse();
+            }
+
+            void parse() {
+                CATCH_ENFORCE( m_size >= 8 && std::memcmp( m_data, snapshotMagic, 8 ) == 0,
+                               "'" << m_path << "' is not a Catch snapshot store" );
+                std::size_t pos = 8;
+                while( pos + sizeof( RecordHeader ) <= m_size ) {
+                    RecordHeader header;
+                    std::memcpy( &header, m_data + pos, sizeof( header ) );
+                    pos += sizeof( header );
+                    CATCH_ENFORCE( pos + header.size <= m_size, "Snapshot store '" << m_path << "' is truncated" );
+                    m_index[header.nameHash] = Entry{ header.contentHash, static_cast<std::size_t>( header.size ), pos };
+                    pos += static_cast<std::size_t>( header.size );
+                }
+            }
+
+            std::string m_path;
+            std::map<std::uint64_t, Entry> m_index;
+            char const* m_data = nullptr;
+            std::size_t m_size = 0;
+#if defined(CATCH_INTERNAL_CONFIG_USE_MMAP)
+            void* m_mapping = nullptr;
+#else
+            std::vector<char> m_buffer;
+#endif
+        };
+
+        SnapshotStore& store() {
+            static SnapshotStore s_store( getCurrentContext().getConfig()->snapshotFile() );
+            return s_store;
+        }
+
+    } // end anonymous namespace
+
+    void checkSnapshot( std::string const& name, std::string const& data, AssertionHandler& handler ) {
+        auto& snapshots = store();
+        auto nameHash = hashBytes( name.data(), name.size() );
+        auto* entry = snapshots.find( nameHash );
+
+        ReusableStringStream rss;
+        if( !entry ) {
+            snapshots.append( nameHash, data );
+            rss << "Recorded new snapshot '" << name << "' (" << data.size() << " bytes) in '" << snapshots.path() << "'";
+            handler.handleMessage( ResultWas::Ok, rss.str() );
+            return;
+        }
+
+        // The content hash rejects nearly all mismatches before touching
+        // the data; the memcmp against the mapped region guards against
+        // hash collisions without copying either side
+        bool matches = entry->size == data.size()
+                    && entry->contentHash == hashBytes( data.data(), data.size() )
+                    && std::memcmp( snapshots.dataAt( entry->offset ), data.data(), data.size() ) == 0;
+
+        if( matches ) {
+            rss << "Snapshot '" << name << "' matches (" << data.size() << " bytes)";
+            handler.handleMessage( ResultWas::Ok, rss.str() );
+        }
+        else if( getCurrentContext().getConfig()->updateSnapshots() ) {
+            snapshots.append( nameHash, data );
+            rss << "Updated snapshot '" << name << "' (" << data.size() << " bytes)";
+            handler.handleMessage( ResultWas::Ok, rss.str() );
+        }
+        else {
+            auto* storedData = snapshots.dataAt( entry->offset );
+            auto commonSize = entry->size < data.size() ? entry->size : data.size();
+            std::size_t firstDifference = 0;
+            while( firstDifference < commonSize && storedData[firstDifference] == data[firstDifference] )
+                ++firstDifference;
+            rss << "Data does not match snapshot '" << name << "': stored " << entry->size
+                << " bytes, got " << data.size() << " bytes, first difference at byte " << firstDifference
+                << "\n(rerun with --update-snapshots to accept the new output)";
+            handler.handleMessage( ResultWas::ExplicitFailure, rss.str() );
+        }
+    }
+
+} // namespace Snapshots
+} // namespace Catch
@@ -0,0 +1,38 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_SNAPSHOT_H_INCLUDED
+#define TWOBLUECUBES_CATCH_SNAPSHOT_H_INCLUDED
+
+#include "catch_capture.hpp"
+
+#include <string>
+
+namespace Catch {
+namespace Snapshots {
+
+    // Compares data against the snapshot stored under name, reporting
+    // through the given handler. A missing snapshot is recorded and
+    // passes; a stored one that no longer matches fails, unless the run
+    // was started with --update-snapshots, in which case it is rewritten.
+    void checkSnapshot( std::string const& name, std::string const& data, AssertionHandler& handler );
+
+} // namespace Snapshots
+} // namespace Catch
+
+///////////////////////////////////////////////////////////////////////////////
+#define INTERNAL_CATCH_SNAPSHOT( macroName, resultDisposition, name, ... ) \
+    do { \
+        INTERNAL_CATCH_ASSERTION_INFO( macroName, Catch::StringRef(), resultDisposition ) \
+        Catch::AssertionHandler catchAssertionHandler( catch_internal_assertionInfo ); \
+        INTERNAL_CATCH_TRY { \
+            Catch::Snapshots::checkSnapshot( name, __VA_ARGS__, catchAssertionHandler ); \
+        } INTERNAL_CATCH_CATCH( catchAssertionHandler ) \
+        INTERNAL_CATCH_REACT( catchAssertionHandler ) \
+    } while( false )
+
+#define REQUIRE_MATCHES_SNAPSHOT( name, ... ) INTERNAL_CATCH_SNAPSHOT( "REQUIRE_MATCHES_SNAPSHOT", Catch::ResultDisposition::Normal, name, __VA_ARGS__ )
+#define CHECK_MATCHES_SNAPSHOT( name, ... ) INTERNAL_CATCH_SNAPSHOT( "CHECK_MATCHES_SNAPSHOT", Catch::ResultDisposition::ContinueOnFailure, name, __VA_ARGS__ )
+
+#endif // TWOBLUECUBES_CATCH_SNAPSHOT_H_INCLUDED
@@ -0,0 +1,55 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_stack_usage.h"
+
+#include <cstdint>
+
+namespace Catch {
+
+    namespace {
+        constexpr unsigned char stackPaintPattern = 0xA5;
+        // Headroom between the window and the live stack pointer, so the
+        // painting/scanning frames themselves sit above the window. Usage
+        // inside this gap is not observable, so it is kept just large
+        // enough for one leaf call frame (the paint loop may be lowered
+        // to a memset call)
+        constexpr std::size_t stackPaintSlackBytes = 256;
+
+        // Lowest and highest painted addresses for this thread, kept as
+        // integers: the window is deliberately outside any object's
+        // lifetime, which pointer diagnostics would (correctly) flag
+        thread_local std::uintptr_t s_paintBase = 0;
+        thread_local std::uintptr_t s_paintTop = 0;
+    }
+
+    void paintStack() {
+        // The address of a local approximates the stack pointer; stacks
+        // grow downward on every platform Catch supports, so the window
+        // below it is exactly where the test body's frames will live
+        unsigned char marker;
+        auto top = reinterpret_cast<std::uintptr_t>(&marker) - stackPaintSlackBytes;
+        auto base = top - stackPaintWindowBytes;
+        // Painted with a plain loop: the region must only be written from
+        // a frame above it, never from a callee whose own frame is in it
+        for (auto p = base; p != top; ++p)
+            *reinterpret_cast<unsigned char*>(p) = stackPaintPattern;
+        s_paintBase = base;
+        s_paintTop = top;
+    }
+
+    std::size_t stackHighWaterBytes() {
+        if (!s_paintBase)
+            return 0;
+        // Scan upward from the bottom: consumption is the distance from
+        // the window's top down to the deepest overwritten byte, so the
+        // scan costs only the unused part of the window
+        for (auto p = s_paintBase; p != s_paintTop; ++p)
+            if (*reinterpret_cast<unsigned char const*>(p) != stackPaintPattern)
+                return static_cast<std::size_t>(s_paintTop - p);
+        return 0;
+    }
+
+} // end namespace Catch
@@ -0,0 +1,32 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_STACK_USAGE_H_INCLUDED
+#define TWOBLUECUBES_CATCH_STACK_USAGE_H_INCLUDED
+
+#include <cstddef>
+
+namespace Catch {
+
+    // Stack high-water measurement (--stack-usage): paintStack() fills a
+    // fixed window below the caller's stack pointer with a known pattern,
+    // the test body then runs over it, and stackHighWaterBytes() scans
+    // for the deepest overwritten byte. Costs one sweep of the window on
+    // each side of the body - microseconds - against hardware
+    // watchpoints or bisection for finding stack-hungry tests.
+    //
+    // The window is per thread; measurements saturate at
+    // stackPaintWindowBytes when a test uses more than the window.
+
+    constexpr std::size_t stackPaintWindowBytes = 256 * 1024;
+
+    void paintStack();
+
+    // Peak painted-stack consumption since the last paintStack() on this
+    // thread; 0 if the stack was never painted
+    std::size_t stackHighWaterBytes();
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_STACK_USAGE_H_INCLUDED
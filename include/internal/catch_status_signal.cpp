@@ -0,0 +1,169 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_status_signal.h"
+#include "catch_compiler_capabilities.h"
+
+#include <cstring>
+
+#if defined(CATCH_CONFIG_POSIX_SIGNALS)
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace Catch {
+namespace {
+
+    // The status board: everything the handler reports, laid down at test
+    // case boundaries. Not thread-local - the signal may be delivered to
+    // any thread, and there is one run to report on.
+    constexpr std::size_t nameBufferSize = 256;
+    char s_testName[nameBufferSize];
+    std::size_t s_testNameLength = 0;
+    unsigned long long s_assertionsPassed = 0;
+    unsigned long long s_assertionsFailed = 0;
+    unsigned long long s_assertionsFailedButOk = 0;
+    unsigned long long s_testCasesDone = 0;
+    unsigned long long s_runStartNanos = 0;
+    unsigned long long s_testStartNanos = 0;
+    // Written last by the publishers, read first by the handler, so a
+    // half-updated name is never reported as current
+    volatile sig_atomic_t s_inTestCase = 0;
+
+#if defined(CATCH_CONFIG_POSIX_SIGNALS)
+    // CLOCK_MONOTONIC via clock_gettime rather than <chrono>, because the
+    // handler needs the same clock and clock_gettime is on the
+    // async-signal-safe list
+    unsigned long long nowNanos() {
+        timespec ts;
+        clock_gettime( CLOCK_MONOTONIC, &ts );
+        return static_cast<unsigned long long>( ts.tv_sec ) * 1000000000ull
+             + static_cast<unsigned long long>( ts.tv_nsec );
+    }
+#else
+    unsigned long long nowNanos() { return 0; }
+#endif
+
+    void publishTotals( Totals const& totals ) {
+        s_assertionsPassed = totals.assertions.passed;
+        s_assertionsFailed = totals.assertions.failed;
+        s_assertionsFailedButOk = totals.assertions.failedButOk;
+        s_testCasesDone = totals.testCases.total();
+    }
+
+#if defined(CATCH_CONFIG_POSIX_SIGNALS)
+
+    void append( char* buffer, std::size_t& length, char const* text, std::size_t count ) {
+        std::memcpy( buffer + length, text, count );
+        length += count;
+    }
+    void append( char* buffer, std::size_t& length, char const* text ) {
+        append( buffer, length, text, std::strlen( text ) );
+    }
+    void appendNumber( char* buffer, std::size_t& length, unsigned long long value ) {
+        char digits[24];
+        std::size_t i = sizeof(digits);
+        do {
+            digits[--i] = static_cast<char>( '0' + value % 10 );
+            value /= 10;
+        } while( value );
+        append( buffer, length, digits + i, sizeof(digits) - i );
+    }
+    void appendSeconds( char* buffer, std::size_t& length, unsigned long long nanos ) {
+        appendNumber( buffer, length, nanos / 1000000000ull );
+        append( buffer, length, "." );
+        appendNumber( buffer, length, ( nanos % 1000000000ull ) / 100000000ull );
+        append( buffer, length, "s" );
+    }
+
+    void handleStatusSignal( int ) {
+        // Bounded: the name is capped at nameBufferSize and every number
+        // at 20 digits, so the fixed text plus all fields always fits
+        char buffer[nameBufferSize + 256];
+        std::size_t length = 0;
+        auto now = nowNanos();
+        append( buffer, length, "\nCatch status: " );
+        if( s_inTestCase ) {
+            append( buffer, length, "running '" );
+            append( buffer, length, s_testName, s_testNameLength );
+            append( buffer, length, "' for " );
+            appendSeconds( buffer, length, now - s_testStartNanos );
+        }
+        else
+            append( buffer, length, "between test cases" );
+        append( buffer, length, "; " );
+        appendNumber( buffer, length, s_testCasesDone );
+        append( buffer, length, " test cases done; assertions: " );
+        appendNumber( buffer, length, s_assertionsPassed );
+        append( buffer, length, " passed, " );
+        appendNumber( buffer, length, s_assertionsFailed );
+        append( buffer, length, " failed" );
+        if( s_assertionsFailedButOk ) {
+            append( buffer, length, ", " );
+            appendNumber( buffer, length, s_assertionsFailedButOk );
+            append( buffer, length, " failed as expected" );
+        }
+        if( s_runStartNanos ) {
+            append( buffer, length, "; run time " );
+            appendSeconds( buffer, length, now - s_runStartNanos );
+        }
+        append( buffer, length, "\n" );
+        static_cast<void>( write( 2, buffer, length ) );
+    }
+
+    struct sigaction s_oldSigUsr1Action;
+    bool s_handlerInstalled = false;
+
+#endif // CATCH_CONFIG_POSIX_SIGNALS
+
+} // end anonymous namespace
+
+    void publishRunStatus( std::string const& testName, Totals const& totals ) {
+        if( !s_runStartNanos )
+            s_runStartNanos = nowNanos();
+        auto count = testName.size();
+        if( count > nameBufferSize )
+            count = nameBufferSize;
+        std::memcpy( s_testName, testName.data(), count );
+        s_testNameLength = count;
+        publishTotals( totals );
+        s_testStartNanos = nowNanos();
+        s_inTestCase = 1;
+    }
+
+    void clearRunStatusTestCase( Totals const& totals ) {
+        s_inTestCase = 0;
+        publishTotals( totals );
+    }
+
+#if defined(CATCH_CONFIG_POSIX_SIGNALS)
+
+    StatusSignalHandler::StatusSignalHandler() {
+        if( s_handlerInstalled )
+            return;
+        struct sigaction sa = { };
+        sa.sa_handler = handleStatusSignal;
+        // The runner must not see EINTR from a status query
+        sa.sa_flags = SA_RESTART;
+        sigaction( SIGUSR1, &sa, &s_oldSigUsr1Action );
+        s_handlerInstalled = true;
+    }
+
+    StatusSignalHandler::~StatusSignalHandler() {
+        if( s_handlerInstalled ) {
+            sigaction( SIGUSR1, &s_oldSigUsr1Action, nullptr );
+            s_handlerInstalled = false;
+        }
+    }
+
+#else
+
+    StatusSignalHandler::StatusSignalHandler() {}
+    StatusSignalHandler::~StatusSignalHandler() {}
+
+#endif // CATCH_CONFIG_POSIX_SIGNALS
+
+} // end namespace Catch
@@ -0,0 +1,43 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_STATUS_SIGNAL_H_INCLUDED
+#define TWOBLUECUBES_CATCH_STATUS_SIGNAL_H_INCLUDED
+
+#include "catch_totals.h"
+
+#include <string>
+
+namespace Catch {
+
+    // On-demand run status. The runner publishes the current test case
+    // and the running totals into a fixed buffer at test case boundaries
+    // - plain bounded copies and counter stores, no locks or allocation -
+    // and a SIGUSR1 handler formats and writes them to stderr with
+    // nothing but write(2). A run that looks stuck can thus be asked
+    // what it is doing (kill -USR1 <pid>) without disturbing it, instead
+    // of being killed blind and losing all progress information.
+
+    // Called as each test case starts; also stamps the run start time on
+    // first use
+    void publishRunStatus( std::string const& testName, Totals const& totals );
+    // Called as each test case ends; the handler then reports the run as
+    // between test cases
+    void clearRunStatusTestCase( Totals const& totals );
+
+    // Installs the SIGUSR1 handler for its lifetime (the duration of a
+    // run), restoring whatever was there before. Does nothing on
+    // platforms without POSIX signals.
+    class StatusSignalHandler {
+    public:
+        StatusSignalHandler();
+        ~StatusSignalHandler();
+
+        StatusSignalHandler( StatusSignalHandler const& ) = delete;
+        StatusSignalHandler& operator=( StatusSignalHandler const& ) = delete;
+    };
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_STATUS_SIGNAL_H_INCLUDED
@@ -9,18 +9,40 @@
 
 #include "catch_common.h"
 #include "catch_enforce.h"
+#include "catch_platform.h"
+#include "catch_interfaces_config.h"
 #include "catch_stream.h"
+#include "catch_string_manip.h"
 #include "catch_debug_console.h"
 #include "catch_stringref.h"
-#include "catch_singletons.hpp"
 
+#include <algorithm>
+#include <condition_variable>
 #include <cstdio>
 #include <iostream>
 #include <fstream>
+#include <mutex>
 #include <sstream>
+#include <thread>
 #include <vector>
 #include <memory>
 
+#if defined(CATCH_CONFIG_GZIP_OUTPUT)
+#include <zlib.h>
+#endif
+
+#ifndef CATCH_CONFIG_DEBUG_CONSOLE_CHUNK_SIZE
+#define CATCH_CONFIG_DEBUG_CONSOLE_CHUNK_SIZE 4096
+#endif
+
+#if defined(CATCH_PLATFORM_LINUX) || defined(CATCH_PLATFORM_MAC)
+#define CATCH_INTERNAL_CONFIG_MMAP_OUTPUT
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace Catch {
 
     Catch::IStream::~IStream() = default;
@@ -89,6 +111,194 @@ namespace Catch {
 
         ///////////////////////////////////////////////////////////////////////////
 
+#if defined(CATCH_CONFIG_GZIP_OUTPUT)
+        // Reporter output compressed on the fly (-o report.xml.gz):
+        // writing and compressing the artifact become one pass over the
+        // data instead of a full write followed by an external compressor
+        // re-reading it. Reporter bytes are collected in the put area and
+        // handed to zlib's gzip layer a buffer at a time; flush() only
+        // drains the put area, it does not force a deflate block, so
+        // per-test-case flushing costs no compression ratio.
+        class GzipStreamBuf : public std::streambuf {
+            static constexpr std::size_t bufferSize = 64 * 1024;
+            std::vector<char> m_buffer;
+            gzFile m_file = nullptr;
+
+        public:
+            GzipStreamBuf( std::string const& filename )
+            :   m_buffer( bufferSize )
+            {
+                m_file = gzopen( filename.c_str(), "wb" );
+                CATCH_ENFORCE( m_file, "Unable to open file: '" << filename << "'" );
+                setp( m_buffer.data(), m_buffer.data() + m_buffer.size() );
+            }
+
+            ~GzipStreamBuf() noexcept {
+                GzipStreamBuf::sync();
+                if( m_file )
+                    gzclose( m_file );
+            }
+
+        private:
+            int overflow( int c ) override {
+                sync();
+                if( c != EOF )
+                    sputc( static_cast<char>( c ) );
+                return 0;
+            }
+
+            int sync() override {
+                auto count = static_cast<unsigned int>( pptr() - pbase() );
+                if( count ) {
+                    if( gzwrite( m_file, pbase(), count ) != static_cast<int>( count ) )
+                        return -1;
+                    setp( pbase(), epptr() );
+                }
+                return 0;
+            }
+        };
+
+        class GzipFileStream : public IStream {
+            std::unique_ptr<GzipStreamBuf> m_streamBuf;
+            mutable std::ostream m_os;
+        public:
+            GzipFileStream( StringRef filename )
+            :   m_streamBuf( new GzipStreamBuf( filename.c_str() ) ),
+                m_os( m_streamBuf.get() )
+            {}
+
+            ~GzipFileStream() override = default;
+
+        public: // IStream
+            std::ostream& stream() const override { return m_os; }
+        };
+#endif // CATCH_CONFIG_GZIP_OUTPUT
+
+        ///////////////////////////////////////////////////////////////////////////
+
+#if defined(CATCH_INTERNAL_CONFIG_MMAP_OUTPUT)
+        // File-bound reporter output writes straight into a memory-mapped
+        // window of the destination file: the streambuf's put area is the
+        // mapping itself, so reporter bytes are a memcpy into the page
+        // cache, and the only syscalls are the occasional ftruncate+mmap
+        // when the window fills. Flushing is a no-op - the mapping is
+        // shared, so the data is already with the kernel. The file is
+        // trimmed to its true size on close.
+        class MmapStreamBuf : public std::streambuf {
+            static constexpr std::size_t chunkSize = 1024 * 1024;
+            int m_fd = -1;
+            char* m_map = nullptr;
+            std::size_t m_mapSize = 0;   // bytes mapped (and truncated to)
+            std::size_t m_committed = 0; // file offset of the put area
+            std::size_t m_highWater = 0; // bytes ever written, across seeks
+
+        public:
+            MmapStreamBuf( std::string const& filename ) {
+                m_fd = ::open( filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644 );
+                CATCH_ENFORCE( m_fd >= 0, "Unable to open file: '" << filename << "'" );
+                grow();
+            }
+
+            ~MmapStreamBuf() noexcept {
+                auto used = m_committed + static_cast<std::size_t>( pptr() - pbase() );
+                if( used < m_highWater )
+                    used = m_highWater;
+                if( m_map )
+                    ::munmap( m_map, m_mapSize );
+                if( m_fd >= 0 ) {
+                    // Best effort - there is no way to report failure here
+                    static_cast<void>( ::ftruncate( m_fd, static_cast<off_t>( used ) ) );
+                    ::close( m_fd );
+                }
+            }
+
+            // Whether the mmap path can serve the given file: anything
+            // that is not a regular file (a pipe, a device) cannot be
+            // truncated and mapped, and falls back to the ofstream path
+            static bool supports( std::string const& filename ) {
+                int fd = ::open( filename.c_str(), O_WRONLY | O_CREAT, 0644 );
+                if( fd < 0 )
+                    return false;
+                struct stat info;
+                bool regular = ::fstat( fd, &info ) == 0 && S_ISREG( info.st_mode );
+                ::close( fd );
+                return regular;
+            }
+
+        private:
+            void grow() {
+                m_committed += static_cast<std::size_t>( pptr() - pbase() );
+                if( m_map ) {
+                    ::munmap( m_map, m_mapSize );
+                    m_map = nullptr;
+                }
+                m_mapSize += chunkSize;
+                CATCH_ENFORCE( ::ftruncate( m_fd, static_cast<off_t>( m_mapSize ) ) == 0,
+                               "Unable to grow output file" );
+                void* mapped = ::mmap( nullptr, m_mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0 );
+                CATCH_ENFORCE( mapped != MAP_FAILED, "Unable to map output file" );
+                m_map = static_cast<char*>( mapped );
+                setp( m_map + m_committed, m_map + m_mapSize );
+            }
+
+            int overflow( int c ) override {
+                grow();
+                if( c != EOF )
+                    sputc( static_cast<char>( c ) );
+                return 0;
+            }
+
+            int sync() override {
+                return 0;
+            }
+
+            // The whole file is one contiguous mapping, so seeking is just
+            // rebasing the put area within it. This keeps tellp() working,
+            // which streaming reporters rely on to back-patch placeholders
+            // (e.g. the junit-stream counts). The high-water mark makes
+            // sure a backward seek does not shorten the file on close.
+            pos_type seekoff( off_type off, std::ios_base::seekdir way, std::ios_base::openmode which ) override {
+                if( !( which & std::ios_base::out ) )
+                    return pos_type( off_type( -1 ) );
+                auto current = static_cast<off_type>( m_committed ) + ( pptr() - pbase() );
+                if( current > static_cast<off_type>( m_highWater ) )
+                    m_highWater = static_cast<std::size_t>( current );
+                off_type base = way == std::ios_base::beg ? 0
+                              : way == std::ios_base::cur ? current
+                              : static_cast<off_type>( m_highWater );
+                off_type target = base + off;
+                if( target < 0 )
+                    return pos_type( off_type( -1 ) );
+                while( static_cast<std::size_t>( target ) > m_mapSize )
+                    grow();
+                setp( m_map + target, m_map + m_mapSize );
+                m_committed = static_cast<std::size_t>( target );
+                return pos_type( target );
+            }
+
+            pos_type seekpos( pos_type pos, std::ios_base::openmode which ) override {
+                return seekoff( off_type( pos ), std::ios_base::beg, which );
+            }
+        };
+
+        class MmapFileStream : public IStream {
+            std::unique_ptr<MmapStreamBuf> m_streamBuf;
+            mutable std::ostream m_os;
+        public:
+            MmapFileStream( StringRef filename )
+            :   m_streamBuf( new MmapStreamBuf( filename.c_str() ) ),
+                m_os( m_streamBuf.get() )
+            {}
+
+            ~MmapFileStream() override = default;
+
+        public: // IStream
+            std::ostream& stream() const override { return m_os; }
+        };
+#endif // CATCH_INTERNAL_CONFIG_MMAP_OUTPUT
+
+        ///////////////////////////////////////////////////////////////////////////
+
         class CoutStream : public IStream {
             mutable std::ostream m_os;
         public:
@@ -103,12 +313,20 @@ namespace Catch {
 
         ///////////////////////////////////////////////////////////////////////////
 
+        // On Windows every writeToDebugConsole call becomes an
+        // OutputDebugString, and each of those is a cross-process round
+        // trip with any attached debugger. With the default 256 byte put
+        // area a single failure report trickles out in several such round
+        // trips, so the debug stream gets a chunk-sized put area of its
+        // own: everything written between two stream flushes goes to the
+        // debugger in one call (overflow only splits output that exceeds
+        // a whole chunk)
         class DebugOutStream : public IStream {
-            std::unique_ptr<StreamBufImpl<OutputDebugWriter>> m_streamBuf;
+            std::unique_ptr<StreamBufImpl<OutputDebugWriter, CATCH_CONFIG_DEBUG_CONSOLE_CHUNK_SIZE>> m_streamBuf;
             mutable std::ostream m_os;
         public:
             DebugOutStream()
-            :   m_streamBuf( new StreamBufImpl<OutputDebugWriter>() ),
+            :   m_streamBuf( new StreamBufImpl<OutputDebugWriter, CATCH_CONFIG_DEBUG_CONSOLE_CHUNK_SIZE>() ),
                 m_os( m_streamBuf.get() )
             {}
 
@@ -118,6 +336,176 @@ namespace Catch {
             std::ostream& stream() const override { return m_os; }
         };
 
+        ///////////////////////////////////////////////////////////////////////
+
+        class AsyncStreamBuf;
+        void registerForSyncDrain( AsyncStreamBuf* buf );
+        void deregisterForSyncDrain( AsyncStreamBuf* buf );
+
+        // Decouples reporter formatting from the final sink
+        // (--async-output): the reporter fills one buffer while a
+        // background thread writes the other, so a stalled write - a
+        // network filesystem, a slow CI log collector - overlaps with
+        // running the next test instead of blocking it. The reporter
+        // only waits when it flushes while the previous handoff is
+        // still being written.
+        class AsyncStreamBuf : public std::streambuf {
+            static constexpr std::size_t bufferSize = 1024 * 1024;
+
+            std::ostream& m_sink;
+            std::vector<char> m_fill;   // buffer the reporter writes into
+            std::vector<char> m_handed; // buffer the writer thread drains
+            std::size_t m_pending = 0;  // bytes of m_handed not yet written
+            bool m_writing = false;     // writer is inside m_sink.write
+            bool m_shutdown = false;
+            std::mutex m_mutex;
+            std::condition_variable m_wake;    // reporter -> writer
+            std::condition_variable m_written; // writer -> reporter
+            std::thread m_writer;
+
+        public:
+            AsyncStreamBuf( std::ostream& sink )
+            :   m_sink( sink ),
+                m_fill( bufferSize ),
+                m_handed( bufferSize )
+            {
+                setp( m_fill.data(), m_fill.data() + m_fill.size() );
+                m_writer = std::thread( [this] { writeLoop(); } );
+                registerForSyncDrain( this );
+            }
+
+            ~AsyncStreamBuf() noexcept {
+                deregisterForSyncDrain( this );
+                {
+                    std::unique_lock<std::mutex> lock( m_mutex );
+                    handOff( lock );
+                    m_shutdown = true;
+                }
+                m_wake.notify_one();
+                m_writer.join();
+            }
+
+            // Synchronous fallback, called from flushOutputStreams() -
+            // both the explicit flush point of the non-Auto flush
+            // policies and the fatal error path. Everything buffered is
+            // written by the calling thread, unless the writer thread is
+            // mid-write (then the data is already on its way out, and
+            // writing it again, or interleaving with it, would corrupt
+            // the output). try_lock rather than lock so the fatal path
+            // cannot deadlock on a mutex the crash interrupted.
+            void drainPending() {
+                std::unique_lock<std::mutex> lock( m_mutex, std::try_to_lock );
+                if( !lock.owns_lock() || m_writing )
+                    return;
+                if( m_pending ) {
+                    m_sink.write( m_handed.data(), static_cast<std::streamsize>( m_pending ) );
+                    m_pending = 0;
+                    m_written.notify_one();
+                }
+                if( pptr() != pbase() ) {
+                    m_sink.write( pbase(), pptr() - pbase() );
+                    setp( pbase(), epptr() );
+                }
+                m_sink.flush();
+            }
+
+        private:
+            // Swaps the filled buffer to the writer thread. The wait only
+            // triggers when the reporter produces faster than the sink
+            // accepts - exactly the backpressure this is bounded by.
+            void handOff( std::unique_lock<std::mutex>& lock ) {
+                auto filled = static_cast<std::size_t>( pptr() - pbase() );
+                if( filled == 0 )
+                    return;
+                m_written.wait( lock, [this] { return m_pending == 0 && !m_writing; } );
+                m_fill.swap( m_handed );
+                m_pending = filled;
+                setp( m_fill.data(), m_fill.data() + m_fill.size() );
+                m_wake.notify_one();
+            }
+
+            void writeLoop() {
+                std::unique_lock<std::mutex> lock( m_mutex );
+                for(;;) {
+                    m_wake.wait( lock, [this] { return m_pending != 0 || m_shutdown; } );
+                    if( m_pending != 0 ) {
+                        auto count = m_pending;
+                        m_writing = true;
+                        lock.unlock(); // the slow part runs without the lock
+                        m_sink.write( m_handed.data(), static_cast<std::streamsize>( count ) );
+                        m_sink.flush();
+                        lock.lock();
+                        m_writing = false;
+                        m_pending = 0;
+                        m_written.notify_one();
+                    }
+                    else if( m_shutdown )
+                        return;
+                }
+            }
+
+            int overflow( int c ) override {
+                sync();
+                if( c != EOF )
+                    sputc( static_cast<char>( c ) );
+                return 0;
+            }
+
+            int sync() override {
+                std::unique_lock<std::mutex> lock( m_mutex );
+                handOff( lock );
+                return 0;
+            }
+        };
+
+        // All live async buffers, so flushOutputStreams() can reach them.
+        // There is normally exactly one (the session's reporter stream),
+        // but --jobs workers may add their own.
+        auto asyncStreamBufs() -> std::vector<AsyncStreamBuf*>& {
+            static std::vector<AsyncStreamBuf*> s_bufs;
+            return s_bufs;
+        }
+        auto asyncStreamBufsMutex() -> std::mutex& {
+            static std::mutex s_mutex;
+            return s_mutex;
+        }
+        void registerForSyncDrain( AsyncStreamBuf* buf ) {
+            std::lock_guard<std::mutex> lock( asyncStreamBufsMutex() );
+            asyncStreamBufs().push_back( buf );
+        }
+        void deregisterForSyncDrain( AsyncStreamBuf* buf ) {
+            std::lock_guard<std::mutex> lock( asyncStreamBufsMutex() );
+            auto& bufs = asyncStreamBufs();
+            bufs.erase( std::remove( bufs.begin(), bufs.end(), buf ), bufs.end() );
+        }
+        void drainAsyncStreams() {
+            std::unique_lock<std::mutex> lock( asyncStreamBufsMutex(), std::try_to_lock );
+            if( !lock.owns_lock() )
+                return;
+            for( auto buf : asyncStreamBufs() )
+                buf->drainPending();
+        }
+
+        class AsyncOutStream : public IStream {
+            std::unique_ptr<IStream const> m_wrapped;
+            std::unique_ptr<AsyncStreamBuf> m_streamBuf;
+            mutable std::ostream m_os;
+        public:
+            AsyncOutStream( IStream const* wrapped )
+            :   m_wrapped( wrapped ),
+                m_streamBuf( new AsyncStreamBuf( m_wrapped->stream() ) ),
+                m_os( m_streamBuf.get() )
+            {}
+
+            // Members are destroyed in reverse order, so the buffer's
+            // destructor hands off the tail and joins the writer while
+            // the wrapped sink is still alive
+            ~AsyncOutStream() override = default;
+
+        public: // IStream
+            std::ostream& stream() const override { return m_os; }
+        };
+
     }} // namespace anon::detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -131,12 +519,34 @@ namespace Catch {
             else
                 CATCH_ERROR( "Unrecognised stream: '" << filename << "'" );
         }
-        else
+        else {
+            if( endsWith( filename, ".gz" ) ) {
+#if defined(CATCH_CONFIG_GZIP_OUTPUT)
+                return new detail::GzipFileStream( filename );
+#else
+                CATCH_ERROR( "Compressed output to: '" << filename
+                            << "' requires compiling with CATCH_CONFIG_GZIP_OUTPUT (and linking zlib)" );
+#endif
+            }
+#if defined(CATCH_INTERNAL_CONFIG_MMAP_OUTPUT)
+            if( detail::MmapStreamBuf::supports( filename.c_str() ) )
+                return new detail::MmapFileStream( filename );
+#endif
             return new detail::FileStream( filename );
+        }
+    }
+
+    auto makeAsyncStream( IStream const* wrapped ) -> IStream const* {
+        return new detail::AsyncOutStream( wrapped );
     }
 
 
     // This class encapsulates the idea of a pool of ostringstreams that can be reused.
+    // Each thread owns its own pool: a ReusableStringStream never leaves the
+    // stack of the thread that created it, so thread-private freelists need
+    // no synchronisation at all - neither locks nor atomics - and the pool
+    // stops being a contention point when tests run on several threads
+    // (see the --jobs option).
     struct StringStreams {
         std::vector<std::unique_ptr<std::ostringstream>> m_streams;
         std::vector<std::size_t> m_unused;
@@ -158,17 +568,22 @@ namespace Catch {
             m_streams[index]->copyfmt( m_referenceStream ); // Restore initial flags and other state
             m_unused.push_back(index);
         }
+
+        static auto forCurrentThread() -> StringStreams& {
+            static thread_local StringStreams s_pool;
+            return s_pool;
+        }
     };
 
     ReusableStringStream::ReusableStringStream()
-    :   m_index( Singleton<StringStreams>::getMutable().add() ),
-        m_oss( Singleton<StringStreams>::getMutable().m_streams[m_index].get() )
+    :   m_index( StringStreams::forCurrentThread().add() ),
+        m_oss( StringStreams::forCurrentThread().m_streams[m_index].get() )
     {}
 
     ReusableStringStream::~ReusableStringStream() {
         static_cast<std::ostringstream*>( m_oss )->str("");
         m_oss->clear();
-        Singleton<StringStreams>::getMutable().release( m_index );
+        StringStreams::forCurrentThread().release( m_index );
     }
 
     auto ReusableStringStream::str() const -> std::string {
@@ -178,6 +593,33 @@ namespace Catch {
 
     ///////////////////////////////////////////////////////////////////////////
 
+    namespace {
+        FlushPolicy s_flushPolicy = FlushPolicy::Auto;
+    }
+
+    void configureOutputBuffering( FlushPolicy policy ) {
+        s_flushPolicy = policy;
+        if( policy == FlushPolicy::TestCaseEnd ) {
+            // One big fully-buffered stdio buffer instead of the default
+            // (line buffered on a tty), so the run makes one write per
+            // test case rather than one per line. setvbuf is only
+            // portable before the first operation on the stream, which
+            // is why this runs at the very start of the session.
+            static std::vector<char> s_stdoutBuffer( 1024*1024 );
+            std::setvbuf( stdout, s_stdoutBuffer.data(), _IOFBF, s_stdoutBuffer.size() );
+        }
+    }
+    auto currentFlushPolicy() -> FlushPolicy {
+        return s_flushPolicy;
+    }
+    void flushOutputStreams() {
+        detail::drainAsyncStreams();
+        cout().flush();
+        std::fflush( stdout );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
 
 #ifndef CATCH_CONFIG_NOSTDOUT // If you #define this you must implement these functions
     std::ostream& cout() { return std::cout; }
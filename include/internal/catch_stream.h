@@ -19,6 +19,18 @@ namespace Catch {
     std::ostream& cerr();
     std::ostream& clog();
 
+    enum class FlushPolicy;
+
+    // Applies the configured flush policy to stdout - in particular,
+    // FlushPolicy::TestCaseEnd installs a large fully-buffered stdio
+    // buffer, so must be called before the run produces any output
+    void configureOutputBuffering( FlushPolicy policy );
+    auto currentFlushPolicy() -> FlushPolicy;
+
+    // Explicit flush point for the non-Auto policies - also called from
+    // the fatal error path so buffered output survives a crash
+    void flushOutputStreams();
+
     class StringRef;
 
     struct IStream {
@@ -28,6 +40,11 @@ namespace Catch {
 
     auto makeStream( StringRef const &filename ) -> IStream const*;
 
+    // Wraps a stream in the double-buffered background writer stage
+    // (--async-output): takes ownership of the wrapped stream and writes
+    // to it from a dedicated thread
+    auto makeAsyncStream( IStream const* wrapped ) -> IStream const*;
+
     class ReusableStringStream {
         std::size_t m_index;
         std::ostream* m_oss;
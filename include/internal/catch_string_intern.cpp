@@ -0,0 +1,112 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_string_intern.h"
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace Catch {
+
+    namespace {
+
+        struct StringRefLess {
+            bool operator()( StringRef const& lhs, StringRef const& rhs ) const {
+                auto minSize = lhs.size() < rhs.size() ? lhs.size() : rhs.size();
+                int cmp = std::memcmp( lhs.currentData(), rhs.currentData(), minSize );
+                if( cmp != 0 )
+                    return cmp < 0;
+                return lhs.size() < rhs.size();
+            }
+        };
+
+        class StringInternPool {
+            std::vector<std::unique_ptr<char[]>> m_blocks;
+            char* m_cursor = nullptr;
+            std::size_t m_remaining = 0;
+            std::set<StringRef, StringRefLess> m_interned;
+
+            char const* store( std::string const& str ) {
+                std::size_t const blockSize = 16 * 1024;
+                auto needed = str.size() + 1; // keep pooled strings null terminated
+                if( needed > m_remaining ) {
+                    auto size = needed > blockSize ? needed : blockSize;
+                    m_blocks.push_back( std::unique_ptr<char[]>( new char[size] ) );
+                    m_cursor = m_blocks.back().get();
+                    m_remaining = size;
+                }
+                auto stored = m_cursor;
+                std::memcpy( stored, str.c_str(), needed );
+                m_cursor += needed;
+                m_remaining -= needed;
+                return stored;
+            }
+
+        public:
+            StringRef intern( std::string const& str ) {
+                auto it = m_interned.find( StringRef( str ) );
+                if( it != m_interned.end() )
+                    return StringRef( it->currentData(), it->size() );
+                StringRef interned( store( str ), str.size() );
+                m_interned.insert( interned );
+                return interned;
+            }
+        };
+
+        StringInternPool& stringInternPool() {
+            // Function-local so it is ready during static-init-time test
+            // registration
+            static StringInternPool s_pool;
+            return s_pool;
+        }
+
+        struct CStrLess {
+            bool operator()( char const* lhs, char const* rhs ) const {
+                return std::strcmp( lhs, rhs ) < 0;
+            }
+        };
+
+        // Two-level lookup: the pointer cache answers repeat queries with
+        // one pointer-hash probe - __FILE__ expansions within a translation
+        // unit share a literal, so after the first call per TU the content
+        // comparison never runs again
+        class SourceFileInternPool {
+            std::unordered_map<char const*, char const*> m_byPointer;
+            std::map<char const*, char const*, CStrLess> m_canonical;
+            std::mutex m_mutex;
+
+        public:
+            char const* intern( char const* file ) {
+                std::lock_guard<std::mutex> lock( m_mutex );
+                auto it = m_byPointer.find( file );
+                if( it != m_byPointer.end() )
+                    return it->second;
+                auto canonical = m_canonical.emplace( file, file ).first->second;
+                m_byPointer.emplace( file, canonical );
+                return canonical;
+            }
+        };
+
+        SourceFileInternPool& sourceFileInternPool() {
+            static SourceFileInternPool s_pool;
+            return s_pool;
+        }
+
+    }
+
+    StringRef internString( std::string const& str ) {
+        return stringInternPool().intern( str );
+    }
+
+    char const* internSourceFile( char const* file ) {
+        return sourceFileInternPool().intern( file );
+    }
+
+} // end namespace Catch
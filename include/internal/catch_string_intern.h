@@ -0,0 +1,34 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_STRING_INTERN_H_INCLUDED
+#define TWOBLUECUBES_CATCH_STRING_INTERN_H_INCLUDED
+
+#include "catch_stringref.h"
+
+#include <string>
+
+namespace Catch {
+
+    // Interns a string into a shared, process-lifetime pool and returns a
+    // view of the pooled copy. Equal strings share a single copy, so
+    // metadata that repeats across thousands of test cases (tags, class
+    // names) is stored once, packed into a few contiguous blocks instead
+    // of scattered small allocations. Interned strings are null terminated
+    // and never freed.
+    StringRef internString( std::string const& str );
+
+    // Maps a __FILE__ literal to one canonical pointer per distinct file
+    // name, so two locations in the same file always compare file-equal by
+    // pointer alone - SourceLineInfo's comparisons short-circuit on pointer
+    // equality, so interned locations never reach the strcmp fallback. The
+    // returned pointer is the first-seen literal itself (no copy is made);
+    // callers must pass pointers with static storage duration. Unlike
+    // internString this is thread safe, as trackers intern section
+    // locations from concurrently running --jobs workers.
+    char const* internSourceFile( char const* file );
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_STRING_INTERN_H_INCLUDED
@@ -20,20 +20,24 @@ namespace Catch {
         }
     }
 
-    bool startsWith( std::string const& s, std::string const& prefix ) {
-        return s.size() >= prefix.size() && std::equal(prefix.begin(), prefix.end(), s.begin());
+    bool startsWith( StringRef const& s, StringRef const& prefix ) {
+        return s.size() >= prefix.size() &&
+            std::memcmp( s.currentData(), prefix.currentData(), prefix.size() ) == 0;
     }
-    bool startsWith( std::string const& s, char prefix ) {
+    bool startsWith( StringRef const& s, char prefix ) {
         return !s.empty() && s[0] == prefix;
     }
-    bool endsWith( std::string const& s, std::string const& suffix ) {
-        return s.size() >= suffix.size() && std::equal(suffix.rbegin(), suffix.rend(), s.rbegin());
+    bool endsWith( StringRef const& s, StringRef const& suffix ) {
+        return s.size() >= suffix.size() &&
+            std::memcmp( s.currentData() + s.size() - suffix.size(), suffix.currentData(), suffix.size() ) == 0;
     }
-    bool endsWith( std::string const& s, char suffix ) {
+    bool endsWith( StringRef const& s, char suffix ) {
         return !s.empty() && s[s.size()-1] == suffix;
     }
-    bool contains( std::string const& s, std::string const& infix ) {
-        return s.find( infix ) != std::string::npos;
+    bool contains( StringRef const& s, StringRef const& infix ) {
+        auto first = s.currentData();
+        auto last = first + s.size();
+        return std::search( first, last, infix.currentData(), infix.currentData() + infix.size() ) != last;
     }
     void toLowerInPlace( std::string& s ) {
         std::transform( s.begin(), s.end(), s.begin(), toLowerCh );
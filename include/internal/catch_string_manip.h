@@ -7,16 +7,21 @@
 #ifndef TWOBLUECUBES_CATCH_STRING_MANIP_H_INCLUDED
 #define TWOBLUECUBES_CATCH_STRING_MANIP_H_INCLUDED
 
+#include "catch_stringref.h"
+
 #include <string>
 #include <iosfwd>
 
 namespace Catch {
 
-    bool startsWith( std::string const& s, std::string const& prefix );
-    bool startsWith( std::string const& s, char prefix );
-    bool endsWith( std::string const& s, std::string const& suffix );
-    bool endsWith( std::string const& s, char suffix );
-    bool contains( std::string const& s, std::string const& infix );
+    // The predicates take StringRefs so that owning strings, literals and
+    // views into the intern pool can all be queried without building a
+    // temporary std::string at the call site
+    bool startsWith( StringRef const& s, StringRef const& prefix );
+    bool startsWith( StringRef const& s, char prefix );
+    bool endsWith( StringRef const& s, StringRef const& suffix );
+    bool endsWith( StringRef const& s, char suffix );
+    bool contains( StringRef const& s, StringRef const& infix );
     void toLowerInPlace( std::string& s );
     std::string toLower( std::string const& s );
     std::string trim( std::string const& str );
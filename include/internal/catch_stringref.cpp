@@ -16,6 +16,7 @@
 #include <ostream>
 #include <cstring>
 #include <cstdint>
+#include <cassert>
 
 namespace {
     const uint32_t byte_2_lead = 0xC0;
@@ -32,36 +33,18 @@ namespace Catch {
         return std::string( m_start, m_size );
     }
 
-    void StringRef::swap( StringRef& other ) noexcept {
-        std::swap( m_start, other.m_start );
-        std::swap( m_size, other.m_size );
-        std::swap( m_data, other.m_data );
-    }
-
     auto StringRef::c_str() const -> char const* {
-        if( isSubstring() )
-           const_cast<StringRef*>( this )->takeOwnership();
+        assert( !isSubstring() && "c_str() requires a null terminated StringRef - make an OwnedString instead" );
         return m_start;
     }
     auto StringRef::currentData() const noexcept -> char const* {
         return m_start;
     }
 
-    auto StringRef::isOwned() const noexcept -> bool {
-        return m_data != nullptr;
-    }
     auto StringRef::isSubstring() const noexcept -> bool {
         return m_start[m_size] != '\0';
     }
 
-    void StringRef::takeOwnership() {
-        if( !isOwned() ) {
-            m_data = new char[m_size+1];
-            memcpy( m_data, m_start, m_size );
-            m_data[m_size] = '\0';
-            m_start = m_data;
-        }
-    }
     auto StringRef::substr( size_type start, size_type size ) const noexcept -> StringRef {
         if( start < m_size )
             return StringRef( m_start+start, size );
@@ -97,6 +80,24 @@ namespace Catch {
         return noChars;
     }
 
+    OwnedString::OwnedString( StringRef ref )
+    :   m_allocated( nullptr ),
+        m_size( ref.size() )
+    {
+        char* buffer = m_inline;
+        if( m_size >= sizeof(m_inline) ) {
+            m_allocated = new char[m_size+1];
+            buffer = m_allocated;
+        }
+        std::memcpy( buffer, ref.currentData(), m_size );
+        buffer[m_size] = '\0';
+        m_str = buffer;
+    }
+
+    OwnedString::~OwnedString() noexcept {
+        delete[] m_allocated;
+    }
+
     auto operator + ( StringRef const& lhs, StringRef const& rhs ) -> std::string {
         std::string str;
         str.reserve( lhs.size() + rhs.size() );
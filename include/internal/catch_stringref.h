@@ -13,15 +13,12 @@
 
 namespace Catch {
 
-    class StringData;
-
     /// A non-owning string class (similar to the forthcoming std::string_view)
     /// Note that, because a StringRef may be a substring of another string,
-    /// it may not be null terminated. c_str() must return a null terminated
-    /// string, however, and so the StringRef will internally take ownership
-    /// (taking a copy), if necessary. In theory this ownership is not externally
-    /// visible - but it does mean (substring) StringRefs should not be shared between
-    /// threads.
+    /// it may not be null terminated. c_str() requires null termination and
+    /// asserts it; to hand a substring to a C API, go through OwnedString
+    /// below. StringRef itself never owns anything - copying one is two
+    /// member copies and cannot allocate.
     class StringRef {
     public:
         using size_type = std::size_t;
@@ -32,10 +29,6 @@ namespace Catch {
         char const* m_start;
         size_type m_size;
 
-        char* m_data = nullptr;
-
-        void takeOwnership();
-
         static constexpr char const* const s_empty = "";
 
     public: // construction/ assignment
@@ -43,19 +36,6 @@ namespace Catch {
         :   StringRef( s_empty, 0 )
         {}
 
-        StringRef( StringRef const& other ) noexcept
-        :   m_start( other.m_start ),
-            m_size( other.m_size )
-        {}
-
-        StringRef( StringRef&& other ) noexcept
-        :   m_start( other.m_start ),
-            m_size( other.m_size ),
-            m_data( other.m_data )
-        {
-            other.m_data = nullptr;
-        }
-
         StringRef( char const* rawChars ) noexcept;
 
         StringRef( char const* rawChars, size_type size ) noexcept
@@ -68,22 +48,8 @@ namespace Catch {
             m_size( stdString.size() )
         {}
 
-        ~StringRef() noexcept {
-            delete[] m_data;
-        }
-
-        auto operator = ( StringRef const &other ) noexcept -> StringRef& {
-            delete[] m_data;
-            m_data = nullptr;
-            m_start = other.m_start;
-            m_size = other.m_size;
-            return *this;
-        }
-
         operator std::string() const;
 
-        void swap( StringRef& other ) noexcept;
-
     public: // operators
         auto operator == ( StringRef const& other ) const noexcept -> bool;
         auto operator != ( StringRef const& other ) const noexcept -> bool;
@@ -105,14 +71,40 @@ namespace Catch {
         auto substr( size_type start, size_type size ) const noexcept -> StringRef;
 
         // Returns the current start pointer.
-        // Note that the pointer can change when if the StringRef is a substring
         auto currentData() const noexcept -> char const*;
 
-    private: // ownership queries - may not be consistent between calls
-        auto isOwned() const noexcept -> bool;
+    private:
         auto isSubstring() const noexcept -> bool;
     };
 
+    /// The owned half of the owned/borrowed split: a null terminated copy
+    /// of a StringRef, for passing to C APIs. Strings up to 63 characters
+    /// - the overwhelmingly common case for the substrings built during
+    /// assertion message assembly - live in the inline buffer; only longer
+    /// ones allocate. Intended as a scope-local adapter, so it is neither
+    /// copyable nor movable.
+    class OwnedString {
+    public:
+        explicit OwnedString( StringRef ref );
+        ~OwnedString() noexcept;
+
+        OwnedString( OwnedString const& ) = delete;
+        auto operator = ( OwnedString const& ) -> OwnedString& = delete;
+
+        auto c_str() const noexcept -> char const* {
+            return m_str;
+        }
+        auto size() const noexcept -> std::size_t {
+            return m_size;
+        }
+
+    private:
+        char m_inline[64];
+        char* m_allocated; // non-null when the text did not fit m_inline
+        char const* m_str;
+        std::size_t m_size;
+    };
+
     auto operator + ( StringRef const& lhs, StringRef const& rhs ) -> std::string;
     auto operator + ( StringRef const& lhs, char const* rhs ) -> std::string;
     auto operator + ( char const* lhs, StringRef const& rhs ) -> std::string;
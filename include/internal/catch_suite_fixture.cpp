@@ -0,0 +1,124 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_suite_fixture.h"
+
+#include "catch_enforce.h"
+#include "catch_string_manip.h"
+#include "catch_test_case_info.h"
+#include "catch_test_dependencies.h"
+
+#include <mutex>
+
+namespace Catch {
+
+    ISuiteFixture::~ISuiteFixture() = default;
+
+    namespace {
+
+        struct SuiteFixtureEntry {
+            std::string spec;
+            // Non-empty when the spec is a tag: the name between the
+            // brackets, lowercased to match lcaseTags
+            std::string lcaseTag;
+            std::unique_ptr<ISuiteFixture> fixture;
+            std::size_t remaining = 0;
+            bool active = false;
+
+            SuiteFixtureEntry( std::string const& _spec, std::string const& _lcaseTag,
+                               std::unique_ptr<ISuiteFixture> _fixture )
+            :   spec( _spec ),
+                lcaseTag( _lcaseTag ),
+                fixture( std::move( _fixture ) )
+            {}
+        };
+
+        // Function-local statics: fixtures register from global
+        // constructors, before any fixed-order global would be ready
+        std::vector<SuiteFixtureEntry>& suiteFixtures() {
+            static std::vector<SuiteFixtureEntry> s_fixtures;
+            return s_fixtures;
+        }
+        std::mutex& suiteFixtureMutex() {
+            static std::mutex s_mutex;
+            return s_mutex;
+        }
+
+        bool matches( SuiteFixtureEntry const& entry, TestCaseInfo const& testInfo ) {
+            if( !entry.lcaseTag.empty() ) {
+                for( auto const& tag : testInfo.lcaseTags )
+                    if( tag == entry.lcaseTag )
+                        return true;
+                return false;
+            }
+            return dependencyPathsMatch( entry.spec, testInfo.lineInfo.file );
+        }
+
+    } // anonymous namespace
+
+    void registerSuiteFixture( std::string const& spec, std::unique_ptr<ISuiteFixture> fixture ) {
+        CATCH_ENFORCE_PARTS( !spec.empty(), "Suite fixture spec must not be empty" );
+        std::string lcaseTag;
+        if( spec.size() > 2 && spec.front() == '[' && spec.back() == ']' )
+            lcaseTag = toLower( spec.substr( 1, spec.size() - 2 ) );
+
+        std::lock_guard<std::mutex> lock( suiteFixtureMutex() );
+        suiteFixtures().emplace_back( spec, lcaseTag, std::move( fixture ) );
+    }
+
+    void primeSuiteFixtures( std::vector<TestCase> const& selectedTests ) {
+        std::lock_guard<std::mutex> lock( suiteFixtureMutex() );
+        for( auto& entry : suiteFixtures() ) {
+            entry.remaining = 0;
+            for( auto const& testCase : selectedTests )
+                if( matches( entry, testCase ) )
+                    ++entry.remaining;
+        }
+    }
+
+    void primeSuiteFixtures( std::vector<TestCase const*> const& selectedTests ) {
+        std::lock_guard<std::mutex> lock( suiteFixtureMutex() );
+        for( auto& entry : suiteFixtures() ) {
+            entry.remaining = 0;
+            for( auto const* testCase : selectedTests )
+                if( matches( entry, *testCase ) )
+                    ++entry.remaining;
+        }
+    }
+
+    // Setup and teardown run with the registry locked: under --jobs the
+    // first worker to reach a matching test performs the (possibly slow)
+    // setup while the others queue behind it rather than starting the
+    // same fixture twice
+    void suiteFixturesTestStarting( TestCaseInfo const& testInfo ) {
+        std::lock_guard<std::mutex> lock( suiteFixtureMutex() );
+        for( auto& entry : suiteFixtures() )
+            if( !entry.active && entry.remaining > 0 && matches( entry, testInfo ) ) {
+                entry.fixture->setup();
+                entry.active = true;
+            }
+    }
+
+    void suiteFixturesTestEnded( TestCaseInfo const& testInfo ) {
+        std::lock_guard<std::mutex> lock( suiteFixtureMutex() );
+        for( auto& entry : suiteFixtures() )
+            if( entry.remaining > 0 && matches( entry, testInfo ) )
+                if( --entry.remaining == 0 && entry.active ) {
+                    entry.fixture->teardown();
+                    entry.active = false;
+                }
+    }
+
+    void teardownSuiteFixtures() {
+        std::lock_guard<std::mutex> lock( suiteFixtureMutex() );
+        for( auto& entry : suiteFixtures() )
+            if( entry.active ) {
+                entry.fixture->teardown();
+                entry.active = false;
+                entry.remaining = 0;
+            }
+    }
+
+} // end namespace Catch
@@ -0,0 +1,68 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_SUITE_FIXTURE_H_INCLUDED
+#define TWOBLUECUBES_CATCH_SUITE_FIXTURE_H_INCLUDED
+
+#include "catch_compiler_capabilities.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Catch {
+
+    class TestCase;
+    struct TestCaseInfo;
+
+    // A suite-scope fixture (CATCH_REGISTER_SUITE_FIXTURE): setup runs
+    // once, just before the first selected test its spec matches, and
+    // teardown once, right after the last one - however the run is
+    // ordered, sharded or parallelised. The spec is either a tag
+    // ("[db]") or a source file path; a fixture whose spec matches no
+    // selected test is never set up. Expensive shared state (a spun-up
+    // database, a loaded model) lives in the fixture object instead of
+    // function-local statics that are never torn down.
+    struct ISuiteFixture {
+        virtual ~ISuiteFixture();
+        virtual void setup() {}
+        virtual void teardown() {}
+    };
+
+    void registerSuiteFixture( std::string const& spec, std::unique_ptr<ISuiteFixture> fixture );
+
+    // Counts, for each registered fixture, how many of the tests about
+    // to run it matches - called by the session once the selection
+    // (filters, shard) is final, so teardown can fire as soon as the
+    // last matching test completes
+    void primeSuiteFixtures( std::vector<TestCase> const& selectedTests );
+    void primeSuiteFixtures( std::vector<TestCase const*> const& selectedTests );
+
+    // Called by the RunContext around each test case
+    void suiteFixturesTestStarting( TestCaseInfo const& testInfo );
+    void suiteFixturesTestEnded( TestCaseInfo const& testInfo );
+
+    // Tears down anything still set up - an aborted or budget-cut run
+    // leaves matching tests unrun
+    void teardownSuiteFixtures();
+
+    template<typename T>
+    struct SuiteFixtureRegistrar {
+        explicit SuiteFixtureRegistrar( std::string const& spec ) {
+            registerSuiteFixture( spec, std::unique_ptr<ISuiteFixture>( new T() ) );
+        }
+    };
+
+} // end namespace Catch
+
+#if !defined(CATCH_CONFIG_DISABLE)
+#define CATCH_REGISTER_SUITE_FIXTURE( fixtureType, spec ) \
+    CATCH_INTERNAL_SUPPRESS_GLOBALS_WARNINGS \
+    namespace{ Catch::SuiteFixtureRegistrar<fixtureType> catch_internal_SuiteFixtureRegistrarFor##fixtureType( spec ); } \
+    CATCH_INTERNAL_UNSUPPRESS_GLOBALS_WARNINGS
+#else
+#define CATCH_REGISTER_SUITE_FIXTURE( fixtureType, spec )
+#endif
+
+#endif // TWOBLUECUBES_CATCH_SUITE_FIXTURE_H_INCLUDED
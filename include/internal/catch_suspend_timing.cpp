@@ -0,0 +1,38 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_suspend_timing.h"
+#include "catch_timer.h"
+
+namespace Catch {
+
+    namespace {
+        // Per thread: a section's timer and any SuspendTiming scopes
+        // inside it run on the same thread, and suspensions on one
+        // parallel worker (see --jobs) must not bleed into another's
+        // durations
+        thread_local uint64_t s_suspendedNanoseconds = 0;
+        thread_local int s_suspendDepth = 0;
+    }
+
+    uint64_t suspendedTimeNanoseconds() {
+        return s_suspendedNanoseconds;
+    }
+
+    SuspendTiming::SuspendTiming()
+    :   m_start( 0 )
+    {
+        // Only the outermost scope measures, so nested scopes cannot
+        // double-count the same wall time
+        if( s_suspendDepth++ == 0 )
+            m_start = getCurrentNanosecondsSinceEpoch();
+    }
+
+    SuspendTiming::~SuspendTiming() {
+        if( --s_suspendDepth == 0 )
+            s_suspendedNanoseconds += getCurrentNanosecondsSinceEpoch() - m_start;
+    }
+
+} // end namespace Catch
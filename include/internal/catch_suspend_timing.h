@@ -0,0 +1,47 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_SUSPEND_TIMING_H_INCLUDED
+#define TWOBLUECUBES_CATCH_SUSPEND_TIMING_H_INCLUDED
+
+#include "catch_common.h"
+
+#include <cstdint>
+
+namespace Catch {
+
+    // Total time this thread has spent inside SuspendTiming scopes, in
+    // nanoseconds. Monotonic; duration accounting subtracts the growth
+    // between two reads.
+    uint64_t suspendedTimeNanoseconds();
+
+    // Excludes the enclosed scope from measured durations: time spent
+    // while a SuspendTiming object is alive does not count towards the
+    // enclosing sections' or test case's reported duration (--durations,
+    // JUnit times, the duration cache). Lets a test keep expensive setup
+    // or teardown inline without it polluting the timings:
+    //
+    //     TEST_CASE( "query planner" ) {
+    //         {
+    //             Catch::SuspendTiming _;
+    //             loadFixtureDatabase();
+    //         }
+    //         REQUIRE( plan( query ).cost < 100 );
+    //     }
+    //
+    // Scopes may nest; only the outermost scope accumulates, so nested
+    // time is not counted twice. The exclusion applies to durations
+    // measured on the thread the scope runs on.
+    class SuspendTiming : NonCopyable {
+    public:
+        SuspendTiming();
+        ~SuspendTiming();
+
+    private:
+        uint64_t m_start;
+    };
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_SUSPEND_TIMING_H_INCLUDED
@@ -0,0 +1,42 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_test_abort.h"
+
+#if defined(CATCH_CONFIG_DISABLE_EXCEPTIONS)
+
+#include <cstdlib>
+
+namespace Catch {
+
+    namespace {
+        thread_local std::jmp_buf s_testAbortTarget;
+        thread_local bool s_testAbortArmed = false;
+    }
+
+    std::jmp_buf& testAbortTarget() {
+        return s_testAbortTarget;
+    }
+
+    void armTestAbort() {
+        s_testAbortArmed = true;
+    }
+    void disarmTestAbort() {
+        s_testAbortArmed = false;
+    }
+    bool testAbortArmed() {
+        return s_testAbortArmed;
+    }
+
+    void abortCurrentTest() {
+        // Disarm first: a longjmp target is only valid while its frame
+        // is live, and it is about to be re-entered
+        s_testAbortArmed = false;
+        std::longjmp( s_testAbortTarget, 1 );
+    }
+
+} // end namespace Catch
+
+#endif // CATCH_CONFIG_DISABLE_EXCEPTIONS
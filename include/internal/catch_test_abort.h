@@ -0,0 +1,38 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_TEST_ABORT_H_INCLUDED
+#define TWOBLUECUBES_CATCH_TEST_ABORT_H_INCLUDED
+
+#include "catch_compiler_capabilities.h"
+
+#if defined(CATCH_CONFIG_DISABLE_EXCEPTIONS)
+
+#include <csetjmp>
+
+namespace Catch {
+
+    // Without exceptions a failing REQUIRE cannot unwind back to the
+    // runner by throwing TestFailureException, so the runner arms a
+    // longjmp landing point around each test body invocation instead:
+    // setjmp on the (thread local) buffer below before calling into user
+    // code, and the abort longjmps back. The buffer is per thread so the
+    // watchdog-supervised timeout path arms its own.
+
+    std::jmp_buf& testAbortTarget();
+
+    // The armed flag keeps aborts raised outside any test body (e.g.
+    // from a stray AssertionHandler) on the old terminate path
+    void armTestAbort();
+    void disarmTestAbort();
+    bool testAbortArmed();
+
+    [[noreturn]]
+    void abortCurrentTest();
+
+} // end namespace Catch
+
+#endif // CATCH_CONFIG_DISABLE_EXCEPTIONS
+
+#endif // TWOBLUECUBES_CATCH_TEST_ABORT_H_INCLUDED
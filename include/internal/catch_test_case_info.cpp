@@ -10,9 +10,11 @@
 #include "catch_enforce.h"
 #include "catch_test_spec.h"
 #include "catch_interfaces_testcase.h"
+#include "catch_string_intern.h"
 #include "catch_string_manip.h"
 
 #include <cctype>
+#include <cstdlib>
 #include <exception>
 #include <algorithm>
 #include <sstream>
@@ -32,13 +34,17 @@ namespace Catch {
                 return TestCaseInfo::MayFail;
             else if( tag == "!nonportable" )
                 return TestCaseInfo::NonPortable;
+            else if( tag == "!exclusive" )
+                return TestCaseInfo::Exclusive;
             else if( tag == "!benchmark" )
                 return static_cast<TestCaseInfo::SpecialProperties>( TestCaseInfo::Benchmark | TestCaseInfo::IsHidden );
             else
                 return TestCaseInfo::None;
         }
         bool isReservedTag( std::string const& tag ) {
-            return parseSpecialTag( tag ) == TestCaseInfo::None && tag.size() > 0 && !std::isalnum( static_cast<unsigned char>(tag[0]) );
+            return parseSpecialTag( tag ) == TestCaseInfo::None
+                && !startsWith( tag, "!priority=" )
+                && tag.size() > 0 && !std::isalnum( static_cast<unsigned char>(tag[0]) );
         }
         void enforceNotReservedTag( std::string const& tag, SourceLineInfo const& _lineInfo ) {
             CATCH_ENFORCE( !isReservedTag(tag),
@@ -48,6 +54,20 @@ namespace Catch {
         }
     }
 
+    std::string filenameTagFromPath( std::string const& path ) {
+        std::string filename = path;
+        auto lastSlash = filename.find_last_of("\\/");
+        if( lastSlash != std::string::npos ) {
+            filename.erase(0, lastSlash);
+            filename[0] = '#';
+        }
+        auto lastDot = filename.find_last_of('.');
+        if( lastDot != std::string::npos ) {
+            filename.erase(lastDot);
+        }
+        return filename;
+    }
+
     TestCase makeTestCase(  ITestInvoker* _testCase,
                             std::string const& _className,
                             NameAndTags const& nameAndTags,
@@ -94,14 +114,37 @@ namespace Catch {
     void setTags( TestCaseInfo& testCaseInfo, std::vector<std::string> tags ) {
         std::sort(begin(tags), end(tags));
         tags.erase(std::unique(begin(tags), end(tags)), end(tags));
+        testCaseInfo.tags.clear();
+        testCaseInfo.tags.reserve(tags.size());
         testCaseInfo.lcaseTags.clear();
+        testCaseInfo.lcaseTags.reserve(tags.size());
 
         for( auto const& tag : tags ) {
             std::string lcaseTag = toLower( tag );
             testCaseInfo.properties = static_cast<TestCaseInfo::SpecialProperties>( testCaseInfo.properties | parseSpecialTag( lcaseTag ) );
-            testCaseInfo.lcaseTags.push_back( lcaseTag );
+            if( startsWith( lcaseTag, "timeout=" ) ) {
+                char* parseEnd = nullptr;
+                auto seconds = std::strtod( lcaseTag.c_str() + 8, &parseEnd );
+                CATCH_ENFORCE( parseEnd && *parseEnd == '\0' && seconds > 0,
+                              "Invalid timeout tag: [" << tag << "]\n"
+                              << "Expected [timeout=<seconds>] with a positive number\n"
+                              << testCaseInfo.lineInfo );
+                testCaseInfo.timeoutSeconds = seconds;
+            }
+            if( startsWith( lcaseTag, "!priority=" ) ) {
+                char* parseEnd = nullptr;
+                auto tier = std::strtol( lcaseTag.c_str() + 10, &parseEnd, 10 );
+                CATCH_ENFORCE( parseEnd && *parseEnd == '\0' && tier >= 0 && tier < TestCaseInfo::unprioritisedTier,
+                              "Invalid priority tag: [" << tag << "]\n"
+                              << "Expected [!priority=<tier>] with a non-negative integer (lower tiers are scheduled first)\n"
+                              << testCaseInfo.lineInfo );
+                testCaseInfo.priorityTier = static_cast<int>( tier );
+            }
+            // Already-lowercase tags intern to the same pooled string for
+            // both vectors
+            testCaseInfo.tags.push_back( internString( tag ) );
+            testCaseInfo.lcaseTags.push_back( internString( lcaseTag ) );
         }
-        testCaseInfo.tags = std::move(tags);
     }
 
     TestCaseInfo::TestCaseInfo( std::string const& _name,
@@ -110,10 +153,14 @@ namespace Catch {
                                 std::vector<std::string> const& _tags,
                                 SourceLineInfo const& _lineInfo )
     :   name( _name ),
-        className( _className ),
+        className( internString( _className ) ),
         description( _description ),
-        lineInfo( _lineInfo ),
-        properties( None )
+        // The interned file pointer makes location comparisons against
+        // this test's sections (and other tests) pointer+line compares
+        lineInfo( internSourceFile( _lineInfo.file ), _lineInfo.line ),
+        properties( None ),
+        timeoutSeconds( 0 ),
+        priorityTier( unprioritisedTier )
     {
         setTags( *this, _tags );
     }
@@ -130,6 +177,15 @@ namespace Catch {
     bool TestCaseInfo::expectedToFail() const {
         return ( properties & (ShouldFail ) ) != 0;
     }
+    bool TestCaseInfo::exclusive() const {
+        return ( properties & Exclusive ) != 0;
+    }
+
+    StringRef TestCaseInfo::lcaseName() const {
+        if( m_lcaseName.empty() )
+            m_lcaseName = internString( toLower( name ) );
+        return m_lcaseName;
+    }
 
     std::string TestCaseInfo::tagsAsString() const {
         std::string ret;
@@ -141,7 +197,7 @@ namespace Catch {
         ret.reserve(full_size);
         for (const auto& tag : tags) {
             ret.push_back('[');
-            ret.append(tag);
+            ret += tag;
             ret.push_back(']');
         }
 
@@ -155,6 +211,7 @@ namespace Catch {
     TestCase TestCase::withName( std::string const& _newName ) const {
         TestCase other( *this );
         other.name = _newName;
+        other.m_lcaseName = StringRef();
         return other;
     }
 
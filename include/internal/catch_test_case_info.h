@@ -9,6 +9,7 @@
 #define TWOBLUECUBES_CATCH_TEST_CASE_INFO_H_INCLUDED
 
 #include "catch_common.h"
+#include "catch_stringref.h"
 #include "catch_test_registry.h"
 
 #include <string>
@@ -32,7 +33,8 @@ namespace Catch {
             MayFail = 1 << 3,
             Throws = 1 << 4,
             NonPortable = 1 << 5,
-            Benchmark = 1 << 6
+            Benchmark = 1 << 6,
+            Exclusive = 1 << 7
         };
 
         TestCaseInfo(   std::string const& _name,
@@ -47,16 +49,37 @@ namespace Catch {
         bool throws() const;
         bool okToFail() const;
         bool expectedToFail() const;
+        bool exclusive() const;
 
         std::string tagsAsString() const;
 
+        // Case-folded name for case-insensitive filtering, built on first
+        // use and pooled in the intern arena so each name is folded at
+        // most once per process however many filters probe it
+        StringRef lcaseName() const;
+
+        // Names are unique (and withName() rewrites them), so they own
+        // their storage; the class name and tags repeat heavily across
+        // test cases and are views into the shared intern pool
         std::string name;
-        std::string className;
+        StringRef className;
         std::string description;
-        std::vector<std::string> tags;
-        std::vector<std::string> lcaseTags;
+        std::vector<StringRef> tags;
+        std::vector<StringRef> lcaseTags;
         SourceLineInfo lineInfo;
         SpecialProperties properties;
+        // Budget from a [timeout=N] tag, in seconds; 0 means no per-test
+        // budget (the --timeout option, if any, applies)
+        double timeoutSeconds;
+        // Scheduling tier from a [!priority=N] tag: lower tiers are
+        // scheduled first, tests without the tag form the implicit last
+        // tier. See sortTests and --fail-fast-tier
+        int priorityTier;
+        static const int unprioritisedTier = 0x7fffffff;
+
+    protected:
+        // Lazily filled by lcaseName(); withName() resets it
+        mutable StringRef m_lcaseName;
     };
 
     class TestCase : public TestCaseInfo {
@@ -81,6 +104,11 @@ namespace Catch {
                             std::string const& className,
                             NameAndTags const& nameAndTags,
                             SourceLineInfo const& lineInfo );
+
+    // The special tag -# derives from a source path ("#stem" of the file
+    // name); shared between tag application and the registry's filename
+    // index so the two can never disagree on the spelling
+    std::string filenameTagFromPath( std::string const& path );
 }
 
 #ifdef __clang__
@@ -8,16 +8,76 @@
 #include "catch_test_case_registry_impl.h"
 
 #include "catch_context.h"
+#include "catch_duration_cache.h"
 #include "catch_enforce.h"
+#include "catch_failure_cache.h"
+#include "catch_history_store.h"
 #include "catch_interfaces_registry_hub.h"
 #include "catch_random_number_generator.h"
+#include "catch_registry_snapshot.h"
+#include "catch_string_intern.h"
 #include "catch_string_manip.h"
 #include "catch_test_case_info.h"
+#include "catch_test_dependencies.h"
+#include "catch_test_manifest.h"
 
+#include <cstdint>
 #include <sstream>
+#include <unordered_map>
+
+#if defined(CATCH_INTERNAL_SECTION_TEST_REGISTRY)
+// The linker provides these for any section with a C-identifier name; weak,
+// so a binary that registered every test dynamically (empty section) links
+extern "C" {
+    extern Catch::TestCaseDescriptor const __start_catch2_tcs[] __attribute__((weak));
+    extern Catch::TestCaseDescriptor const __stop_catch2_tcs[] __attribute__((weak));
+}
+#endif
 
 namespace Catch {
 
+namespace {
+
+    // FNV-1a hash of the test name, optionally perturbed by a seed.
+    // Implemented here rather than deferring to std::hash so that the
+    // shard a test lands in (and the randomised order it gets) is stable
+    // across platforms, standard libraries and runs of the same binary.
+    std::uint64_t stableHash( std::string const& str, std::uint64_t seed = 0 ) {
+        std::uint64_t hash = 0xcbf29ce484222325ull ^ ( seed * 0x100000001b3ull );
+        for( char c : str ) {
+            hash ^= static_cast<std::uint64_t>( static_cast<unsigned char>( c ) );
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+    double durationOf( TestDurations const& durations, TestCase const& testCase ) {
+        auto it = durations.find( testCase.name );
+        // Tests without an observed runtime get a small nominal weight, so
+        // a cold cache still spreads them over all shards
+        return it != durations.end() ? it->second : 0.001;
+    }
+
+    // Greedily assigns the (longest-first sorted) tests to the least loaded
+    // shard and keeps the slice belonging to the configured shard index.
+    // The assignment is deterministic as long as all shards were started
+    // with the same duration cache contents.
+    std::vector<TestCase> durationBalancedShard( std::vector<TestCase> const& testCases, IConfig const& config ) {
+        auto durations = loadSchedulingDurations( config );
+        std::vector<double> shardLoads( config.shardCount(), 0.0 );
+        std::vector<TestCase> shard;
+        for( auto const& testCase : testCases ) {
+            auto lightest = static_cast<unsigned int>(
+                std::min_element( shardLoads.begin(), shardLoads.end() ) - shardLoads.begin() );
+            shardLoads[lightest] += durationOf( durations, testCase );
+            if( lightest == config.shardIndex() )
+                shard.push_back( testCase );
+        }
+        return shard;
+    }
+
+} // anon namespace
+
     std::vector<TestCase> sortTests( IConfig const& config, std::vector<TestCase> const& unsortedTestCases ) {
 
         std::vector<TestCase> sorted = unsortedTestCases;
@@ -26,14 +86,118 @@ namespace Catch {
             case RunTests::InLexicographicalOrder:
                 std::sort( sorted.begin(), sorted.end() );
                 break;
-            case RunTests::InRandomOrder:
-                seedRng( config );
-                std::shuffle( sorted.begin(), sorted.end(), rng() );
+            case RunTests::InRandomOrder: {
+                // Each test's position is given by a stable hash of the seed
+                // and its name, so the order looks random yet is identical
+                // in every process started with the same seed - which lets
+                // sharded runs agree on it without any coordination. Ties
+                // fall back to declaration order via the stable sort.
+                auto const seed = static_cast<std::uint64_t>( config.rngSeed() );
+                std::stable_sort( sorted.begin(), sorted.end(),
+                    [seed]( TestCase const& lhs, TestCase const& rhs ) {
+                        return stableHash( lhs.name, seed ) < stableHash( rhs.name, seed );
+                    } );
+                break;
+            }
+            case RunTests::InDurationBalancedOrder: {
+                // Longest-first by last observed runtime: together with the
+                // dynamic dispatch of --jobs (and the balanced shard slicing
+                // in filterTests) this schedules the slow tests early, so
+                // workers and shards finish at roughly the same time
+                auto durations = loadSchedulingDurations( config );
+                std::stable_sort( sorted.begin(), sorted.end(),
+                    [&durations]( TestCase const& lhs, TestCase const& rhs ) {
+                        return durationOf( durations, lhs ) > durationOf( durations, rhs );
+                    } );
                 break;
+            }
+            case RunTests::InSourceLocalityOrder: {
+                // Tests from the same source file stay adjacent, in their
+                // declaration order, with the files themselves in order of
+                // first appearance - so the code and lazily-initialised
+                // statics a translation unit's tests share stay warm while
+                // its group runs, instead of being churned by interleaving
+                std::unordered_map<std::string, std::size_t> firstSeen;
+                firstSeen.reserve( sorted.size() );
+                for( auto const& testCase : sorted )
+                    firstSeen.emplace( testCase.lineInfo.file, firstSeen.size() );
+                std::stable_sort( sorted.begin(), sorted.end(),
+                    [&firstSeen]( TestCase const& lhs, TestCase const& rhs ) {
+                        return firstSeen[lhs.lineInfo.file] < firstSeen[rhs.lineInfo.file];
+                    } );
+                break;
+            }
             case RunTests::InDeclarationOrder:
                 // already in declaration order
                 break;
         }
+
+        // Priority tiers run lowest-first: tests tagged [!priority=N] move
+        // ahead of untagged ones, and with a --history-file the tests that
+        // failed on their last recorded run are promoted into tier 0, so
+        // the most likely reds are reached in the first seconds of the run.
+        // Promotion rewrites the tier on this (cached) copy, which keeps
+        // the tiers monotone in the final order - the fail-fast-tier check
+        // in the run loop relies on that. Within a tier the configured
+        // sort above is kept; a suite with no tags and no failure history
+        // has a single tier and is left untouched.
+        {
+            bool anyTier = std::any_of( sorted.begin(), sorted.end(),
+                []( TestCase const& testCase ) {
+                    return testCase.priorityTier != TestCaseInfo::unprioritisedTier;
+                } );
+            if( !config.historyFile().empty() ) {
+                HistoryStore history( config.historyFile(), HistoryStore::OpenMode::ReadOnly );
+                for( auto& testCase : sorted ) {
+                    auto const* past = history.find( testCase.name );
+                    if( past && past->lastFailed ) {
+                        testCase.priorityTier = 0;
+                        anyTier = true;
+                    }
+                }
+            }
+            if( anyTier )
+                std::stable_sort( sorted.begin(), sorted.end(),
+                    []( TestCase const& lhs, TestCase const& rhs ) {
+                        return lhs.priorityTier < rhs.priorityTier;
+                    } );
+        }
+
+        // With --rerun-failures, tests that failed last time move to the
+        // front - keeping their relative order, and the order of the rest,
+        // as produced by the configured sort above
+        if( !config.rerunFailuresFile().empty() ) {
+            auto failed = loadFailedTests( config.rerunFailuresFile() );
+            if( !failed.empty() ) {
+                std::stable_partition( sorted.begin(), sorted.end(),
+                    [&failed]( TestCase const& testCase ) {
+                        return failed.count( testCase.name ) > 0;
+                    } );
+                // The fronted tests are the top tier in all but name; record
+                // that so the order stays tier-monotone for --fail-fast-tier
+                for( auto& testCase : sorted ) {
+                    if( !failed.count( testCase.name ) )
+                        break;
+                    testCase.priorityTier = 0;
+                }
+            }
+        }
+
+        // Under a --max-duration budget the tail of the run may never
+        // start, so the tests most likely to carry information move to the
+        // front: those that failed last time and those with no recorded
+        // duration (never run to completion before)
+        if( config.maxDuration() > 0 ) {
+            auto failed = !config.rerunFailuresFile().empty()
+                ? loadFailedTests( config.rerunFailuresFile() ) : FailedTests();
+            auto durations = loadSchedulingDurations( config );
+            if( !failed.empty() || !durations.empty() )
+                std::stable_partition( sorted.begin(), sorted.end(),
+                    [&]( TestCase const& testCase ) {
+                        return failed.count( testCase.name ) > 0
+                            || durations.count( testCase.name ) == 0;
+                    } );
+        }
         return sorted;
     }
     bool matchTest( TestCase const& testCase, TestSpec const& testSpec, IConfig const& config ) {
@@ -41,27 +205,119 @@ namespace Catch {
     }
 
     void enforceNoDuplicateTestCases( std::vector<TestCase> const& functions ) {
-        std::set<TestCase> seenFunctions;
+        // Buckets are keyed by the (cheaply precomputed) name hash; only
+        // tests whose hashes collide ever have their names compared
+        std::unordered_map<std::uint64_t, std::vector<TestCase const*>> seenFunctions;
+        seenFunctions.reserve( functions.size() );
         for( auto const& function : functions ) {
-            auto prev = seenFunctions.insert( function );
-            CATCH_ENFORCE( prev.second,
-                    "error: TEST_CASE( \"" << function.name << "\" ) already defined.\n"
-                    << "\tFirst seen at " << prev.first->getTestCaseInfo().lineInfo << "\n"
-                    << "\tRedefined at " << function.getTestCaseInfo().lineInfo );
+            auto& bucket = seenFunctions[ stableHash( function.name ) ];
+            for( auto const* prev : bucket )
+                CATCH_ENFORCE_PARTS( prev->name != function.name,
+                        "error: TEST_CASE( \"", function.name, "\" ) already defined.\n"
+                        "\tFirst seen at ", prev->getTestCaseInfo().lineInfo.file,
+                        ":", std::to_string( prev->getTestCaseInfo().lineInfo.line ),
+                        "\n\tRedefined at ", function.getTestCaseInfo().lineInfo.file,
+                        ":", std::to_string( function.getTestCaseInfo().lineInfo.line ) );
+            bucket.push_back( &function );
         }
     }
 
     std::vector<TestCase> filterTests( std::vector<TestCase> const& testCases, TestSpec const& testSpec, IConfig const& config ) {
         std::vector<TestCase> filtered;
         filtered.reserve( testCases.size() );
-        for( auto const& testCase : testCases )
-            if( matchTest( testCase, testSpec, config ) )
-                filtered.push_back( testCase );
+        if( !config.manifestFile().empty() ) {
+            // A binary manifest selects by precomputed name hash - nothing
+            // is parsed and no name strings are compared. Like an explicit
+            // name filter, it may select hidden tests; any test specs given
+            // alongside it narrow the selection further.
+            auto manifest = loadTestManifest( config.manifestFile() );
+            for( auto const& testCase : testCases )
+                if( manifest.count( manifestNameHash( testCase.name ) ) > 0 &&
+                    ( !config.hasTestFilters() || testSpec.matches( testCase ) ) &&
+                    ( config.allowThrows() || !testCase.throws() ) )
+                    filtered.push_back( testCase );
+        }
+        else if( StringRef const* tag = testSpec.singleTag() ) {
+            // A plain tag spec is answered from the registry's inverted
+            // index - one hash lookup for the tag, then membership tests
+            // against its (name-keyed) entry instead of walking each test
+            // case's tag vector per pattern
+            auto const& tagIndex = getRegistryHub().getTestCaseRegistry().getTagIndex();
+            auto it = tagIndex.find( *tag );
+            auto const* taggedTests = it != tagIndex.end() ? &it->second.tests : nullptr;
+            // Under -#, "[#stem]" specs are answered from the filename
+            // index instead - those tags are applied to the sorted copies
+            // after registration and never reach the tag index
+            FilenameTagIndex::mapped_type const* fileTests = nullptr;
+            if( config.filenamesAsTags() && tag->size() > 1 && (*tag)[0] == '#' ) {
+                auto const& filenameIndex = getRegistryHub().getTestCaseRegistry().getFilenameTagIndex();
+                auto fileIt = filenameIndex.find( std::string( tag->currentData(), tag->size() ) );
+                if( fileIt != filenameIndex.end() )
+                    fileTests = &fileIt->second;
+            }
+            if( taggedTests || fileTests )
+                for( auto const& testCase : testCases )
+                    if( ( ( taggedTests && taggedTests->count( testCase.name ) > 0 ) ||
+                          ( fileTests && fileTests->count( testCase.name ) > 0 ) ) &&
+                        ( config.allowThrows() || !testCase.throws() ) )
+                        filtered.push_back( testCase );
+        }
+        else {
+            for( auto const& testCase : testCases )
+                if( matchTest( testCase, testSpec, config ) )
+                    filtered.push_back( testCase );
+        }
+
+        auto const& changedFiles = config.changedFiles();
+        if( !changedFiles.empty() ) {
+            // Coarse incremental selection (--changed-files): keep a test
+            // when a changed path names its declaring file or one of the
+            // files the --deps-cache records it touching. A test that
+            // never recorded dependencies selects by declaring file alone
+            auto const dependencies = loadTestDependencies( config.depsCacheFile() );
+            auto const matchesAnyChangedFile = [&changedFiles]( std::string const& file ) {
+                for( auto const& changed : changedFiles )
+                    if( dependencyPathsMatch( changed, file ) )
+                        return true;
+                return false;
+            };
+            filtered.erase( std::remove_if( filtered.begin(), filtered.end(),
+                                [&]( TestCase const& testCase ) {
+                                    if( matchesAnyChangedFile( testCase.lineInfo.file ) )
+                                        return false;
+                                    auto it = dependencies.find( testCase.name );
+                                    if( it != dependencies.end() )
+                                        for( auto const& file : it->second )
+                                            if( matchesAnyChangedFile( file ) )
+                                                return false;
+                                    return true;
+                                } ),
+                            filtered.end() );
+        }
+
+        auto const shardCount = config.shardCount();
+        if( shardCount > 1 ) {
+            if( config.runOrder() == RunTests::InDurationBalancedOrder )
+                return durationBalancedShard( filtered, config );
+
+            // Shards deterministically partition the matched set by a stable
+            // hash of the test name, so N independent processes each pick a
+            // disjoint 1/N slice without any coordination between them
+            auto const shardIndex = config.shardIndex();
+            filtered.erase( std::remove_if( filtered.begin(), filtered.end(),
+                                [=]( TestCase const& testCase ) {
+                                    return stableHash( testCase.name ) % shardCount != shardIndex;
+                                } ),
+                            filtered.end() );
+        }
         return filtered;
     }
     std::vector<TestCase> const& getAllTestCasesSorted( IConfig const& config ) {
         return getRegistryHub().getTestCaseRegistry().getAllTestsSorted( config );
     }
+    std::vector<TestCase> const& getAllTestCasesFiltered( TestSpec const& testSpec, IConfig const& config ) {
+        return getRegistryHub().getTestCaseRegistry().getAllTestsFiltered( testSpec, config );
+    }
 
     void TestRegistry::registerTest( TestCase const& testCase ) {
         std::string name = testCase.getTestCaseInfo().name;
@@ -71,22 +327,164 @@ namespace Catch {
             return registerTest( testCase.withName( rss.str() ) );
         }
         m_functions.push_back( testCase );
+
+        // Keep the inverted tag index in step as each test arrives, so tag
+        // queries and --list-tags are reads of an existing structure
+        // instead of a scan over every test's tag vector
+        auto const& testCaseInfo = m_functions.back().getTestCaseInfo();
+        for( std::size_t i = 0; i < testCaseInfo.tags.size(); ++i ) {
+            // tags and lcaseTags run in parallel (see setTags)
+            auto& entry = m_tagIndex[ testCaseInfo.lcaseTags[i] ];
+            entry.spellings.insert( testCaseInfo.tags[i] );
+            if( entry.tests.insert( testCaseInfo.name ).second && !testCaseInfo.isHidden() )
+                ++entry.visibleCount;
+        }
+        // The filename index answers -# selections without scanning; keyed
+        // lower-cased, like all tag lookups
+        m_filenameTagIndex[ toLower( filenameTagFromPath( testCaseInfo.lineInfo.file ) ) ]
+            .insert( testCaseInfo.name );
+    }
+
+    void TestRegistry::registerTest( ITestInvoker* invoker, SourceLineInfo const& lineInfo, StringRef const& classOrMethod, NameAndTags const& nameAndTags ) {
+        m_deferredTests.push_back( DeferredRegistration{ invoker, lineInfo, classOrMethod, nameAndTags } );
+    }
+
+    void TestRegistry::materialiseDeferredTests( IConfig const* config ) const {
+#if defined(CATCH_INTERNAL_SECTION_TEST_REGISTRY)
+        if( !m_sectionDescriptorsMaterialised ) {
+            m_sectionDescriptorsMaterialised = true;
+            auto self = const_cast<TestRegistry*>( this );
+            for( auto desc = __start_catch2_tcs; desc != __stop_catch2_tcs; ++desc )
+                self->registerTest( makeTestCase( makeTestInvoker( desc->testAsFunction ),
+                                                  extractClassName( desc->classOrMethod ? StringRef( desc->classOrMethod ) : StringRef() ),
+                                                  // name is null for anonymous TEST_CASE()s - registerTest
+                                                  // then names them like any other anonymous test
+                                                  NameAndTags{ desc->name ? StringRef( desc->name ) : StringRef(),
+                                                               desc->tags ? StringRef( desc->tags ) : StringRef() },
+                                                  SourceLineInfo( desc->file, desc->line ) ) );
+        }
+#endif
+        if( m_deferredTests.empty() )
+            return;
+        auto self = const_cast<TestRegistry*>( this );
+
+        std::string snapshotPath = config ? config->registrySnapshotFile() : std::string();
+        if( !snapshotPath.empty() ) {
+            // The snapshot is keyed by a digest of the raw registration
+            // inputs - all string literals, so hashing them costs one pass
+            // with no allocation - and any rebuild that changes the test
+            // set changes the digest, invalidating the file
+            RegistryDigest digest;
+            digest.add( static_cast<std::uint64_t>( m_deferredTests.size() ) );
+            for( auto const& deferred : m_deferredTests ) {
+                digest.add( deferred.nameAndTags.name );
+                digest.add( deferred.nameAndTags.tags );
+                digest.add( deferred.classOrMethod );
+                digest.add( deferred.lineInfo.file );
+                digest.add( static_cast<std::uint64_t>( deferred.lineInfo.line ) );
+            }
+
+            std::vector<RegistrySnapshotRecord> records;
+            if( loadRegistrySnapshot( snapshotPath, digest.value(), records ) &&
+                records.size() == m_deferredTests.size() ) {
+                // Records pair with the deferred invokers positionally;
+                // everything parsing would have derived - tags split out
+                // and validated, special properties, timeouts, lowered
+                // spellings - comes straight from the file
+                for( std::size_t i = 0; i < records.size(); ++i ) {
+                    auto const& record = records[i];
+                    TestCaseInfo info( record.name,
+                                       record.className,
+                                       record.description,
+                                       {},
+                                       // the pooled copy of the file name outlives the
+                                       // registry, as internSourceFile requires
+                                       SourceLineInfo( internString( record.file ).currentData(), record.line ) );
+                    info.properties = static_cast<TestCaseInfo::SpecialProperties>( record.properties );
+                    info.timeoutSeconds = record.timeoutSeconds;
+                    info.priorityTier = record.priorityTier;
+                    info.tags.reserve( record.tags.size() );
+                    info.lcaseTags.reserve( record.tags.size() );
+                    for( auto const& tag : record.tags ) {
+                        info.tags.push_back( internString( tag.first ) );
+                        info.lcaseTags.push_back( internString( tag.second ) );
+                    }
+                    self->registerTest( TestCase( m_deferredTests[i].invoker, std::move( info ) ) );
+                }
+                self->m_deferredTests.clear();
+                return;
+            }
+
+            // Missing or stale snapshot: parse as usual, then write the
+            // snapshot the next run will hit
+            auto firstMaterialised = m_functions.size();
+            for( auto const& deferred : m_deferredTests )
+                self->registerTest( makeTestCase( deferred.invoker,
+                                                  extractClassName( deferred.classOrMethod ),
+                                                  deferred.nameAndTags,
+                                                  deferred.lineInfo ) );
+            self->m_deferredTests.clear();
+            saveRegistrySnapshot( snapshotPath, digest.value(), m_functions, firstMaterialised );
+            return;
+        }
+
+        // The deferred entries reference string literals, so parsing them
+        // here sees exactly what registration at static init saw. Tag
+        // errors that used to be caught before main() now surface on the
+        // first query instead - still before any test has run.
+        for( auto const& deferred : m_deferredTests )
+            self->registerTest( makeTestCase( deferred.invoker,
+                                              extractClassName( deferred.classOrMethod ),
+                                              deferred.nameAndTags,
+                                              deferred.lineInfo ) );
+        self->m_deferredTests.clear();
     }
 
     std::vector<TestCase> const& TestRegistry::getAllTests() const {
+        materialiseDeferredTests();
         return m_functions;
     }
     std::vector<TestCase> const& TestRegistry::getAllTestsSorted( IConfig const& config ) const {
-        if( m_sortedFunctions.empty() )
+        materialiseDeferredTests( &config );
+        // Known-clean suites can opt out of the duplicate scan entirely
+        if( m_sortedFunctions.empty() && !config.skipDuplicateCheck() )
             enforceNoDuplicateTestCases( m_functions );
 
-        if(  m_currentSortOrder != config.runOrder() || m_sortedFunctions.empty() ) {
+        if(  m_currentSortOrder != config.runOrder() || m_currentRngSeed != config.rngSeed() || m_sortedFunctions.empty() ) {
             m_sortedFunctions = sortTests( config, m_functions );
             m_currentSortOrder = config.runOrder();
+            m_currentRngSeed = config.rngSeed();
         }
         return m_sortedFunctions;
     }
 
+    std::vector<TestCase> const& TestRegistry::getAllTestsFiltered( TestSpec const& testSpec, IConfig const& config ) const {
+        // Key over everything the selection depends on, so embedders that
+        // call Session::run() repeatedly in one process skip the re-sort
+        // and re-filter unless the configuration actually changed
+        ReusableStringStream keyStream;
+        keyStream << static_cast<int>( config.runOrder() ) << '|' << config.rngSeed()
+                  << '|' << config.shardCount() << '|' << config.shardIndex()
+                  << '|' << config.allowThrows() << '|' << config.manifestFile()
+                  << '|' << testSpec.specString();
+        auto key = keyStream.str();
+        if( key != m_filterCacheKey ) {
+            m_filteredFunctions = filterTests( getAllTestsSorted( config ), testSpec, config );
+            m_filterCacheKey = key;
+        }
+        return m_filteredFunctions;
+    }
+
+    TagIndex const& TestRegistry::getTagIndex() const {
+        materialiseDeferredTests();
+        return m_tagIndex;
+    }
+
+    FilenameTagIndex const& TestRegistry::getFilenameTagIndex() const {
+        materialiseDeferredTests();
+        return m_filenameTagIndex;
+    }
+
 
 
     ///////////////////////////////////////////////////////////////////////////
@@ -29,20 +29,50 @@ namespace Catch {
 
     std::vector<TestCase> filterTests( std::vector<TestCase> const& testCases, TestSpec const& testSpec, IConfig const& config );
     std::vector<TestCase> const& getAllTestCasesSorted( IConfig const& config );
+    std::vector<TestCase> const& getAllTestCasesFiltered( TestSpec const& testSpec, IConfig const& config );
 
     class TestRegistry : public ITestCaseRegistry {
     public:
         virtual ~TestRegistry() = default;
 
         virtual void registerTest( TestCase const& testCase );
+        // Defers all parsing and string allocation until the registry is
+        // first queried, so registration at static initialization stores
+        // nothing but the raw pointers and literals
+        virtual void registerTest( ITestInvoker* invoker, SourceLineInfo const& lineInfo, StringRef const& classOrMethod, NameAndTags const& nameAndTags );
 
         std::vector<TestCase> const& getAllTests() const override;
         std::vector<TestCase> const& getAllTestsSorted( IConfig const& config ) const override;
+        std::vector<TestCase> const& getAllTestsFiltered( TestSpec const& testSpec, IConfig const& config ) const override;
+        TagIndex const& getTagIndex() const override;
+        FilenameTagIndex const& getFilenameTagIndex() const override;
 
     private:
+        struct DeferredRegistration {
+            ITestInvoker* invoker;
+            SourceLineInfo lineInfo;
+            StringRef classOrMethod;
+            NameAndTags nameAndTags;
+        };
+        // Queries that have a config pass it through, which lets the
+        // deferred entries materialise from a registry snapshot when
+        // --registry-snapshot is given; config-free queries always parse
+        void materialiseDeferredTests( IConfig const* config = nullptr ) const;
+
+#if defined(CATCH_INTERNAL_SECTION_TEST_REGISTRY)
+        mutable bool m_sectionDescriptorsMaterialised = false;
+#endif
+        mutable std::vector<DeferredRegistration> m_deferredTests;
         std::vector<TestCase> m_functions;
         mutable RunTests::InWhatOrder m_currentSortOrder = RunTests::InDeclarationOrder;
+        mutable unsigned int m_currentRngSeed = 0;
         mutable std::vector<TestCase> m_sortedFunctions;
+        // Filter results survive across repeated in-process Session runs;
+        // the key covers everything the selection depends on
+        mutable std::string m_filterCacheKey;
+        mutable std::vector<TestCase> m_filteredFunctions;
+        TagIndex m_tagIndex; // maintained incrementally as tests register
+        FilenameTagIndex m_filenameTagIndex; // likewise, from each test's source path
         std::size_t m_unnamedCount = 0;
         std::ios_base::Init m_ostreamInit; // Forces cout/ cerr to be initialised
     };
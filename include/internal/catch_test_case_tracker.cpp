@@ -8,6 +8,7 @@
 #include "catch_test_case_tracker.h"
 
 #include "catch_enforce.h"
+#include "catch_string_intern.h"
 
 #include <algorithm>
 #include <cassert>
@@ -25,7 +26,10 @@ namespace TestCaseTracking {
 
     NameAndLocation::NameAndLocation( std::string const& _name, SourceLineInfo const& _location )
     :   name( _name ),
-        location( _location )
+        // Interning the file makes findChild's location comparison a
+        // pointer+line compare - both sides always hold canonical pointers,
+        // so the strcmp fallback inside SourceLineInfo never runs here
+        location( internSourceFile( _location.file ), _location.line )
     {}
 
 
@@ -37,8 +41,12 @@ namespace TestCaseTracking {
         return s_instance;
     }
 
+    void TrackerContext::setAllocationArena( Arena& arena ) {
+        m_arena = &arena;
+    }
+
     ITracker& TrackerContext::startRun() {
-        m_rootTracker = std::make_shared<SectionTracker>( NameAndLocation( "{root}", CATCH_INTERNAL_LINEINFO ), *this, nullptr );
+        m_rootTracker = makeTracker<SectionTracker>( NameAndLocation( "{root}", CATCH_INTERNAL_LINEINFO ), *this, nullptr );
         m_currentTracker = nullptr;
         m_runState = Executing;
         return *m_rootTracker;
@@ -93,19 +101,23 @@ namespace TestCaseTracking {
 
 
     void TrackerBase::addChild( ITrackerPtr const& child ) {
+        m_childrenByName[ child->nameAndLocation().name ].push_back( child );
         m_children.push_back( child );
     }
 
+    void TrackerBase::clearChildren() {
+        m_children.clear();
+        m_childrenByName.clear();
+    }
+
     ITrackerPtr TrackerBase::findChild( NameAndLocation const& nameAndLocation ) {
-        auto it = std::find_if( m_children.begin(), m_children.end(),
-            [&nameAndLocation]( ITrackerPtr const& tracker ){
-                return
-                    tracker->nameAndLocation().location == nameAndLocation.location &&
-                    tracker->nameAndLocation().name == nameAndLocation.name;
-            } );
-        return( it != m_children.end() )
-            ? *it
-            : nullptr;
+        auto it = m_childrenByName.find( nameAndLocation.name );
+        if( it == m_childrenByName.end() )
+            return nullptr;
+        for( auto const& tracker : it->second )
+            if( tracker->nameAndLocation().location == nameAndLocation.location )
+                return tracker;
+        return nullptr;
     }
     ITracker& TrackerBase::parent() {
         assert( m_parent ); // Should always be non-null except for root
@@ -202,7 +214,7 @@ namespace TestCaseTracking {
             section = std::static_pointer_cast<SectionTracker>( childTracker );
         }
         else {
-            section = std::make_shared<SectionTracker>( nameAndLocation, ctx, &currentTracker );
+            section = ctx.makeTracker<SectionTracker>( nameAndLocation, ctx, &currentTracker );
             currentTracker.addChild( section );
         }
         if( !ctx.completedCycle() )
@@ -244,7 +256,7 @@ namespace TestCaseTracking {
             tracker = std::static_pointer_cast<IndexTracker>( childTracker );
         }
         else {
-            tracker = std::make_shared<IndexTracker>( nameAndLocation, ctx, &currentTracker, size );
+            tracker = ctx.makeTracker<IndexTracker>( nameAndLocation, ctx, &currentTracker, size );
             currentTracker.addChild( tracker );
         }
 
@@ -261,7 +273,7 @@ namespace TestCaseTracking {
 
     void IndexTracker::moveNext() {
         m_index++;
-        m_children.clear();
+        clearChildren();
     }
 
     void IndexTracker::close() {
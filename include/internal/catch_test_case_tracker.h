@@ -8,10 +8,14 @@
 #ifndef TWOBLUECUBES_CATCH_TEST_CASE_TRACKER_HPP_INCLUDED
 #define TWOBLUECUBES_CATCH_TEST_CASE_TRACKER_HPP_INCLUDED
 
+#include "catch_arena.h"
 #include "catch_compiler_capabilities.h"
 #include "catch_common.h"
 
+#include <utility>
+
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <memory>
 
@@ -68,11 +72,23 @@ namespace TestCaseTracking {
         ITrackerPtr m_rootTracker;
         ITracker* m_currentTracker = nullptr;
         RunState m_runState = NotStarted;
+        Arena* m_arena = nullptr;
 
     public:
 
         static TrackerContext& instance();
 
+        // Subsequently created trackers are bump-allocated from the arena,
+        // which the owner must not reset while any tracker is alive
+        void setAllocationArena( Arena& arena );
+
+        template<typename TrackerT, typename... Args>
+        std::shared_ptr<TrackerT> makeTracker( Args&&... args ) {
+            if( m_arena )
+                return std::allocate_shared<TrackerT>( ArenaAllocator<TrackerT>( *m_arena ), std::forward<Args>(args)... );
+            return std::make_shared<TrackerT>( std::forward<Args>(args)... );
+        }
+
         ITracker& startRun();
         void endRun();
 
@@ -100,6 +116,11 @@ namespace TestCaseTracking {
         TrackerContext& m_ctx;
         ITracker* m_parent;
         Children m_children;
+        // Children hashed by name so that re-entering a test case finds
+        // each section in constant time regardless of sibling count; the
+        // (rarely more than one) same-named entries are told apart by
+        // their source location
+        std::unordered_map<std::string, Children> m_childrenByName;
         CycleState m_runState = NotStarted;
 
     public:
@@ -113,6 +134,8 @@ namespace TestCaseTracking {
 
 
         void addChild( ITrackerPtr const& child ) override;
+        // Drops all children, keeping the name lookup in sync
+        void clearChildren();
 
         ITrackerPtr findChild( NameAndLocation const& nameAndLocation ) override;
         ITracker& parent() override;
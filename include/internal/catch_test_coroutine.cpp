@@ -0,0 +1,102 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_test_coroutine.h"
+
+#if defined(CATCH_CONFIG_CXX20_COROUTINES)
+
+#include "catch_enforce.h"
+
+#include <algorithm>
+#include <new>
+#include <thread>
+
+namespace Catch {
+
+    namespace {
+        TestScheduler* currentScheduler = nullptr;
+    }
+
+    TestScheduler::TestScheduler() : m_previous( currentScheduler ) {
+        currentScheduler = this;
+    }
+    TestScheduler::~TestScheduler() {
+        currentScheduler = m_previous;
+    }
+
+    TestScheduler* TestScheduler::current() noexcept {
+        return currentScheduler;
+    }
+
+    void TestScheduler::schedule( std::coroutine_handle<> coroutine ) {
+        m_ready.push_back( coroutine );
+    }
+
+    void TestScheduler::scheduleAt( std::chrono::steady_clock::time_point wakeTime, std::coroutine_handle<> coroutine ) {
+        auto laterFirst = []( Timer const& lhs, Timer const& rhs ) { return lhs.wakeTime > rhs.wakeTime; };
+        m_timers.push_back( Timer{ wakeTime, coroutine } );
+        std::push_heap( m_timers.begin(), m_timers.end(), laterFirst );
+    }
+
+    void TestScheduler::run( TestTask& root ) {
+        root.start();
+        auto laterFirst = []( Timer const& lhs, Timer const& rhs ) { return lhs.wakeTime > rhs.wakeTime; };
+        while( !root.done() ) {
+            if( !m_ready.empty() ) {
+                auto coroutine = m_ready.front();
+                m_ready.pop_front();
+                coroutine.resume();
+            }
+            else if( !m_timers.empty() ) {
+                // Nothing is ready, so one blocking wait until the earliest
+                // deadline covers every pending sleep
+                std::pop_heap( m_timers.begin(), m_timers.end(), laterFirst );
+                auto timer = m_timers.back();
+                m_timers.pop_back();
+                std::this_thread::sleep_until( timer.wakeTime );
+                timer.coroutine.resume();
+            }
+            else {
+                CATCH_RUNTIME_ERROR( "Async test deadlocked: every coroutine is suspended and nothing is scheduled to wake one" );
+            }
+        }
+        root.await_resume(); // rethrows anything the body threw
+    }
+
+    void TestTask::start() {
+        if( m_started || !m_handle )
+            return;
+        CATCH_ENFORCE( TestScheduler::current(), "TestTask::start() can only be used inside a running async test" );
+        m_started = true;
+        TestScheduler::current()->schedule( m_handle );
+    }
+
+    void YieldAwaiter::await_suspend( std::coroutine_handle<> coroutine ) const {
+        TestScheduler::current()->schedule( coroutine );
+    }
+
+    void SleepAwaiter::await_suspend( std::coroutine_handle<> coroutine ) const {
+        TestScheduler::current()->scheduleAt( m_wakeTime, coroutine );
+    }
+
+    SleepAwaiter sleepFor( double seconds ) noexcept {
+        return SleepAwaiter{ std::chrono::steady_clock::now() +
+                             std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                 std::chrono::duration<double>( seconds ) ) };
+    }
+
+    void TestInvokerAsCoroutine::invoke() const {
+        TestScheduler scheduler;
+        auto task = m_testAsCoroutine();
+        scheduler.run( task );
+    }
+
+    auto makeTestInvoker( TestTask (*testAsCoroutine)() ) noexcept -> ITestInvoker* {
+        return new( std::nothrow ) TestInvokerAsCoroutine( testAsCoroutine );
+    }
+
+} // end namespace Catch
+
+#endif // CATCH_CONFIG_CXX20_COROUTINES
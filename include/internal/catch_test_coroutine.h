@@ -0,0 +1,192 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_TEST_COROUTINE_H_INCLUDED
+#define TWOBLUECUBES_CATCH_TEST_COROUTINE_H_INCLUDED
+
+#include "catch_compiler_capabilities.h"
+
+#if defined(CATCH_CONFIG_CXX20_COROUTINES)
+
+#include "catch_test_registry.h"
+
+#include <chrono>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <vector>
+
+namespace Catch {
+
+    // The coroutine type returned by ASYNC_TEST_CASE bodies and any child
+    // coroutines they compose. Tasks start suspended: awaiting one runs it
+    // to completion, while start() schedules it to run concurrently with
+    // its caller so the waits of several operations overlap on the one
+    // scheduler thread. Awaiting a task rethrows anything its body threw,
+    // so failed REQUIREs propagate the usual way.
+    class TestTask {
+    public:
+        struct promise_type {
+            TestTask get_return_object() {
+                return TestTask( std::coroutine_handle<promise_type>::from_promise( *this ) );
+            }
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            auto final_suspend() noexcept {
+                // Hand control straight back to an awaiting parent, or to
+                // the scheduler loop if nobody is waiting on us
+                struct ResumeContinuation {
+                    bool await_ready() const noexcept { return false; }
+                    std::coroutine_handle<> await_suspend( std::coroutine_handle<promise_type> self ) const noexcept {
+                        self.promise().m_done = true;
+                        if( self.promise().m_continuation )
+                            return self.promise().m_continuation;
+                        return std::noop_coroutine();
+                    }
+                    void await_resume() const noexcept {}
+                };
+                return ResumeContinuation{};
+            }
+            void return_void() noexcept {}
+            void unhandled_exception() { m_exception = std::current_exception(); }
+
+            std::exception_ptr m_exception;
+            std::coroutine_handle<> m_continuation;
+            bool m_done = false;
+        };
+
+        TestTask() noexcept = default;
+        explicit TestTask( std::coroutine_handle<promise_type> handle ) noexcept : m_handle( handle ) {}
+        TestTask( TestTask&& other ) noexcept : m_handle( other.m_handle ), m_started( other.m_started ) {
+            other.m_handle = nullptr;
+        }
+        TestTask& operator=( TestTask&& other ) noexcept {
+            if( this != &other ) {
+                destroy();
+                m_handle = other.m_handle;
+                m_started = other.m_started;
+                other.m_handle = nullptr;
+            }
+            return *this;
+        }
+        TestTask( TestTask const& ) = delete;
+        TestTask& operator=( TestTask const& ) = delete;
+        ~TestTask() { destroy(); }
+
+        // Schedules the task to run concurrently with its caller; awaiting
+        // it afterwards joins it. Exceptions from a task that is never
+        // awaited are not reported.
+        void start();
+
+        bool done() const noexcept { return !m_handle || m_handle.promise().m_done; }
+
+        bool await_ready() const noexcept { return done(); }
+        std::coroutine_handle<> await_suspend( std::coroutine_handle<> continuation ) noexcept {
+            m_handle.promise().m_continuation = continuation;
+            if( m_started )
+                return std::noop_coroutine(); // already running; it resumes us from its final suspend
+            m_started = true;
+            return m_handle; // symmetric transfer straight into the body
+        }
+        void await_resume() const {
+            if( m_handle && m_handle.promise().m_exception )
+                std::rethrow_exception( m_handle.promise().m_exception );
+        }
+
+    private:
+        void destroy() noexcept {
+            if( m_handle ) {
+                m_handle.destroy();
+                m_handle = nullptr;
+            }
+        }
+
+        std::coroutine_handle<promise_type> m_handle;
+        bool m_started = false;
+    };
+
+    // Single-threaded event loop driving an async test body and whatever
+    // tasks and sleeps it spawns. Ready coroutines are resumed round-robin;
+    // when only timed waits remain the loop sleeps until the earliest
+    // deadline, so dozens of overlapping waits cost one wait.
+    class TestScheduler {
+    public:
+        TestScheduler();
+        ~TestScheduler();
+        TestScheduler( TestScheduler const& ) = delete;
+        TestScheduler& operator=( TestScheduler const& ) = delete;
+
+        // The scheduler driving the currently running async test, if any
+        static TestScheduler* current() noexcept;
+
+        void schedule( std::coroutine_handle<> coroutine );
+        void scheduleAt( std::chrono::steady_clock::time_point wakeTime, std::coroutine_handle<> coroutine );
+
+        // Drives the loop until the root task completes, then rethrows
+        // anything its body threw
+        void run( TestTask& root );
+
+    private:
+        struct Timer {
+            std::chrono::steady_clock::time_point wakeTime;
+            std::coroutine_handle<> coroutine;
+        };
+
+        std::deque<std::coroutine_handle<>> m_ready;
+        std::vector<Timer> m_timers; // min-heap on wakeTime
+        TestScheduler* m_previous;
+    };
+
+    // co_await Catch::yieldExecution() - reschedules the current coroutine
+    // behind any other ready work
+    struct YieldAwaiter {
+        bool await_ready() const noexcept { return false; }
+        void await_suspend( std::coroutine_handle<> coroutine ) const;
+        void await_resume() const noexcept {}
+    };
+    inline YieldAwaiter yieldExecution() noexcept { return {}; }
+
+    // co_await Catch::sleepFor( seconds ) - suspends without blocking the
+    // scheduler, so other tasks (and their sleeps) make progress meanwhile
+    struct SleepAwaiter {
+        std::chrono::steady_clock::time_point m_wakeTime;
+        bool await_ready() const noexcept { return false; }
+        void await_suspend( std::coroutine_handle<> coroutine ) const;
+        void await_resume() const noexcept {}
+    };
+    SleepAwaiter sleepFor( double seconds ) noexcept;
+
+    // Sibling of TestInvokerAsMethod for coroutine test bodies: drives a
+    // scheduler until the body's task completes
+    class TestInvokerAsCoroutine : public ITestInvoker {
+        TestTask (*m_testAsCoroutine)();
+    public:
+        TestInvokerAsCoroutine( TestTask (*testAsCoroutine)() ) noexcept : m_testAsCoroutine( testAsCoroutine ) {}
+
+        void invoke() const override;
+    };
+
+    auto makeTestInvoker( TestTask (*testAsCoroutine)() ) noexcept -> ITestInvoker*;
+
+} // end namespace Catch
+
+#if defined(CATCH_CONFIG_DISABLE)
+    // As INTERNAL_CATCH_TESTCASE_NO_REGISTRATION: a never-instantiated
+    // function template, so no coroutine frame or body code is generated
+    #define INTERNAL_CATCH_ASYNC_TESTCASE_NO_REGISTRATION( TestName, ... ) \
+        template<typename CatchDiscardedTest> static Catch::TestTask TestName()
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+#define INTERNAL_CATCH_ASYNC_TESTCASE2( TestName, ... ) \
+    static Catch::TestTask TestName(); \
+    CATCH_INTERNAL_SUPPRESS_GLOBALS_WARNINGS \
+    namespace{ Catch::AutoReg INTERNAL_CATCH_UNIQUE_NAME( autoRegistrar )( Catch::makeTestInvoker( &TestName ), CATCH_INTERNAL_LINEINFO, Catch::StringRef(), Catch::NameAndTags{ __VA_ARGS__ } ); } /* NOLINT */ \
+    CATCH_INTERNAL_UNSUPPRESS_GLOBALS_WARNINGS \
+    static Catch::TestTask TestName()
+#define INTERNAL_CATCH_ASYNC_TESTCASE( ... ) \
+    INTERNAL_CATCH_ASYNC_TESTCASE2( INTERNAL_CATCH_UNIQUE_NAME( ____C_A_T_C_H____T_E_S_T____ ), __VA_ARGS__ )
+
+#endif // CATCH_CONFIG_CXX20_COROUTINES
+
+#endif // TWOBLUECUBES_CATCH_TEST_COROUTINE_H_INCLUDED
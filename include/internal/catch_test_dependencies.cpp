@@ -0,0 +1,69 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_test_dependencies.h"
+
+#include <fstream>
+
+namespace Catch {
+
+    namespace {
+
+        thread_local std::set<std::string>* s_dependencyRecorder = nullptr;
+
+        bool isPathSeparator( char c ) {
+            return c == '/' || c == '\\';
+        }
+
+    } // anonymous namespace
+
+    TestDependencies loadTestDependencies( std::string const& cacheFile ) {
+        TestDependencies dependencies;
+        std::ifstream f( cacheFile.c_str() );
+        std::string line;
+        while( std::getline( f, line ) ) {
+            auto tab = line.find( '\t' );
+            if( tab == std::string::npos )
+                continue;
+            dependencies[line.substr( tab + 1 )].insert( line.substr( 0, tab ) );
+        }
+        return dependencies;
+    }
+
+    void saveTestDependencies( std::string const& cacheFile, TestDependencies const& dependencies ) {
+        std::ofstream f( cacheFile.c_str() );
+        for( auto const& entry : dependencies )
+            for( auto const& file : entry.second )
+                f << file << '\t' << entry.first << '\n';
+    }
+
+    bool dependencyPathsMatch( std::string const& changedPath, std::string const& sourcePath ) {
+        auto const& shorter = changedPath.size() <= sourcePath.size() ? changedPath : sourcePath;
+        auto const& longer = changedPath.size() <= sourcePath.size() ? sourcePath : changedPath;
+        if( shorter.empty() )
+            return false;
+
+        auto const offset = longer.size() - shorter.size();
+        for( std::size_t i = 0; i < shorter.size(); ++i ) {
+            char a = shorter[i];
+            char b = longer[offset + i];
+            if( a != b && !( isPathSeparator( a ) && isPathSeparator( b ) ) )
+                return false;
+        }
+        // The suffix must start at a path component boundary -
+        // "tests.cpp" must not match "other_tests.cpp"
+        return offset == 0 || isPathSeparator( longer[offset - 1] );
+    }
+
+    void setDependencyRecorder( std::set<std::string>* recorder ) {
+        s_dependencyRecorder = recorder;
+    }
+
+    void addTestFileDependency( std::string const& filePath ) {
+        if( s_dependencyRecorder )
+            s_dependencyRecorder->insert( filePath );
+    }
+
+} // end namespace Catch
@@ -0,0 +1,44 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_TEST_DEPENDENCIES_H_INCLUDED
+#define TWOBLUECUBES_CATCH_TEST_DEPENDENCIES_H_INCLUDED
+
+#include <map>
+#include <set>
+#include <string>
+
+namespace Catch {
+
+    // Maps a test case name to the source files it reported touching.
+    // Tests record files by calling Catch::addTestFileDependency while
+    // they run; the map is persisted in the --deps-cache file and
+    // --changed-files selects against it (plus each test's declaring
+    // file, which is always known).
+    using TestDependencies = std::map<std::string, std::set<std::string>>;
+
+    // Reads a dependency cache previously written by saveTestDependencies.
+    // Returns an empty map if the file is missing or malformed.
+    TestDependencies loadTestDependencies( std::string const& cacheFile );
+
+    // Writes the dependency cache, one file per line, tab-separated from
+    // the test name
+    void saveTestDependencies( std::string const& cacheFile, TestDependencies const& dependencies );
+
+    // Whether a changed path names the given source file. Build trees,
+    // __FILE__ and VCS output rarely agree on a prefix, so the shorter
+    // path matches when it is a whole-component suffix of the longer one
+    bool dependencyPathsMatch( std::string const& changedPath, std::string const& sourcePath );
+
+    // Installs (or, with nullptr, removes) the set that
+    // Catch::addTestFileDependency records into - the RunContext points
+    // this at per-test storage around each test case
+    void setDependencyRecorder( std::set<std::string>* recorder );
+
+    // User-facing: records a file the currently running test depends on
+    void addTestFileDependency( std::string const& filePath );
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_TEST_DEPENDENCIES_H_INCLUDED
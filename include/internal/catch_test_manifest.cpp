@@ -0,0 +1,69 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_test_manifest.h"
+
+#include <cstring>
+#include <fstream>
+
+namespace Catch {
+
+    namespace {
+        // "CatchTM" plus a format version byte
+        const char manifestMagic[8] = { 'C','a','t','c','h','T','M','1' };
+
+        void writeUInt64( std::ostream& os, std::uint64_t value ) {
+            char bytes[8];
+            for( int i = 0; i < 8; ++i )
+                bytes[i] = static_cast<char>( ( value >> ( 8 * i ) ) & 0xffu );
+            os.write( bytes, 8 );
+        }
+
+        bool readUInt64( std::istream& is, std::uint64_t& value ) {
+            char bytes[8];
+            if( !is.read( bytes, 8 ) )
+                return false;
+            value = 0;
+            for( int i = 0; i < 8; ++i )
+                value |= static_cast<std::uint64_t>( static_cast<unsigned char>( bytes[i] ) ) << ( 8 * i );
+            return true;
+        }
+    }
+
+    std::uint64_t manifestNameHash( std::string const& name ) {
+        std::uint64_t hash = 0xcbf29ce484222325ull;
+        for( char c : name ) {
+            hash ^= static_cast<std::uint64_t>( static_cast<unsigned char>( c ) );
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+    TestManifest loadTestManifest( std::string const& manifestFile ) {
+        TestManifest manifest;
+        std::ifstream f( manifestFile.c_str(), std::ios::binary );
+        char magic[8];
+        if( !f.read( magic, 8 ) || std::memcmp( magic, manifestMagic, 8 ) != 0 )
+            return manifest;
+
+        std::uint64_t count;
+        if( !readUInt64( f, count ) )
+            return manifest;
+        manifest.reserve( static_cast<std::size_t>( count ) );
+        std::uint64_t hash;
+        for( std::uint64_t i = 0; i < count && readUInt64( f, hash ); ++i )
+            manifest.insert( hash );
+        return manifest;
+    }
+
+    void saveTestManifest( std::string const& manifestFile, std::vector<std::string> const& testNames ) {
+        std::ofstream f( manifestFile.c_str(), std::ios::binary );
+        f.write( manifestMagic, 8 );
+        writeUInt64( f, testNames.size() );
+        for( auto const& name : testNames )
+            writeUInt64( f, manifestNameHash( name ) );
+    }
+
+} // end namespace Catch
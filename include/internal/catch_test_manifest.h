@@ -0,0 +1,35 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_TEST_MANIFEST_H_INCLUDED
+#define TWOBLUECUBES_CATCH_TEST_MANIFEST_H_INCLUDED
+
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace Catch {
+
+    // A binary test manifest: a fixed header followed by one 64-bit name
+    // hash per test, all little-endian. Selecting tests from a manifest
+    // compares precomputed hashes, so neither side ever parses, lowers or
+    // compares test name strings.
+    using TestManifest = std::unordered_set<std::uint64_t>;
+
+    // FNV-1a over the raw name bytes. Deliberately not std::hash, so a
+    // manifest written by one binary selects the same tests in another,
+    // regardless of platform or standard library.
+    std::uint64_t manifestNameHash( std::string const& name );
+
+    // Reads a manifest previously written by saveTestManifest.
+    // Returns an empty set if the file is missing or malformed.
+    TestManifest loadTestManifest( std::string const& manifestFile );
+
+    // Writes the manifest for the given test names
+    void saveTestManifest( std::string const& manifestFile, std::vector<std::string> const& testNames );
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_TEST_MANIFEST_H_INCLUDED
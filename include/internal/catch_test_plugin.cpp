@@ -0,0 +1,63 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_test_plugin.h"
+
+#include "catch_enforce.h"
+#include "catch_interfaces_registry_hub.h"
+#include "catch_interfaces_testcase.h"
+#include "catch_platform.h"
+#include "catch_test_case_info.h"
+
+#if defined(CATCH_PLATFORM_LINUX) || defined(CATCH_PLATFORM_MAC)
+#include <dlfcn.h>
+
+namespace Catch {
+
+    std::size_t loadTestPlugin( std::string const& path ) {
+        auto const& hostRegistry = getRegistryHub().getTestCaseRegistry();
+        auto countBefore = hostRegistry.getAllTests().size();
+
+        void* handle = ::dlopen( path.c_str(), RTLD_NOW | RTLD_LOCAL );
+        CATCH_ENFORCE( handle, "Could not load test plugin: " << ::dlerror() );
+
+        // A plugin that resolved Catch's symbols against ours - e.g. one
+        // linked against a shared Catch library - registered its tests
+        // straight into our hub when its AutoReg constructors ran above.
+        // A plugin carrying its own copy of the implementation instead
+        // populated a private registry, which we fetch through the
+        // exported entry point and merge by hand.
+        using PluginRegistryFn = ITestCaseRegistry const* (*)();
+        auto pluginRegistryFn = reinterpret_cast<PluginRegistryFn>( ::dlsym( handle, "catchPluginTestRegistry" ) );
+        CATCH_ENFORCE( pluginRegistryFn, "'" << path << "' does not look like a test plugin: " << ::dlerror() );
+
+        auto const* pluginRegistry = pluginRegistryFn();
+        if( pluginRegistry != &hostRegistry )
+            for( auto const& testCase : pluginRegistry->getAllTests() )
+                getMutableRegistryHub().registerTest( testCase );
+
+        // The handle is deliberately leaked - the plugin's test invokers
+        // stay callable for the lifetime of the process
+        return hostRegistry.getAllTests().size() - countBefore;
+    }
+
+} // end namespace Catch
+
+#else // dlopen is not available
+
+namespace Catch {
+
+    std::size_t loadTestPlugin( std::string const& path ) {
+        CATCH_ENFORCE( false, "Could not load test plugin '" << path << "': test plugins are only supported on POSIX platforms" );
+        return 0;
+    }
+
+} // end namespace Catch
+
+#endif
+
+extern "C" Catch::ITestCaseRegistry const* catchPluginTestRegistry() {
+    return &Catch::getRegistryHub().getTestCaseRegistry();
+}
@@ -0,0 +1,31 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_TEST_PLUGIN_H_INCLUDED
+#define TWOBLUECUBES_CATCH_TEST_PLUGIN_H_INCLUDED
+
+#include <cstddef>
+#include <string>
+
+namespace Catch {
+
+    struct ITestCaseRegistry;
+
+    // Loads a test plugin - a shared object whose translation units use
+    // the usual TEST_CASE macros - and merges the tests it registered
+    // into this process's registry hub. Returns the number of tests the
+    // plugin contributed. The plugin must be built with the same compiler
+    // and standard library settings as the runner.
+    std::size_t loadTestPlugin( std::string const& path );
+
+} // end namespace Catch
+
+extern "C" {
+    // Exported from every image that links the Catch implementation, so a
+    // runner that dlopens a plugin can look up the plugin's own registry
+    // and merge its tests
+    Catch::ITestCaseRegistry const* catchPluginTestRegistry();
+}
+
+#endif // TWOBLUECUBES_CATCH_TEST_PLUGIN_H_INCLUDED
@@ -20,13 +20,10 @@ namespace Catch {
 
     AutoReg::AutoReg( ITestInvoker* invoker, SourceLineInfo const& lineInfo, StringRef const& classOrMethod, NameAndTags const& nameAndTags ) noexcept {
         CATCH_TRY {
-            getMutableRegistryHub()
-                    .registerTest(
-                        makeTestCase(
-                            invoker,
-                            extractClassName( classOrMethod ),
-                            nameAndTags,
-                            lineInfo));
+            // Just captures the raw literals - the registry parses them on
+            // first query, so startup cost no longer scales with the number
+            // of tests compiled in
+            getMutableRegistryHub().registerTest( invoker, lineInfo, classOrMethod, nameAndTags );
         } CATCH_CATCH_ALL {
             // Do not throw when constructing global objects, instead register the exception to be processed later
             getMutableRegistryHub().registerStartupException();
@@ -47,31 +47,76 @@ struct AutoReg : NonCopyable {
 
 } // end namespace Catch
 
+#if defined(CATCH_CONFIG_SECTION_TEST_REGISTRY) && defined(CATCH_INTERNAL_CONFIG_SECTION_TEST_REGISTRY)
+#define CATCH_INTERNAL_SECTION_TEST_REGISTRY
+#endif
+
+#if defined(CATCH_INTERNAL_SECTION_TEST_REGISTRY)
+
+namespace Catch {
+
+    // One of these is emitted per TEST_CASE into the catch2_tcs linker
+    // section as constant data - no dynamic initializer runs for it, and
+    // the linker concatenates them into one contiguous descriptor array
+    // that the registry walks on its first query
+    struct TestCaseDescriptor {
+        void (*testAsFunction)();
+        char const* classOrMethod;
+        char const* file;
+        std::size_t line;
+        char const* name;
+        char const* tags;
+    };
+
+} // end namespace Catch
+
+// The explicit aligned() pins each descriptor to the struct's natural
+// alignment - without it the compiler may over-align individual globals
+// (e.g. to 32 bytes), which would desync walking the section as an array
+#define CATCH_INTERNAL_SECTION_DESCRIPTOR_ATTRS \
+    __attribute__((section("catch2_tcs"), used, aligned(__alignof__(Catch::TestCaseDescriptor))))
+
+#endif // CATCH_INTERNAL_SECTION_TEST_REGISTRY
+
 #define INTERNAL_CATCH_EXPAND1(param) INTERNAL_CATCH_EXPAND2(param)
 #define INTERNAL_CATCH_EXPAND2(...) INTERNAL_CATCH_NO## __VA_ARGS__
 #define INTERNAL_CATCH_DEF(...) INTERNAL_CATCH_DEF __VA_ARGS__
 #define INTERNAL_CATCH_NOINTERNAL_CATCH_DEF
 
 #if defined(CATCH_CONFIG_DISABLE)
+    // Disabled test bodies become never-instantiated function templates:
+    // the body is still parsed, so it cannot silently rot, but no code is
+    // ever generated for it and nothing it references is instantiated or
+    // odr-used - the whole test compiles to literally nothing
     #define INTERNAL_CATCH_TESTCASE_NO_REGISTRATION( TestName, ... ) \
-        static void TestName()
+        template<typename CatchDiscardedTest> static void TestName()
     #define INTERNAL_CATCH_TESTCASE_METHOD_NO_REGISTRATION( TestName, ClassName, ... ) \
         namespace{                        \
             struct TestName : INTERNAL_CATCH_EXPAND1(INTERNAL_CATCH_DEF ClassName) { \
-                void test();              \
+                template<typename CatchDiscardedTest> void test(); \
             };                            \
         }                                 \
+        template<typename CatchDiscardedTest> \
         void TestName::test()
 
 #endif
 
     ///////////////////////////////////////////////////////////////////////////////
+#if defined(CATCH_INTERNAL_SECTION_TEST_REGISTRY)
+    #define INTERNAL_CATCH_TESTCASE2( TestName, ... ) \
+        static void TestName(); \
+        CATCH_INTERNAL_SUPPRESS_GLOBALS_WARNINGS \
+        namespace{ constexpr Catch::TestCaseDescriptor INTERNAL_CATCH_UNIQUE_NAME( catchDescriptor ) CATCH_INTERNAL_SECTION_DESCRIPTOR_ATTRS = { &TestName, nullptr, __FILE__, static_cast<std::size_t>( __LINE__ ), __VA_ARGS__ }; } /* NOLINT */ \
+        CATCH_INTERNAL_UNSUPPRESS_GLOBALS_WARNINGS \
+        static void TestName()
+#else
     #define INTERNAL_CATCH_TESTCASE2( TestName, ... ) \
         static void TestName(); \
         CATCH_INTERNAL_SUPPRESS_GLOBALS_WARNINGS \
         namespace{ Catch::AutoReg INTERNAL_CATCH_UNIQUE_NAME( autoRegistrar )( Catch::makeTestInvoker( &TestName ), CATCH_INTERNAL_LINEINFO, Catch::StringRef(), Catch::NameAndTags{ __VA_ARGS__ } ); } /* NOLINT */ \
         CATCH_INTERNAL_UNSUPPRESS_GLOBALS_WARNINGS \
         static void TestName()
+#endif
     #define INTERNAL_CATCH_TESTCASE( ... ) \
         INTERNAL_CATCH_TESTCASE2( INTERNAL_CATCH_UNIQUE_NAME( ____C_A_T_C_H____T_E_S_T____ ), __VA_ARGS__ )
 
@@ -82,6 +127,19 @@ struct AutoReg : NonCopyable {
         CATCH_INTERNAL_UNSUPPRESS_GLOBALS_WARNINGS
 
     ///////////////////////////////////////////////////////////////////////////////
+#if defined(CATCH_INTERNAL_SECTION_TEST_REGISTRY)
+    #define INTERNAL_CATCH_TEST_CASE_METHOD2( TestName, ClassName, ... )\
+        CATCH_INTERNAL_SUPPRESS_GLOBALS_WARNINGS \
+        namespace{ \
+            struct TestName : INTERNAL_CATCH_EXPAND1(INTERNAL_CATCH_DEF ClassName) { \
+                void test(); \
+            }; \
+            static void INTERNAL_CATCH_UNIQUE_NAME_LINE( TestName, _invoke )() { TestName obj; obj.test(); } \
+            constexpr Catch::TestCaseDescriptor INTERNAL_CATCH_UNIQUE_NAME_LINE( TestName, _descriptor ) CATCH_INTERNAL_SECTION_DESCRIPTOR_ATTRS = { &INTERNAL_CATCH_UNIQUE_NAME_LINE( TestName, _invoke ), #ClassName, __FILE__, static_cast<std::size_t>( __LINE__ ), __VA_ARGS__ }; /* NOLINT */ \
+        } \
+        CATCH_INTERNAL_UNSUPPRESS_GLOBALS_WARNINGS \
+        void TestName::test()
+#else
     #define INTERNAL_CATCH_TEST_CASE_METHOD2( TestName, ClassName, ... )\
         CATCH_INTERNAL_SUPPRESS_GLOBALS_WARNINGS \
         namespace{ \
@@ -92,6 +150,7 @@ struct AutoReg : NonCopyable {
         } \
         CATCH_INTERNAL_UNSUPPRESS_GLOBALS_WARNINGS \
         void TestName::test()
+#endif
     #define INTERNAL_CATCH_TEST_CASE_METHOD( ClassName, ... ) \
         INTERNAL_CATCH_TEST_CASE_METHOD2( INTERNAL_CATCH_UNIQUE_NAME( ____C_A_T_C_H____T_E_S_T____ ), ClassName, __VA_ARGS__ )
 
@@ -6,9 +6,11 @@
  */
 
 #include "catch_test_spec.h"
+#include "catch_string_intern.h"
 #include "catch_string_manip.h"
 
 #include <algorithm>
+#include <cctype>
 #include <string>
 #include <vector>
 #include <memory>
@@ -20,14 +22,30 @@ namespace Catch {
     TestSpec::TagPattern::~TagPattern() = default;
     TestSpec::ExcludedPattern::~ExcludedPattern() = default;
 
+    StringRef const* TestSpec::Pattern::singleTag() const {
+        return nullptr;
+    }
+    std::string const* TestSpec::Pattern::literalName() const {
+        return nullptr;
+    }
+    std::string const* TestSpec::NamePattern::literalName() const {
+        return m_wildcardPattern.literalPattern();
+    }
+    StringRef const* TestSpec::TagPattern::singleTag() const {
+        return &m_tag;
+    }
+
     TestSpec::NamePattern::NamePattern( std::string const& name )
-    : m_wildcardPattern( toLower( name ), CaseSensitive::No )
+    // The pattern is folded once here and candidates supply their cached
+    // lower-cased name, so the comparison itself is case-sensitive and
+    // skips the per-character tolower the old in-place folding paid
+    : m_wildcardPattern( toLower( name ), CaseSensitive::Yes )
     {}
     bool TestSpec::NamePattern::matches( TestCaseInfo const& testCase ) const {
-        return m_wildcardPattern.matches( toLower( testCase.name ) );
+        return m_wildcardPattern.matches( testCase.lcaseName() );
     }
 
-    TestSpec::TagPattern::TagPattern( std::string const& tag ) : m_tag( toLower( tag ) ) {}
+    TestSpec::TagPattern::TagPattern( std::string const& tag ) : m_tag( internString( toLower( tag ) ) ) {}
     bool TestSpec::TagPattern::matches( TestCaseInfo const& testCase ) const {
         return std::find(begin(testCase.lcaseTags),
                          end(testCase.lcaseTags),
@@ -46,14 +64,61 @@ namespace Catch {
         return true;
     }
 
+    std::size_t TestSpec::FoldedNameHash::operator()( std::string const& s ) const {
+        // FNV-1a over the case-folded characters, matching FoldedNameEquals
+        std::size_t hash = 0x811c9dc5u;
+        for( char c : s ) {
+            hash ^= static_cast<std::size_t>(
+                static_cast<unsigned char>( std::tolower( static_cast<unsigned char>( c ) ) ) );
+            hash *= 0x01000193u;
+        }
+        return hash;
+    }
+    bool TestSpec::FoldedNameEquals::operator()( std::string const& lhs, std::string const& rhs ) const {
+        return lhs.size() == rhs.size() &&
+            std::equal( lhs.begin(), lhs.end(), rhs.begin(),
+                []( char l, char r ) {
+                    return std::tolower( static_cast<unsigned char>( l ) ) ==
+                           std::tolower( static_cast<unsigned char>( r ) );
+                } );
+    }
+
+    void TestSpec::prepare() const {
+        for( std::size_t i = 0; i < m_filters.size(); ++i ) {
+            std::string const* name = m_filters[i].m_patterns.size() == 1
+                ? m_filters[i].m_patterns[0]->literalName()
+                : nullptr;
+            if( name )
+                m_literalNames.insert( *name );
+            else
+                m_generalFilters.push_back( i );
+        }
+        m_prepared = true;
+    }
+
     bool TestSpec::hasFilters() const {
         return !m_filters.empty();
     }
     bool TestSpec::matches( TestCaseInfo const& testCase ) const {
-        // A TestSpec matches if any filter matches
-        for( auto const& filter : m_filters )
-            if( filter.matches( testCase ) )
+        if( !m_prepared )
+            prepare();
+        // A TestSpec matches if any filter matches; filters that are plain
+        // test names were collapsed into a single hash set by prepare()
+        if( !m_literalNames.empty() && m_literalNames.count( testCase.name ) > 0 )
+            return true;
+        for( auto filterIndex : m_generalFilters )
+            if( m_filters[filterIndex].matches( testCase ) )
                 return true;
         return false;
     }
+
+    std::string const& TestSpec::specString() const {
+        return m_specString;
+    }
+
+    StringRef const* TestSpec::singleTag() const {
+        if( m_filters.size() != 1 || m_filters[0].m_patterns.size() != 1 )
+            return nullptr;
+        return m_filters[0].m_patterns[0]->singleTag();
+    }
 }
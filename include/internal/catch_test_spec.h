@@ -19,6 +19,7 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <unordered_set>
 
 namespace Catch {
 
@@ -26,6 +27,12 @@ namespace Catch {
         struct Pattern {
             virtual ~Pattern();
             virtual bool matches( TestCaseInfo const& testCase ) const = 0;
+            // The lower-cased tag if this pattern matches exactly one,
+            // non-negated tag; nullptr for all other pattern kinds
+            virtual StringRef const* singleTag() const;
+            // The lower-cased name if this pattern matches exactly one,
+            // non-negated, wildcard-free test name; nullptr otherwise
+            virtual std::string const* literalName() const;
         };
         using PatternPtr = std::shared_ptr<Pattern>;
 
@@ -34,6 +41,7 @@ namespace Catch {
             NamePattern( std::string const& name );
             virtual ~NamePattern();
             virtual bool matches( TestCaseInfo const& testCase ) const override;
+            virtual std::string const* literalName() const override;
         private:
             WildcardPattern m_wildcardPattern;
         };
@@ -43,8 +51,11 @@ namespace Catch {
             TagPattern( std::string const& tag );
             virtual ~TagPattern();
             virtual bool matches( TestCaseInfo const& testCase ) const override;
+            virtual StringRef const* singleTag() const override;
         private:
-            std::string m_tag;
+            // Interned, so comparisons against a test's (equally interned)
+            // lcaseTags are pointer-and-size compares over pooled storage
+            StringRef m_tag;
         };
 
         class ExcludedPattern : public Pattern {
@@ -66,8 +77,37 @@ namespace Catch {
         bool hasFilters() const;
         bool matches( TestCaseInfo const& testCase ) const;
 
+        // If the whole spec reduces to a single, non-negated tag, returns
+        // that (lower-cased, interned) tag so the selection can be answered
+        // from the registry's tag index; nullptr otherwise
+        StringRef const* singleTag() const;
+
+        // The arguments this spec was parsed from, joined up - two specs
+        // with equal strings select the same tests, which the registry
+        // relies on for its filter cache
+        std::string const& specString() const;
+
     private:
+        // Case-folded hashing and comparison, so registry names can be
+        // looked up without building a lowered copy per candidate
+        struct FoldedNameHash {
+            std::size_t operator()( std::string const& s ) const;
+        };
+        struct FoldedNameEquals {
+            bool operator()( std::string const& lhs, std::string const& rhs ) const;
+        };
+
+        // Filters that are a single wildcard-free name pattern - the common
+        // shape of a -f manifest with thousands of lines - are collapsed
+        // into one hash set, so matching a candidate costs a single lookup
+        // instead of a wildcard scan per filter. Built on first use.
+        void prepare() const;
+
         std::vector<Filter> m_filters;
+        std::string m_specString;
+        mutable std::unordered_set<std::string, FoldedNameHash, FoldedNameEquals> m_literalNames;
+        mutable std::vector<std::size_t> m_generalFilters; // indices into m_filters
+        mutable bool m_prepared = false;
 
         friend class TestSpecParser;
     };
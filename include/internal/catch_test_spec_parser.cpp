@@ -6,21 +6,51 @@
  */
 
 #include "catch_test_spec_parser.h"
+#include "catch_tag_alias.h"
 
 namespace Catch {
 
+    namespace {
+        // One classification byte per character, with a bit per scanner
+        // mode marking the characters that end that mode's token. The
+        // scanner advances through a token with one table lookup per
+        // character, so parse time stays linear even for the multi-
+        // kilobyte comma-joined specs orchestrators generate.
+        enum CharClass : unsigned char {
+            EndsName  = 0x01,   // ',' '[' '\\'
+            EndsQuote = 0x02,   // '"'
+            EndsTag   = 0x04    // ']'
+        };
+        struct SpecCharTable {
+            unsigned char bits[256];
+            SpecCharTable() : bits() {
+                bits[static_cast<unsigned char>(',')]  |= EndsName;
+                bits[static_cast<unsigned char>('[')]  |= EndsName;
+                bits[static_cast<unsigned char>('\\')] |= EndsName;
+                bits[static_cast<unsigned char>('"')]  |= EndsQuote;
+                bits[static_cast<unsigned char>(']')]  |= EndsTag;
+            }
+        };
+        SpecCharTable const specCharTable;
+
+        std::size_t scanToken( std::string const& arg, std::size_t pos, unsigned char endBit ) {
+            while( pos < arg.size() && !( specCharTable.bits[static_cast<unsigned char>( arg[pos] )] & endBit ) )
+                ++pos;
+            return pos;
+        }
+    }
+
     TestSpecParser::TestSpecParser( ITagAliasRegistry const& tagAliases ) : m_tagAliases( &tagAliases ) {}
 
     TestSpecParser& TestSpecParser::parse( std::string const& arg ) {
         m_mode = None;
         m_exclusion = false;
         m_start = std::string::npos;
-        m_arg = m_tagAliases->expandAliases( arg );
+        m_arg = arg;
+        m_testSpec.m_specString += m_arg;
+        m_testSpec.m_specString += ',';
         m_escapeChars.clear();
-        for( m_pos = 0; m_pos < m_arg.size(); ++m_pos )
-            visitChar( m_arg[m_pos] );
-        if( m_mode == Name )
-            addPattern<TestSpec::NamePattern>();
+        scan();
         return *this;
     }
     TestSpec TestSpecParser::testSpec() {
@@ -28,38 +58,106 @@ namespace Catch {
         return m_testSpec;
     }
 
-    void TestSpecParser::visitChar( char c ) {
-        if( m_mode == None ) {
-            switch( c ) {
-            case ' ': return;
-            case '~': m_exclusion = true; return;
-            case '[': return startNewMode( Tag, ++m_pos );
-            case '"': return startNewMode( QuotedName, ++m_pos );
-            case '\\': return escape();
-            default: startNewMode( Name, m_pos ); break;
-            }
-        }
-        if( m_mode == Name ) {
-            if( c == ',' ) {
-                addPattern<TestSpec::NamePattern>();
-                addFilter();
-            }
-            else if( c == '[' ) {
-                if( subString() == "exclude:" )
-                    m_exclusion = true;
-                else
+    // Tokenizes m_arg. Tokens are tracked as [m_start, m_pos) slices of
+    // m_arg and only copied once, when a pattern is made from them; the
+    // recorded escape positions are fixed up in a single pass there.
+    void TestSpecParser::scan() {
+        std::size_t const size = m_arg.size();
+        m_pos = 0;
+        while( m_pos < size ) {
+            char const c = m_arg[m_pos];
+            switch( m_mode ) {
+            case None:
+                switch( c ) {
+                case ' ':  ++m_pos; break;
+                case '~':  m_exclusion = true; ++m_pos; break;
+                case '[':  startNewMode( Tag, m_pos + 1 ); m_pos += 2; break;
+                case '"':  startNewMode( QuotedName, m_pos + 1 ); m_pos += 2; break;
+                case '\\': escape(); ++m_pos; break;
+                default:   startNewMode( Name, m_pos ); break;
+                }
+                break;
+
+            case Name:
+                m_pos = scanToken( m_arg, m_pos, EndsName );
+                if( m_pos == size )
+                    break;
+                if( m_arg[m_pos] == ',' ) {
                     addPattern<TestSpec::NamePattern>();
-                startNewMode( Tag, ++m_pos );
+                    addFilter();
+                    ++m_pos;
+                }
+                else if( m_arg[m_pos] == '[' ) {
+                    if( subString() == "exclude:" )
+                        m_exclusion = true;
+                    else
+                        addPattern<TestSpec::NamePattern>();
+                    startNewMode( Tag, m_pos + 1 );
+                    m_pos += 2;
+                }
+                else { // '\\'
+                    escape();
+                    ++m_pos;
+                }
+                break;
+
+            case EscapedName:
+                m_mode = Name;
+                ++m_pos;
+                break;
+
+            case QuotedName:
+                m_pos = scanToken( m_arg, m_pos, EndsQuote );
+                if( m_pos < size ) {
+                    addPattern<TestSpec::NamePattern>();
+                    ++m_pos;
+                }
+                break;
+
+            case Tag:
+                m_pos = scanToken( m_arg, m_pos, EndsTag );
+                if( m_pos < size ) {
+                    if( !expandTagAlias() )
+                        addPattern<TestSpec::TagPattern>();
+                    ++m_pos;
+                }
+                break;
             }
-            else if( c == '\\' )
-                escape();
         }
-        else if( m_mode == EscapedName )
-            m_mode = Name;
-        else if( m_mode == QuotedName && c == '"' )
+        if( m_mode == Name ) {
+            m_pos = size;
             addPattern<TestSpec::NamePattern>();
-        else if( m_mode == Tag && c == ']' )
-            addPattern<TestSpec::TagPattern>();
+        }
+    }
+    // If the just-closed tag token is a registered alias, tokenizes its
+    // expansion in place of the token. One registry lookup per [@...]
+    // token, instead of a find/splice pass over the whole spec per
+    // registered alias - parsing cost no longer scales with how many
+    // aliases the binary registers.
+    bool TestSpecParser::expandTagAlias() {
+        if( m_inAliasExpansion || m_pos == m_start || m_arg[m_start] != '@' )
+            return false;
+        TagAlias const* alias = m_tagAliases->find( '[' + subString() + ']' );
+        if( !alias )
+            return false;
+
+        // A pending exclusion is left set so the expansion's first
+        // pattern consumes it, as it did when the alias text was spliced
+        // into the spec string ahead of tokenization
+        m_inAliasExpansion = true;
+        m_mode = None;
+        std::string outerArg;
+        outerArg.swap( m_arg );
+        std::size_t outerPos = m_pos;
+
+        m_arg = alias->tag;
+        scan();
+
+        m_arg.swap( outerArg );
+        m_pos = outerPos;
+        m_mode = None;
+        m_inAliasExpansion = false;
+        return true;
     }
     void TestSpecParser::startNewMode( Mode mode, std::size_t start ) {
         m_mode = mode;
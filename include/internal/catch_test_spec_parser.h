@@ -23,6 +23,9 @@ namespace Catch {
         enum Mode{ None, Name, QuotedName, Tag, EscapedName };
         Mode m_mode = None;
         bool m_exclusion = false;
+        // Aliases expand one level deep - an alias inside an expansion is
+        // kept as a literal tag, which also rules out expansion cycles
+        bool m_inAliasExpansion = false;
         std::size_t m_start = std::string::npos, m_pos = 0;
         std::string m_arg;
         std::vector<std::size_t> m_escapeChars;
@@ -37,17 +40,29 @@ namespace Catch {
         TestSpec testSpec();
 
     private:
-        void visitChar( char c );
+        void scan();
+        bool expandTagAlias();
         void startNewMode( Mode mode, std::size_t start );
         void escape();
         std::string subString() const;
 
         template<typename T>
         void addPattern() {
-            std::string token = subString();
-            for( std::size_t i = 0; i < m_escapeChars.size(); ++i )
-                token = token.substr( 0, m_escapeChars[i]-m_start-i ) + token.substr( m_escapeChars[i]-m_start-i+1 );
-            m_escapeChars.clear();
+            std::string token;
+            if( m_escapeChars.empty() )
+                token = subString();
+            else {
+                // Single fixup pass: copy the spans between the recorded
+                // backslashes, dropping each backslash itself
+                token.reserve( m_pos - m_start - m_escapeChars.size() );
+                std::size_t from = m_start;
+                for( auto escapePos : m_escapeChars ) {
+                    token.append( m_arg, from, escapePos - from );
+                    from = escapePos + 1;
+                }
+                token.append( m_arg, from, m_pos - from );
+                m_escapeChars.clear();
+            }
             if( startsWith( token, "exclude:" ) ) {
                 m_exclusion = true;
                 token = token.substr( 8 );
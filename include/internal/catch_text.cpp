@@ -0,0 +1,117 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+// catch_clara.h (pulled in via catch_text.h) needs the console width
+#include "catch_config.hpp"
+
+#include "catch_text.h"
+
+#include <cassert>
+#include <ostream>
+
+namespace Catch {
+
+    namespace {
+
+        // Same character classes as TextFlow, but as switches rather than
+        // std::string::find over a static std::string per character
+        bool isWrapWhitespace( char c ) {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+        }
+        bool isWrapBreakableBefore( char c ) {
+            switch( c ) {
+                case '[': case '(': case '{': case '<': case '|':
+                    return true;
+                default:
+                    return false;
+            }
+        }
+        bool isWrapBreakableAfter( char c ) {
+            switch( c ) {
+                case ']': case ')': case '}': case '>':
+                case '.': case ',': case ':': case ';':
+                case '*': case '+': case '-': case '=':
+                case '&': case '/': case '\\':
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        void writeSpaces( std::ostream& os, std::size_t count ) {
+            static const char spaces[] = "                ";
+            while( count > 0 ) {
+                auto chunk = count < sizeof(spaces)-1 ? count : sizeof(spaces)-1;
+                os.write( spaces, static_cast<std::streamsize>( chunk ) );
+                count -= chunk;
+            }
+        }
+
+    } // anon namespace
+
+    void printWrapped( std::ostream& os, StringRef text, std::size_t width, std::size_t indent ) {
+        assert( width > indent );
+
+        char const* chars = text.currentData();
+        std::size_t size = text.size();
+        std::size_t avail = width - indent;
+
+        std::size_t pos = 0;
+        bool first = true;
+        while( pos < size ) {
+            // The segment runs to the next hard line break, or the end
+            std::size_t end = pos;
+            while( end < size && chars[end] != '\n' )
+                ++end;
+
+            std::size_t len;
+            bool hyphenate = false;
+            if( end < pos + avail ) {
+                len = end - pos;
+            }
+            else {
+                // Back up from the width limit to the last break
+                // opportunity - Column::iterator::isBoundary()'s rules
+                len = avail;
+                while( len > 0 &&
+                        !( pos + len == size ||
+                           ( isWrapWhitespace( chars[pos + len] ) && !isWrapWhitespace( chars[pos + len - 1] ) ) ||
+                           isWrapBreakableBefore( chars[pos + len] ) ||
+                           isWrapBreakableAfter( chars[pos + len - 1] ) ) )
+                    --len;
+                while( len > 0 && isWrapWhitespace( chars[pos + len - 1] ) )
+                    --len;
+                if( len == 0 ) {
+                    hyphenate = true;
+                    len = avail - 1;
+                }
+            }
+
+            if( first && len == 0 )
+                return; // Column treats a leading empty line as an empty column
+
+            // Column prints the whole segment when it overruns the wrap
+            // point by no more than the indent - kept bug-for-bug so the
+            // two produce identical output
+            std::size_t emitLen = pos + width < end ? len : end - pos;
+
+            if( !first )
+                os << '\n';
+            first = false;
+            writeSpaces( os, indent );
+            os.write( chars + pos, static_cast<std::streamsize>( emitLen ) );
+            if( hyphenate )
+                os << '-';
+
+            pos += len;
+            if( pos < size && chars[pos] == '\n' )
+                ++pos;
+            else
+                while( pos < size && isWrapWhitespace( chars[pos] ) )
+                    ++pos;
+        }
+    }
+
+} // namespace Catch
@@ -9,9 +9,21 @@
 #define TWOBLUECUBES_CATCH_TEXT_H_INCLUDED
 
 #include "catch_clara.h"
+#include "catch_stringref.h"
+
+#include <iosfwd>
 
 namespace Catch {
     using namespace clara::TextFlow;
+
+    // Single-pass alternative to TextFlow::Column for the reporters' hot
+    // paths. Wraps text to width, prefixes each line with indent spaces,
+    // and writes every line to the stream as one slice of the original
+    // text - no per-line substrings or intermediate strings - so the cost
+    // is linear in the message size. Break rules (and line content) match
+    // Column exactly, it just never copies.
+    // Like Column, does not write a trailing newline.
+    void printWrapped( std::ostream& os, StringRef text, std::size_t width, std::size_t indent );
 }
 
 #endif // TWOBLUECUBES_CATCH_TEXT_H_INCLUDED
@@ -0,0 +1,323 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_text_diff.h"
+
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+namespace Catch {
+
+    namespace {
+
+        // Bounds on both the search and the report. A diff that needs more
+        // than maxEditDistance line edits, or sides of more than
+        // maxDiffableLines lines, is summarised from its first difference
+        // instead of searched in full.
+        const std::size_t contextLines = 2;
+        const std::size_t maxReportLines = 48;
+        const std::size_t maxRenderedLineLength = 120;
+        const std::ptrdiff_t maxEditDistance = 64;
+        const std::size_t maxDiffableLines = 20000;
+        const std::size_t charWindowBefore = 20;
+        const std::size_t charWindowLength = 60;
+
+        struct LineSpan {
+            std::size_t begin, end; // [begin, end) into the text, terminator excluded
+        };
+
+        auto splitLines( std::string const& text ) -> std::vector<LineSpan> {
+            std::vector<LineSpan> lines;
+            std::size_t start = 0;
+            for( std::size_t pos = 0; pos < text.size(); ++pos ) {
+                if( text[pos] == '\n' ) {
+                    lines.push_back( LineSpan{ start, pos } );
+                    start = pos + 1;
+                }
+            }
+            if( start < text.size() )
+                lines.push_back( LineSpan{ start, text.size() } );
+            return lines;
+        }
+
+        auto sameLine( std::string const& a, LineSpan la, std::string const& b, LineSpan lb ) -> bool {
+            return la.end - la.begin == lb.end - lb.begin &&
+                   a.compare( la.begin, la.end - la.begin, b, lb.begin, lb.end - lb.begin ) == 0;
+        }
+
+        // ' ' context, '-' only in lhs, '+' only in rhs. Positions are the
+        // 0-based line numbers each side stood at before the edit, so hunk
+        // headers can report where in the full texts a hunk sits.
+        struct DiffOp {
+            char marker;
+            std::size_t lhsLine, rhsLine;
+        };
+
+        // Caps the number of emitted lines and the length of each
+        class DiffWriter {
+            std::ostream& m_os;
+            std::size_t m_linesWritten = 0;
+            bool m_capped = false;
+        public:
+            explicit DiffWriter( std::ostream& os ) : m_os( os ) {}
+
+            auto capped() const -> bool { return m_capped; }
+
+            void writeHeader( std::size_t lhsLine, std::size_t rhsLine ) {
+                if( m_capped )
+                    return;
+                m_os << "@@ lhs line " << lhsLine + 1 << ", rhs line " << rhsLine + 1 << " @@\n";
+            }
+
+            void writeLine( char marker, std::string const& text, LineSpan span ) {
+                if( m_capped )
+                    return;
+                if( m_linesWritten == maxReportLines ) {
+                    m_os << "... (diff output capped)\n";
+                    m_capped = true;
+                    return;
+                }
+                m_os << marker << ' ';
+                auto size = span.end - span.begin;
+                if( size > maxRenderedLineLength ) {
+                    m_os.write( text.data() + span.begin, static_cast<std::streamsize>( maxRenderedLineLength ) );
+                    m_os << "...";
+                }
+                else {
+                    m_os.write( text.data() + span.begin, static_cast<std::streamsize>( size ) );
+                }
+                m_os << '\n';
+                ++m_linesWritten;
+            }
+        };
+
+        // Greedy Myers search over the trimmed middles, abandoned once the
+        // edit distance exceeds maxEditDistance so a wildly different pair
+        // of texts cannot cost more than O((N+M) * maxEditDistance).
+        // Returns false when abandoned; on success ops holds the edit
+        // script with line numbers made absolute via the offsets.
+        auto myersDiff( std::string const& lhsText, std::vector<LineSpan> const& a, std::size_t aOffset, std::size_t aCount,
+                        std::string const& rhsText, std::vector<LineSpan> const& b, std::size_t bOffset, std::size_t bCount,
+                        std::vector<DiffOp>& ops ) -> bool {
+            auto n = static_cast<std::ptrdiff_t>( aCount );
+            auto m = static_cast<std::ptrdiff_t>( bCount );
+            auto maxD = maxEditDistance;
+            if( n + m < maxD )
+                maxD = n + m;
+
+            std::vector<std::ptrdiff_t> v( 2 * static_cast<std::size_t>( maxD ) + 1, 0 );
+            std::vector<std::vector<std::ptrdiff_t>> trace;
+            std::ptrdiff_t reachedD = -1;
+            for( std::ptrdiff_t d = 0; d <= maxD && reachedD < 0; ++d ) {
+                trace.push_back( v );
+                for( std::ptrdiff_t k = -d; k <= d; k += 2 ) {
+                    std::ptrdiff_t x;
+                    if( k == -d || ( k != d && v[maxD + k - 1] < v[maxD + k + 1] ) )
+                        x = v[maxD + k + 1];
+                    else
+                        x = v[maxD + k - 1] + 1;
+                    auto y = x - k;
+                    while( x < n && y < m &&
+                           sameLine( lhsText, a[aOffset + static_cast<std::size_t>( x )],
+                                     rhsText, b[bOffset + static_cast<std::size_t>( y )] ) ) {
+                        ++x;
+                        ++y;
+                    }
+                    v[maxD + k] = x;
+                    if( x >= n && y >= m ) {
+                        reachedD = d;
+                        break;
+                    }
+                }
+            }
+            if( reachedD < 0 )
+                return false;
+
+            // Backtrack from (n, m) through the recorded v snapshots
+            std::vector<DiffOp> reversed;
+            auto x = n;
+            auto y = m;
+            for( auto d = reachedD; d >= 0 && ( x > 0 || y > 0 ); --d ) {
+                auto const& pv = trace[static_cast<std::size_t>( d )];
+                auto k = x - y;
+                std::ptrdiff_t prevK;
+                if( k == -d || ( k != d && pv[maxD + k - 1] < pv[maxD + k + 1] ) )
+                    prevK = k + 1;
+                else
+                    prevK = k - 1;
+                auto prevX = d > 0 ? pv[maxD + prevK] : 0;
+                auto prevY = prevX - prevK;
+                while( x > prevX && y > prevY ) {
+                    --x;
+                    --y;
+                    reversed.push_back( DiffOp{ ' ', aOffset + static_cast<std::size_t>( x ), bOffset + static_cast<std::size_t>( y ) } );
+                }
+                if( d > 0 ) {
+                    if( x == prevX ) {
+                        --y;
+                        reversed.push_back( DiffOp{ '+', aOffset + static_cast<std::size_t>( x ), bOffset + static_cast<std::size_t>( y ) } );
+                    }
+                    else {
+                        --x;
+                        reversed.push_back( DiffOp{ '-', aOffset + static_cast<std::size_t>( x ), bOffset + static_cast<std::size_t>( y ) } );
+                    }
+                }
+            }
+            ops.assign( reversed.rbegin(), reversed.rend() );
+            return true;
+        }
+
+        void writeOp( DiffWriter& writer, DiffOp const& op,
+                      std::string const& lhsText, std::vector<LineSpan> const& a,
+                      std::string const& rhsText, std::vector<LineSpan> const& b ) {
+            if( op.marker == '+' )
+                writer.writeLine( '+', rhsText, b[op.rhsLine] );
+            else
+                writer.writeLine( op.marker, lhsText, a[op.lhsLine] );
+        }
+
+        // Groups the edit script into unified-style hunks: runs of changes,
+        // padded with context lines, merged when the common gap between
+        // them is small enough that splitting would only add headers
+        void writeHunks( std::ostream& os, std::vector<DiffOp> const& ops,
+                         std::string const& lhsText, std::vector<LineSpan> const& a,
+                         std::string const& rhsText, std::vector<LineSpan> const& b ) {
+            DiffWriter writer( os );
+            std::size_t pos = 0;
+            while( pos < ops.size() && !writer.capped() ) {
+                // Find the next run of changes
+                while( pos < ops.size() && ops[pos].marker == ' ' )
+                    ++pos;
+                if( pos == ops.size() )
+                    break;
+                auto hunkBegin = pos;
+                auto hunkEnd = pos;
+                while( hunkEnd < ops.size() ) {
+                    if( ops[hunkEnd].marker != ' ' ) {
+                        ++hunkEnd;
+                        continue;
+                    }
+                    // Merge across a short common gap
+                    std::size_t gap = 0;
+                    while( hunkEnd + gap < ops.size() && ops[hunkEnd + gap].marker == ' ' )
+                        ++gap;
+                    if( hunkEnd + gap < ops.size() && gap <= 2 * contextLines )
+                        hunkEnd += gap;
+                    else
+                        break;
+                }
+                auto renderBegin = hunkBegin > contextLines ? hunkBegin - contextLines : 0;
+                auto renderEnd = hunkEnd + contextLines < ops.size() ? hunkEnd + contextLines : ops.size();
+                writer.writeHeader( ops[renderBegin].lhsLine, ops[renderBegin].rhsLine );
+                for( auto i = renderBegin; i < renderEnd; ++i )
+                    writeOp( writer, ops[i], lhsText, a, rhsText, b );
+                pos = renderEnd;
+            }
+        }
+
+        // When the line diff was abandoned, show where the texts start to
+        // disagree rather than nothing: trailing common context, then the
+        // head of each side's differing region
+        void writeFirstDifference( std::ostream& os,
+                                   std::string const& lhsText, std::vector<LineSpan> const& a, std::size_t aOffset, std::size_t aCount,
+                                   std::string const& rhsText, std::vector<LineSpan> const& b, std::size_t bOffset, std::size_t bCount ) {
+            DiffWriter writer( os );
+            writer.writeHeader( aOffset, bOffset );
+            auto context = aOffset < contextLines ? aOffset : contextLines;
+            for( auto i = aOffset - context; i < aOffset; ++i )
+                writer.writeLine( ' ', lhsText, a[i] );
+            const std::size_t headLines = 8;
+            for( std::size_t i = 0; i < aCount && i < headLines; ++i )
+                writer.writeLine( '-', lhsText, a[aOffset + i] );
+            for( std::size_t i = 0; i < bCount && i < headLines; ++i )
+                writer.writeLine( '+', rhsText, b[bOffset + i] );
+            if( aCount > headLines || bCount > headLines )
+                os << "... (" << aCount << " lhs and " << bCount << " rhs lines differ in all)\n";
+        }
+
+        // Single-line texts cannot be usefully line-diffed; report the
+        // first differing character with a window of each side around it
+        void writeCharDifference( std::ostream& os, std::string const& lhs, std::string const& rhs ) {
+            std::size_t firstDiff = 0;
+            while( firstDiff < lhs.size() && firstDiff < rhs.size() && lhs[firstDiff] == rhs[firstDiff] )
+                ++firstDiff;
+            os << "first difference at character " << firstDiff << ":\n";
+            auto windowStart = firstDiff > charWindowBefore ? firstDiff - charWindowBefore : 0;
+            for( int side = 0; side < 2; ++side ) {
+                auto const& text = side == 0 ? lhs : rhs;
+                os << ( side == 0 ? "lhs: " : "rhs: " );
+                if( windowStart > 0 )
+                    os << "...";
+                auto length = text.size() - windowStart < charWindowLength ? text.size() - windowStart : charWindowLength;
+                os.write( text.data() + windowStart, static_cast<std::streamsize>( length ) );
+                if( windowStart + length < text.size() )
+                    os << "...";
+                os << '\n';
+            }
+        }
+
+    } // anon namespace
+
+    void formatTextDiff( std::ostream& os, std::string const& lhs, std::string const& rhs ) {
+        if( lhs == rhs ) {
+            // Stringification elides the middle of very long strings, so
+            // equal texts here can still mean unequal operands
+            if( lhs.find( "[..." ) != std::string::npos )
+                os << "(no difference in the shown text; the sides differ within the elided middle)\n";
+            else
+                os << "(the two sides are identical)\n";
+            return;
+        }
+        if( lhs.find( '\n' ) == std::string::npos && rhs.find( '\n' ) == std::string::npos ) {
+            writeCharDifference( os, lhs, rhs );
+            return;
+        }
+
+        auto a = splitLines( lhs );
+        auto b = splitLines( rhs );
+
+        // Trimming the common prefix and suffix first makes the usual case
+        // - huge texts differing in one spot - linear, whatever the bounds
+        // on the search proper
+        std::size_t prefix = 0;
+        while( prefix < a.size() && prefix < b.size() && sameLine( lhs, a[prefix], rhs, b[prefix] ) )
+            ++prefix;
+        std::size_t suffix = 0;
+        while( suffix < a.size() - prefix && suffix < b.size() - prefix &&
+               sameLine( lhs, a[a.size() - 1 - suffix], rhs, b[b.size() - 1 - suffix] ) )
+            ++suffix;
+        auto aCount = a.size() - prefix - suffix;
+        auto bCount = b.size() - prefix - suffix;
+
+        std::vector<DiffOp> ops;
+        bool diffed = aCount <= maxDiffableLines && bCount <= maxDiffableLines &&
+                      myersDiff( lhs, a, prefix, aCount, rhs, b, prefix, bCount, ops );
+        if( !diffed ) {
+            writeFirstDifference( os, lhs, a, prefix, aCount, rhs, b, prefix, bCount );
+            return;
+        }
+        if( ops.empty() ) {
+            // Identical line-by-line, so the difference is in terminators
+            os << "(the sides differ only in line terminators)\n";
+            return;
+        }
+
+        // Fold enough surrounding common lines back in to give the first
+        // and last hunks their context
+        auto leadingContext = prefix < contextLines ? prefix : contextLines;
+        auto trailingContext = suffix < contextLines ? suffix : contextLines;
+        std::vector<DiffOp> padded;
+        padded.reserve( ops.size() + leadingContext + trailingContext );
+        for( auto i = prefix - leadingContext; i < prefix; ++i )
+            padded.push_back( DiffOp{ ' ', i, i } );
+        padded.insert( padded.end(), ops.begin(), ops.end() );
+        for( std::size_t i = 0; i < trailingContext; ++i )
+            padded.push_back( DiffOp{ ' ', a.size() - suffix + i, b.size() - suffix + i } );
+
+        writeHunks( os, padded, lhs, a, rhs, b );
+    }
+
+} // namespace Catch
@@ -0,0 +1,23 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_TEXT_DIFF_H_INCLUDED
+#define TWOBLUECUBES_CATCH_TEXT_DIFF_H_INCLUDED
+
+#include <iosfwd>
+#include <string>
+
+namespace Catch {
+
+    // Streams a compact difference report for two large texts in place of
+    // printing both in full. Multi-line texts get a unified-style diff of
+    // changed hunks with context, computed with a bounded Myers search so
+    // pathological inputs cannot make the report slower than the test;
+    // single-line texts get the first differing position with a short
+    // window of each side. Output is capped regardless of input size.
+    void formatTextDiff( std::ostream& os, std::string const& lhs, std::string const& rhs );
+
+} // namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_TEXT_DIFF_H_INCLUDED
@@ -0,0 +1,83 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "catch_thread_output.h"
+
+#include <ostream>
+#include <streambuf>
+#include <vector>
+
+namespace Catch {
+
+    namespace {
+
+        // Single-writer by construction - the owning thread is the only
+        // one that ever touches it - so plain indices suffice. The ring
+        // overwrites its oldest bytes rather than growing, bounding what
+        // a chatty million-iteration loop can cost.
+        class ThreadOutputBuffer : public std::streambuf {
+            static const std::size_t ringCapacity = 256 * 1024;
+
+            std::vector<char> m_ring;
+            std::size_t m_next = 0;
+            bool m_wrapped = false;
+
+            void put( char c ) {
+                if( m_ring.empty() )
+                    m_ring.resize( ringCapacity );
+                m_ring[m_next] = c;
+                if( ++m_next == ringCapacity ) {
+                    m_next = 0;
+                    m_wrapped = true;
+                }
+            }
+
+        public:
+            int_type overflow( int_type c ) override {
+                if( c != traits_type::eof() )
+                    put( static_cast<char>( c ) );
+                return c;
+            }
+            std::streamsize xsputn( char const* s, std::streamsize n ) override {
+                for( std::streamsize i = 0; i < n; ++i )
+                    put( s[i] );
+                return n;
+            }
+
+            std::string drain() {
+                std::string out;
+                if( m_wrapped ) {
+                    out = "[Catch::tout() ring buffer wrapped - oldest output lost]\n";
+                    out.append( m_ring.data() + m_next, ringCapacity - m_next );
+                }
+                out.append( m_ring.data(), m_next );
+                m_next = 0;
+                m_wrapped = false;
+                return out;
+            }
+        };
+
+        struct ThreadOutput {
+            ThreadOutputBuffer buffer;
+            std::ostream stream;
+            ThreadOutput() : stream( &buffer ) {}
+        };
+
+        ThreadOutput& threadOutput() {
+            static thread_local ThreadOutput output;
+            return output;
+        }
+
+    } // anonymous namespace
+
+    std::ostream& tout() {
+        return threadOutput().stream;
+    }
+
+    std::string drainThreadOutput() {
+        return threadOutput().buffer.drain();
+    }
+
+} // namespace Catch
@@ -0,0 +1,32 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_THREAD_OUTPUT_H_INCLUDED
+#define TWOBLUECUBES_CATCH_THREAD_OUTPUT_H_INCLUDED
+
+#include <iosfwd>
+#include <string>
+
+namespace Catch {
+
+    // Per-thread test output. The process-global stdout redirect cannot
+    // attribute output when --jobs workers run tests concurrently, so
+    // tout() writes into a ring buffer owned by the calling thread
+    // instead: each write is a plain store into thread-local storage -
+    // no lock, no atomics, no contention. The runner drains the buffer
+    // when the test case ends on that thread, so the text lands in the
+    // same reporter channel as redirected stdout (e.g. JUnit's
+    // system-out), correctly attributed even in parallel runs.
+    //
+    // The ring is bounded; when a test writes more than the capacity the
+    // oldest output is overwritten and the drained text says so.
+    std::ostream& tout();
+
+    // Returns everything the calling thread wrote since the last drain,
+    // oldest first, and resets the buffer
+    std::string drainThreadOutput();
+
+} // namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_THREAD_OUTPUT_H_INCLUDED
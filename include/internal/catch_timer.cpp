@@ -7,30 +7,141 @@
  */
 
 #include "catch_timer.h"
+#include "catch_compiler_capabilities.h"
 
 #include <chrono>
+#include <fstream>
+#include <map>
+
+#if defined(CATCH_CONFIG_TSC_TIMER)
+#  if defined(_MSC_VER)
+#    include <intrin.h>
+#  elif defined(__x86_64__) || defined(__i386__)
+#    include <x86intrin.h>
+#  endif
+#endif
 
 static const uint64_t nanosecondsInSecond = 1000000000;
 
 namespace Catch {
 
+    namespace {
+        IClock*& currentClock() {
+            static IClock* s_clock = nullptr;
+            return s_clock;
+        }
+    }
+
+    IClock::~IClock() = default;
+
+    void setClock( IClock* clock ) {
+        currentClock() = clock;
+    }
+
+    auto ManualClock::nowNanoseconds() -> uint64_t {
+        return m_nanoseconds;
+    }
+    void ManualClock::advanceNanoseconds( uint64_t nanoseconds ) {
+        m_nanoseconds += nanoseconds;
+    }
+    void ManualClock::advanceSeconds( double seconds ) {
+        m_nanoseconds += static_cast<uint64_t>( seconds * nanosecondsInSecond );
+    }
+
     auto getCurrentNanosecondsSinceEpoch() -> uint64_t {
+        // One well-predicted branch on the hot path; the substituted clock
+        // is the rare case
+        if( IClock* clock = currentClock() )
+            return clock->nowNanoseconds();
         return std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::high_resolution_clock::now().time_since_epoch() ).count();
     }
 
     namespace {
-        auto estimateClockResolution() -> uint64_t {
+        std::string& resolutionCacheFile() {
+            static std::string s_cacheFile;
+            return s_cacheFile;
+        }
+
+        // One entry per line: the clock source key followed by its estimated
+        // resolution. A missing or unreadable file means no cached entries.
+        auto loadCachedResolutions() -> std::map<std::string, uint64_t> {
+            std::map<std::string, uint64_t> resolutions;
+            std::ifstream file( resolutionCacheFile().c_str() );
+            std::string key;
+            uint64_t resolution;
+            while( file >> key >> resolution )
+                resolutions[key] = resolution;
+            return resolutions;
+        }
+
+        auto cachedOrEstimatedResolution( std::string const& clockKey, uint64_t (*estimate)() ) -> uint64_t {
+            if( resolutionCacheFile().empty() )
+                return estimate();
+
+            auto resolutions = loadCachedResolutions();
+            auto it = resolutions.find( clockKey );
+            if( it != resolutions.end() )
+                return it->second;
+
+            auto resolution = estimate();
+            resolutions[clockKey] = resolution;
+            std::ofstream file( resolutionCacheFile().c_str() );
+            for( auto const& entry : resolutions )
+                file << entry.first << " " << entry.second << "\n";
+            return resolution;
+        }
+
+#if defined(CATCH_CONFIG_TSC_TIMER)
+        auto readTicks() -> uint64_t {
+#  if defined(__aarch64__)
+            // cntvct is not serialising, so wait for earlier instructions to
+            // complete before reading it
+            uint64_t ticks;
+            asm volatile( "isb\n\tmrs %0, cntvct_el0" : "=r"( ticks ) );
+            return ticks;
+#  else
+            // rdtscp waits for earlier instructions to retire before reading
+            unsigned int aux;
+            return __rdtscp( &aux );
+#  endif
+        }
+
+        auto calibrateTickFrequency() -> uint64_t {
+            // Count ticks across a fixed slice of the chrono clock's time.
+            // 10ms keeps the calibration error well under 1% without a
+            // noticeable pause on first use.
+            static const uint64_t calibrationNanoseconds = 10 * 1000 * 1000;
+            auto startNanoseconds = getCurrentNanosecondsSinceEpoch();
+            auto startTicks = readTicks();
+            uint64_t endNanoseconds;
+            do {
+                endNanoseconds = getCurrentNanosecondsSinceEpoch();
+            } while( endNanoseconds - startNanoseconds < calibrationNanoseconds );
+            auto elapsedTicks = readTicks() - startTicks;
+            return elapsedTicks * nanosecondsInSecond / ( endNanoseconds - startNanoseconds );
+        }
+#endif // CATCH_CONFIG_TSC_TIMER
+
+        auto ticksToNanoseconds( uint64_t ticks ) -> uint64_t {
+            auto frequency = getTickFrequency();
+            // Split the conversion so the multiplication cannot overflow for
+            // long intervals
+            return ( ticks / frequency ) * nanosecondsInSecond
+                 + ( ticks % frequency ) * nanosecondsInSecond / frequency;
+        }
+
+        auto estimateClockResolution( uint64_t (*readClock)(), uint64_t countsPerSecond ) -> uint64_t {
             uint64_t sum = 0;
             static const uint64_t iterations = 1000000;
 
-            auto startTime = getCurrentNanosecondsSinceEpoch();
+            auto startTime = readClock();
 
             for( std::size_t i = 0; i < iterations; ++i ) {
 
                 uint64_t ticks;
-                uint64_t baseTicks = getCurrentNanosecondsSinceEpoch();
+                uint64_t baseTicks = readClock();
                 do {
-                    ticks = getCurrentNanosecondsSinceEpoch();
+                    ticks = readClock();
                 } while( ticks == baseTicks );
 
                 auto delta = ticks - baseTicks;
@@ -39,7 +150,7 @@ namespace Catch {
                 // If we have been calibrating for over 3 seconds -- the clock
                 // is terrible and we should move on.
                 // TBD: How to signal that the measured resolution is probably wrong?
-                if (ticks > startTime + 3 * nanosecondsInSecond) {
+                if (ticks > startTime + 3 * countsPerSecond) {
                     return sum / i;
                 }
             }
@@ -48,9 +159,47 @@ namespace Catch {
             // - and potentially do more iterations if there's a high variance.
             return sum/iterations;
         }
+
+        auto estimateChronoResolution() -> uint64_t {
+            return estimateClockResolution( getCurrentNanosecondsSinceEpoch, nanosecondsInSecond );
+        }
+        auto estimateTickResolution() -> uint64_t {
+            return ticksToNanoseconds( estimateClockResolution( getCurrentTicks, getTickFrequency() ) );
+        }
+    }
+
+    void setClockResolutionCacheFile( std::string const& cacheFile ) {
+        resolutionCacheFile() = cacheFile;
     }
+
     auto getEstimatedClockResolution() -> uint64_t {
-        static auto s_resolution = estimateClockResolution();
+        static auto s_resolution = cachedOrEstimatedResolution( "chrono", estimateChronoResolution );
+        return s_resolution;
+    }
+
+    auto getCurrentTicks() -> uint64_t {
+#if defined(CATCH_CONFIG_TSC_TIMER)
+        return readTicks();
+#else
+        return getCurrentNanosecondsSinceEpoch();
+#endif
+    }
+    auto getTickFrequency() -> uint64_t {
+#if defined(CATCH_CONFIG_TSC_TIMER)
+        static auto s_frequency = calibrateTickFrequency();
+        return s_frequency;
+#else
+        return nanosecondsInSecond;
+#endif
+    }
+    auto getEstimatedTickResolution() -> uint64_t {
+        // Without the tick clock both estimators read the chrono clock, so
+        // they share a cache entry
+#if defined(CATCH_CONFIG_TSC_TIMER)
+        static auto s_resolution = cachedOrEstimatedResolution( "tsc", estimateTickResolution );
+#else
+        static auto s_resolution = cachedOrEstimatedResolution( "chrono", estimateTickResolution );
+#endif
         return s_resolution;
     }
 
@@ -70,5 +219,12 @@ namespace Catch {
         return getElapsedMicroseconds()/1000000.0;
     }
 
+    void TickTimer::start() {
+        m_ticks = getCurrentTicks();
+    }
+    auto TickTimer::getElapsedNanoseconds() const -> uint64_t {
+        return ticksToNanoseconds( getCurrentTicks() - m_ticks );
+    }
+
 
 } // namespace Catch
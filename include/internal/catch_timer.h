@@ -9,12 +9,53 @@
 #define TWOBLUECUBES_CATCH_TIMER_H_INCLUDED
 
 #include <cstdint>
+#include <string>
 
 namespace Catch {
 
+    // The clock behind getCurrentNanosecondsSinceEpoch and Timer. Tests of
+    // timeout/retry logic can substitute their own implementation so
+    // time-dependent code runs at CPU speed instead of burning real wall
+    // time waiting for deadlines to pass.
+    struct IClock {
+        virtual ~IClock();
+        virtual auto nowNanoseconds() -> uint64_t = 0;
+    };
+
+    // Substitutes the given clock for the wall clock; pass nullptr to
+    // restore it. The caller keeps ownership and must keep the clock alive
+    // until it is restored. Not thread-safe - install before spawning any
+    // threads that read the time.
+    void setClock( IClock* clock );
+
+    // Manual-advance clock: time stands still until advance*() is called,
+    // so a test can jump straight past a timeout it wants to trigger.
+    class ManualClock : public IClock {
+        uint64_t m_nanoseconds = 0;
+    public:
+        auto nowNanoseconds() -> uint64_t override;
+        void advanceNanoseconds( uint64_t nanoseconds );
+        void advanceSeconds( double seconds );
+    };
+
     auto getCurrentNanosecondsSinceEpoch() -> uint64_t;
     auto getEstimatedClockResolution() -> uint64_t;
 
+    // Uses the named file to persist estimated clock resolutions between
+    // runs, keyed by clock source. Estimating burns ~1M clock reads, so the
+    // cache spares short benchmark-containing runs a fixed startup cost.
+    // The values are only meaningful on the machine that wrote them. Must be
+    // set before the estimators first run to have any effect.
+    void setClockResolutionCacheFile( std::string const& cacheFile );
+
+    // Reads the CPU tick counter (rdtsc on x86, cntvct on ARM64) when
+    // CATCH_CONFIG_TSC_TIMER is in force, falling back to the chrono clock
+    // otherwise. The tick frequency is calibrated against the chrono clock
+    // once per process.
+    auto getCurrentTicks() -> uint64_t;
+    auto getTickFrequency() -> uint64_t;
+    auto getEstimatedTickResolution() -> uint64_t;
+
     class Timer {
         uint64_t m_nanoseconds = 0;
     public:
@@ -25,6 +66,15 @@ namespace Catch {
         auto getElapsedSeconds() const -> double;
     };
 
+    // Like Timer, but reads the tick clock. Used by BENCHMARK, where the
+    // cheaper reads keep the timer out of the measurement.
+    class TickTimer {
+        uint64_t m_ticks = 0;
+    public:
+        void start();
+        auto getElapsedNanoseconds() const -> uint64_t;
+    };
+
 } // namespace Catch
 
 #endif // TWOBLUECUBES_CATCH_TIMER_H_INCLUDED
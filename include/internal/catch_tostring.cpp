@@ -21,18 +21,161 @@
 #include "catch_interfaces_config.h"
 #include "catch_context.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <iomanip>
 
+#if defined(CATCH_CONFIG_CPP17_CHARCONV)
+#include <charconv>
+#endif
+
 namespace Catch {
 
 namespace Detail {
 
     const std::string unprintableString = "{?}";
 
+    std::size_t stringifyMaxElements() {
+        if( auto config = getCurrentContext().getConfig() )
+            return config->stringifyMaxElements();
+        return 64; // stringified outside a run: the ConfigData default
+    }
+
     namespace {
         const int hexThreshold = 255;
 
+        // Direct formatting into caller-provided stack buffers, so the
+        // arithmetic StringMakers never touch an (locale-aware, allocating)
+        // ostream. Each returns a pointer past the last character written;
+        // buffers are sized by the callers to fit the worst case.
+#if defined(CATCH_CONFIG_CPP17_CHARCONV)
+        char* writeDecimal( char* first, char* last, long long value ) {
+            return std::to_chars( first, last, value ).ptr;
+        }
+        char* writeDecimal( char* first, char* last, unsigned long long value ) {
+            return std::to_chars( first, last, value ).ptr;
+        }
+        char* writeHex( char* first, char* last, unsigned long long value ) {
+            return std::to_chars( first, last, value, 16 ).ptr;
+        }
+#else
+        char* writeDecimal( char* first, char* last, long long value ) {
+            return first + std::snprintf( first, static_cast<std::size_t>( last - first ), "%lld", value );
+        }
+        char* writeDecimal( char* first, char* last, unsigned long long value ) {
+            return first + std::snprintf( first, static_cast<std::size_t>( last - first ), "%llu", value );
+        }
+        char* writeHex( char* first, char* last, unsigned long long value ) {
+            return first + std::snprintf( first, static_cast<std::size_t>( last - first ), "%llx", value );
+        }
+#endif
+
+#if defined(CATCH_CONFIG_CPP14_CONSTEXPR)
+        // Texts for the small integers, laid out into static storage at
+        // compile time. Literal operands (REQUIRE(x == 42) and friends)
+        // overwhelmingly fall in this range, so formatting them on failure
+        // becomes a table lookup and an SSO string copy instead of a
+        // formatting call - which adds up in data-driven suites that
+        // intentionally log thousands of failures.
+        struct SmallIntTable {
+            static const int Low = -255, High = 255;
+            char texts[High - Low + 1][5]; // sign + up to 3 digits + NUL
+
+            constexpr SmallIntTable() : texts{} {
+                for( int value = Low; value <= High; ++value ) {
+                    char* out = texts[value - Low];
+                    int remaining = value < 0 ? -value : value;
+                    if( value < 0 )
+                        *out++ = '-';
+                    if( remaining >= 100 )
+                        *out++ = static_cast<char>( '0' + remaining / 100 );
+                    if( remaining >= 10 )
+                        *out++ = static_cast<char>( '0' + remaining / 10 % 10 );
+                    *out++ = static_cast<char>( '0' + remaining % 10 );
+                    *out = '\0';
+                }
+            }
+            char const* get( long long value ) const {
+                return texts[value - Low];
+            }
+        };
+        constexpr SmallIntTable smallIntTable;
+#endif
+
+        // Stringified strings longer than this keep only their head and
+        // tail, with the middle elided - a multi-megabyte payload in a
+        // failed assertion should not produce megabytes of report
+        constexpr std::size_t maxStringifiedStringLength = 4096;
+
+        // Word-at-a-time classification for string escaping: the returned
+        // mask has the high bit set in every byte holding a control
+        // character below 0x20 or DEL (0x7f) - the escape candidates.
+        // Bytes of 0x80 and above (UTF-8 sequences) are never flagged, so
+        // multi-byte text passes through untouched.
+        std::uint64_t escapeCandidates( std::uint64_t word ) {
+            constexpr std::uint64_t ones = 0x0101010101010101ull;
+            constexpr std::uint64_t highs = 0x8080808080808080ull;
+            std::uint64_t below = ( word - ones * 0x20 ) & ~word;
+            std::uint64_t del = word ^ ( ones * 0x7f );
+            del = ( del - ones ) & ~del;
+            return ( below | del ) & highs;
+        }
+
+        bool needsEscape( unsigned char c, bool showInvisibles ) {
+            if( c == '\n' || c == '\t' )
+                return showInvisibles;
+            return c < 0x20 || c == 0x7f;
+        }
+
+        void appendEscape( std::string& out, unsigned char c ) {
+            if( c == '\n' )
+                out.append( "\\n" );
+            else if( c == '\t' )
+                out.append( "\\t" );
+            else {
+                const char digits[] = "0123456789abcdef";
+                const char escape[4] = { '\\', 'x', digits[c >> 4], digits[c & 0xf] };
+                out.append( escape, 4 );
+            }
+        }
+
+        // Appends the characters with escape candidates replaced by their
+        // escape sequences. Clean stretches are skipped a word at a time
+        // with the classifier above and appended in one piece, so escaping
+        // a large mostly-printable payload is a scan plus a few bulk
+        // copies, not a per-character loop.
+        void appendEscaped( std::string& out, char const* data, std::size_t size, bool showInvisibles ) {
+            std::size_t done = 0; // everything before this is appended
+            std::size_t pos = 0;  // scan cursor; [done, pos) is known clean
+            std::uint64_t word;
+            while( pos < size ) {
+                if( pos + sizeof(word) <= size ) {
+                    std::memcpy( &word, data + pos, sizeof(word) );
+                    if( !escapeCandidates( word ) ) {
+                        pos += sizeof(word);
+                        continue;
+                    }
+                }
+                // A flagged (or trailing partial) word: resolve its bytes
+                // one at a time. Flagged is not necessarily escaped -
+                // newlines and tabs stay verbatim unless invisibles are
+                // being shown.
+                auto wordEnd = (std::min)( pos + sizeof(word), size );
+                for( ; pos < wordEnd; ++pos ) {
+                    auto c = static_cast<unsigned char>( data[pos] );
+                    if( needsEscape( c, showInvisibles ) ) {
+                        out.append( data + done, pos - done );
+                        appendEscape( out, c );
+                        done = pos + 1;
+                    }
+                }
+            }
+            out.append( data + done, size - done );
+        }
+
         struct Endianness {
             enum Arch { Big, Little };
 
@@ -48,6 +191,48 @@ namespace Detail {
         };
     }
 
+    void appendStringified( std::string& out, long long value ) {
+#if defined(CATCH_CONFIG_CPP14_CONSTEXPR)
+        if( value >= SmallIntTable::Low && value <= SmallIntTable::High ) {
+            out.append( smallIntTable.get( value ) );
+            return;
+        }
+#endif
+        // Worst case is 20 digits, a sign, the " (0x" annotation with 16
+        // hex digits and the closing paren - comfortably within the buffer
+        char buffer[64];
+        char* pos = writeDecimal( buffer, buffer + sizeof(buffer), value );
+        if( value > hexThreshold ) {
+            pos = std::copy_n( " (0x", 4, pos );
+            pos = writeHex( pos, buffer + sizeof(buffer), static_cast<unsigned long long>( value ) );
+            *pos++ = ')';
+        }
+        out.append( buffer, static_cast<std::size_t>( pos - buffer ) );
+    }
+
+    void appendStringified( std::string& out, unsigned long long value ) {
+#if defined(CATCH_CONFIG_CPP14_CONSTEXPR)
+        if( value <= static_cast<unsigned long long>( SmallIntTable::High ) ) {
+            out.append( smallIntTable.get( static_cast<long long>( value ) ) );
+            return;
+        }
+#endif
+        char buffer[64];
+        char* pos = writeDecimal( buffer, buffer + sizeof(buffer), value );
+        if( value > static_cast<unsigned long long>( hexThreshold ) ) {
+            pos = std::copy_n( " (0x", 4, pos );
+            pos = writeHex( pos, buffer + sizeof(buffer), value );
+            *pos++ = ')';
+        }
+        out.append( buffer, static_cast<std::size_t>( pos - buffer ) );
+    }
+
+    void appendDecimal( std::string& out, unsigned long long value ) {
+        char buffer[24];
+        char* pos = writeDecimal( buffer, buffer + sizeof(buffer), value );
+        out.append( buffer, static_cast<std::size_t>( pos - buffer ) );
+    }
+
     std::string rawMemoryToString( const void *object, std::size_t size ) {
         // Reverse order for little endian architectures
         int i = 0, end = static_cast<int>( size ), inc = 1;
@@ -72,11 +257,19 @@ std::string fpToString( T value, int precision ) {
         return "nan";
     }
 
-    ReusableStringStream rss;
-    rss << std::setprecision( precision )
-        << std::fixed
-        << value;
-    std::string d = rss.str();
+    // %f matches what the ostream insertion with std::fixed produced, but
+    // without the stream setup or the locale lookups. Values of extreme
+    // magnitude overflow the stack buffer, so fall back to a sized string
+    char buffer[64];
+    auto size = std::snprintf( buffer, sizeof(buffer), "%.*f", precision, static_cast<double>( value ) );
+    std::string d;
+    if( size < static_cast<int>( sizeof(buffer) ) )
+        d.assign( buffer, static_cast<std::size_t>( size ) );
+    else {
+        d.resize( static_cast<std::size_t>( size ) + 1 );
+        std::snprintf( &d[0], d.size(), "%.*f", precision, static_cast<double>( value ) );
+        d.pop_back(); // trailing null
+    }
     std::size_t i = d.find_last_not_of( '0' );
     if( i != std::string::npos && i != d.size()-1 ) {
         if( d[i] == '.' )
@@ -94,25 +287,25 @@ std::string fpToString( T value, int precision ) {
 //// ======================================================= ////
 
 std::string StringMaker<std::string>::convert(const std::string& str) {
-    if (!getCurrentContext().getConfig()->showInvisibles()) {
-        return '"' + str + '"';
-    }
-
-    std::string s("\"");
-    for (char c : str) {
-        switch (c) {
-        case '\n':
-            s.append("\\n");
-            break;
-        case '\t':
-            s.append("\\t");
-            break;
-        default:
-            s.push_back(c);
-            break;
-        }
+    const bool showInvisibles = getCurrentContext().getConfig()->showInvisibles();
+
+    std::string s;
+    s.reserve( (std::min)( str.size(), Detail::maxStringifiedStringLength ) + 2 );
+    s += '"';
+    if( str.size() > Detail::maxStringifiedStringLength ) {
+        const auto half = Detail::maxStringifiedStringLength / 2;
+        Detail::appendEscaped( s, str.data(), half, showInvisibles );
+        s += "[...";
+        char count[24];
+        auto end = Detail::writeDecimal( count, count + sizeof(count),
+                                 static_cast<unsigned long long>( str.size() - 2 * half ) );
+        s.append( count, static_cast<std::size_t>( end - count ) );
+        s += " characters elided...]";
+        Detail::appendEscaped( s, str.data() + str.size() - half, half, showInvisibles );
+    } else {
+        Detail::appendEscaped( s, str.data(), str.size(), showInvisibles );
     }
-    s.append("\"");
+    s += '"';
     return s;
 }
 
@@ -177,12 +370,9 @@ std::string StringMaker<long>::convert(long value) {
     return ::Catch::Detail::stringify(static_cast<long long>(value));
 }
 std::string StringMaker<long long>::convert(long long value) {
-    ReusableStringStream rss;
-    rss << value;
-    if (value > Detail::hexThreshold) {
-        rss << " (0x" << std::hex << value << ')';
-    }
-    return rss.str();
+    std::string out;
+    Detail::appendStringified(out, value);
+    return out;
 }
 
 std::string StringMaker<unsigned int>::convert(unsigned int value) {
@@ -192,12 +382,9 @@ std::string StringMaker<unsigned long>::convert(unsigned long value) {
     return ::Catch::Detail::stringify(static_cast<unsigned long long>(value));
 }
 std::string StringMaker<unsigned long long>::convert(unsigned long long value) {
-    ReusableStringStream rss;
-    rss << value;
-    if (value > Detail::hexThreshold) {
-        rss << " (0x" << std::hex << value << ')';
-    }
-    return rss.str();
+    std::string out;
+    Detail::appendStringified(out, value);
+    return out;
 }
 
 
@@ -11,6 +11,7 @@
 
 #include <vector>
 #include <cstddef>
+#include <iterator>
 #include <type_traits>
 #include <string>
 #include "catch_compiler_capabilities.h"
@@ -307,17 +308,109 @@ namespace Catch {
 #endif
 
     namespace Detail {
+        // Elements kept at each end when a container is stringified, from
+        // the configuration (--stringify-max-elements); 0 keeps them all
+        std::size_t stringifyMaxElements();
+
+        // Appends the exact StringMaker rendering of an integer straight
+        // onto the buffer, with no temporary string
+        void appendStringified(std::string& out, long long value);
+        void appendStringified(std::string& out, unsigned long long value);
+
+        // Plain decimal digits, without the hex annotation large values
+        // get from their StringMaker - for counts inside markers
+        void appendDecimal(std::string& out, unsigned long long value);
+
+        // Plain integer elements (not bool or a character type, which
+        // render differently) append their digits directly; everything
+        // else goes through its StringMaker
+        template<typename T>
+        struct UsesDirectAppend : std::integral_constant<bool,
+            std::is_integral<T>::value &&
+            !std::is_same<T, bool>::value &&
+            !std::is_same<T, char>::value &&
+            !std::is_same<T, signed char>::value &&
+            !std::is_same<T, unsigned char>::value &&
+            !std::is_same<T, wchar_t>::value &&
+            !std::is_same<T, char16_t>::value &&
+            !std::is_same<T, char32_t>::value> {};
+
+        template<typename T>
+        typename std::enable_if<UsesDirectAppend<T>::value && std::is_signed<T>::value, void>::type
+        appendRangeElement(std::string& out, T const& value) {
+            appendStringified(out, static_cast<long long>(value));
+        }
+        template<typename T>
+        typename std::enable_if<UsesDirectAppend<T>::value && !std::is_signed<T>::value, void>::type
+        appendRangeElement(std::string& out, T const& value) {
+            appendStringified(out, static_cast<unsigned long long>(value));
+        }
+        template<typename T>
+        typename std::enable_if<!UsesDirectAppend<T>::value, void>::type
+        appendRangeElement(std::string& out, T const& value) {
+            out += ::Catch::Detail::stringify(value);
+        }
+
         template<typename InputIterator>
-        std::string rangeToString(InputIterator first, InputIterator last) {
-            ReusableStringStream rss;
-            rss << "{ ";
+        void appendRangeElements(std::string& out, InputIterator first, InputIterator last) {
+            out += "{ ";
             if (first != last) {
-                rss << ::Catch::Detail::stringify(*first);
-                for (++first; first != last; ++first)
-                    rss << ", " << ::Catch::Detail::stringify(*first);
+                appendRangeElement(out, *first);
+                for (++first; first != last; ++first) {
+                    out += ", ";
+                    appendRangeElement(out, *first);
+                }
             }
-            rss << " }";
-            return rss.str();
+            out += " }";
+        }
+
+        // Single-pass iterators cannot be measured or advanced over the
+        // elided middle, so they keep the full output
+        template<typename InputIterator>
+        std::string rangeToString(InputIterator first, InputIterator last, std::input_iterator_tag) {
+            std::string out;
+            appendRangeElements(out, first, last);
+            return out;
+        }
+
+        // Multi-pass iterators reserve the output buffer from the range
+        // size up front (one allocation for the common numeric case) and
+        // cap it at the configured number of elements from each end, with
+        // the middle elided - formatting a failed assertion on a huge
+        // container costs O(cap), not O(n)
+        template<typename ForwardIterator>
+        std::string rangeToString(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+            const auto cap = stringifyMaxElements();
+            const auto size = static_cast<std::size_t>(std::distance(first, last));
+            std::string out;
+            if (cap == 0 || size <= 2 * cap) {
+                out.reserve(4 + size * 8);
+                appendRangeElements(out, first, last);
+                return out;
+            }
+
+            out.reserve(64 + 2 * cap * 8);
+            out += "{ ";
+            appendRangeElement(out, *first);
+            for (std::size_t i = 1; i < cap; ++i) {
+                out += ", ";
+                appendRangeElement(out, *++first);
+            }
+            out += ", [...";
+            appendDecimal(out, static_cast<unsigned long long>(size - 2 * cap));
+            out += " elements elided...]";
+            std::advance(first, static_cast<typename std::iterator_traits<ForwardIterator>::difference_type>(size - 2 * cap + 1));
+            for (; first != last; ++first) {
+                out += ", ";
+                appendRangeElement(out, *first);
+            }
+            out += " }";
+            return out;
+        }
+
+        template<typename InputIterator>
+        std::string rangeToString(InputIterator first, InputIterator last) {
+            return rangeToString(first, last, typename std::iterator_traits<InputIterator>::iterator_category());
         }
     }
 
@@ -476,18 +569,24 @@ namespace Catch {
         return ::Catch::Detail::rangeToString( begin( range ), end( range ) );
     }
 
-    // Handle vector<bool> specially
+    // Handle vector<bool> specially: its iterators dereference to proxy
+    // objects, so the elements are taken by value. The configured element
+    // cap applies as for any other range.
     template<typename Allocator>
     std::string rangeToString( std::vector<bool, Allocator> const& v ) {
+        const auto cap = ::Catch::Detail::stringifyMaxElements();
+        const bool capped = cap != 0 && v.size() > 2 * cap;
         ReusableStringStream rss;
         rss << "{ ";
-        bool first = true;
-        for( bool b : v ) {
-            if( first )
-                first = false;
-            else
+        for( std::size_t i = 0; i < v.size(); ++i ) {
+            if( i )
                 rss << ", ";
-            rss << ::Catch::Detail::stringify( b );
+            if( capped && i == cap ) {
+                rss << "[..." << v.size() - 2 * cap << " elements elided...]";
+                i = v.size() - cap - 1;
+                continue;
+            }
+            rss << ::Catch::Detail::stringify( static_cast<bool>( v[i] ) );
         }
         rss << " }";
         return rss.str();
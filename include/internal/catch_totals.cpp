@@ -14,6 +14,7 @@ namespace Catch {
         diff.passed = passed - other.passed;
         diff.failed = failed - other.failed;
         diff.failedButOk = failedButOk - other.failedButOk;
+        diff.passedOnRetry = passedOnRetry - other.passedOnRetry;
         return diff;
     }
 
@@ -21,6 +22,7 @@ namespace Catch {
         passed += other.passed;
         failed += other.failed;
         failedButOk += other.failedButOk;
+        passedOnRetry += other.passedOnRetry;
         return *this;
     }
 
@@ -23,6 +23,9 @@ namespace Catch {
         std::size_t passed = 0;
         std::size_t failed = 0;
         std::size_t failedButOk = 0;
+        // Of the passed, how many only passed on a --retry-failures
+        // attempt (already included in passed); unused for assertions
+        std::size_t passedOnRetry = 0;
     };
 
     struct Totals {
@@ -0,0 +1,40 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_TRACEPOINTS_H_INCLUDED
+#define TWOBLUECUBES_CATCH_TRACEPOINTS_H_INCLUDED
+
+#include "catch_compiler_capabilities.h"
+
+// Static tracepoints at test and assertion boundaries, so external
+// profilers (perf, eBPF, SystemTap) can attribute samples to tests
+// without parsing any console output. Each probe compiles to a single
+// nop when no tracer is attached; the string arguments are pointers
+// into Catch's own storage, read from the traced process by the tool.
+//
+// Probes live in the "catch2" provider:
+//   test_case_starting( char const* name )
+//   test_case_ended( char const* name, std::size_t failedAssertions )
+//   section_starting( char const* name )
+//   assertion_failed( char const* file, std::size_t line )
+
+#if defined(CATCH_CONFIG_USDT)
+
+#include <sys/sdt.h>
+
+#define CATCH_TRACE_TEST_CASE_STARTING( namePtr ) DTRACE_PROBE1( catch2, test_case_starting, namePtr )
+#define CATCH_TRACE_TEST_CASE_ENDED( namePtr, failedAssertions ) DTRACE_PROBE2( catch2, test_case_ended, namePtr, failedAssertions )
+#define CATCH_TRACE_SECTION_STARTING( namePtr ) DTRACE_PROBE1( catch2, section_starting, namePtr )
+#define CATCH_TRACE_ASSERTION_FAILED( filePtr, line ) DTRACE_PROBE2( catch2, assertion_failed, filePtr, line )
+
+#else
+
+#define CATCH_TRACE_TEST_CASE_STARTING( namePtr )
+#define CATCH_TRACE_TEST_CASE_ENDED( namePtr, failedAssertions )
+#define CATCH_TRACE_SECTION_STARTING( namePtr )
+#define CATCH_TRACE_ASSERTION_FAILED( filePtr, line )
+
+#endif
+
+#endif // TWOBLUECUBES_CATCH_TRACEPOINTS_H_INCLUDED
@@ -11,8 +11,12 @@
 #ifndef TWOBLUECUBES_CATCH_USER_INTERFACES_H_INCLUDED
 #define TWOBLUECUBES_CATCH_USER_INTERFACES_H_INCLUDED
 
+#include <string>
+
 namespace Catch {
     unsigned int rngSeed();
+    unsigned int rngSeedForCurrentTest();
+    void addTestFileDependency( std::string const& filePath );
 }
 
 #endif // TWOBLUECUBES_CATCH_USER_INTERFACES_H_INCLUDED
@@ -9,6 +9,7 @@
 #include "catch_enforce.h"
 #include "catch_string_manip.h"
 
+#include <cctype>
 #include <sstream>
 
 namespace Catch {
@@ -28,21 +29,44 @@ namespace Catch {
         }
     }
 
-    bool WildcardPattern::matches( std::string const& str ) const {
+    // Candidates are compared in place, character by character - the pattern
+    // was already case-folded in the constructor, so no normalised copy of
+    // the candidate string needs to be allocated per match
+    bool WildcardPattern::matches( StringRef const& str ) const {
         switch( m_wildcard ) {
             case NoWildcard:
-                return m_pattern == adjustCase( str );
+                return str.size() == m_pattern.size() && matchesAt( str, 0 );
             case WildcardAtStart:
-                return endsWith( adjustCase( str ), m_pattern );
+                return str.size() >= m_pattern.size() && matchesAt( str, str.size() - m_pattern.size() );
             case WildcardAtEnd:
-                return startsWith( adjustCase( str ), m_pattern );
+                return str.size() >= m_pattern.size() && matchesAt( str, 0 );
             case WildcardAtBothEnds:
-                return contains( adjustCase( str ), m_pattern );
+                if( str.size() < m_pattern.size() )
+                    return false;
+                for( std::size_t pos = 0; pos <= str.size() - m_pattern.size(); ++pos )
+                    if( matchesAt( str, pos ) )
+                        return true;
+                return false;
             default:
                 CATCH_INTERNAL_ERROR( "Unknown enum" );
         }
     }
 
+    std::string const* WildcardPattern::literalPattern() const {
+        return m_wildcard == NoWildcard ? &m_pattern : nullptr;
+    }
+
+    bool WildcardPattern::matchesAt( StringRef const& str, std::size_t pos ) const {
+        for( std::size_t i = 0; i < m_pattern.size(); ++i )
+            if( normaliseChar( str[pos + i] ) != m_pattern[i] )
+                return false;
+        return true;
+    }
+
+    char WildcardPattern::normaliseChar( char c ) const {
+        return m_caseSensitivity == CaseSensitive::No ? static_cast<char>( std::tolower( c ) ) : c;
+    }
+
     std::string WildcardPattern::adjustCase( std::string const& str ) const {
         return m_caseSensitivity == CaseSensitive::No ? toLower( str ) : str;
     }
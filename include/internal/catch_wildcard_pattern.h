@@ -9,6 +9,7 @@
 #define TWOBLUECUBES_CATCH_WILDCARD_PATTERN_HPP_INCLUDED
 
 #include "catch_common.h"
+#include "catch_stringref.h"
 
 
 namespace Catch
@@ -25,10 +26,17 @@ namespace Catch
 
         WildcardPattern( std::string const& pattern, CaseSensitive::Choice caseSensitivity );
         virtual ~WildcardPattern() = default;
-        virtual bool matches( std::string const& str ) const;
+        virtual bool matches( StringRef const& str ) const;
+
+        // The case-normalised pattern if it contains no wildcards - such a
+        // pattern only ever matches whole strings, so callers with many
+        // patterns can collapse them into a hash lookup; nullptr otherwise
+        std::string const* literalPattern() const;
 
     private:
         std::string adjustCase( std::string const& str ) const;
+        char normaliseChar( char c ) const;
+        bool matchesAt( StringRef const& str, std::size_t pos ) const;
         CaseSensitive::Choice m_caseSensitivity;
         WildcardPosition m_wildcard = NoWildcard;
         std::string m_pattern;
@@ -5,10 +5,15 @@
  *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
  */
 
+#if !defined(CATCH_CONFIG_MINIMAL_RUNTIME)
+
 #include "catch_xmlwriter.h"
 
 #include "catch_enforce.h"
 
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <iomanip>
 
 using uchar = unsigned char;
@@ -49,6 +54,77 @@ namespace {
             << static_cast<int>(c);
     }
 
+    // The encoder writes either to a stream or, when the writer is
+    // assembling its in-memory buffer, straight to a string - these two
+    // sinks let one implementation serve both
+    struct OstreamSink {
+        std::ostream& os;
+        void append( char c ) { os.put( c ); }
+        void append( char const* s ) { os << s; }
+        void append( char const* s, std::size_t n ) { os.write( s, static_cast<std::streamsize>( n ) ); }
+        void hexEscape( uchar c ) { hexEscapeChar( os, c ); }
+    };
+    struct StringSink {
+        std::string& out;
+        void append( char c ) { out += c; }
+        void append( char const* s ) { out += s; }
+        void append( char const* s, std::size_t n ) { out.append( s, n ); }
+        void hexEscape( uchar c ) {
+            char buffer[8];
+            std::snprintf( buffer, sizeof(buffer), "\\x%02X", c );
+            out += buffer;
+        }
+    };
+
+    // True for every byte the encoder has to look at one at a time:
+    // markup escapes, control characters, DEL and anything past plain
+    // ASCII (which needs UTF-8 validation)
+    bool needsScalarEncoding(uchar c) {
+        return c < 0x20 || c >= 0x7F || c == '<' || c == '&' || c == '>' || c == '"';
+    }
+
+    constexpr uint64_t broadcast(uchar c) {
+        return 0x0101010101010101ull * c;
+    }
+
+    // High bit set in every byte of v that is zero. May produce false
+    // positives in bytes following a genuine zero (borrow propagation),
+    // which only costs a byte the scalar path re-checks.
+    uint64_t zeroBytes(uint64_t v) {
+        return (v - broadcast(0x01)) & ~v & broadcast(0x80);
+    }
+
+    // SWAR scan: walks the string eight bytes at a time and returns the
+    // index of the next byte needing scalar treatment (or the size).
+    // Clean runs between those bytes can be copied to the output in bulk.
+    std::size_t findNextScalarByte(std::string const& str, std::size_t idx) {
+        std::size_t const size = str.size();
+        while (idx + 8 <= size) {
+            uint64_t w;
+            std::memcpy(&w, str.data() + idx, 8);
+            uint64_t marked = w & broadcast(0x80);             // >= 0x80
+            marked |= (w - broadcast(0x20)) & ~w & broadcast(0x80); // < 0x20
+            marked |= zeroBytes(w ^ broadcast(0x7F));
+            marked |= zeroBytes(w ^ broadcast('<'));
+            marked |= zeroBytes(w ^ broadcast('&'));
+            marked |= zeroBytes(w ^ broadcast('>'));
+            marked |= zeroBytes(w ^ broadcast('"'));
+            if (marked) {
+                // Locate the first marked byte with plain tests - keeps
+                // the result independent of host endianness
+                while (idx < size && !needsScalarEncoding(static_cast<uchar>(str[idx]))) {
+                    ++idx;
+                }
+                return idx;
+            }
+            idx += 8;
+        }
+        while (idx < size && !needsScalarEncoding(static_cast<uchar>(str[idx]))) {
+            ++idx;
+        }
+        return idx;
+    }
+
 } // anonymous namespace
 
     XmlEncode::XmlEncode( std::string const& str, ForWhat forWhat )
@@ -56,29 +132,46 @@ namespace {
         m_forWhat( forWhat )
     {}
 
-    void XmlEncode::encodeTo( std::ostream& os ) const {
+namespace {
+
+    template<typename Sink>
+    void encodeToSink( std::string const& m_str, XmlEncode::ForWhat m_forWhat, Sink sink ) {
         // Apostrophe escaping not necessary if we always use " to write attributes
         // (see: http://www.w3.org/TR/xml/#syntax)
 
-        for( std::size_t idx = 0; idx < m_str.size(); ++ idx ) {
+        std::size_t idx = 0;
+        while (idx < m_str.size()) {
+            // Bulk-copy the run up to the next byte that needs individual
+            // treatment - for typical strings that is all of them
+            auto runStart = idx;
+            idx = findNextScalarByte(m_str, idx);
+            if (idx > runStart) {
+                sink.append(m_str.data() + runStart, idx - runStart);
+            }
+            if (idx == m_str.size()) {
+                return;
+            }
+
             uchar c = m_str[idx];
             switch (c) {
-            case '<':   os << "&lt;"; break;
-            case '&':   os << "&amp;"; break;
+            case '<':   sink.append("&lt;"); ++idx; break;
+            case '&':   sink.append("&amp;"); ++idx; break;
 
             case '>':
                 // See: http://www.w3.org/TR/xml/#syntax
                 if (idx > 2 && m_str[idx - 1] == ']' && m_str[idx - 2] == ']')
-                    os << "&gt;";
+                    sink.append("&gt;");
                 else
-                    os << c;
+                    sink.append(static_cast<char>(c));
+                ++idx;
                 break;
 
             case '\"':
-                if (m_forWhat == ForAttributes)
-                    os << "&quot;";
+                if (m_forWhat == XmlEncode::ForAttributes)
+                    sink.append("&quot;");
                 else
-                    os << c;
+                    sink.append(static_cast<char>(c));
+                ++idx;
                 break;
 
             default:
@@ -87,13 +180,16 @@ namespace {
                 // Escape control characters in standard ascii
                 // see http://stackoverflow.com/questions/404107/why-are-control-characters-illegal-in-xml-1-0
                 if (c < 0x09 || (c > 0x0D && c < 0x20) || c == 0x7F) {
-                    hexEscapeChar(os, c);
+                    sink.hexEscape(c);
+                    ++idx;
                     break;
                 }
 
-                // Plain ASCII: Write it to stream
+                // Plain ASCII (only tab, newline and carriage return get
+                // this far): Write it to stream
                 if (c < 0x7F) {
-                    os << c;
+                    sink.append(static_cast<char>(c));
+                    ++idx;
                     break;
                 }
 
@@ -105,14 +201,16 @@ namespace {
                 // Or as 10XX XXXX
                 if (c <  0xC0 ||
                     c >= 0xF8) {
-                    hexEscapeChar(os, c);
+                    sink.hexEscape(c);
+                    ++idx;
                     break;
                 }
 
                 auto encBytes = trailingBytes(c);
                 // Are there enough bytes left to avoid accessing out-of-bounds memory?
                 if (idx + encBytes - 1 >= m_str.size()) {
-                    hexEscapeChar(os, c);
+                    sink.hexEscape(c);
+                    ++idx;
                     break;
                 }
                 // The header is valid, check data
@@ -136,20 +234,29 @@ namespace {
                     // Encoded value out of range
                     (value >= 0x110000)
                     ) {
-                    hexEscapeChar(os, c);
+                    sink.hexEscape(c);
+                    ++idx;
                     break;
                 }
 
                 // If we got here, this is in fact a valid(ish) utf-8 sequence
-                for (std::size_t n = 0; n < encBytes; ++n) {
-                    os << m_str[idx + n];
-                }
-                idx += encBytes - 1;
+                sink.append(m_str.data() + idx, encBytes);
+                idx += encBytes;
                 break;
             }
         }
     }
 
+} // anonymous namespace
+
+    void XmlEncode::encodeTo( std::ostream& os ) const {
+        encodeToSink( m_str, m_forWhat, OstreamSink{ os } );
+    }
+
+    void XmlEncode::encodeTo( std::string& out ) const {
+        encodeToSink( m_str, m_forWhat, StringSink{ out } );
+    }
+
     std::ostream& operator << ( std::ostream& os, XmlEncode const& xmlEncode ) {
         xmlEncode.encodeTo( os );
         return os;
@@ -191,12 +298,16 @@ namespace {
     XmlWriter::~XmlWriter() {
         while( !m_tags.empty() )
             endElement();
+        flush();
     }
 
     XmlWriter& XmlWriter::startElement( std::string const& name ) {
         ensureTagClosed();
         newlineIfNecessary();
-        m_os << m_indent << '<' << name;
+        if( !m_compact )
+            m_buffer += m_indent;
+        m_buffer += '<';
+        m_buffer += name;
         m_tags.push_back( name );
         m_indent += "  ";
         m_tagIsOpen = true;
@@ -213,25 +324,38 @@ namespace {
         newlineIfNecessary();
         m_indent = m_indent.substr( 0, m_indent.size()-2 );
         if( m_tagIsOpen ) {
-            m_os << "/>";
+            m_buffer += "/>";
             m_tagIsOpen = false;
         }
         else {
-            m_os << m_indent << "</" << m_tags.back() << ">";
+            if( !m_compact )
+                m_buffer += m_indent;
+            m_buffer += "</";
+            m_buffer += m_tags.back();
+            m_buffer += '>';
         }
-        m_os << std::endl;
+        m_buffer += '\n';
         m_tags.pop_back();
         return *this;
     }
 
     XmlWriter& XmlWriter::writeAttribute( std::string const& name, std::string const& attribute ) {
-        if( !name.empty() && !attribute.empty() )
-            m_os << ' ' << name << "=\"" << XmlEncode( attribute, XmlEncode::ForAttributes ) << '"';
+        if( !name.empty() && !attribute.empty() ) {
+            m_buffer += ' ';
+            m_buffer += name;
+            m_buffer += "=\"";
+            XmlEncode( attribute, XmlEncode::ForAttributes ).encodeTo( m_buffer );
+            m_buffer += '"';
+        }
         return *this;
     }
 
     XmlWriter& XmlWriter::writeAttribute( std::string const& name, bool attribute ) {
-        m_os << ' ' << name << "=\"" << ( attribute ? "true" : "false" ) << '"';
+        m_buffer += ' ';
+        m_buffer += name;
+        m_buffer += "=\"";
+        m_buffer += ( attribute ? "true" : "false" );
+        m_buffer += '"';
         return *this;
     }
 
@@ -239,9 +363,9 @@ namespace {
         if( !text.empty() ){
             bool tagWasOpen = m_tagIsOpen;
             ensureTagClosed();
-            if( tagWasOpen && indent )
-                m_os << m_indent;
-            m_os << XmlEncode( text );
+            if( tagWasOpen && indent && !m_compact )
+                m_buffer += m_indent;
+            XmlEncode( text ).encodeTo( m_buffer );
             m_needsNewline = true;
         }
         return *this;
@@ -249,36 +373,66 @@ namespace {
 
     XmlWriter& XmlWriter::writeComment( std::string const& text ) {
         ensureTagClosed();
-        m_os << m_indent << "<!--" << text << "-->";
+        if( !m_compact )
+            m_buffer += m_indent;
+        m_buffer += "<!--";
+        m_buffer += text;
+        m_buffer += "-->";
         m_needsNewline = true;
         return *this;
     }
 
     void XmlWriter::writeStylesheetRef( std::string const& url ) {
-        m_os << "<?xml-stylesheet type=\"text/xsl\" href=\"" << url << "\"?>\n";
+        m_buffer += "<?xml-stylesheet type=\"text/xsl\" href=\"";
+        m_buffer += url;
+        m_buffer += "\"?>\n";
     }
 
     XmlWriter& XmlWriter::writeBlankLine() {
         ensureTagClosed();
-        m_os << '\n';
+        m_buffer += '\n';
         return *this;
     }
 
     void XmlWriter::ensureTagClosed() {
         if( m_tagIsOpen ) {
-            m_os << ">" << std::endl;
+            m_buffer += ">\n";
             m_tagIsOpen = false;
         }
     }
 
+    XmlWriter& XmlWriter::flush() {
+        if( !m_buffer.empty() ) {
+            m_os.write( m_buffer.data(), static_cast<std::streamsize>( m_buffer.size() ) );
+            m_os.flush();
+            m_buffer.clear();
+        }
+        return *this;
+    }
+
+    void XmlWriter::useCompactFormatting( bool compact ) {
+        m_compact = compact;
+    }
+
+    std::size_t XmlWriter::bufferPosition() const {
+        return m_buffer.size();
+    }
+
+    void XmlWriter::rewindBuffer( std::size_t position ) {
+        if( position < m_buffer.size() )
+            m_buffer.resize( position );
+    }
+
     void XmlWriter::writeDeclaration() {
-        m_os << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+        m_buffer += "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
     }
 
     void XmlWriter::newlineIfNecessary() {
         if( m_needsNewline ) {
-            m_os << std::endl;
+            m_buffer += '\n';
             m_needsNewline = false;
         }
     }
 }
+
+#endif // CATCH_CONFIG_MINIMAL_RUNTIME
@@ -22,6 +22,7 @@ namespace Catch {
         XmlEncode( std::string const& str, ForWhat forWhat = ForTextNodes );
 
         void encodeTo( std::ostream& os ) const;
+        void encodeTo( std::string& out ) const;
 
         friend std::ostream& operator << ( std::ostream& os, XmlEncode const& xmlEncode );
 
@@ -87,6 +88,24 @@ namespace Catch {
 
         void ensureTagClosed();
 
+        // Writes the internal buffer out to the stream. Everything is
+        // assembled in memory first, so callers should flush at a coarse
+        // granularity - e.g. once per test case - rather than relying on
+        // the stream for buffering. The destructor flushes what is left.
+        XmlWriter& flush();
+
+        // In compact mode no indentation is emitted, which trims a good
+        // chunk off large, deeply nested reports
+        void useCompactFormatting( bool compact );
+
+        // Lets a caller drop an already-written balanced subtree from the
+        // unflushed buffer: capture the position before starting the
+        // subtree's first element, and rewind once its last element has
+        // been ended. Both points must be outside any open tag and at the
+        // same nesting depth, or the document is corrupted.
+        std::size_t bufferPosition() const;
+        void rewindBuffer( std::size_t position );
+
     private:
 
         void writeDeclaration();
@@ -95,8 +114,11 @@ namespace Catch {
 
         bool m_tagIsOpen = false;
         bool m_needsNewline = false;
+        bool m_compact = false;
         std::vector<std::string> m_tags;
         std::string m_indent;
+        // Grow-only: cleared on flush but keeps its capacity
+        std::string m_buffer;
         std::ostream& m_os;
     };
 
@@ -148,6 +148,9 @@ namespace Catch {
             stream( _config.stream() )
         {
             m_reporterPrefs.shouldRedirectStdOut = false;
+            // Assertions are buffered into the section tree regardless, so
+            // one batched call per section loses nothing
+            m_reporterPrefs.shouldBatchAssertions = true;
             if( !DerivedT::getSupportedVerbosities().count( m_config->verbosity() ) )
                 CATCH_ERROR( "Verbosity level not supported by this reporter" );
         }
@@ -205,6 +208,14 @@ namespace Catch {
             sectionNode.assertions.push_back(assertionStats);
             return true;
         }
+        void assertionsEnded(std::vector<AssertionStats> const& batch) override {
+            // Routed through the virtual assertionEnded so per-assertion
+            // bookkeeping in derived reporters still runs; the saving is
+            // on the runner side, which delivered the whole section in
+            // one call
+            for (auto const& assertionStats : batch)
+                static_cast<void>(assertionEnded(assertionStats));
+        }
         void sectionEnded(SectionStats const& sectionStats) override {
             assert(!m_sectionStack.empty());
             SectionNode& node = *m_sectionStack.back();
@@ -0,0 +1,194 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#if !defined(CATCH_CONFIG_MINIMAL_RUNTIME)
+
+#include "catch_reporter_binary.h"
+
+#include "../internal/catch_reporter_registrars.hpp"
+#include "../internal/catch_stream.h"
+
+#include <cstring>
+
+namespace Catch {
+
+    // Record types and payload layouts (see the header for the primitives):
+    //
+    //   0x01 TestRunStarting    str name
+    //   0x02 TestGroupStarting  str name | u64 groupIndex | u64 groupsCount
+    //   0x03 TestCaseStarting   str name | str className | str filename | u64 line
+    //   0x04 SectionStarting    str name | str filename | u64 line
+    //   0x05 AssertionEnded     u32 resultType | u8 ok | str macroName |
+    //                           str expression | str expandedExpression |
+    //                           str messages | str filename | u64 line
+    //   0x06 SectionEnded       str name | counts assertions | f64 durationInSeconds
+    //   0x07 TestCaseEnded      str name | counts assertions | str stdOut | str stdErr
+    //   0x08 TestGroupEnded     str name | counts assertions | counts testCases | u8 aborting
+    //   0x09 TestRunEnded       str name | counts assertions | counts testCases | u8 aborting
+    //
+    // where "counts" is u64 passed | u64 failed | u64 failedButOk.
+    namespace {
+        static const char binaryReportMagic[] = { 'C', 'B', 'R', 'S' };
+        static const uint8_t binaryReportVersion = 1;
+
+        enum class RecordType : uint8_t {
+            TestRunStarting = 0x01,
+            TestGroupStarting = 0x02,
+            TestCaseStarting = 0x03,
+            SectionStarting = 0x04,
+            AssertionEnded = 0x05,
+            SectionEnded = 0x06,
+            TestCaseEnded = 0x07,
+            TestGroupEnded = 0x08,
+            TestRunEnded = 0x09
+        };
+    } // anonymous namespace
+
+    BinaryReporter::BinaryReporter( ReporterConfig const& _config )
+    :   StreamingReporterBase( _config ) {
+        m_reporterPrefs.shouldRedirectStdOut = true;
+        m_reporterPrefs.shouldReportAllAssertions = true;
+        stream.write( binaryReportMagic, sizeof(binaryReportMagic) );
+        stream.put( static_cast<char>( binaryReportVersion ) );
+    }
+
+    BinaryReporter::~BinaryReporter() {}
+
+    std::string BinaryReporter::getDescription() {
+        return "Writes length-prefixed binary records for cheap machine parsing";
+    }
+
+    void BinaryReporter::push8( uint8_t value ) {
+        m_payload.push_back( static_cast<char>( value ) );
+    }
+    void BinaryReporter::push32( uint32_t value ) {
+        for( int shift = 0; shift < 32; shift += 8 )
+            m_payload.push_back( static_cast<char>( ( value >> shift ) & 0xff ) );
+    }
+    void BinaryReporter::push64( uint64_t value ) {
+        for( int shift = 0; shift < 64; shift += 8 )
+            m_payload.push_back( static_cast<char>( ( value >> shift ) & 0xff ) );
+    }
+    void BinaryReporter::pushDouble( double value ) {
+        uint64_t bits;
+        static_assert( sizeof(bits) == sizeof(value), "unexpected double size" );
+        std::memcpy( &bits, &value, sizeof(bits) );
+        push64( bits );
+    }
+    void BinaryReporter::pushString( std::string const& value ) {
+        push32( static_cast<uint32_t>( value.size() ) );
+        m_payload.append( value );
+    }
+    void BinaryReporter::pushCounts( Counts const& counts ) {
+        push64( counts.passed );
+        push64( counts.failed );
+        push64( counts.failedButOk );
+    }
+    void BinaryReporter::endRecord( uint8_t recordType ) {
+        char prefix[5];
+        prefix[0] = static_cast<char>( recordType );
+        auto length = static_cast<uint32_t>( m_payload.size() );
+        for( int i = 0; i < 4; ++i )
+            prefix[i+1] = static_cast<char>( ( length >> (i*8) ) & 0xff );
+        stream.write( prefix, sizeof(prefix) );
+        stream.write( m_payload.data(), static_cast<std::streamsize>( m_payload.size() ) );
+        m_payload.clear();
+    }
+
+    void BinaryReporter::testRunStarting( TestRunInfo const& runInfo ) {
+        StreamingReporterBase::testRunStarting( runInfo );
+        pushString( runInfo.name );
+        endRecord( static_cast<uint8_t>( RecordType::TestRunStarting ) );
+    }
+
+    void BinaryReporter::testGroupStarting( GroupInfo const& groupInfo ) {
+        StreamingReporterBase::testGroupStarting( groupInfo );
+        pushString( groupInfo.name );
+        push64( groupInfo.groupIndex );
+        push64( groupInfo.groupsCounts );
+        endRecord( static_cast<uint8_t>( RecordType::TestGroupStarting ) );
+    }
+
+    void BinaryReporter::testCaseStarting( TestCaseInfo const& testCaseInfo ) {
+        StreamingReporterBase::testCaseStarting( testCaseInfo );
+        pushString( testCaseInfo.name );
+        pushString( testCaseInfo.className );
+        pushString( testCaseInfo.lineInfo.file );
+        push64( testCaseInfo.lineInfo.line );
+        endRecord( static_cast<uint8_t>( RecordType::TestCaseStarting ) );
+    }
+
+    void BinaryReporter::sectionStarting( SectionInfo const& sectionInfo ) {
+        StreamingReporterBase::sectionStarting( sectionInfo );
+        pushString( sectionInfo.name );
+        pushString( sectionInfo.lineInfo.file );
+        push64( sectionInfo.lineInfo.line );
+        endRecord( static_cast<uint8_t>( RecordType::SectionStarting ) );
+    }
+
+    void BinaryReporter::assertionStarting( AssertionInfo const& ) {}
+
+    bool BinaryReporter::assertionEnded( AssertionStats const& assertionStats ) {
+        AssertionResult const& result = assertionStats.assertionResult;
+
+        push32( static_cast<uint32_t>( result.getResultType() ) );
+        push8( result.isOk() ? 1 : 0 );
+        pushString( result.getTestMacroName() );
+        pushString( result.hasExpression() ? result.getExpression() : std::string() );
+        pushString( result.hasExpression() ? result.getExpandedExpression() : std::string() );
+
+        ReusableStringStream messages;
+        if( !result.getMessage().empty() )
+            messages << result.getMessage() << '\n';
+        for( auto const& msg : assertionStats.infoMessages )
+            if( msg.type == ResultWas::Info )
+                messages << msg.message << '\n';
+        pushString( messages.str() );
+
+        pushString( result.getSourceInfo().file );
+        push64( result.getSourceInfo().line );
+        endRecord( static_cast<uint8_t>( RecordType::AssertionEnded ) );
+        return true;
+    }
+
+    void BinaryReporter::sectionEnded( SectionStats const& sectionStats ) {
+        pushString( sectionStats.sectionInfo.name );
+        pushCounts( sectionStats.assertions );
+        pushDouble( sectionStats.durationInSeconds );
+        endRecord( static_cast<uint8_t>( RecordType::SectionEnded ) );
+        StreamingReporterBase::sectionEnded( sectionStats );
+    }
+
+    void BinaryReporter::testCaseEnded( TestCaseStats const& testCaseStats ) {
+        pushString( testCaseStats.testInfo.name );
+        pushCounts( testCaseStats.totals.assertions );
+        pushString( testCaseStats.stdOut );
+        pushString( testCaseStats.stdErr );
+        endRecord( static_cast<uint8_t>( RecordType::TestCaseEnded ) );
+        StreamingReporterBase::testCaseEnded( testCaseStats );
+    }
+
+    void BinaryReporter::testGroupEnded( TestGroupStats const& testGroupStats ) {
+        pushString( testGroupStats.groupInfo.name );
+        pushCounts( testGroupStats.totals.assertions );
+        pushCounts( testGroupStats.totals.testCases );
+        push8( testGroupStats.aborting ? 1 : 0 );
+        endRecord( static_cast<uint8_t>( RecordType::TestGroupEnded ) );
+        StreamingReporterBase::testGroupEnded( testGroupStats );
+    }
+
+    void BinaryReporter::testRunEnded( TestRunStats const& testRunStats ) {
+        pushString( testRunStats.runInfo.name );
+        pushCounts( testRunStats.totals.assertions );
+        pushCounts( testRunStats.totals.testCases );
+        push8( testRunStats.aborting ? 1 : 0 );
+        endRecord( static_cast<uint8_t>( RecordType::TestRunEnded ) );
+        stream.flush();
+        StreamingReporterBase::testRunEnded( testRunStats );
+    }
+
+} // end namespace Catch
+
+#endif // CATCH_CONFIG_MINIMAL_RUNTIME
@@ -0,0 +1,68 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_REPORTER_BINARY_H_INCLUDED
+#define TWOBLUECUBES_CATCH_REPORTER_BINARY_H_INCLUDED
+
+#include "catch_reporter_bases.hpp"
+
+#include <cstdint>
+
+namespace Catch {
+
+    // Writes the test run as a compact stream of length-prefixed binary
+    // records, one per reporter event, so downstream tooling can parse
+    // results without the cost of XML encoding and decoding. The format is
+    // deliberately trivial to read - see scripts/binaryReportReader.py for
+    // a reference reader.
+    //
+    // The stream starts with the magic bytes "CBRS" and a format version
+    // byte, followed by records of the form
+    //
+    //     u8 recordType | u32 payloadLength | payload
+    //
+    // All integers are little-endian; strings are a u32 byte count followed
+    // by the UTF-8 bytes; doubles are 8 raw IEEE-754 bytes. Record types
+    // and payload layouts are documented in the implementation file.
+    //
+    // Intended for use with a file (-o <filename>) - binary output to a
+    // console is neither useful nor, on Windows, safe from newline
+    // translation.
+    class BinaryReporter : public StreamingReporterBase<BinaryReporter> {
+    public:
+        BinaryReporter( ReporterConfig const& _config );
+        ~BinaryReporter() override;
+
+        static std::string getDescription();
+
+        void testRunStarting( TestRunInfo const& runInfo ) override;
+        void testGroupStarting( GroupInfo const& groupInfo ) override;
+        void testCaseStarting( TestCaseInfo const& testCaseInfo ) override;
+        void sectionStarting( SectionInfo const& sectionInfo ) override;
+
+        void assertionStarting( AssertionInfo const& assertionInfo ) override;
+        bool assertionEnded( AssertionStats const& assertionStats ) override;
+
+        void sectionEnded( SectionStats const& sectionStats ) override;
+        void testCaseEnded( TestCaseStats const& testCaseStats ) override;
+        void testGroupEnded( TestGroupStats const& testGroupStats ) override;
+        void testRunEnded( TestRunStats const& testRunStats ) override;
+
+    private:
+        // Records are staged in m_payload (reused between records, so the
+        // steady state is allocation free) and written out in one go
+        void push8( uint8_t value );
+        void push32( uint32_t value );
+        void push64( uint64_t value );
+        void pushDouble( double value );
+        void pushString( std::string const& value );
+        void pushCounts( Counts const& counts );
+        void endRecord( uint8_t recordType );
+
+        std::string m_payload;
+    };
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_REPORTER_BINARY_H_INCLUDED
@@ -5,11 +5,15 @@
  *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
  */
 
+#if !defined(CATCH_CONFIG_MINIMAL_RUNTIME)
+
 #include "catch_reporter_compact.h"
 
 #include "../internal/catch_reporter_registrars.hpp"
 #include "internal/catch_console_colour.h"
 
+#include <cstring>
+
 namespace {
 
 #ifdef CATCH_PLATFORM_MAC
@@ -69,6 +73,11 @@ void printTotals(std::ostream& out, const Totals& totals) {
             << pluralise(totals.testCases.passed, "test case") <<
             " with " << pluralise(totals.assertions.passed, "assertion") << '.';
     }
+    if (totals.testCases.passedOnRetry > 0) {
+        Colour colour(Colour::Warning);
+        out << " (" << pluralise(totals.testCases.passedOnRetry, "test case")
+            << " passed only on retry)";
+    }
 }
 
 // Implementation of CompactReporter formatting
@@ -238,6 +247,78 @@ private:
     bool printInfoMessages;
 };
 
+// Fast formatting path for plain passed/failed lines. Machine-read CI
+// logs are dominated by assertions with no info messages and colour
+// off; those lines are assembled into a fixed stack buffer with direct
+// copies and handed to the stream as a single write, instead of a dozen
+// small operator<< calls (and colour guards) per assertion.
+class CompactLineBuffer {
+public:
+    bool append( char c ) {
+        if( m_used >= sizeof(m_buffer) )
+            return false;
+        m_buffer[m_used++] = c;
+        return true;
+    }
+    bool append( char const* data, std::size_t size ) {
+        if( size > sizeof(m_buffer) - m_used )
+            return false;
+        std::memcpy( m_buffer + m_used, data, size );
+        m_used += size;
+        return true;
+    }
+    bool append( char const* str ) {
+        return append( str, std::strlen( str ) );
+    }
+    bool append( std::string const& str ) {
+        return append( str.data(), str.size() );
+    }
+    bool appendNumber( std::size_t value ) {
+        // Enough for a 64 bit value
+        char digits[20];
+        std::size_t n = 0;
+        do {
+            digits[n++] = static_cast<char>( '0' + value % 10 );
+            value /= 10;
+        } while( value );
+        while( n )
+            if( !append( digits[--n] ) )
+                return false;
+        return true;
+    }
+    char const* data() const { return m_buffer; }
+    std::size_t size() const { return m_used; }
+
+private:
+    char m_buffer[1024];
+    std::size_t m_used = 0;
+};
+
+// Writes the exact line the AssertionPrinter would produce for a plain
+// passed or failed result. Returns false, writing nothing, when the
+// line does not fit the buffer - the caller then falls back to the
+// general path.
+bool printFastResultLine( std::ostream& out, AssertionResult const& result, char const* passOrFail ) {
+    CompactLineBuffer line;
+    SourceLineInfo const lineInfo = result.getSourceInfo();
+    bool ok = line.append( lineInfo.file );
+#ifndef __GNUG__
+    ok = ok && line.append( '(' ) && line.appendNumber( lineInfo.line ) && line.append( ')' );
+#else
+    ok = ok && line.append( ':' ) && line.appendNumber( lineInfo.line );
+#endif
+    ok = ok && line.append( ": ", 2 ) && line.append( passOrFail ) && line.append( ':' );
+    if( result.hasExpression() )
+        ok = ok && line.append( ' ' ) && line.append( result.getExpression() );
+    if( result.hasExpandedExpression() )
+        ok = ok && line.append( " for: ", 6 ) && line.append( result.getExpandedExpression() );
+    ok = ok && line.append( '\n' );
+    if( !ok )
+        return false;
+    out.write( line.data(), static_cast<std::streamsize>( line.size() ) );
+    return true;
+}
+
 } // anon namespace
 
         std::string CompactReporter::getDescription() {
@@ -266,6 +347,21 @@ private:
                 printInfoMessages = false;
             }
 
+            // With colour off and no info messages the common passed and
+            // failed lines take the stack-buffer fast path; anything more
+            // involved keeps the full printer
+            if( colourIsDisabled() && _assertionStats.infoMessages.empty() ) {
+                auto type = result.getResultType();
+                char const* passOrFail =
+                    type == ResultWas::Ok ? passedString() :
+                    type == ResultWas::ExpressionFailed && !result.isOk() ? failedString() :
+                    nullptr;
+                if( passOrFail && printFastResultLine( stream, result, passOrFail ) ) {
+                    stream.flush();
+                    return true;
+                }
+            }
+
             AssertionPrinter printer( stream, _assertionStats, printInfoMessages );
             printer.print();
 
@@ -287,6 +383,6 @@ private:
 
         CompactReporter::~CompactReporter() {}
 
-    CATCH_REGISTER_REPORTER( "compact", CompactReporter )
-
 } // end namespace Catch
+
+#endif // CATCH_CONFIG_MINIMAL_RUNTIME
@@ -14,6 +14,7 @@
 #include "../internal/catch_text.h"
 #include "../internal/catch_stringref.h"
 
+#include <algorithm>
 #include <cfloat>
 #include <cstdio>
 
@@ -141,7 +142,8 @@ private:
         if (result.hasExpandedExpression()) {
             stream << "with expansion:\n";
             Colour colourGuard(Colour::ReconstructedExpression);
-            stream << Column(result.getExpandedExpression()).indent(2) << '\n';
+            printWrapped(stream, result.getExpandedExpression(), CATCH_CONFIG_CONSOLE_WIDTH - 1, 2);
+            stream << '\n';
         }
     }
     void printMessage() const {
@@ -149,8 +151,10 @@ private:
             stream << messageLabel << ':' << '\n';
         for (auto const& msg : messages) {
             // If this assertion is a warning ignore any INFO messages
-            if (printInfoMessages || msg.type != ResultWas::Info)
-                stream << Column(msg.message).indent(2) << '\n';
+            if (printInfoMessages || msg.type != ResultWas::Info) {
+                printWrapped(stream, msg.message, CATCH_CONFIG_CONSOLE_WIDTH - 1, 2);
+                stream << '\n';
+            }
         }
     }
     void printSourceInfo() const {
@@ -341,10 +345,11 @@ ConsoleReporter::ConsoleReporter(ReporterConfig const& config)
     : StreamingReporterBase(config),
     m_tablePrinter(new TablePrinter(config.stream(),
     {
-        { "benchmark name", CATCH_CONFIG_CONSOLE_WIDTH - 32, ColumnInfo::Left },
-        { "iters", 8, ColumnInfo::Right },
-        { "elapsed ns", 14, ColumnInfo::Right },
-        { "average", 14, ColumnInfo::Right }
+        { "benchmark name", CATCH_CONFIG_CONSOLE_WIDTH - 44, ColumnInfo::Left },
+        { "samples", 8, ColumnInfo::Right },
+        { "iters", 10, ColumnInfo::Right },
+        { "mean", 12, ColumnInfo::Right },
+        { "std dev", 12, ColumnInfo::Right }
     })) {}
 ConsoleReporter::~ConsoleReporter() = default;
 
@@ -390,7 +395,9 @@ void ConsoleReporter::sectionEnded(SectionStats const& _sectionStats) {
             stream << "\nNo assertions in test case";
         stream << " '" << _sectionStats.sectionInfo.name << "'\n" << std::endl;
     }
-    if (m_config->showDurations() == ShowDurations::Always) {
+    if (m_config->slowestDurations() > 0) {
+        recordDuration(_sectionStats.durationInSeconds, _sectionStats.sectionInfo.name);
+    } else if (m_config->showDurations() == ShowDurations::Always) {
         stream << getFormattedDuration(_sectionStats.durationInSeconds) << " s: " << _sectionStats.sectionInfo.name << std::endl;
     }
     if (m_headerPrinted) {
@@ -408,7 +415,7 @@ void ConsoleReporter::benchmarkStarting(BenchmarkInfo const& info) {
     bool firstLine = true;
     for (auto line : nameCol) {
         if (!firstLine)
-            (*m_tablePrinter) << ColumnBreak() << ColumnBreak() << ColumnBreak();
+            (*m_tablePrinter) << ColumnBreak() << ColumnBreak() << ColumnBreak() << ColumnBreak();
         else
             firstLine = false;
 
@@ -416,15 +423,72 @@ void ConsoleReporter::benchmarkStarting(BenchmarkInfo const& info) {
     }
 }
 void ConsoleReporter::benchmarkEnded(BenchmarkStats const& stats) {
-    Duration average(stats.elapsedTimeInNanoseconds / stats.iterations);
+    Duration mean(static_cast<uint64_t>(stats.meanNs + 0.5));
+    Duration stdDev(static_cast<uint64_t>(stats.standardDeviationNs + 0.5));
     (*m_tablePrinter)
+        << stats.samples << ColumnBreak()
         << stats.iterations << ColumnBreak()
-        << stats.elapsedTimeInNanoseconds << ColumnBreak()
-        << average << ColumnBreak();
+        << mean << ColumnBreak()
+        << stdDev << ColumnBreak();
+
+    if (stats.perfCounters.sampled && stats.iterations > 0) {
+        auto const& pc = stats.perfCounters;
+        auto iterations = static_cast<double>(stats.iterations);
+        ReusableStringStream rss;
+        rss << "  " << static_cast<double>(pc.cycles) / iterations << " cycles/it, "
+            << static_cast<double>(pc.instructions) / iterations << " instr/it";
+        if (pc.cycles > 0)
+            rss << " (IPC " << static_cast<double>(pc.instructions) / static_cast<double>(pc.cycles) << ')';
+        rss << ", " << static_cast<double>(pc.cacheMisses) / iterations << " cache miss/it, "
+            << static_cast<double>(pc.branchMisses) / iterations << " branch miss/it";
+        stream << rss.str() << '\n';
+    }
+
+    if (stats.allocMetrics.sampled) {
+        auto const& am = stats.allocMetrics;
+        auto iterations = static_cast<double>(stats.iterations);
+        ReusableStringStream rss;
+        rss << "  " << static_cast<double>(am.allocations) / iterations << " allocs/it, "
+            << static_cast<double>(am.bytesAllocated) / iterations << " B/it, peak live "
+            << am.peakLiveBytes << " B";
+        stream << rss.str() << '\n';
+    }
+
+    if (stats.comparative) {
+        ReusableStringStream rss;
+        rss << "  " << stats.ratioToBaseline << "x baseline +/- "
+            << stats.ratioConfidence << " (" << stats.confidenceLevel * 100 << "%)";
+        stream << rss.str() << '\n';
+    }
+
+    // The frequency state is always in the payload; it is only printed
+    // when the run asked for pinning, i.e. when stability is being tuned
+    if (stats.cpuState.pinnedCore >= 0) {
+        ReusableStringStream rss;
+        rss << "  pinned to core " << stats.cpuState.pinnedCore;
+        if (!stats.cpuState.governor.empty())
+            rss << ", governor: " << stats.cpuState.governor;
+        if (stats.cpuState.turboEnabled >= 0)
+            rss << ", turbo " << (stats.cpuState.turboEnabled ? "on" : "off");
+        stream << rss.str() << '\n';
+    }
 }
 
 void ConsoleReporter::testCaseEnded(TestCaseStats const& _testCaseStats) {
     m_tablePrinter->close();
+    if (_testCaseStats.resourceUsage.sampled) {
+        auto const& usage = _testCaseStats.resourceUsage;
+        stream << "Resources: "
+               << getFormattedDuration(usage.userCpuSeconds) << " s user, "
+               << getFormattedDuration(usage.systemCpuSeconds) << " s sys, peak RSS +"
+               << usage.peakRssKb << " KB, "
+               << usage.minorPageFaults << '/' << usage.majorPageFaults
+               << " minor/major faults: " << _testCaseStats.testInfo.name << std::endl;
+    }
+    if (_testCaseStats.stackPeakBytes >= 0) {
+        stream << "Stack: peak " << _testCaseStats.stackPeakBytes
+               << " bytes: " << _testCaseStats.testInfo.name << std::endl;
+    }
     StreamingReporterBase::testCaseEnded(_testCaseStats);
     m_headerPrinted = false;
 }
@@ -438,6 +502,7 @@ void ConsoleReporter::testGroupEnded(TestGroupStats const& _testGroupStats) {
     StreamingReporterBase::testGroupEnded(_testGroupStats);
 }
 void ConsoleReporter::testRunEnded(TestRunStats const& _testRunStats) {
+    printSlowestDurations();
     printTotalsDivider(_testRunStats.totals);
     printTotals(_testRunStats.totals);
     stream << std::endl;
@@ -580,6 +645,11 @@ void ConsoleReporter::printTotals( Totals const& totals ) {
         printSummaryRow("test cases", columns, 0);
         printSummaryRow("assertions", columns, 1);
     }
+    if (totals.testCases.passedOnRetry > 0) {
+        stream << Colour(Colour::Warning)
+            << pluralise(totals.testCases.passedOnRetry, "test case")
+            << " passed only on retry\n";
+    }
 }
 void ConsoleReporter::printSummaryRow(std::string const& label, std::vector<SummaryColumn> const& cols, std::size_t row) {
     for (auto col : cols) {
@@ -624,7 +694,33 @@ void ConsoleReporter::printSummaryDivider() {
     stream << getLineOfChars<'-'>() << '\n';
 }
 
-CATCH_REGISTER_REPORTER("console", ConsoleReporter)
+namespace {
+    bool fasterEntry(std::pair<double, std::string> const& lhs, std::pair<double, std::string> const& rhs) {
+        return lhs.first > rhs.first;
+    }
+}
+
+void ConsoleReporter::recordDuration(double durationInSeconds, std::string const& name) {
+    // Min-heap of the n slowest entries seen so far, so memory and work
+    // per section stay constant no matter how large the run is
+    if (m_slowestDurations.size() < m_config->slowestDurations()) {
+        m_slowestDurations.emplace_back(durationInSeconds, name);
+        std::push_heap(m_slowestDurations.begin(), m_slowestDurations.end(), fasterEntry);
+    } else if (durationInSeconds > m_slowestDurations.front().first) {
+        std::pop_heap(m_slowestDurations.begin(), m_slowestDurations.end(), fasterEntry);
+        m_slowestDurations.back() = std::make_pair(durationInSeconds, name);
+        std::push_heap(m_slowestDurations.begin(), m_slowestDurations.end(), fasterEntry);
+    }
+}
+void ConsoleReporter::printSlowestDurations() {
+    if (m_slowestDurations.empty())
+        return;
+    std::sort_heap(m_slowestDurations.begin(), m_slowestDurations.end(), fasterEntry);
+    stream << getLineOfChars<'-'>() << '\n'
+           << "Slowest " << m_slowestDurations.size() << " durations:\n";
+    for (auto const& entry : m_slowestDurations)
+        stream << getFormattedDuration(entry.first) << " s: " << entry.second << '\n';
+}
 
 } // end namespace Catch
 
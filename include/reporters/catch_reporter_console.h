@@ -70,7 +70,13 @@ namespace Catch {
         void printTotalsDivider(Totals const& totals);
         void printSummaryDivider();
 
+        // Used with --durations-top: keeps the n slowest entries in a
+        // fixed-size min-heap instead of printing a line per section
+        void recordDuration(double durationInSeconds, std::string const& name);
+        void printSlowestDurations();
+
     private:
+        std::vector<std::pair<double, std::string>> m_slowestDurations;
         bool m_headerPrinted = false;
     };
 
@@ -0,0 +1,199 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#if !defined(CATCH_CONFIG_MINIMAL_RUNTIME)
+
+#include "catch_reporter_diff.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+namespace Catch {
+
+    namespace {
+
+        // Cursor over one record's payload. Reads are bounds-checked so a
+        // truncated or corrupt baseline degrades to "no baseline" instead
+        // of reading garbage.
+        struct PayloadCursor {
+            char const* data;
+            std::size_t size;
+            std::size_t pos = 0;
+            bool ok = true;
+
+            PayloadCursor( char const* _data, std::size_t _size )
+            :   data( _data ),
+                size( _size )
+            {}
+
+            uint64_t read64() {
+                if( pos + 8 > size ) {
+                    ok = false;
+                    return 0;
+                }
+                uint64_t value = 0;
+                for( int shift = 0; shift < 64; shift += 8 )
+                    value |= static_cast<uint64_t>( static_cast<unsigned char>( data[pos++] ) ) << shift;
+                return value;
+            }
+            double readDouble() {
+                uint64_t bits = read64();
+                double value;
+                std::memcpy( &value, &bits, sizeof(value) );
+                return value;
+            }
+            std::string readString() {
+                if( pos + 4 > size ) {
+                    ok = false;
+                    return std::string();
+                }
+                uint32_t length = 0;
+                for( int shift = 0; shift < 32; shift += 8 )
+                    length |= static_cast<uint32_t>( static_cast<unsigned char>( data[pos++] ) ) << shift;
+                if( pos + length > size ) {
+                    ok = false;
+                    return std::string();
+                }
+                std::string value( data + pos, length );
+                pos += length;
+                return value;
+            }
+        };
+
+        // Replays a binary report (see catch_reporter_binary.cpp for the
+        // format), keeping per test case what the diff needs: whether it
+        // failed and how long it took. The duration comes from the
+        // SectionEnded record of the root section, which shares the test
+        // case's name; TestCaseEnded itself carries only the counts.
+        // Returns false if the file is missing, is not a binary report or
+        // is damaged.
+        bool loadDiffBaseline( std::string const& filename, std::map<std::string, DiffReporter::BaselineEntry>& baseline ) {
+            std::ifstream file( filename, std::ios::binary );
+            if( !file )
+                return false;
+            std::string data( ( std::istreambuf_iterator<char>( file ) ), std::istreambuf_iterator<char>() );
+            if( data.size() < 5 || std::memcmp( data.data(), "CBRS", 4 ) != 0 || data[4] != 1 )
+                return false;
+
+            std::string currentTest;
+            double currentDuration = 0;
+            std::size_t pos = 5;
+            while( pos + 5 <= data.size() ) {
+                auto recordType = static_cast<unsigned char>( data[pos] );
+                uint32_t length = 0;
+                for( int shift = 0; shift < 32; shift += 8 )
+                    length |= static_cast<uint32_t>( static_cast<unsigned char>( data[pos + 1 + shift/8] ) ) << shift;
+                pos += 5;
+                if( pos + length > data.size() )
+                    return false;
+
+                PayloadCursor payload( data.data() + pos, length );
+                switch( recordType ) {
+                    case 0x03: // TestCaseStarting
+                        currentTest = payload.readString();
+                        currentDuration = 0;
+                        break;
+                    case 0x06: { // SectionEnded
+                        auto name = payload.readString();
+                        payload.read64(); // passed
+                        payload.read64(); // failed
+                        payload.read64(); // failedButOk
+                        auto duration = payload.readDouble();
+                        if( payload.ok && name == currentTest )
+                            currentDuration = duration;
+                        break;
+                    }
+                    case 0x07: { // TestCaseEnded
+                        auto name = payload.readString();
+                        payload.read64(); // passed
+                        auto failed = payload.read64();
+                        if( payload.ok )
+                            baseline[name] = { failed > 0, currentDuration };
+                        break;
+                    }
+                    default:
+                        break;
+                }
+                if( !payload.ok )
+                    return false;
+                pos += length;
+            }
+            return pos == data.size();
+        }
+
+    } // anonymous namespace
+
+    DiffReporter::DiffReporter( ReporterConfig const& _config )
+    :   StreamingReporterBase( _config ) {
+        m_reporterPrefs.shouldRedirectStdOut = true;
+        auto baselineFile = m_config->diffBaselineFile();
+        if( !baselineFile.empty() )
+            m_baselineLoaded = loadDiffBaseline( baselineFile, m_baseline );
+        if( !m_baselineLoaded )
+            stream << "No usable baseline (--diff-baseline"
+                   << ( baselineFile.empty() ? std::string() : " '" + baselineFile + "'" )
+                   << ") - reporting all test cases\n";
+    }
+
+    DiffReporter::~DiffReporter() {}
+
+    std::string DiffReporter::getDescription() {
+        return "Reports only test cases that changed against a previous run's binary report";
+    }
+
+    void DiffReporter::assertionStarting( AssertionInfo const& ) {}
+
+    bool DiffReporter::assertionEnded( AssertionStats const& ) {
+        return true;
+    }
+
+    void DiffReporter::sectionEnded( SectionStats const& sectionStats ) {
+        // The root section carries the test case's duration and shares
+        // its name
+        if( currentTestCaseInfo && sectionStats.sectionInfo.name == currentTestCaseInfo->name )
+            m_currentDuration = sectionStats.durationInSeconds;
+        StreamingReporterBase::sectionEnded( sectionStats );
+    }
+
+    void DiffReporter::testCaseEnded( TestCaseStats const& testCaseStats ) {
+        ++m_seen;
+        auto const& name = testCaseStats.testInfo.name;
+        bool nowFailed = testCaseStats.totals.assertions.failed > 0;
+        char const* nowLabel = nowFailed ? "failed" : "passed";
+
+        auto it = m_baseline.find( name );
+        if( it == m_baseline.end() ) {
+            stream << name << ": new, " << nowLabel << '\n';
+            ++m_changed;
+        }
+        else if( it->second.failed != nowFailed ) {
+            stream << name << ": " << ( it->second.failed ? "failed" : "passed" )
+                   << " -> " << nowLabel << '\n';
+            ++m_changed;
+        }
+        else {
+            auto threshold = m_config->diffDurationThreshold();
+            if( threshold > 0 && std::abs( m_currentDuration - it->second.durationInSeconds ) >= threshold ) {
+                stream << name << ": duration " << getFormattedDuration( it->second.durationInSeconds )
+                       << "s -> " << getFormattedDuration( m_currentDuration ) << "s\n";
+                ++m_changed;
+            }
+        }
+        m_currentDuration = 0;
+        StreamingReporterBase::testCaseEnded( testCaseStats );
+    }
+
+    void DiffReporter::testRunEnded( TestRunStats const& testRunStats ) {
+        if( m_baselineLoaded )
+            stream << m_changed << " of " << m_seen << " test cases changed\n";
+        stream.flush();
+        StreamingReporterBase::testRunEnded( testRunStats );
+    }
+
+} // end namespace Catch
+
+#endif // CATCH_CONFIG_MINIMAL_RUNTIME
@@ -0,0 +1,55 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_REPORTER_DIFF_H_INCLUDED
+#define TWOBLUECUBES_CATCH_REPORTER_DIFF_H_INCLUDED
+
+#include "catch_reporter_bases.hpp"
+
+#include <map>
+
+namespace Catch {
+
+    // Reports the run as a diff against a previous run: only test cases
+    // whose outcome changed produce a line. The baseline is the previous
+    // run's binary report (-r binary, see catch_reporter_binary.h), named
+    // with --diff-baseline. A test case is reported when it is not in the
+    // baseline, when it flipped between passing and failing, or when its
+    // duration moved by at least --diff-duration-threshold seconds. On a
+    // large suite where most outcomes repeat run after run this shrinks
+    // the report - and everything downstream that renders it - to the
+    // handful of entries a reviewer actually reads.
+    //
+    // Without a usable baseline every test case counts as new, so the
+    // first run of a pipeline degrades to a full (if terse) report.
+    class DiffReporter : public StreamingReporterBase<DiffReporter> {
+    public:
+        struct BaselineEntry {
+            bool failed;
+            double durationInSeconds;
+        };
+
+        DiffReporter( ReporterConfig const& _config );
+        ~DiffReporter() override;
+
+        static std::string getDescription();
+
+        void assertionStarting( AssertionInfo const& assertionInfo ) override;
+        bool assertionEnded( AssertionStats const& assertionStats ) override;
+
+        void sectionEnded( SectionStats const& sectionStats ) override;
+        void testCaseEnded( TestCaseStats const& testCaseStats ) override;
+        void testRunEnded( TestRunStats const& testRunStats ) override;
+
+    private:
+        std::map<std::string, BaselineEntry> m_baseline;
+        bool m_baselineLoaded = false;
+        double m_currentDuration = 0;
+        std::size_t m_changed = 0;
+        std::size_t m_seen = 0;
+    };
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_REPORTER_DIFF_H_INCLUDED
@@ -0,0 +1,133 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#if !defined(CATCH_CONFIG_MINIMAL_RUNTIME)
+
+#include "catch_reporter_jsonl.h"
+
+#include "../internal/catch_reporter_registrars.hpp"
+
+#include <cstdio>
+
+namespace Catch {
+
+    JsonlReporter::JsonlReporter( ReporterConfig const& _config )
+    :   StreamingReporterBase( _config ) {
+        m_reporterPrefs.shouldRedirectStdOut = true;
+        m_reporterPrefs.shouldReportAllAssertions = true;
+    }
+
+    JsonlReporter::~JsonlReporter() {}
+
+    std::string JsonlReporter::getDescription() {
+        return "Reports test results as newline-delimited JSON, one object per event";
+    }
+
+    void JsonlReporter::writeJsonString( std::string const& value ) {
+        stream << '"';
+        for( unsigned char c : value ) {
+            switch( c ) {
+                case '"':  stream << "\\\""; break;
+                case '\\': stream << "\\\\"; break;
+                case '\n': stream << "\\n"; break;
+                case '\t': stream << "\\t"; break;
+                case '\r': stream << "\\r"; break;
+                default:
+                    if( c < 0x20 ) {
+                        char buffer[8];
+                        std::snprintf( buffer, sizeof(buffer), "\\u%04x", c );
+                        stream << buffer;
+                    }
+                    else
+                        stream << static_cast<char>( c );
+            }
+        }
+        stream << '"';
+    }
+
+    void JsonlReporter::testRunStarting( TestRunInfo const& runInfo ) {
+        StreamingReporterBase::testRunStarting( runInfo );
+        stream << "{\"event\":\"run-started\",\"name\":";
+        writeJsonString( runInfo.name );
+        stream << "}\n";
+        stream.flush();
+    }
+
+    void JsonlReporter::testCaseStarting( TestCaseInfo const& testCaseInfo ) {
+        StreamingReporterBase::testCaseStarting( testCaseInfo );
+        stream << "{\"event\":\"test-started\",\"name\":";
+        writeJsonString( testCaseInfo.name );
+        stream << ",\"tags\":";
+        writeJsonString( testCaseInfo.tagsAsString() );
+        stream << ",\"filename\":";
+        writeJsonString( testCaseInfo.lineInfo.file );
+        stream << ",\"line\":" << testCaseInfo.lineInfo.line << "}\n";
+        stream.flush();
+    }
+
+    void JsonlReporter::assertionStarting( AssertionInfo const& ) {}
+
+    bool JsonlReporter::assertionEnded( AssertionStats const& assertionStats ) {
+        AssertionResult const& result = assertionStats.assertionResult;
+        if( result.isOk() && !m_config->includeSuccessfulResults() )
+            return true;
+
+        stream << "{\"event\":\"assertion\",\"passed\":" << ( result.isOk() ? "true" : "false" )
+               << ",\"type\":";
+        writeJsonString( result.getTestMacroName() );
+        stream << ",\"filename\":";
+        writeJsonString( result.getSourceInfo().file );
+        stream << ",\"line\":" << result.getSourceInfo().line;
+        if( result.hasExpression() ) {
+            stream << ",\"expression\":";
+            writeJsonString( result.getExpression() );
+            stream << ",\"expanded\":";
+            writeJsonString( result.getExpandedExpression() );
+        }
+        if( result.hasMessage() ) {
+            stream << ",\"message\":";
+            writeJsonString( result.getMessage() );
+        }
+        stream << "}\n";
+        stream.flush();
+        return true;
+    }
+
+    void JsonlReporter::testCaseEnded( TestCaseStats const& testCaseStats ) {
+        StreamingReporterBase::testCaseEnded( testCaseStats );
+        auto const& assertions = testCaseStats.totals.assertions;
+        stream << "{\"event\":\"test-ended\",\"name\":";
+        writeJsonString( testCaseStats.testInfo.name );
+        stream << ",\"passed\":" << ( assertions.allOk() ? "true" : "false" )
+               << ",\"assertions-passed\":" << assertions.passed
+               << ",\"assertions-failed\":" << assertions.failed
+               << ",\"expected-failures\":" << assertions.failedButOk;
+        if( !testCaseStats.stdOut.empty() ) {
+            stream << ",\"stdout\":";
+            writeJsonString( testCaseStats.stdOut );
+        }
+        if( !testCaseStats.stdErr.empty() ) {
+            stream << ",\"stderr\":";
+            writeJsonString( testCaseStats.stdErr );
+        }
+        stream << "}\n";
+        stream.flush();
+    }
+
+    void JsonlReporter::testRunEnded( TestRunStats const& testRunStats ) {
+        auto const& totals = testRunStats.totals;
+        stream << "{\"event\":\"run-ended\",\"passed\":" << ( totals.assertions.allOk() ? "true" : "false" )
+               << ",\"tests-passed\":" << totals.testCases.passed
+               << ",\"tests-failed\":" << totals.testCases.failed
+               << ",\"assertions-passed\":" << totals.assertions.passed
+               << ",\"assertions-failed\":" << totals.assertions.failed
+               << "}\n";
+        stream.flush();
+        StreamingReporterBase::testRunEnded( testRunStats );
+    }
+
+} // end namespace Catch
+
+#endif // CATCH_CONFIG_MINIMAL_RUNTIME
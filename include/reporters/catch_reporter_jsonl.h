@@ -0,0 +1,42 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_REPORTER_JSONL_H_INCLUDED
+#define TWOBLUECUBES_CATCH_REPORTER_JSONL_H_INCLUDED
+
+#include "catch_reporter_bases.hpp"
+
+namespace Catch {
+
+    // Emits newline-delimited JSON: one self-contained object per event,
+    // no pretty printing. Each line is flushed as it is written, so a
+    // log-shipper tailing the file sees results as they happen instead of
+    // having to wait for - and then parse - a complete document.
+    //
+    // The events are "run-started", "test-started", "assertion" (failures
+    // always, passes only with -s), "test-ended" and "run-ended"; every
+    // object carries an "event" key naming its type.
+    class JsonlReporter : public StreamingReporterBase<JsonlReporter> {
+    public:
+        JsonlReporter( ReporterConfig const& _config );
+        ~JsonlReporter() override;
+
+        static std::string getDescription();
+
+        void testRunStarting( TestRunInfo const& runInfo ) override;
+        void testCaseStarting( TestCaseInfo const& testCaseInfo ) override;
+
+        void assertionStarting( AssertionInfo const& assertionInfo ) override;
+        bool assertionEnded( AssertionStats const& assertionStats ) override;
+
+        void testCaseEnded( TestCaseStats const& testCaseStats ) override;
+        void testRunEnded( TestRunStats const& testRunStats ) override;
+
+    private:
+        void writeJsonString( std::string const& value );
+    };
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_REPORTER_JSONL_H_INCLUDED
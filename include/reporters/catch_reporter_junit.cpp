@@ -6,14 +6,18 @@
  *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
  */
 
+#if !defined(CATCH_CONFIG_MINIMAL_RUNTIME)
+
 #include "catch_reporter_bases.hpp"
 
 #include "catch_reporter_junit.h"
 
+#include "../internal/catch_stream.h"
 #include "../internal/catch_tostring.h"
 #include "../internal/catch_reporter_registrars.hpp"
 
 #include <cassert>
+#include <cstdio>
 #include <sstream>
 #include <ctime>
 #include <algorithm>
@@ -47,14 +51,28 @@ namespace Catch {
             return std::string(timeStamp);
         }
 
-        std::string fileNameTag(const std::vector<std::string> &tags) {
+        std::string fileNameTag(const std::vector<StringRef> &tags) {
             auto it = std::find_if(begin(tags),
                                    end(tags),
-                                   [] (std::string const& tag) {return tag.front() == '#'; });
+                                   [] (StringRef const& tag) {return tag.size() > 0 && tag[0] == '#'; });
             if (it != tags.end())
-                return it->substr(1);
+                return it->substr(1, it->size() - 1);
             return std::string();
         }
+
+        // Fixed-width renderings of the aggregate <testsuite> attributes, so
+        // the placeholders written up front can be overwritten in place once
+        // the real values are known (see JunitStreamingReporter)
+        std::string paddedCount( std::size_t count ) {
+            char buffer[16];
+            std::snprintf( buffer, sizeof(buffer), "%010zu", count );
+            return buffer[10] == '\0' ? std::string( buffer ) : std::string( "9999999999" );
+        }
+        std::string paddedTime( double seconds ) {
+            char buffer[16];
+            std::snprintf( buffer, sizeof(buffer), "%010.3f", seconds );
+            return buffer[10] == '\0' ? std::string( buffer ) : std::string( "999999.999" );
+        }
     } // anonymous namespace
 
     JunitReporter::JunitReporter( ReporterConfig const& _config )
@@ -110,6 +128,7 @@ namespace Catch {
 
     void JunitReporter::testRunEndedCumulative() {
         xml.endElement();
+        xml.flush();
     }
 
     void JunitReporter::writeGroup( TestGroupNode const& groupNode, double suiteTime ) {
@@ -243,6 +262,221 @@ namespace Catch {
         }
     }
 
-    CATCH_REGISTER_REPORTER( "junit", JunitReporter )
+    JunitStreamingReporter::JunitStreamingReporter( ReporterConfig const& _config )
+        :   CumulativeReporterBase( _config ),
+            xml( _config.stream() )
+        {
+            m_reporterPrefs.shouldRedirectStdOut = true;
+            m_reporterPrefs.shouldReportAllAssertions = true;
+        }
+
+    JunitStreamingReporter::~JunitStreamingReporter() {}
+
+    std::string JunitStreamingReporter::getDescription() {
+        return "Reports test results in JUnit XML, streaming each test case as it completes";
+    }
+
+    void JunitStreamingReporter::noMatchingTestCases( std::string const& /*spec*/ ) {}
+
+    void JunitStreamingReporter::testRunStarting( TestRunInfo const& ) {
+        xml.startElement( "testsuites" );
+    }
+
+    void JunitStreamingReporter::testGroupStarting( GroupInfo const& groupInfo ) {
+        suiteTimer.start();
+        unexpectedExceptions = 0;
+
+        xml.startElement( "testsuite" );
+        xml.writeAttribute( "name", groupInfo.name );
+        xml.writeAttribute( "hostname", "tbd" ); // !TBD
+        xml.writeAttribute( "timestamp", getCurrentTimestamp() );
+
+        // The real values are not known until the group ends, so write
+        // fixed-width placeholders and remember where they are. The
+        // writer buffers in memory, so flush before taking the position.
+        xml.flush();
+        countsPos = stream.tellp();
+        xml.writeAttribute( "errors", paddedCount( 0 ) );
+        xml.writeAttribute( "failures", paddedCount( 0 ) );
+        xml.writeAttribute( "tests", paddedCount( 0 ) );
+        if( m_config->showDurations() != ShowDurations::Never )
+            xml.writeAttribute( "time", paddedTime( 0 ) );
+    }
+
+    void JunitStreamingReporter::testCaseStarting( TestCaseInfo const& testCaseInfo ) {
+        m_okToFail = testCaseInfo.okToFail();
+    }
+
+    bool JunitStreamingReporter::assertionEnded( AssertionStats const& assertionStats ) {
+        if( assertionStats.assertionResult.getResultType() == ResultWas::ThrewException && !m_okToFail )
+            unexpectedExceptions++;
+        return CumulativeReporterBase::assertionEnded( assertionStats );
+    }
+
+    void JunitStreamingReporter::testCaseEnded( TestCaseStats const& testCaseStats ) {
+        assert( m_sectionStack.empty() );
+        assert( m_deepestSection );
+        m_deepestSection->stdOut = testCaseStats.stdOut;
+        m_deepestSection->stdErr = testCaseStats.stdErr;
+
+        // Unlike the base class we write the test case out immediately and
+        // drop it, so memory stays flat however many test cases run
+        TestCaseNode node( testCaseStats );
+        node.children.push_back( m_rootSection );
+        m_rootSection.reset();
+        m_deepestSection.reset();
+
+        writeTestCase( node );
+        xml.flush();
+    }
+
+    void JunitStreamingReporter::testGroupEnded( TestGroupStats const& testGroupStats ) {
+        double suiteTime = suiteTimer.getElapsedSeconds();
+        xml.endElement();
+        xml.flush();
+
+        // Patch the placeholder attributes now the counts are known. On a
+        // non-seekable stream (a console, a pipe) patching is impossible;
+        // warn rather than let a CI consumer silently ingest a report
+        // claiming zero tests ran.
+        bool patched = false;
+        if( countsPos >= 0 ) {
+            auto endPos = stream.tellp();
+            stream.seekp( countsPos );
+            if( stream ) {
+                stream << " errors=\"" << paddedCount( unexpectedExceptions ) << '"'
+                       << " failures=\"" << paddedCount( testGroupStats.totals.assertions.failed - unexpectedExceptions ) << '"'
+                       << " tests=\"" << paddedCount( testGroupStats.totals.assertions.total() ) << '"';
+                if( m_config->showDurations() != ShowDurations::Never )
+                    stream << " time=\"" << paddedTime( suiteTime ) << '"';
+                stream.seekp( endPos );
+                patched = true;
+            }
+            else {
+                stream.clear();
+            }
+        }
+        if( !patched )
+            Catch::cerr() << "junit-stream: output stream is not seekable, so the testsuite counts"
+                             " (tests/failures/errors) remain zero placeholders."
+                             " Write to a file with -o, or use the junit reporter.\n";
+        countsPos = -1;
+    }
+
+    void JunitStreamingReporter::testRunEndedCumulative() {
+        xml.endElement();
+        xml.flush();
+    }
+
+    void JunitStreamingReporter::writeTestCase( TestCaseNode const& testCaseNode ) {
+        TestCaseStats const& stats = testCaseNode.value;
+
+        // All test cases have exactly one section - which represents the
+        // test case itself. That section may have 0-n nested sections
+        assert( testCaseNode.children.size() == 1 );
+        SectionNode const& rootSection = *testCaseNode.children.front();
+
+        std::string className = stats.testInfo.className;
+
+        if( className.empty() ) {
+            className = fileNameTag(stats.testInfo.tags);
+            if ( className.empty() )
+                className = "global";
+        }
+
+        if ( !m_config->name().empty() )
+            className = m_config->name() + "." + className;
+
+        writeSection( className, "", rootSection );
+    }
+
+    void JunitStreamingReporter::writeSection(  std::string const& className,
+                        std::string const& rootName,
+                        SectionNode const& sectionNode ) {
+        std::string name = trim( sectionNode.stats.sectionInfo.name );
+        if( !rootName.empty() )
+            name = rootName + '/' + name;
+
+        if( !sectionNode.assertions.empty() ||
+            !sectionNode.stdOut.empty() ||
+            !sectionNode.stdErr.empty() ) {
+            XmlWriter::ScopedElement e = xml.scopedElement( "testcase" );
+            if( className.empty() ) {
+                xml.writeAttribute( "classname", name );
+                xml.writeAttribute( "name", "root" );
+            }
+            else {
+                xml.writeAttribute( "classname", className );
+                xml.writeAttribute( "name", name );
+            }
+            xml.writeAttribute( "time", ::Catch::Detail::stringify( sectionNode.stats.durationInSeconds ) );
+
+            writeAssertions( sectionNode );
+
+            if( !sectionNode.stdOut.empty() )
+                xml.scopedElement( "system-out" ).writeText( trim( sectionNode.stdOut ), false );
+            if( !sectionNode.stdErr.empty() )
+                xml.scopedElement( "system-err" ).writeText( trim( sectionNode.stdErr ), false );
+        }
+        for( auto const& childNode : sectionNode.childSections )
+            if( className.empty() )
+                writeSection( name, "", *childNode );
+            else
+                writeSection( className, name, *childNode );
+    }
+
+    void JunitStreamingReporter::writeAssertions( SectionNode const& sectionNode ) {
+        for( auto const& assertion : sectionNode.assertions )
+            writeAssertion( assertion );
+    }
+
+    void JunitStreamingReporter::writeAssertion( AssertionStats const& stats ) {
+        AssertionResult const& result = stats.assertionResult;
+        if( !result.isOk() ) {
+            std::string elementName;
+            switch( result.getResultType() ) {
+                case ResultWas::ThrewException:
+                case ResultWas::FatalErrorCondition:
+                    elementName = "error";
+                    break;
+                case ResultWas::ExplicitFailure:
+                    elementName = "failure";
+                    break;
+                case ResultWas::ExpressionFailed:
+                    elementName = "failure";
+                    break;
+                case ResultWas::DidntThrowException:
+                    elementName = "failure";
+                    break;
+
+                // We should never see these here:
+                case ResultWas::Info:
+                case ResultWas::Warning:
+                case ResultWas::Ok:
+                case ResultWas::Unknown:
+                case ResultWas::FailureBit:
+                case ResultWas::Exception:
+                    elementName = "internalError";
+                    break;
+            }
+
+            XmlWriter::ScopedElement e = xml.scopedElement( elementName );
+
+            xml.writeAttribute( "message", result.getExpandedExpression() );
+            xml.writeAttribute( "type", result.getTestMacroName() );
+
+            ReusableStringStream rss;
+            if( !result.getMessage().empty() )
+                rss << result.getMessage() << '\n';
+            for( auto const& msg : stats.infoMessages )
+                if( msg.type == ResultWas::Info )
+                    rss << msg.message << '\n';
+
+            rss << "at " << result.getSourceInfo();
+            xml.writeText( rss.str(), false );
+        }
+    }
 
 } // end namespace Catch
+
+#endif // CATCH_CONFIG_MINIMAL_RUNTIME
@@ -56,6 +56,52 @@ namespace Catch {
         bool m_okToFail = false;
     };
 
+    // Emits the same XML as JunitReporter, but writes each <testcase>
+    // element as soon as the test case completes instead of buffering the
+    // whole run, so memory use is bounded by the largest single test case.
+    // The aggregate attributes of <testsuite> are written as fixed-width
+    // placeholders and patched once the group has finished - this needs a
+    // seekable output stream (i.e. -o <file>); on a non-seekable stream the
+    // counts are left as zeros.
+    class JunitStreamingReporter : public CumulativeReporterBase<JunitStreamingReporter> {
+    public:
+        JunitStreamingReporter(ReporterConfig const& _config);
+
+        ~JunitStreamingReporter() override;
+
+        static std::string getDescription();
+
+        void noMatchingTestCases(std::string const& /*spec*/) override;
+
+        void testRunStarting(TestRunInfo const& runInfo) override;
+
+        void testGroupStarting(GroupInfo const& groupInfo) override;
+
+        void testCaseStarting(TestCaseInfo const& testCaseInfo) override;
+        bool assertionEnded(AssertionStats const& assertionStats) override;
+
+        void testCaseEnded(TestCaseStats const& testCaseStats) override;
+
+        void testGroupEnded(TestGroupStats const& testGroupStats) override;
+
+        void testRunEndedCumulative() override;
+
+        void writeTestCase(TestCaseNode const& testCaseNode);
+
+        void writeSection(std::string const& className,
+                          std::string const& rootName,
+                          SectionNode const& sectionNode);
+
+        void writeAssertions(SectionNode const& sectionNode);
+        void writeAssertion(AssertionStats const& stats);
+
+        XmlWriter xml;
+        Timer suiteTimer;
+        std::ostream::pos_type countsPos = -1;
+        unsigned int unexpectedExceptions = 0;
+        bool m_okToFail = false;
+    };
+
 } // end namespace Catch
 
 #endif // TWOBLUECUBES_CATCH_REPORTER_JUNIT_H_INCLUDED
@@ -11,126 +11,210 @@
 
 namespace Catch {
 
+    namespace {
+        auto gcd( unsigned int a, unsigned int b ) -> unsigned int {
+            while( b != 0 ) {
+                auto t = a % b;
+                a = b;
+                b = t;
+            }
+            return a;
+        }
+    }
+
     ListeningReporter::ListeningReporter() {
         // We will assume that listeners will always want all assertions
         m_preferences.shouldReportAllAssertions = true;
+        // Fixed up as children are added: 0 is the gcd identity, so the
+        // first child's sample rate is taken over unchanged
+        m_preferences.shouldReportAssertionStarting = false;
+        m_preferences.successfulAssertionSampleRate = 0;
+        // true is the identity for the all-children-must-agree merge below
+        m_preferences.shouldBatchAssertions = true;
+    }
+
+    void ListeningReporter::mergePreferences( ReporterPreferences const& childPrefs ) {
+        m_preferences.shouldReportAssertionStarting =
+            m_preferences.shouldReportAssertionStarting || childPrefs.shouldReportAssertionStarting;
+        // One streaming child means everyone streams: a mixed delivery
+        // would see the same assertion twice or out of order
+        m_preferences.shouldBatchAssertions =
+            m_preferences.shouldBatchAssertions && childPrefs.shouldBatchAssertions;
+        // The runner delivers every gcd-th successful assertion; each
+        // child then applies its own stride relative to that, so every
+        // child still sees exactly every Nth assertion overall
+        m_preferences.successfulAssertionSampleRate =
+            gcd( m_preferences.successfulAssertionSampleRate, childPrefs.successfulAssertionSampleRate );
     }
 
     void ListeningReporter::addListener( IStreamingReporterPtr&& listener ) {
+        m_listenerPrefs.push_back( listener->getPreferences() );
+        mergePreferences( m_listenerPrefs.back() );
         m_listeners.push_back( std::move( listener ) );
     }
 
     void ListeningReporter::addReporter(IStreamingReporterPtr&& reporter) {
         assert(!m_reporter && "Listening reporter can wrap only 1 real reporter");
         m_reporter = std::move( reporter );
-        m_preferences.shouldRedirectStdOut = m_reporter->getPreferences().shouldRedirectStdOut;
+        m_reporterPrefs = m_reporter->getPreferences();
+        mergePreferences( m_reporterPrefs );
+        m_preferences.shouldRedirectStdOut = m_reporterPrefs.shouldRedirectStdOut;
     }
 
     ReporterPreferences ListeningReporter::getPreferences() const {
         return m_preferences;
     }
 
+    bool ListeningReporter::subscribed( std::size_t listenerIndex, unsigned int event ) const {
+        return ( m_listenerPrefs[listenerIndex].subscribedEvents & event ) != 0;
+    }
+
     std::set<Verbosity> ListeningReporter::getSupportedVerbosities() {
         return std::set<Verbosity>{ };
     }
 
 
     void ListeningReporter::noMatchingTestCases( std::string const& spec ) {
-        for ( auto const& listener : m_listeners ) {
-            listener->noMatchingTestCases( spec );
+        for ( std::size_t i = 0; i < m_listeners.size(); ++i ) {
+            if ( subscribed( i, ListenerEvents::TestRun ) )
+                m_listeners[i]->noMatchingTestCases( spec );
         }
         m_reporter->noMatchingTestCases( spec );
     }
 
     void ListeningReporter::benchmarkStarting( BenchmarkInfo const& benchmarkInfo ) {
-        for ( auto const& listener : m_listeners ) {
-            listener->benchmarkStarting( benchmarkInfo );
+        for ( std::size_t i = 0; i < m_listeners.size(); ++i ) {
+            if ( subscribed( i, ListenerEvents::Benchmark ) )
+                m_listeners[i]->benchmarkStarting( benchmarkInfo );
         }
         m_reporter->benchmarkStarting( benchmarkInfo );
     }
     void ListeningReporter::benchmarkEnded( BenchmarkStats const& benchmarkStats ) {
-        for ( auto const& listener : m_listeners ) {
-            listener->benchmarkEnded( benchmarkStats );
+        for ( std::size_t i = 0; i < m_listeners.size(); ++i ) {
+            if ( subscribed( i, ListenerEvents::Benchmark ) )
+                m_listeners[i]->benchmarkEnded( benchmarkStats );
         }
         m_reporter->benchmarkEnded( benchmarkStats );
     }
 
     void ListeningReporter::testRunStarting( TestRunInfo const& testRunInfo ) {
-        for ( auto const& listener : m_listeners ) {
-            listener->testRunStarting( testRunInfo );
+        for ( std::size_t i = 0; i < m_listeners.size(); ++i ) {
+            if ( subscribed( i, ListenerEvents::TestRun ) )
+                m_listeners[i]->testRunStarting( testRunInfo );
         }
         m_reporter->testRunStarting( testRunInfo );
     }
 
     void ListeningReporter::testGroupStarting( GroupInfo const& groupInfo ) {
-        for ( auto const& listener : m_listeners ) {
-            listener->testGroupStarting( groupInfo );
+        for ( std::size_t i = 0; i < m_listeners.size(); ++i ) {
+            if ( subscribed( i, ListenerEvents::TestGroup ) )
+                m_listeners[i]->testGroupStarting( groupInfo );
         }
         m_reporter->testGroupStarting( groupInfo );
     }
 
 
     void ListeningReporter::testCaseStarting( TestCaseInfo const& testInfo ) {
-        for ( auto const& listener : m_listeners ) {
-            listener->testCaseStarting( testInfo );
+        for ( std::size_t i = 0; i < m_listeners.size(); ++i ) {
+            if ( subscribed( i, ListenerEvents::TestCase ) )
+                m_listeners[i]->testCaseStarting( testInfo );
         }
         m_reporter->testCaseStarting( testInfo );
     }
 
     void ListeningReporter::sectionStarting( SectionInfo const& sectionInfo ) {
-        for ( auto const& listener : m_listeners ) {
-            listener->sectionStarting( sectionInfo );
+        for ( std::size_t i = 0; i < m_listeners.size(); ++i ) {
+            if ( subscribed( i, ListenerEvents::Section ) )
+                m_listeners[i]->sectionStarting( sectionInfo );
         }
         m_reporter->sectionStarting( sectionInfo );
     }
 
     void ListeningReporter::assertionStarting( AssertionInfo const& assertionInfo ) {
-        for ( auto const& listener : m_listeners ) {
-            listener->assertionStarting( assertionInfo );
+        for ( std::size_t i = 0; i < m_listeners.size(); ++i ) {
+            if ( m_listenerPrefs[i].shouldReportAssertionStarting && subscribed( i, ListenerEvents::Assertion ) )
+                m_listeners[i]->assertionStarting( assertionInfo );
         }
-        m_reporter->assertionStarting( assertionInfo );
+        if ( m_reporterPrefs.shouldReportAssertionStarting )
+            m_reporter->assertionStarting( assertionInfo );
+    }
+
+    bool ListeningReporter::shouldDeliverSampled( unsigned int rate ) const {
+        if ( rate <= 1 )
+            return true;
+        // We only ever see every aggregated-rate-th successful assertion
+        // (the runner samples with the gcd of all children's rates), so
+        // this child's stride is relative to those deliveries
+        auto aggregated = m_preferences.successfulAssertionSampleRate;
+        auto stride = aggregated > 1 ? rate / aggregated : rate;
+        return stride <= 1 || m_successfulAssertionsSeen % stride == 0;
     }
 
     // The return value indicates if the messages buffer should be cleared:
     bool ListeningReporter::assertionEnded( AssertionStats const& assertionStats ) {
-        for( auto const& listener : m_listeners ) {
-            static_cast<void>( listener->assertionEnded( assertionStats ) );
+        bool isOk = assertionStats.assertionResult.getResultType() == ResultWas::Ok;
+        if ( isOk )
+            ++m_successfulAssertionsSeen;
+        for( std::size_t i = 0; i < m_listeners.size(); ++i ) {
+            if ( !subscribed( i, ListenerEvents::Assertion ) )
+                continue;
+            if ( isOk && !shouldDeliverSampled( m_listenerPrefs[i].successfulAssertionSampleRate ) )
+                continue;
+            static_cast<void>( m_listeners[i]->assertionEnded( assertionStats ) );
         }
+        if ( isOk && !shouldDeliverSampled( m_reporterPrefs.successfulAssertionSampleRate ) )
+            return true;
         return m_reporter->assertionEnded( assertionStats );
     }
 
+    // Only reached when every child opted into batching (the merge is a
+    // logical and), so the batch forwards as-is; sampling does not apply,
+    // as batching children asked for whole sections
+    void ListeningReporter::assertionsEnded( std::vector<AssertionStats> const& batch ) {
+        for( std::size_t i = 0; i < m_listeners.size(); ++i ) {
+            if ( subscribed( i, ListenerEvents::Assertion ) )
+                m_listeners[i]->assertionsEnded( batch );
+        }
+        m_reporter->assertionsEnded( batch );
+    }
+
     void ListeningReporter::sectionEnded( SectionStats const& sectionStats ) {
-        for ( auto const& listener : m_listeners ) {
-            listener->sectionEnded( sectionStats );
+        for ( std::size_t i = 0; i < m_listeners.size(); ++i ) {
+            if ( subscribed( i, ListenerEvents::Section ) )
+                m_listeners[i]->sectionEnded( sectionStats );
         }
         m_reporter->sectionEnded( sectionStats );
     }
 
     void ListeningReporter::testCaseEnded( TestCaseStats const& testCaseStats ) {
-        for ( auto const& listener : m_listeners ) {
-            listener->testCaseEnded( testCaseStats );
+        for ( std::size_t i = 0; i < m_listeners.size(); ++i ) {
+            if ( subscribed( i, ListenerEvents::TestCase ) )
+                m_listeners[i]->testCaseEnded( testCaseStats );
         }
         m_reporter->testCaseEnded( testCaseStats );
     }
 
     void ListeningReporter::testGroupEnded( TestGroupStats const& testGroupStats ) {
-        for ( auto const& listener : m_listeners ) {
-            listener->testGroupEnded( testGroupStats );
+        for ( std::size_t i = 0; i < m_listeners.size(); ++i ) {
+            if ( subscribed( i, ListenerEvents::TestGroup ) )
+                m_listeners[i]->testGroupEnded( testGroupStats );
         }
         m_reporter->testGroupEnded( testGroupStats );
     }
 
     void ListeningReporter::testRunEnded( TestRunStats const& testRunStats ) {
-        for ( auto const& listener : m_listeners ) {
-            listener->testRunEnded( testRunStats );
+        for ( std::size_t i = 0; i < m_listeners.size(); ++i ) {
+            if ( subscribed( i, ListenerEvents::TestRun ) )
+                m_listeners[i]->testRunEnded( testRunStats );
         }
         m_reporter->testRunEnded( testRunStats );
     }
 
 
     void ListeningReporter::skipTest( TestCaseInfo const& testInfo ) {
-        for ( auto const& listener : m_listeners ) {
-            listener->skipTest( testInfo );
+        for ( std::size_t i = 0; i < m_listeners.size(); ++i ) {
+            if ( subscribed( i, ListenerEvents::TestCase ) )
+                m_listeners[i]->skipTest( testInfo );
         }
         m_reporter->skipTest( testInfo );
     }
@@ -11,12 +11,27 @@
 
 namespace Catch {
 
+    // Fans each event out to every listener and then the wrapped
+    // reporter. A single event object is shared by reference across all
+    // of them - N listeners never cost additional copies; listeners that
+    // need to keep event data beyond the callback must copy it
+    // themselves (as CumulativeReporterBase does).
     class ListeningReporter : public IStreamingReporter {
         using Reporters = std::vector<IStreamingReporterPtr>;
         Reporters m_listeners;
         IStreamingReporterPtr m_reporter = nullptr;
         ReporterPreferences m_preferences;
 
+        // Each child's preferences, cached at registration so the hot
+        // dispatch loops need no virtual getPreferences() calls
+        std::vector<ReporterPreferences> m_listenerPrefs;
+        ReporterPreferences m_reporterPrefs;
+        std::size_t m_successfulAssertionsSeen = 0;
+
+        void mergePreferences( ReporterPreferences const& childPrefs );
+        bool shouldDeliverSampled( unsigned int rate ) const;
+        bool subscribed( std::size_t listenerIndex, unsigned int event ) const;
+
     public:
         ListeningReporter();
 
@@ -42,6 +57,7 @@ namespace Catch {
 
         // The return value indicates if the messages buffer should be cleared:
         bool assertionEnded( AssertionStats const& assertionStats ) override;
+        void assertionsEnded( std::vector<AssertionStats> const& batch ) override;
         void sectionEnded( SectionStats const& sectionStats ) override;
         void testCaseEnded( TestCaseStats const& testCaseStats ) override;
         void testGroupEnded( TestGroupStats const& testGroupStats ) override;
@@ -0,0 +1,196 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#if !defined(CATCH_CONFIG_MINIMAL_RUNTIME)
+
+#include "catch_reporter_progress.h"
+
+#include "../internal/catch_history_store.h"
+#include "../internal/catch_test_case_registry_impl.h"
+#include "../internal/catch_timer.h"
+
+namespace Catch {
+
+    namespace {
+        // Terminal width assumed when truncating; anything longer would
+        // wrap and defeat the carriage-return rewrite
+        constexpr std::size_t statusLineWidth = 79;
+        // Minimum interval between rewrites, so a suite of sub-millisecond
+        // tests does not spend its wall time repainting a terminal
+        constexpr std::uint64_t renderIntervalNanos = 100 * 1000 * 1000;
+
+        void appendDuration( std::string& line, double seconds ) {
+            auto whole = static_cast<unsigned long long>( seconds );
+            if( whole >= 60 ) {
+                line += std::to_string( whole / 60 );
+                line += 'm';
+                line += std::to_string( whole % 60 );
+                line += 's';
+            }
+            else {
+                line += std::to_string( whole );
+                line += '.';
+                line += static_cast<char>( '0' + static_cast<int>( seconds * 10 ) % 10 );
+                line += 's';
+            }
+        }
+    }
+
+    ProgressReporter::ProgressReporter( ReporterConfig const& _config )
+    :   StreamingReporterBase( _config ) {
+        // Captured test output would tear the status line mid-rewrite;
+        // redirected, it surfaces through the failure summaries instead
+        m_reporterPrefs.shouldRedirectStdOut = true;
+        m_reporterPrefs.shouldReportAssertionStarting = false;
+    }
+
+    ProgressReporter::~ProgressReporter() {}
+
+    std::string ProgressReporter::getDescription() {
+        return "Reports progress on a single rewritten status line";
+    }
+
+    double ProgressReporter::expectedDurationOf( std::string const& testName ) const {
+        auto it = m_durations.find( testName );
+        return it != m_durations.end() ? it->second : m_meanKnownDuration;
+    }
+
+    void ProgressReporter::testRunStarting( TestRunInfo const& runInfo ) {
+        StreamingReporterBase::testRunStarting( runInfo );
+        m_runStartNanos = getCurrentNanosecondsSinceEpoch();
+
+        auto const& testCases = getAllTestCasesFiltered( m_config->testSpec(), *m_config );
+        m_totalTests = testCases.size();
+
+        // The ETA weighs each remaining test by its last observed runtime;
+        // tests the cache has never seen count as an average test. With no
+        // cache at all there is nothing to extrapolate from and no ETA is
+        // shown until one run has been recorded.
+        m_durations = loadSchedulingDurations( *m_config );
+        if( !m_durations.empty() ) {
+            double knownTotal = 0;
+            std::size_t knownCount = 0;
+            for( auto const& testCase : testCases ) {
+                auto it = m_durations.find( testCase.name );
+                if( it != m_durations.end() ) {
+                    knownTotal += it->second;
+                    ++knownCount;
+                }
+            }
+            if( knownCount > 0 )
+                m_meanKnownDuration = knownTotal / static_cast<double>( knownCount );
+            knownTotal += m_meanKnownDuration * static_cast<double>( m_totalTests - knownCount );
+            m_remainingExpected = knownTotal;
+        }
+    }
+
+    void ProgressReporter::testCaseStarting( TestCaseInfo const& testCaseInfo ) {
+        StreamingReporterBase::testCaseStarting( testCaseInfo );
+        m_currentTest = testCaseInfo.name;
+        renderStatusLine( m_currentTest, false );
+    }
+
+    void ProgressReporter::assertionStarting( AssertionInfo const& ) {}
+
+    bool ProgressReporter::assertionEnded( AssertionStats const& ) {
+        // Failures surface as a per-test summary line in testCaseEnded;
+        // anything more verbose belongs to the console reporter
+        return true;
+    }
+
+    void ProgressReporter::testCaseEnded( TestCaseStats const& testCaseStats ) {
+        StreamingReporterBase::testCaseEnded( testCaseStats );
+        ++m_testsDone;
+        m_testsPassed += testCaseStats.totals.testCases.passed;
+        m_testsFailed += testCaseStats.totals.testCases.failed;
+        if( m_remainingExpected > 0 ) {
+            m_remainingExpected -= expectedDurationOf( testCaseStats.testInfo.name );
+            if( m_remainingExpected < 0 )
+                m_remainingExpected = 0;
+        }
+        if( testCaseStats.totals.testCases.failed > 0 ) {
+            // The one kind of output that persists: failed tests scroll,
+            // passing ones only move the counters
+            clearStatusLine();
+            stream << "FAILED: " << testCaseStats.testInfo.name
+                   << " (" << testCaseStats.totals.assertions.failed << " of "
+                   << testCaseStats.totals.assertions.total() << " assertions failed)\n";
+            renderStatusLine( m_currentTest, true );
+        }
+    }
+
+    void ProgressReporter::testRunEnded( TestRunStats const& testRunStats ) {
+        clearStatusLine();
+        auto elapsed = static_cast<double>( getCurrentNanosecondsSinceEpoch() - m_runStartNanos ) / 1000000000.0;
+        std::string line;
+        line += std::to_string( m_testsDone );
+        line += " test cases in ";
+        appendDuration( line, elapsed );
+        line += ": ";
+        line += std::to_string( m_testsPassed );
+        line += " passed, ";
+        line += std::to_string( m_testsFailed );
+        line += " failed (";
+        line += std::to_string( testRunStats.totals.assertions.total() );
+        line += " assertions)";
+        stream << line << std::endl;
+        StreamingReporterBase::testRunEnded( testRunStats );
+    }
+
+    void ProgressReporter::renderStatusLine( std::string const& currentTest, bool forced ) {
+        auto now = getCurrentNanosecondsSinceEpoch();
+        if( !forced && m_lastRenderNanos != 0 && now - m_lastRenderNanos < renderIntervalNanos )
+            return;
+        m_lastRenderNanos = now;
+
+        std::string line;
+        line.reserve( statusLineWidth + 1 );
+        line += '[';
+        line += std::to_string( m_testsDone );
+        line += '/';
+        line += std::to_string( m_totalTests );
+        line += "] ";
+        line += std::to_string( m_testsPassed );
+        line += " passed";
+        if( m_testsFailed ) {
+            line += ", ";
+            line += std::to_string( m_testsFailed );
+            line += " failed";
+        }
+        line += " | ";
+        appendDuration( line, static_cast<double>( now - m_runStartNanos ) / 1000000000.0 );
+        if( m_remainingExpected > 0 ) {
+            line += " eta ";
+            appendDuration( line, m_remainingExpected );
+        }
+        line += " | ";
+        if( line.size() < statusLineWidth ) {
+            auto room = statusLineWidth - line.size();
+            if( currentTest.size() <= room )
+                line += currentTest;
+            else {
+                line.append( currentTest, 0, room - 3 );
+                line += "...";
+            }
+        }
+
+        // Pad over whatever the previous, possibly longer, line left behind
+        auto printedLength = line.size();
+        if( line.size() < m_lastLineLength )
+            line.append( m_lastLineLength - line.size(), ' ' );
+        m_lastLineLength = printedLength;
+        stream << '\r' << line << std::flush;
+    }
+
+    void ProgressReporter::clearStatusLine() {
+        if( m_lastLineLength == 0 )
+            return;
+        stream << '\r' << std::string( m_lastLineLength, ' ' ) << '\r';
+        m_lastLineLength = 0;
+    }
+
+} // end namespace Catch
+
+#endif // CATCH_CONFIG_MINIMAL_RUNTIME
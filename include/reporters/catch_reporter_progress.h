@@ -0,0 +1,59 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_REPORTER_PROGRESS_H_INCLUDED
+#define TWOBLUECUBES_CATCH_REPORTER_PROGRESS_H_INCLUDED
+
+#include "catch_reporter_bases.hpp"
+
+#include "../internal/catch_duration_cache.h"
+
+namespace Catch {
+
+    // Maintains a single carriage-return-rewritten status line: tests done
+    // out of total, pass/fail counts, elapsed time and - when a duration
+    // cache is available - an ETA. Output volume is constant regardless of
+    // suite size: updates are rate limited, only failed test cases leave a
+    // permanent line behind, and a one-line summary ends the run. Made for
+    // watching large suites interactively (e.g. over SSH), where the
+    // console reporter's scrolling costs measurable wall time.
+    class ProgressReporter : public StreamingReporterBase<ProgressReporter> {
+    public:
+        ProgressReporter( ReporterConfig const& _config );
+        ~ProgressReporter() override;
+
+        static std::string getDescription();
+
+        void testRunStarting( TestRunInfo const& runInfo ) override;
+        void testCaseStarting( TestCaseInfo const& testCaseInfo ) override;
+
+        void assertionStarting( AssertionInfo const& assertionInfo ) override;
+        bool assertionEnded( AssertionStats const& assertionStats ) override;
+
+        void testCaseEnded( TestCaseStats const& testCaseStats ) override;
+        void testRunEnded( TestRunStats const& testRunStats ) override;
+
+    private:
+        // Rewrites the status line in place; forced renders bypass the
+        // rate limit (test ends with failures, run end)
+        void renderStatusLine( std::string const& currentTest, bool forced );
+        void clearStatusLine();
+        double expectedDurationOf( std::string const& testName ) const;
+
+        TestDurations m_durations;
+        double m_meanKnownDuration = 0;
+        double m_remainingExpected = 0;
+        std::size_t m_totalTests = 0;
+        std::size_t m_testsDone = 0;
+        std::size_t m_testsPassed = 0;
+        std::size_t m_testsFailed = 0;
+        std::string m_currentTest;
+        std::uint64_t m_runStartNanos = 0;
+        std::uint64_t m_lastRenderNanos = 0;
+        std::size_t m_lastLineLength = 0;
+    };
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_REPORTER_PROGRESS_H_INCLUDED
@@ -0,0 +1,130 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#if !defined(CATCH_CONFIG_MINIMAL_RUNTIME)
+
+#include "catch_reporter_trace.h"
+
+#include "../internal/catch_reporter_registrars.hpp"
+#include "../internal/catch_timer.h"
+
+#include <atomic>
+#include <cstdio>
+
+namespace Catch {
+
+    namespace {
+        // Distinct lanes per reporter instance, so parallel workers (which
+        // each construct their own reporter) do not overlap in the viewer
+        int nextTraceTid() {
+            static std::atomic<int> s_nextTid{ 1 };
+            return s_nextTid++;
+        }
+    } // anonymous namespace
+
+    TraceReporter::TraceReporter( ReporterConfig const& _config )
+    :   StreamingReporterBase( _config ),
+        m_tid( nextTraceTid() ) {
+        m_reporterPrefs.shouldRedirectStdOut = true;
+        m_reporterPrefs.shouldReportAllAssertions = true;
+    }
+
+    TraceReporter::~TraceReporter() {}
+
+    std::string TraceReporter::getDescription() {
+        return "Writes a chrome://tracing compatible JSON timeline of the run";
+    }
+
+    void TraceReporter::writeJsonString( std::string const& value ) {
+        stream << '"';
+        for( unsigned char c : value ) {
+            switch( c ) {
+                case '"':  stream << "\\\""; break;
+                case '\\': stream << "\\\\"; break;
+                case '\n': stream << "\\n"; break;
+                case '\t': stream << "\\t"; break;
+                case '\r': stream << "\\r"; break;
+                default:
+                    if( c < 0x20 ) {
+                        char buffer[8];
+                        std::snprintf( buffer, sizeof(buffer), "\\u%04x", c );
+                        stream << buffer;
+                    }
+                    else
+                        stream << static_cast<char>( c );
+            }
+        }
+        stream << '"';
+    }
+
+    void TraceReporter::writeEvent( char phase, std::string const& name, std::string const& category ) {
+        if( !m_firstEvent )
+            stream << ",\n";
+        m_firstEvent = false;
+
+        auto timestampMicroseconds = getCurrentNanosecondsSinceEpoch() / 1000;
+        stream << "{\"name\":";
+        writeJsonString( name );
+        stream << ",\"cat\":\"" << category << "\""
+               << ",\"ph\":\"" << phase << "\""
+               << ( phase == 'i' ? ",\"s\":\"t\"" : "" )
+               << ",\"ts\":" << timestampMicroseconds
+               << ",\"pid\":1,\"tid\":" << m_tid << '}';
+    }
+
+    void TraceReporter::testRunStarting( TestRunInfo const& runInfo ) {
+        StreamingReporterBase::testRunStarting( runInfo );
+        stream << "[\n";
+    }
+
+    void TraceReporter::testCaseStarting( TestCaseInfo const& testCaseInfo ) {
+        StreamingReporterBase::testCaseStarting( testCaseInfo );
+        writeEvent( 'B', testCaseInfo.name, "test case" );
+    }
+
+    void TraceReporter::sectionStarting( SectionInfo const& sectionInfo ) {
+        StreamingReporterBase::sectionStarting( sectionInfo );
+        // The root section mirrors the test case itself, which already has
+        // its own event pair
+        if( m_sectionDepth++ > 0 )
+            writeEvent( 'B', sectionInfo.name, "section" );
+    }
+
+    void TraceReporter::assertionStarting( AssertionInfo const& ) {}
+
+    bool TraceReporter::assertionEnded( AssertionStats const& assertionStats ) {
+        AssertionResult const& result = assertionStats.assertionResult;
+        if( !result.isOk() || m_config->includeSuccessfulResults() ) {
+            std::string name = result.getTestMacroName();
+            if( result.hasExpression() ) {
+                name += "( ";
+                name += result.getExpression();
+                name += " )";
+            }
+            writeEvent( 'i', name, result.isOk() ? "assertion" : "failure" );
+        }
+        return true;
+    }
+
+    void TraceReporter::sectionEnded( SectionStats const& sectionStats ) {
+        if( --m_sectionDepth > 0 )
+            writeEvent( 'E', sectionStats.sectionInfo.name, "section" );
+        StreamingReporterBase::sectionEnded( sectionStats );
+    }
+
+    void TraceReporter::testCaseEnded( TestCaseStats const& testCaseStats ) {
+        writeEvent( 'E', testCaseStats.testInfo.name, "test case" );
+        StreamingReporterBase::testCaseEnded( testCaseStats );
+    }
+
+    void TraceReporter::testRunEnded( TestRunStats const& testRunStats ) {
+        stream << "\n]\n";
+        stream.flush();
+        StreamingReporterBase::testRunEnded( testRunStats );
+    }
+
+} // end namespace Catch
+
+#endif // CATCH_CONFIG_MINIMAL_RUNTIME
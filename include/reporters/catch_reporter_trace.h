@@ -0,0 +1,52 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef TWOBLUECUBES_CATCH_REPORTER_TRACE_H_INCLUDED
+#define TWOBLUECUBES_CATCH_REPORTER_TRACE_H_INCLUDED
+
+#include "catch_reporter_bases.hpp"
+
+namespace Catch {
+
+    // Writes the run as a chrome://tracing / Perfetto compatible JSON
+    // timeline: a begin/end event pair per test case and per section, plus
+    // an instant event per failed assertion (per passed assertion too, when
+    // -s is given). Load the file in a trace viewer to get a flamegraph of
+    // where suite time goes without instrumenting anything by hand.
+    //
+    // Timestamps are absolute microseconds from the shared system clock, so
+    // the lanes of parallel workers (each reporter instance gets its own
+    // thread id) line up against each other; viewers normalise to the
+    // earliest event.
+    class TraceReporter : public StreamingReporterBase<TraceReporter> {
+    public:
+        TraceReporter( ReporterConfig const& _config );
+        ~TraceReporter() override;
+
+        static std::string getDescription();
+
+        void testRunStarting( TestRunInfo const& runInfo ) override;
+        void testCaseStarting( TestCaseInfo const& testCaseInfo ) override;
+        void sectionStarting( SectionInfo const& sectionInfo ) override;
+
+        void assertionStarting( AssertionInfo const& assertionInfo ) override;
+        bool assertionEnded( AssertionStats const& assertionStats ) override;
+
+        void sectionEnded( SectionStats const& sectionStats ) override;
+        void testCaseEnded( TestCaseStats const& testCaseStats ) override;
+        void testRunEnded( TestRunStats const& testRunStats ) override;
+
+    private:
+        // Emits one complete trace event object; phase is "B", "E" or "i"
+        void writeEvent( char phase, std::string const& name, std::string const& category );
+        void writeJsonString( std::string const& value );
+
+        int m_tid;
+        unsigned int m_sectionDepth = 0;
+        bool m_firstEvent = true;
+    };
+
+} // end namespace Catch
+
+#endif // TWOBLUECUBES_CATCH_REPORTER_TRACE_H_INCLUDED
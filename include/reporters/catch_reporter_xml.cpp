@@ -6,6 +6,8 @@
  *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
  */
 
+#if !defined(CATCH_CONFIG_MINIMAL_RUNTIME)
+
 #include "catch_reporter_xml.h"
 
 #include "../internal/catch_capture.hpp"
@@ -65,6 +67,12 @@ namespace Catch {
 
     void XmlReporter::testCaseStarting( TestCaseInfo const& testInfo ) {
         StreamingReporterBase::testCaseStarting(testInfo);
+        if( m_slim ) {
+            // Remember where this test case's subtree begins, so a clean
+            // pass can be rewound away wholesale in testCaseEnded
+            m_xml.ensureTagClosed();
+            m_testCaseBufferStart = m_xml.bufferPosition();
+        }
         m_xml.startElement( "TestCase" )
             .writeAttribute( "name", trim( testInfo.name ) )
             .writeAttribute( "description", testInfo.description )
@@ -181,22 +189,61 @@ namespace Catch {
 
     void XmlReporter::testCaseEnded( TestCaseStats const& testCaseStats ) {
         StreamingReporterBase::testCaseEnded( testCaseStats );
-        XmlWriter::ScopedElement e = m_xml.scopedElement( "OverallResult" );
-        e.writeAttribute( "success", testCaseStats.totals.assertions.allOk() );
+        {
+            XmlWriter::ScopedElement e = m_xml.scopedElement( "OverallResult" );
+            e.writeAttribute( "success", testCaseStats.totals.assertions.allOk() );
 
-        if ( m_config->showDurations() == ShowDurations::Always )
-            e.writeAttribute( "durationInSeconds", m_testCaseTimer.getElapsedSeconds() );
+            if ( m_config->showDurations() == ShowDurations::Always )
+                e.writeAttribute( "durationInSeconds", m_testCaseTimer.getElapsedSeconds() );
+
+            if( testCaseStats.resourceUsage.sampled ) {
+                auto const& usage = testCaseStats.resourceUsage;
+                m_xml.scopedElement( "ResourceUsage" )
+                    .writeAttribute( "userCpuSeconds", usage.userCpuSeconds )
+                    .writeAttribute( "systemCpuSeconds", usage.systemCpuSeconds )
+                    .writeAttribute( "peakRssKbDelta", usage.peakRssKb )
+                    .writeAttribute( "minorPageFaults", usage.minorPageFaults )
+                    .writeAttribute( "majorPageFaults", usage.majorPageFaults );
+            }
 
-        if( !testCaseStats.stdOut.empty() )
-            m_xml.scopedElement( "StdOut" ).writeText( trim( testCaseStats.stdOut ), false );
-        if( !testCaseStats.stdErr.empty() )
-            m_xml.scopedElement( "StdErr" ).writeText( trim( testCaseStats.stdErr ), false );
+            if( testCaseStats.stackPeakBytes >= 0 )
+                m_xml.scopedElement( "StackUsage" )
+                    .writeAttribute( "peakBytes", testCaseStats.stackPeakBytes );
 
+            if( !testCaseStats.stdOut.empty() )
+                m_xml.scopedElement( "StdOut" ).writeText( trim( testCaseStats.stdOut ), false );
+            if( !testCaseStats.stdErr.empty() )
+                m_xml.scopedElement( "StdErr" ).writeText( trim( testCaseStats.stdErr ), false );
+        }
         m_xml.endElement();
+
+        // A cleanly passed test case's subtree is dropped from the buffer
+        // in the slim profile; it is accounted for in the group's
+        // <PassedTestCases> aggregate instead
+        if( m_slim && testCaseStats.totals.assertions.allPassed() ) {
+            m_xml.rewindBuffer( m_testCaseBufferStart );
+            ++m_slimPassedTests;
+            m_slimPassedAssertions += testCaseStats.totals.assertions.passed;
+            if ( m_config->showDurations() == ShowDurations::Always )
+                m_slimPassedDuration += m_testCaseTimer.getElapsedSeconds();
+        }
+
+        // The writer buffers in memory; one write per test case
+        m_xml.flush();
     }
 
     void XmlReporter::testGroupEnded( TestGroupStats const& testGroupStats ) {
         StreamingReporterBase::testGroupEnded( testGroupStats );
+        if( m_slim ) {
+            XmlWriter::ScopedElement e = m_xml.scopedElement( "PassedTestCases" );
+            e.writeAttribute( "count", m_slimPassedTests );
+            e.writeAttribute( "assertions", m_slimPassedAssertions );
+            if ( m_config->showDurations() == ShowDurations::Always )
+                e.writeAttribute( "durationInSeconds", m_slimPassedDuration );
+            m_slimPassedTests = 0;
+            m_slimPassedAssertions = 0;
+            m_slimPassedDuration = 0;
+        }
         // TODO: Check testGroupStats.aborting and act accordingly.
         m_xml.scopedElement( "OverallResults" )
             .writeAttribute( "successes", testGroupStats.totals.assertions.passed )
@@ -212,12 +259,23 @@ namespace Catch {
             .writeAttribute( "failures", testRunStats.totals.assertions.failed )
             .writeAttribute( "expectedFailures", testRunStats.totals.assertions.failedButOk );
         m_xml.endElement();
+        m_xml.flush();
     }
 
-    CATCH_REGISTER_REPORTER( "xml", XmlReporter )
+    XmlSlimReporter::XmlSlimReporter( ReporterConfig const& _config )
+    :   XmlReporter( _config )
+    {
+        m_slim = true;
+    }
+
+    std::string XmlSlimReporter::getDescription() {
+        return "Reports failing tests as XML in full, aggregating clean passes";
+    }
 
 } // end namespace Catch
 
 #if defined(_MSC_VER)
 #pragma warning(pop)
 #endif
+
+#endif // CATCH_CONFIG_MINIMAL_RUNTIME
@@ -50,10 +50,30 @@ namespace Catch {
 
         void testRunEnded(TestRunStats const& testRunStats) override;
 
-    private:
+    protected:
         Timer m_testCaseTimer;
         XmlWriter m_xml;
         int m_sectionDepth = 0;
+
+        // Slim profile (see XmlSlimReporter): clean test cases' subtrees
+        // are rewound out of the writer's buffer and folded into a single
+        // per-group aggregate instead
+        bool m_slim = false;
+        std::size_t m_testCaseBufferStart = 0;
+        std::size_t m_slimPassedTests = 0;
+        std::size_t m_slimPassedAssertions = 0;
+        double m_slimPassedDuration = 0;
+    };
+
+    // Same document shape as XmlReporter, but only test cases with a
+    // failure (or an expected failure) keep their full Section/assertion
+    // structure; everything that passed cleanly is aggregated into one
+    // compact <PassedTestCases> element per group
+    class XmlSlimReporter : public XmlReporter {
+    public:
+        XmlSlimReporter(ReporterConfig const& _config);
+
+        static std::string getDescription();
     };
 
 } // end namespace Catch
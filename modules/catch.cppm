@@ -0,0 +1,91 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+// Experimental C++20 module interface for Catch2.
+//
+// On module-enabled toolchains `import catch2;` replaces re-parsing the
+// full header in every test TU with loading a precompiled module, which
+// is where most of Catch's per-TU compile time goes.
+//
+// Preprocessor macros cannot be exported from a module, so TUs that
+// define test cases still include catch.hpp for TEST_CASE, REQUIRE and
+// friends (the include is cheap when the compiler shares the module's
+// state). TUs that only drive the framework - a custom main() calling
+// Session, reporters, programmatic configuration - can import alone.
+//
+// Built by the Catch2CxxModule target (see CATCH_BUILD_CXX_MODULE).
+
+module;
+
+// Reporter interfaces are part of the exported surface
+#define CATCH_CONFIG_EXTERNAL_INTERFACES
+#include "catch.hpp"
+#include "internal/catch_session.h"
+
+export module catch2;
+
+export namespace Catch {
+
+    // Running tests
+    using Catch::Session;
+    using Catch::ConfigData;
+    using Catch::Config;
+    using Catch::IConfig;
+    using Catch::IConfigPtr;
+
+    // Test case introspection
+    using Catch::TestCase;
+    using Catch::TestCaseInfo;
+    using Catch::SourceLineInfo;
+    using Catch::StringRef;
+    using Catch::Totals;
+    using Catch::Counts;
+
+    // Assertion support types usable outside the macros
+    // Through its definition in Detail - as of GCC 12, modules-ts cannot
+    // re-export a name that the header itself introduced with a
+    // using-declaration
+    using Catch::Detail::Approx;
+    using Catch::ResultWas;
+    using Catch::ResultDisposition;
+    using Catch::AssertionResult;
+    using Catch::AssertionInfo;
+    using Catch::AssertionStats;
+
+    // Reporter interfaces, for custom reporters and listeners
+    using Catch::IStreamingReporter;
+    using Catch::IStreamingReporterPtr;
+    using Catch::ReporterConfig;
+    using Catch::SectionInfo;
+    using Catch::SectionStats;
+    using Catch::TestCaseStats;
+    using Catch::TestGroupStats;
+    using Catch::TestRunInfo;
+    using Catch::TestRunStats;
+
+    // Registry access for programmatic drivers
+    using Catch::getRegistryHub;
+    using Catch::getMutableRegistryHub;
+
+    // Stringification entry point
+    using Catch::StringMaker;
+
+    namespace Matchers {
+        using Catch::Matchers::Contains;
+        using Catch::Matchers::EndsWith;
+        using Catch::Matchers::Equals;
+        using Catch::Matchers::Matches;
+        using Catch::Matchers::StartsWith;
+        using Catch::Matchers::VectorContains;
+        using Catch::Matchers::WithinAbs;
+        using Catch::Matchers::WithinULP;
+        using Catch::Matchers::Predicate;
+        using Catch::Matchers::WritesGolden;
+    }
+
+    namespace literals {
+        using Catch::literals::operator""_a;
+    }
+
+} // export namespace Catch
@@ -0,0 +1,30 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include "catch.hpp"
+
+// Per-assertion overhead of the framework itself: expression decomposition,
+// result handling and reporter dispatch for assertions that pass. Failing
+// assertions are not driven through the full pipeline here because every
+// failure produces reporter output, which would dominate the timing; the
+// decomposition benchmark covers the expression-building part of that path
+// and ReporterBench.cpp covers the dispatch.
+TEST_CASE( "Assertion overhead", "[benchmark]" ) {
+    int i = 0;
+
+    BENCHMARK( "Passing REQUIRE" ) {
+        REQUIRE( ++i > 0 );
+    }
+
+    BENCHMARK( "Passing CHECK" ) {
+        CHECK( ++i > 0 );
+    }
+
+    bool neverTrue = false;
+    BENCHMARK( "Decomposing a failing comparison" ) {
+        auto const expr = Catch::Decomposer() <= ++i == -1;
+        neverTrue |= expr.getResult();
+    }
+    CHECK_FALSE( neverTrue );
+}
@@ -0,0 +1,32 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include "catch.hpp"
+#include "internal/catch_test_case_registry_impl.h"
+
+#include <string>
+
+namespace {
+    struct NullInvoker : Catch::ITestInvoker {
+        void invoke() const override {}
+    };
+}
+
+// Every TEST_CASE in a binary registers itself during static initialisation,
+// before main() is entered, so startup time scales with test count. This
+// exercises the same path: building the name, parsing the tag string into a
+// TestCaseInfo and inserting into the registry.
+TEST_CASE( "Test case registration overhead", "[benchmark]" ) {
+    BENCHMARK( "Register 1000 test cases" ) {
+        Catch::TestRegistry registry;
+        for( int i = 0; i < 1000; ++i ) {
+            std::string name = "Benchmark test " + std::to_string( i );
+            registry.registerTest(
+                Catch::makeTestCase( new NullInvoker(),
+                                     std::string(),
+                                     Catch::NameAndTags( name.c_str(), "[benchmark][registration]" ),
+                                     CATCH_INTERNAL_LINEINFO ) );
+        }
+    }
+}
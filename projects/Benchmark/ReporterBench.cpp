@@ -0,0 +1,33 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include "catch.hpp"
+#include "internal/catch_config.hpp"
+#include "internal/catch_interfaces_reporter.h"
+#include "reporters/catch_reporter_console.h"
+
+#include <sstream>
+
+// Cost of pushing one assertion event through a streaming reporter, as
+// RunContext does for every assertion. The console reporter drops passing
+// assertions early, so this measures the per-assertion dispatch overhead
+// rather than output formatting.
+TEST_CASE( "Reporter event dispatch overhead", "[benchmark]" ) {
+    using namespace Catch;
+
+    std::ostringstream sink;
+    IConfigPtr config( new Config( ConfigData() ) );
+    ConsoleReporter console( ReporterConfig( config, sink ) );
+    IStreamingReporter& reporter = console;
+
+    AssertionInfo info{ StringRef( "REQUIRE" ), CATCH_INTERNAL_LINEINFO, StringRef( "x == y" ), ResultDisposition::Normal };
+    AssertionResultData data( ResultWas::Ok, LazyExpression( false ) );
+    AssertionResult result( info, data );
+    AssertionStats stats( result, {}, Totals() );
+
+    BENCHMARK( "Passing assertion event" ) {
+        reporter.assertionStarting( info );
+        reporter.assertionEnded( stats );
+    }
+}
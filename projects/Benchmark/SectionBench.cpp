@@ -0,0 +1,53 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include "catch.hpp"
+#include "internal/catch_test_case_tracker.h"
+
+namespace {
+    Catch::TestCaseTracking::NameAndLocation makeNAL( std::string const& name ) {
+        return Catch::TestCaseTracking::NameAndLocation( name, Catch::SourceLineInfo( "", 0 ) );
+    }
+}
+
+// Cost of the section tracking machinery that decides, on each pass through
+// a test case, which SECTION to enter next. Each iteration plays out the
+// complete tracker lifecycle of one test case, so the numbers include the
+// re-entry bookkeeping a SECTION pays every time its test case re-runs.
+TEST_CASE( "Section tracking overhead", "[benchmark]" ) {
+    using namespace Catch;
+
+    BENCHMARK( "Test case with one section" ) {
+        TrackerContext ctx;
+        ctx.startRun();
+        ctx.startCycle();
+        ITracker& testCase = SectionTracker::acquire( ctx, makeNAL( "Testcase" ) );
+        ITracker& s1 = SectionTracker::acquire( ctx, makeNAL( "S1" ) );
+        s1.close();
+        testCase.close();
+    }
+
+    BENCHMARK( "Test case with two sibling sections" ) {
+        TrackerContext ctx;
+        ctx.startRun();
+
+        ctx.startCycle();
+        {
+            ITracker& testCase = SectionTracker::acquire( ctx, makeNAL( "Testcase" ) );
+            ITracker& s1 = SectionTracker::acquire( ctx, makeNAL( "S1" ) );
+            s1.close();
+            SectionTracker::acquire( ctx, makeNAL( "S2" ) );
+            testCase.close();
+        }
+
+        ctx.startCycle();
+        {
+            ITracker& testCase = SectionTracker::acquire( ctx, makeNAL( "Testcase" ) );
+            SectionTracker::acquire( ctx, makeNAL( "S1" ) );
+            ITracker& s2 = SectionTracker::acquire( ctx, makeNAL( "S2" ) );
+            s2.close();
+            testCase.close();
+        }
+    }
+}
@@ -0,0 +1,34 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include "catch.hpp"
+
+#include <string>
+#include <vector>
+
+// Catch stringifies the operands of a decomposed expression whenever an
+// assertion needs reporting, so conversion cost is paid on every failure
+// and, with -s, on every success as well.
+TEST_CASE( "Stringification overhead", "[benchmark]" ) {
+
+    int i = 42;
+    BENCHMARK( "int" ) {
+        Catch::keep( Catch::Detail::stringify( ++i ) );
+    }
+
+    double d = 3.14;
+    BENCHMARK( "double" ) {
+        Catch::keep( Catch::Detail::stringify( d ) );
+    }
+
+    std::string s( 32, 'x' );
+    BENCHMARK( "std::string" ) {
+        Catch::keep( Catch::Detail::stringify( s ) );
+    }
+
+    std::vector<int> v( 100 );
+    BENCHMARK( "std::vector<int> with 100 elements" ) {
+        Catch::keep( Catch::Detail::stringify( v ) );
+    }
+}
@@ -0,0 +1,95 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+// The assertion workload shared by Assertions.cpp and LeanAssertions.cpp,
+// so the full header and the lean header are timed against an identical
+// translation unit body. Representative of a typical test file: plain
+// test cases, sections, the REQUIRE/CHECK families, messages and Approx.
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    inline int identity( int i ) { return i; }
+    inline void boom() { throw std::runtime_error( "boom" ); }
+}
+
+TEST_CASE( "ctb: comparisons", "[.compile-bench]" ) {
+    int a = 1, b = 2, c = 3;
+    REQUIRE( a < b );
+    REQUIRE( b < c );
+    REQUIRE_FALSE( c < a );
+    CHECK( a + b == c );
+    CHECK( identity( a ) == a );
+    CHECK_FALSE( identity( b ) == c );
+}
+
+TEST_CASE( "ctb: sections", "[.compile-bench]" ) {
+    std::vector<int> v( 5 );
+
+    SECTION( "resizing bigger changes size and capacity" ) {
+        v.resize( 10 );
+        REQUIRE( v.size() == 10 );
+        REQUIRE( v.capacity() >= 10 );
+    }
+    SECTION( "resizing smaller changes size but not capacity" ) {
+        v.resize( 0 );
+        REQUIRE( v.size() == 0 );
+        REQUIRE( v.capacity() >= 5 );
+    }
+    SECTION( "reserving bigger changes capacity but not size" ) {
+        v.reserve( 10 );
+        REQUIRE( v.size() == 5 );
+        REQUIRE( v.capacity() >= 10 );
+        SECTION( "reserving smaller again does not change capacity" ) {
+            v.reserve( 7 );
+            REQUIRE( v.capacity() >= 10 );
+        }
+    }
+}
+
+TEST_CASE( "ctb: exceptions", "[.compile-bench]" ) {
+    REQUIRE_THROWS( boom() );
+    REQUIRE_THROWS_AS( boom(), std::runtime_error );
+    CHECK_THROWS_AS( boom(), std::exception );
+    REQUIRE_NOTHROW( identity( 1 ) );
+    CHECK_NOTHROW( identity( 2 ) );
+}
+
+TEST_CASE( "ctb: messages", "[.compile-bench]" ) {
+    int answer = 42;
+    std::string name = "compile bench";
+    INFO( "checking " << name );
+    CAPTURE( answer, name );
+    CHECK( answer == 42 );
+    SUCCEED( "nothing to check" );
+}
+
+TEST_CASE( "ctb: floating point", "[.compile-bench]" ) {
+    double pi = 3.14159;
+    REQUIRE( pi == Approx( 3.14159 ) );
+    REQUIRE( pi != Approx( 3.0 ) );
+    CHECK( 1.0 / 3.0 == Approx( 0.33333 ).epsilon( 0.001 ) );
+    CHECK( 0.0 == Approx( 0.00001 ).margin( 0.0001 ) );
+}
+
+TEST_CASE( "ctb: bdd style", "[.compile-bench]" ) {
+    GIVEN( "a counter at zero" ) {
+        int counter = 0;
+        WHEN( "it is incremented" ) {
+            ++counter;
+            THEN( "it is one" ) {
+                REQUIRE( counter == 1 );
+            }
+        }
+        WHEN( "it is decremented" ) {
+            --counter;
+            THEN( "it is minus one" ) {
+                REQUIRE( counter == -1 );
+            }
+        }
+    }
+}
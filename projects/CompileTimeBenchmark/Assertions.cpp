@@ -0,0 +1,12 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+// Assertion-only TU through the full header - the baseline cost most
+// test files pay. Compare with LeanAssertions.cpp, which compiles the
+// same body through catch_lean.hpp.
+
+#include "catch.hpp"
+
+#include "AssertionSuite.h"
@@ -0,0 +1,56 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+// Generator-heavy TU: value lists, ranges, tables and the combinator
+// generators (take/chunk), each of which instantiates its own generator
+// templates per element type.
+
+#include "catch.hpp"
+
+#include <string>
+#include <utility>
+
+TEST_CASE( "ctb: value generators", "[.compile-bench]" ) {
+    auto i = GENERATE( 1, 3, 5 );
+    auto s = GENERATE( as<std::string>(), "a", "bb", "ccc" );
+    CHECK( i % 2 == 1 );
+    CHECK( !s.empty() );
+}
+
+TEST_CASE( "ctb: range generators", "[.compile-bench]" ) {
+    auto x = GENERATE( range( 0, 10 ) );
+    auto y = GENERATE( range( 10, 20 ) );
+    REQUIRE( x < y );
+}
+
+TEST_CASE( "ctb: table generators", "[.compile-bench]" ) {
+    auto entry = GENERATE( table<std::string, std::size_t>( {
+        { "one", 3 },
+        { "three", 5 },
+        { "seventeen", 9 },
+    } ) );
+    REQUIRE( std::get<0>( entry ).size() == std::get<1>( entry ) );
+}
+
+TEST_CASE( "ctb: generator combinators", "[.compile-bench]" ) {
+    auto small = GENERATE( take( 5, range( 0, 100 ) ) );
+    CHECK( small < 5 );
+
+    auto v = GENERATE( values( { 2, 4, 6 } ) );
+    CHECK( v % 2 == 0 );
+
+    auto pair = GENERATE( chunk( 2, take( 6, range( 1, 100 ) ) ) );
+    REQUIRE( pair.size() == 2 );
+}
+
+TEST_CASE( "ctb: generators with sections", "[.compile-bench]" ) {
+    auto i = GENERATE( range( 1, 4 ) );
+    SECTION( "squares are positive" ) {
+        REQUIRE( i * i > 0 );
+    }
+    SECTION( "successors are bigger" ) {
+        REQUIRE( i + 1 > i );
+    }
+}
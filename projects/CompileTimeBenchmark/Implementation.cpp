@@ -0,0 +1,14 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+// The implementation TU: CATCH_CONFIG_MAIN enables every part of the
+// headers (CATCH_CONFIG_ALL_PARTS, the external interfaces, the default
+// main), the one-off cost paid by the main source file of a test
+// binary. Against the single header this additionally stitches in the
+// whole implementation; against include/ that part is compiled
+// separately, as the Catch2Impl library.
+
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
@@ -0,0 +1,12 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+// The same assertion workload as Assertions.cpp, but through the
+// assertion-only catch_lean.hpp - the difference between the two is the
+// per-TU cost of the matchers, generators and reporter declarations.
+
+#include "catch_lean.hpp"
+
+#include "AssertionSuite.h"
@@ -0,0 +1,80 @@
+/*
+ *  Distributed under the Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+// Matcher-heavy TU: string, vector and floating point matchers plus
+// composition and a custom matcher, which is where most of the matcher
+// template instantiation cost comes from.
+
+#include "catch.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace Catch::Matchers;
+
+namespace {
+
+    class IsEvenMatcher : public Catch::MatcherBase<int> {
+    public:
+        bool match( int const& i ) const override {
+            return i % 2 == 0;
+        }
+        std::string describe() const override {
+            return "is even";
+        }
+    };
+
+    IsEvenMatcher IsEven() { return IsEvenMatcher(); }
+
+}
+
+TEST_CASE( "ctb: string matchers", "[.compile-bench]" ) {
+    std::string subject = "this string contains 'abc' as a substring";
+
+    REQUIRE_THAT( subject, Contains( "string" ) );
+    REQUIRE_THAT( subject, StartsWith( "this" ) && EndsWith( "substring" ) );
+    CHECK_THAT( subject, Contains( "ABC", Catch::CaseSensitive::No ) );
+    CHECK_THAT( subject, Equals( subject ) );
+    CHECK_THAT( subject, Matches( "this string contains '.*' as a substring" ) );
+    CHECK_THAT( subject, !Contains( "xyz" ) );
+}
+
+TEST_CASE( "ctb: vector matchers", "[.compile-bench]" ) {
+    std::vector<int> v{ 1, 2, 3 };
+    std::vector<int> empty;
+
+    REQUIRE_THAT( v, VectorContains( 2 ) );
+    REQUIRE_THAT( v, Contains( std::vector<int>{ 1, 2 } ) );
+    CHECK_THAT( v, Equals( std::vector<int>{ 1, 2, 3 } ) );
+    CHECK_THAT( v, UnorderedEquals( std::vector<int>{ 3, 1, 2 } ) );
+    CHECK_THAT( empty, !VectorContains( 1 ) );
+}
+
+TEST_CASE( "ctb: floating point matchers", "[.compile-bench]" ) {
+    REQUIRE_THAT( 1.0, WithinAbs( 1.0, 0.001 ) );
+    REQUIRE_THAT( 1.0, WithinULP( 1.0, 0 ) );
+    CHECK_THAT( 0.1 + 0.2, WithinAbs( 0.3, 0.0001 ) || WithinULP( 0.3, 4 ) );
+    CHECK_THAT( 1.0f, WithinULP( 1.0f, 0 ) );
+}
+
+TEST_CASE( "ctb: predicate and custom matchers", "[.compile-bench]" ) {
+    REQUIRE_THAT( 4, IsEven() );
+    CHECK_THAT( 3, !IsEven() );
+    REQUIRE_THAT( "good",
+                  Predicate<std::string>(
+                      []( std::string const& s ) { return s.size() == 4; },
+                      "has four characters" ) );
+    CHECK_THAT( 6, IsEven() && Predicate<int>( []( int i ) { return i > 0; } ) );
+}
+
+TEST_CASE( "ctb: exception matchers", "[.compile-bench]" ) {
+    auto thrower = [] { throw std::runtime_error( "boom goes the dynamite" ); };
+    REQUIRE_THROWS_WITH( thrower(), Contains( "boom" ) );
+    CHECK_THROWS_MATCHES( thrower(), std::runtime_error,
+                          Predicate<std::runtime_error>(
+                              []( std::runtime_error const& ex ) {
+                                  return std::string( ex.what() ) == "boom goes the dynamite";
+                              } ) );
+}
@@ -0,0 +1,49 @@
+#include "catch.hpp"
+#include "internal/catch_checkpoint.h"
+
+#include <sstream>
+
+namespace {
+    auto dumpedCheckpoints() -> std::string {
+        std::ostringstream oss;
+        Catch::writeCheckpoints( oss );
+        return oss.str();
+    }
+}
+
+TEST_CASE( "Checkpoint ring buffer", "[checkpoint]" ) {
+
+    // The run context clears the ring per test case, not per section
+    // pass, so start each section from a known state
+    Catch::clearCheckpoints();
+
+    SECTION( "starts empty" ) {
+        CHECK( !Catch::haveCheckpoints() );
+    }
+
+    SECTION( "records the call site and the scalar" ) {
+        CHECKPOINT( 42 );
+        CHECK( Catch::haveCheckpoints() );
+        auto dump = dumpedCheckpoints();
+        CHECK( dump.find( "Checkpoint.tests.cpp" ) != std::string::npos );
+        CHECK( dump.find( ": 42" ) != std::string::npos );
+    }
+
+    SECTION( "negative scalars survive the round trip" ) {
+        CHECKPOINT( -7 );
+        CHECK( dumpedCheckpoints().find( ": -7" ) != std::string::npos );
+    }
+
+    SECTION( "old entries are overwritten, and counted" ) {
+        for( int i = 0; i < 100; ++i )
+            CHECKPOINT( i );
+        auto dump = dumpedCheckpoints();
+        // The ring holds 16 entries: 84..99 survive, 0..83 are gone
+        CHECK( dump.find( ": 99" ) != std::string::npos );
+        CHECK( dump.find( ": 84" ) != std::string::npos );
+        CHECK( dump.find( ": 83" ) == std::string::npos );
+        CHECK( dump.find( "84 older overwritten" ) != std::string::npos );
+    }
+
+    Catch::clearCheckpoints();
+}
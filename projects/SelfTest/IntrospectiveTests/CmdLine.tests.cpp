@@ -453,6 +453,85 @@ TEST_CASE( "Process can be configured on command line", "[config][command-line]"
             CHECK( !result );
 #ifndef CATCH_CONFIG_DISABLE_MATCHERS
             CHECK_THAT( result.errorMessage(), Contains( "colour mode must be one of" ) );
+#endif
+        }
+    }
+
+    SECTION( "flush-policy") {
+
+        using Catch::FlushPolicy;
+
+        SECTION( "without option" ) {
+            CHECK(cli.parse({"test"}));
+
+            REQUIRE( config.flushPolicy == FlushPolicy::Auto );
+        }
+
+        SECTION( "auto" ) {
+            CHECK(cli.parse({"test", "--flush-policy", "auto"}));
+
+            REQUIRE( config.flushPolicy == FlushPolicy::Auto );
+        }
+
+        SECTION( "immediate" ) {
+            CHECK(cli.parse({"test", "--flush-policy", "immediate"}));
+
+            REQUIRE( config.flushPolicy == FlushPolicy::Immediate );
+        }
+
+        SECTION( "testcase" ) {
+            CHECK(cli.parse({"test", "--flush-policy", "testcase"}));
+
+            REQUIRE( config.flushPolicy == FlushPolicy::TestCaseEnd );
+        }
+
+        SECTION( "error" ) {
+            auto result = cli.parse({"test", "--flush-policy", "wrong"});
+            CHECK( !result );
+#ifndef CATCH_CONFIG_DISABLE_MATCHERS
+            CHECK_THAT( result.errorMessage(), Contains( "flush policy must be one of" ) );
+#endif
+        }
+    }
+
+    SECTION( "async-output" ) {
+
+        SECTION( "without option" ) {
+            CHECK(cli.parse({"test"}));
+
+            REQUIRE( config.asyncOutput == false );
+        }
+
+        SECTION( "with option" ) {
+            CHECK(cli.parse({"test", "--async-output"}));
+
+            REQUIRE( config.asyncOutput == true );
+        }
+    }
+
+    SECTION("sharding") {
+        SECTION("shard count") {
+            CHECK(cli.parse({ "test", "--shard-count", "8" }));
+
+            REQUIRE(config.shardCount == 8);
+        }
+        SECTION("shard count must be positive") {
+            auto result = cli.parse({ "test", "--shard-count", "0" });
+            CHECK( !result );
+#ifndef CATCH_CONFIG_DISABLE_MATCHERS
+            CHECK_THAT( result.errorMessage(), Contains( "The shard count must be greater than 0" ) );
+#endif
+        }
+        SECTION("shard index") {
+            CHECK(cli.parse({ "test", "--shard-index", "2" }));
+
+            REQUIRE(config.shardIndex == 2);
+        }
+        SECTION("shard index must be numeric") {
+            auto result = cli.parse({ "test", "--shard-index", "oops" });
+            CHECK( !result );
+#ifndef CATCH_CONFIG_DISABLE_MATCHERS
+            CHECK_THAT( result.errorMessage(), Contains( "convert" ) && Contains( "oops" ) );
 #endif
         }
     }
@@ -8,9 +8,6 @@ namespace Catch {
 
     // Implementation of test accessors
     struct StringRefTestAccess {
-        static auto isOwned( StringRef const& stringRef ) -> bool {
-            return stringRef.isOwned();
-        }
         static auto isSubstring( StringRef const& stringRef ) -> bool {
             return stringRef.isSubstring();
         }
@@ -18,9 +15,6 @@ namespace Catch {
 
 
     namespace {
-    auto isOwned( StringRef const& stringRef ) -> bool {
-        return StringRefTestAccess::isOwned( stringRef );
-    }
     auto isSubstring( StringRef const& stringRef ) -> bool {
         return StringRefTestAccess::isSubstring( stringRef );
     }
@@ -31,7 +25,8 @@ namespace Catch {
 TEST_CASE( "StringRef", "[Strings][StringRef]" ) {
 
     using Catch::StringRef;
-    using Catch::isOwned; using Catch::isSubstring;
+    using Catch::OwnedString;
+    using Catch::isSubstring;
 
     SECTION( "Empty string" ) {
         StringRef empty;
@@ -49,24 +44,21 @@ TEST_CASE( "StringRef", "[Strings][StringRef]" ) {
         auto rawChars = s.currentData();
         REQUIRE( std::strcmp( rawChars, "hello" ) == 0 );
 
-        SECTION( "c_str() does not cause copy" ) {
-            REQUIRE( isOwned( s ) == false );
-
+        SECTION( "c_str() returns the original pointer" ) {
             REQUIRE( s.c_str() == rawChars );
-
-            REQUIRE( isOwned( s ) == false );
         }
     }
     SECTION( "From sub-string" ) {
         StringRef original = StringRef( "original string" ).substr(0, 8);
         REQUIRE( original == "original" );
         REQUIRE( isSubstring( original ) );
-        REQUIRE( isOwned( original ) == false );
-
-        original.c_str(); // Forces it to take ownership
 
-        REQUIRE( isSubstring( original ) == false );
-        REQUIRE( isOwned( original ) );
+        // A substring is not null terminated, so a null terminated copy
+        // has to be made explicitly
+        OwnedString copy( original );
+        REQUIRE( std::strcmp( copy.c_str(), "original" ) == 0 );
+        REQUIRE( copy.size() == original.size() );
+        REQUIRE( copy.c_str() != original.currentData() );
     }
 
 
@@ -77,36 +69,36 @@ TEST_CASE( "StringRef", "[Strings][StringRef]" ) {
         SECTION( "zero-based substring" ) {
             REQUIRE( ss.empty() == false );
             REQUIRE( ss.size() == 5 );
-            REQUIRE( std::strcmp( ss.c_str(), "hello" ) == 0 );
             REQUIRE( ss == "hello" );
         }
-        SECTION( "c_str() causes copy" ) {
+        SECTION( "substring refs stay borrowed" ) {
             REQUIRE( isSubstring( ss ) );
-            REQUIRE( isOwned( ss ) == false );
-
-            auto rawChars = ss.currentData();
-            REQUIRE( rawChars == s.currentData() ); // same pointer value
-            REQUIRE( ss.c_str() != rawChars );
-
-            REQUIRE( isSubstring( ss ) == false );
-            REQUIRE( isOwned( ss ) );
-
-            REQUIRE( ss.currentData() != s.currentData() ); // different pointer value
+            REQUIRE( ss.currentData() == s.currentData() ); // same pointer value
         }
 
         SECTION( "non-zero-based substring") {
             ss = s.substr( 6, 6 );
             REQUIRE( ss.size() == 6 );
-            REQUIRE( std::strcmp( ss.c_str(), "world!" ) == 0 );
+            REQUIRE( ss == "world!" );
         }
 
         SECTION( "Pointer values of full refs should match" ) {
             StringRef s2 = s;
             REQUIRE( s.c_str() == s2.c_str() );
         }
+    }
 
-        SECTION( "Pointer values of substring refs should not match" ) {
-            REQUIRE( s.c_str() != ss.c_str() );
+    SECTION( "OwnedString" ) {
+        SECTION( "short strings fit the inline buffer" ) {
+            OwnedString short_( StringRef( "abc" ) );
+            REQUIRE( short_.size() == 3 );
+            REQUIRE( std::strcmp( short_.c_str(), "abc" ) == 0 );
+        }
+        SECTION( "long strings are copied to the heap" ) {
+            std::string longStr( 100, 'x' );
+            OwnedString long_( ( StringRef( longStr ) ) );
+            REQUIRE( long_.size() == 100 );
+            REQUIRE( std::strcmp( long_.c_str(), longStr.c_str() ) == 0 );
         }
     }
 
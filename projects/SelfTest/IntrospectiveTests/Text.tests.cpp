@@ -0,0 +1,119 @@
+#include "catch.hpp"
+#include "internal/catch_config.hpp"
+#include "internal/catch_text.h"
+#include "internal/catch_text_diff.h"
+
+#include <sstream>
+
+namespace {
+    // printWrapped promises the exact output of TextFlow::Column, just
+    // without the per-line copies - check them against each other
+    auto wrapped( std::string const& text, std::size_t width, std::size_t indent ) -> std::string {
+        std::ostringstream oss;
+        Catch::printWrapped( oss, text, width, indent );
+        return oss.str();
+    }
+    auto columnWrapped( std::string const& text, std::size_t width, std::size_t indent ) -> std::string {
+        return Catch::Column( text ).width( width ).indent( indent ).toString();
+    }
+}
+
+TEST_CASE( "printWrapped matches TextFlow::Column", "[Strings][Text]" ) {
+
+    SECTION( "plain text" ) {
+        std::string texts[] = {
+            "",
+            "short",
+            "several words that wrap onto more than one line at this width",
+            "an-unbroken-run-of-characters-much-longer-than-the-line-width-so-it-hyphenates",
+            "breakable[before chars and breakable]after chars",
+            "trailing whitespace   ",
+            "hard\nline\nbreaks",
+            "blank\n\nline",
+            "\nleading newline",
+            "ends with newline\n"
+        };
+        for( auto const& text : texts ) {
+            INFO( '"' << text << '"' );
+            CHECK( wrapped( text, 15, 0 ) == columnWrapped( text, 15, 0 ) );
+            CHECK( wrapped( text, 15, 2 ) == columnWrapped( text, 15, 2 ) );
+        }
+    }
+
+    SECTION( "segment overrunning the width by less than the indent" ) {
+        // Column prints such segments whole - make sure we stay in step
+        std::string text = "aaaa bbbb cccc"; // 14 chars: wraps at width 13, fits at 15
+        CHECK( wrapped( text, 15, 2 ) == columnWrapped( text, 15, 2 ) );
+    }
+}
+
+namespace {
+    auto diffed( std::string const& lhs, std::string const& rhs ) -> std::string {
+        std::ostringstream oss;
+        Catch::formatTextDiff( oss, lhs, rhs );
+        return oss.str();
+    }
+}
+
+TEST_CASE( "formatTextDiff", "[Strings][Text][diff]" ) {
+
+    SECTION( "changed line becomes one hunk with context" ) {
+        std::string lhs, rhs;
+        for( int i = 0; i < 10; ++i ) {
+            lhs += "line " + std::to_string( i ) + "\n";
+            rhs += ( i == 5 ? "changed" : "line " + std::to_string( i ) ) + "\n";
+        }
+        CHECK( diffed( lhs, rhs ) ==
+            "@@ lhs line 4, rhs line 4 @@\n"
+            "  line 3\n"
+            "  line 4\n"
+            "- line 5\n"
+            "+ changed\n"
+            "  line 6\n"
+            "  line 7\n" );
+    }
+
+    SECTION( "inserted line shows as an addition" ) {
+        std::string lhs = "a\nb\nc\nd\ne\nf\n";
+        std::string rhs = "a\nb\nc\nX\nd\ne\nf\n";
+        CHECK( diffed( lhs, rhs ) ==
+            "@@ lhs line 2, rhs line 2 @@\n"
+            "  b\n"
+            "  c\n"
+            "+ X\n"
+            "  d\n"
+            "  e\n" );
+    }
+
+    SECTION( "nearby hunks merge" ) {
+        std::string lhs = "a\nb\nc\nd\ne\nf\n";
+        std::string rhs = "A\nb\nc\nd\ne\nF\n";
+        auto result = diffed( lhs, rhs );
+        // One header, not two - the gap between the changes fits in context
+        CHECK( result.find( "@@ lhs" ) == result.rfind( "@@ lhs" ) );
+        CHECK( result.find( "- a\n+ A\n" ) != std::string::npos );
+        CHECK( result.find( "- f\n+ F\n" ) != std::string::npos );
+    }
+
+    SECTION( "single line texts report the first differing character" ) {
+        std::string lhs( 100, 'a' );
+        auto rhs = lhs;
+        rhs[60] = 'b';
+        auto result = diffed( lhs, rhs );
+        CHECK( result.find( "first difference at character 60" ) != std::string::npos );
+    }
+
+    SECTION( "identical sides are called out" ) {
+        CHECK( diffed( "same\ntext\n", "same\ntext\n" ) == "(the two sides are identical)\n" );
+    }
+
+    SECTION( "output is capped for wildly different texts" ) {
+        std::string lhs, rhs;
+        for( int i = 0; i < 300; ++i ) {
+            lhs += "left " + std::to_string( i ) + "\n";
+            rhs += "right " + std::to_string( i ) + "\n";
+        }
+        auto result = diffed( lhs, rhs );
+        CHECK( result.size() < 4096 );
+    }
+}
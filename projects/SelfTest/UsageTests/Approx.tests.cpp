@@ -211,4 +211,28 @@ TEST_CASE( "Comparison with explicitly convertible types", "[Approx]" )
 
 }
 
+TEST_CASE( "Whole ranges can be compared with ApproxRange", "[Approx]" ) {
+    std::vector<double> const expected = { 1.0, 2.0, 3.0 };
+
+    std::vector<double> close = { 1.0 + 1e-10, 2.0, 3.0 - 1e-10 };
+    REQUIRE( close == ApproxRange( expected ) );
+    REQUIRE( ApproxRange( expected ) == close );
+
+    std::vector<double> off = { 1.0, 2.5, 3.0 };
+    REQUIRE( off != ApproxRange( expected ) );
+    REQUIRE( ApproxRange( expected ) != off );
+
+    std::vector<double> shorter = { 1.0, 2.0 };
+    REQUIRE( shorter != ApproxRange( expected ) );
+
+    std::vector<float> floats = { 1.f, 2.f, 3.f };
+    REQUIRE( floats == ApproxRange( expected ) );
+
+    REQUIRE( off == ApproxRange( expected ).epsilon( 0.5 ) );
+    REQUIRE( off == ApproxRange( expected ).margin( 0.5 ) );
+
+    REQUIRE_THROWS_AS( ApproxRange( expected ).margin( -1.0 ), std::domain_error );
+    REQUIRE_THROWS_AS( ApproxRange( expected ).epsilon( 2.0 ), std::domain_error );
+}
+
 }} // namespace ApproxTests
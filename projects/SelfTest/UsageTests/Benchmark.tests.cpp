@@ -41,3 +41,23 @@ TEST_CASE( "benchmarked", "[!benchmark]" ) {
         sum += array[i];
     REQUIRE( sum > size );
 }
+
+TEST_CASE( "comparing benchmarks", "[!benchmark]" ) {
+
+    std::vector<int> v( 100, 1 );
+
+    BENCHMARK_GROUP( "Summing a vector" ) {
+        BENCHMARK_VARIANT( "Indexed loop" ) {
+            int sum = 0;
+            for( std::size_t i = 0; i < v.size(); ++i )
+                sum += v[i];
+            Catch::keep( sum );
+        }
+        BENCHMARK_VARIANT( "Range-for" ) {
+            int sum = 0;
+            for( int x : v )
+                sum += x;
+            Catch::keep( sum );
+        }
+    }
+}
@@ -60,4 +60,28 @@ namespace Inner
     }
 }
 
+static int suiteFixtureSetupCount = 0;
+static int suiteFixtureLiveCount = 0;
+
+class SuiteScopeFixture : public Catch::ISuiteFixture
+{
+public:
+    void setup() override    { ++suiteFixtureSetupCount; ++suiteFixtureLiveCount; }
+    void teardown() override { --suiteFixtureLiveCount; }
+};
+
+CATCH_REGISTER_SUITE_FIXTURE( SuiteScopeFixture, "[suite-fixture]" )
+
+TEST_CASE( "A suite fixture is set up once before its first matching test", "[class][suite-fixture]" )
+{
+    REQUIRE( suiteFixtureSetupCount == 1 );
+    REQUIRE( suiteFixtureLiveCount == 1 );
+}
+
+TEST_CASE( "A suite fixture stays up until its last matching test ends", "[class][suite-fixture]" )
+{
+    REQUIRE( suiteFixtureSetupCount == 1 );
+    REQUIRE( suiteFixtureLiveCount == 1 );
+}
+
 }} // namespace ClassTests
@@ -64,3 +64,21 @@ TEST_CASE( "toString(enum class w/operator<<)", "[toString][enum][enumClass]" )
     EnumClass2 e3 = static_cast<EnumClass2>(10);
     CHECK( ::Catch::Detail::stringify(e3) == "Unknown enum value 10" );
 }
+
+// Enum registered with CATCH_REGISTER_ENUM stringifies to enumerator names
+namespace {
+enum class Fruits { Banana, Apple, Mango };
+enum Vehicles { Bicycle, Car };
+}
+
+CATCH_REGISTER_ENUM( Fruits, Fruits::Banana, Fruits::Apple, Fruits::Mango )
+CATCH_REGISTER_ENUM( Vehicles, Bicycle, Car )
+
+TEST_CASE( "toString(registered enum)", "[toString][enum]" ) {
+    CHECK( ::Catch::Detail::stringify( Fruits::Apple ) == "Apple" );
+    CHECK( ::Catch::Detail::stringify( Fruits::Mango ) == "Mango" );
+    CHECK( ::Catch::Detail::stringify( Vehicles::Car ) == "Car" );
+    SECTION( "Unregistered values fall back to the underlying integer" ) {
+        CHECK( ::Catch::Detail::stringify( static_cast<Fruits>( 42 ) ) == "42" );
+    }
+}
@@ -106,6 +106,71 @@ TEST_CASE( "Random numbers in a range", "[.][approvals]" ) {
     REQUIRE( square(x) >= 0 );
 }
 
+// The sampling form of random takes an explicit count and draws values
+// (possibly repeating) from the inclusive range, however wide it is
+TEST_CASE( "Random sampled numbers in a range", "[.][approvals]" ) {
+    auto x = GENERATE( random( -1000000000, 1000000000, 20 ) );
+    CAPTURE( x );
+    REQUIRE( x >= -1000000000 );
+    REQUIRE( x <= 1000000000 );
+}
+
+// Batched generation hands the body whole batches of values per test
+// entry, so a large value set costs a fraction of the tracker walks.
+// The trade-off: anything below sees one entry per batch, not per value.
+TEST_CASE( "Batched generation" ) {
+    auto xs = GENERATE_BATCHED( 4, range( 0, 10 ) );
+    CAPTURE( xs.size() );
+    REQUIRE( !xs.empty() );
+    REQUIRE( xs.back() - xs.front() == static_cast<int>( xs.size() ) - 1 );
+}
+
+TEST_CASE( "Whole-run batched generation" ) {
+    auto xs = GENERATE_ALL( range( 1, 6 ), 10 );
+    REQUIRE( xs == std::vector<int>{ 1, 2, 3, 4, 5, 10 } );
+}
+
+// Literal data can skip generator objects entirely: the values live in
+// a constexpr table and the tracker just walks an index across it
+TEST_CASE( "Static table generation" ) {
+    auto x = GENERATE_STATIC( int, 2, 4, 6, 8 );
+    REQUIRE( x % 2 == 0 );
+    REQUIRE( x >= 2 );
+    REQUIRE( x <= 8 );
+}
+
+namespace {
+    // Stand-in for a large fixture object: counts copies so the test can
+    // pin down that by-reference generation makes none after build-up
+    struct CopyCountingElement {
+        int value;
+        static int copies;
+        CopyCountingElement( int v ) : value( v ) {}
+        CopyCountingElement( CopyCountingElement const& other ) : value( other.value ) { ++copies; }
+        CopyCountingElement( CopyCountingElement&& other ) noexcept : value( other.value ) {}
+    };
+    int CopyCountingElement::copies = 0;
+}
+
+// GENERATE_REF builds the value set once, then each section pass reads
+// its element in place - the copy count must not grow between passes
+TEST_CASE( "By-reference generation makes no per-pass copies" ) {
+    static int copiesAfterFirstPass = -1;
+    static int passes = 0;
+    auto const& element = GENERATE_REF( CopyCountingElement( 1 ), CopyCountingElement( 2 ) );
+    ++passes;
+    if( copiesAfterFirstPass < 0 )
+        copiesAfterFirstPass = CopyCountingElement::copies;
+    CHECK( CopyCountingElement::copies == copiesAfterFirstPass );
+    REQUIRE( element.value == passes );
+}
+
+TEST_CASE( "take and chunk reshape other generators" ) {
+    auto pair = GENERATE( chunk( 2, take( 6, range( 1, 100 ) ) ) );
+    REQUIRE( pair.size() == 2 );
+    REQUIRE( pair[0] + 1 == pair[1] );
+}
+
 #ifdef __cpp_structured_bindings
 
 // Based on example from https://docs.cucumber.io/gherkin/reference/#scenario-outline
@@ -253,6 +253,17 @@ namespace { namespace MatchersTests {
                 std::reverse(begin(permuted), end(permuted));
                 REQUIRE_THAT(permuted, UnorderedEquals(v));
             }
+            SECTION("UnorderedEquals (non-hashable)") {
+                // Types without std::hash take the permutation-check
+                // fallback instead of the counting path
+                struct Unhashed {
+                    int value;
+                    bool operator==(Unhashed const& other) const { return value == other.value; }
+                };
+                std::vector<Unhashed> a = { {1}, {2}, {3} };
+                std::vector<Unhashed> b = { {3}, {1}, {2} };
+                CHECK_THAT(a, UnorderedEquals(b));
+            }
         }
 
         TEST_CASE("Vector matchers that fail", "[matchers][vector][.][failing]") {
@@ -403,6 +414,37 @@ namespace { namespace MatchersTests {
             }
         }
 
+        TEST_CASE("Floating point range matchers", "[matchers][floating-point]") {
+            std::vector<double> const expected{ 1., 2., 3. };
+            SECTION("Margin") {
+                std::vector<double> jittered{ 1.05, 1.95, 3. };
+                REQUIRE_THAT(jittered, AllWithinAbs(expected, 0.1));
+
+                std::vector<double> offTarget{ 1., 2.5, 3. };
+                REQUIRE_THAT(offTarget, !AllWithinAbs(expected, 0.1));
+            }
+            SECTION("ULPs") {
+                std::vector<double> exact{ 1., 2., 3. };
+                REQUIRE_THAT(exact, AllWithinUlps(expected, 0));
+
+                std::vector<double> nudged{ 1., nextafter(2., 3.), 3. };
+                REQUIRE_THAT(nudged, AllWithinUlps(expected, 1));
+                REQUIRE_THAT(nudged, !AllWithinUlps(expected, 0));
+            }
+            SECTION("Mismatched sizes") {
+                std::vector<double> shorter{ 1., 2. };
+                REQUIRE_THAT(shorter, !AllWithinUlps(expected, 1));
+                REQUIRE_THAT(shorter, !AllWithinAbs(expected, 0.1));
+            }
+            SECTION("Constructor validation") {
+                REQUIRE_NOTHROW(AllWithinAbs(expected, 0.));
+                REQUIRE_THROWS_AS(AllWithinAbs(expected, -1.), std::domain_error);
+
+                REQUIRE_NOTHROW(AllWithinUlps(expected, 0));
+                REQUIRE_THROWS_AS(AllWithinUlps(expected, -1), std::domain_error);
+            }
+        }
+
         TEST_CASE("Arbitrary predicate matcher", "[matchers][generic]") {
             SECTION("Function pointer") {
                 REQUIRE_THAT(1,  Predicate<int>(alwaysTrue, "always true"));
@@ -432,6 +474,31 @@ namespace { namespace MatchersTests {
             CHECK_THAT(actual, !UnorderedEquals(expected));
         }
 
+        struct CopyCountingMatcher : Catch::MatcherBase<int> {
+            CopyCountingMatcher( int* copies ) : m_copies( copies ) {}
+            CopyCountingMatcher( CopyCountingMatcher const& other )
+            :   m_copies( other.m_copies ) {
+                ++*m_copies;
+            }
+            CopyCountingMatcher( CopyCountingMatcher&& other ) noexcept
+            :   m_copies( other.m_copies ) {}
+
+            bool match( int const& ) const override { return true; }
+            std::string describe() const override { return "counts copies"; }
+
+            int* m_copies;
+        };
+
+        TEST_CASE("Matcher temporaries are moved into the match expression", "[matchers]") {
+            // A matcher owning state (strings, vectors) must not be copied
+            // on its way into the expression - that would cost an
+            // allocation per assertion in a hot verification loop
+            int copies = 0;
+            auto expr = Catch::makeMatchExpr( 1, CopyCountingMatcher( &copies ), Catch::StringRef() );
+            CHECK( expr.getResult() );
+            REQUIRE( copies == 0 );
+        }
+
 } } // namespace MatchersTests
 
 #endif // CATCH_CONFIG_DISABLE_MATCHERS
@@ -130,6 +130,20 @@ TEST_CASE( "sends information to INFO", "[.][failing]" ) {
     REQUIRE( false );
 }
 
+TEST_CASE( "DEFERRED_CAPTURE is only stringified on failure", "[messages][.][failing]" ) {
+    int i = 7;
+    std::string s = "deferred";
+    DEFERRED_CAPTURE( i );
+    DEFERRED_CAPTURE( s );
+    REQUIRE( i > 10 );
+}
+
+TEST_CASE( "DEFERRED_CAPTURE values are not reported for passing assertions", "[messages]" ) {
+    int i = 7;
+    DEFERRED_CAPTURE( i );
+    REQUIRE( i == 7 );
+}
+
 TEST_CASE( "Pointers can be converted to strings", "[messages][.][approvals]" ) {
     int p;
     WARN( "actual address of p: " << &p );
@@ -18,6 +18,8 @@
 #include <cerrno>
 #include <limits>
 #include <sstream>
+#include <atomic>
+#include <thread>
 
 namespace { namespace MiscTests {
 
@@ -125,6 +127,15 @@ TEST_CASE( "even more nested SECTION tests", "[sections]" ) {
     }
 }
 
+TEST_CASE( "SECTION budgets", "[sections]" ) {
+    SECTION( "well within budget" ) {
+        // Generous enough to never flake; the point is that the verdict
+        // arrives through the normal assertion path at section end
+        SECTION_BUDGET( 60000 );
+        REQUIRE( 1 + 1 == 2 );
+    }
+}
+
 TEST_CASE( "looped SECTION tests", "[.][failing][sections]" ) {
     int a = 1;
 
@@ -150,6 +161,13 @@ TEST_CASE( "Sends stuff to stdout and stderr", "[.]" ) {
     std::clog << "A string sent to stderr via clog" << std::endl;
 }
 
+TEST_CASE( "Sends stuff to the per-thread output stream", "[.]" ) {
+    // Unlike direct stdout, tout() stays correctly attributed when tests
+    // run on parallel workers; it is drained at test case end into the
+    // same channel as redirected stdout
+    Catch::tout() << "A string sent to the thread output ring" << std::endl;
+}
+
 TEST_CASE( "null strings" ) {
     REQUIRE( makeString( false ) != static_cast<char*>(nullptr));
     REQUIRE( makeString( true ) == static_cast<char*>(nullptr));
@@ -353,4 +371,17 @@ TEST_CASE( "#1175 - Hidden Test", "[.]" ) {
   SUCCEED();
 }
 
+TEST_CASE( "Assertions from worker threads are captured", "[threads][!exclusive]" ) {
+    std::atomic<int> sum{ 0 };
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&sum]() {
+            sum += 4;
+            CHECK( sum % 4 == 0 );
+        });
+    }
+    for (auto& t : threads) { t.join(); }
+    REQUIRE( sum == 16 );
+}
+
 }} // namespace MiscTests
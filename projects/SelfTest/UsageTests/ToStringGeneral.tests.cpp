@@ -174,3 +174,28 @@ TEST_CASE("Exception as a value (e.g. in REQUIRE_THROWS_MATCHES) can be stringif
     REQUIRE(::Catch::Detail::stringify(OperatorException{}) == "OperatorException");
     REQUIRE(::Catch::Detail::stringify(StringMakerException{}) == "StringMakerException");
 }
+
+TEST_CASE( "Strings with binary content are hex-escaped", "[toString]" ) {
+    SECTION( "Control characters" ) {
+        std::string binary( "ab" );
+        binary += '\x01';
+        binary += '\x7f';
+        binary += "cd";
+        REQUIRE( ::Catch::Detail::stringify( binary ) == "\"ab\\x01\\x7fcd\"" );
+    }
+    SECTION( "Tabs and newlines stay verbatim" ) {
+        REQUIRE( ::Catch::Detail::stringify( std::string( "a\tb\nc" ) ) == "\"a\tb\nc\"" );
+    }
+    SECTION( "Multi-byte sequences pass through untouched" ) {
+        REQUIRE( ::Catch::Detail::stringify( std::string( "\xc3\xa9" ) ) == "\"\xc3\xa9\"" );
+    }
+}
+
+TEST_CASE( "Very long strings are stringified with their middle elided", "[toString]" ) {
+    std::string longString( 10000, 'x' );
+    auto stringified = ::Catch::Detail::stringify( longString );
+    REQUIRE( stringified.size() < longString.size() );
+    REQUIRE( stringified.substr( 0, 11 ) == "\"xxxxxxxxxx" );
+    REQUIRE( stringified.find( "[...5904 characters elided...]" ) != std::string::npos );
+    REQUIRE( stringified.substr( stringified.size() - 11 ) == "xxxxxxxxxx\"" );
+}
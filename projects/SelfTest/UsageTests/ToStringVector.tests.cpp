@@ -83,4 +83,17 @@ TEST_CASE( "array<int, N> -> toString", "[toString][containers][array]" ) {
     REQUIRE( Catch::Detail::stringify( oneValue ) == "{ 42 }" );
     std::array<int, 2> twoValues = {{ 42, 250 }};
     REQUIRE( Catch::Detail::stringify( twoValues ) == "{ 42, 250 }" );
-}
\ No newline at end of file
+}
+TEST_CASE( "Large vectors -> toString elides the middle", "[toString][containers][vector]" ) {
+    std::vector<int> v( 200 );
+    for( std::size_t i = 0; i < v.size(); ++i )
+        v[i] = static_cast<int>( i );
+    auto str = ::Catch::Detail::stringify( v );
+    REQUIRE( str.substr( 0, 10 ) == "{ 0, 1, 2," );
+    REQUIRE( str.find( "[...72 elements elided...]" ) != std::string::npos );
+    REQUIRE( str.substr( str.size() - 12 ) == ", 198, 199 }" );
+
+    std::vector<bool> bools( 200, true );
+    auto boolStr = ::Catch::Detail::stringify( bools );
+    REQUIRE( boolStr.find( "[...72 elements elided...]" ) != std::string::npos );
+}
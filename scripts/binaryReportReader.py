@@ -0,0 +1,115 @@
+#!/usr/bin/env python
+#
+# Reference reader for the 'binary' reporter (catch_reporter_binary.cpp).
+#
+# Usage: binaryReportReader.py <report-file>
+#
+# Prints one line per record. The format is a 4-byte magic "CBRS", a
+# version byte, then records of [u8 type][u32 payloadLength][payload],
+# all integers little-endian, strings length-prefixed with a u32.
+
+from __future__ import print_function
+
+import struct
+import sys
+
+
+class Payload:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def u8(self):
+        (value,) = struct.unpack_from('<B', self.data, self.pos)
+        self.pos += 1
+        return value
+
+    def u32(self):
+        (value,) = struct.unpack_from('<I', self.data, self.pos)
+        self.pos += 4
+        return value
+
+    def u64(self):
+        (value,) = struct.unpack_from('<Q', self.data, self.pos)
+        self.pos += 8
+        return value
+
+    def f64(self):
+        (value,) = struct.unpack_from('<d', self.data, self.pos)
+        self.pos += 8
+        return value
+
+    def string(self):
+        length = self.u32()
+        value = self.data[self.pos:self.pos + length]
+        self.pos += length
+        return value.decode('utf-8', 'replace')
+
+    def counts(self):
+        return {'passed': self.u64(), 'failed': self.u64(), 'failedButOk': self.u64()}
+
+
+def readRecords(f):
+    magic = f.read(4)
+    if magic != b'CBRS':
+        raise RuntimeError('Not a Catch binary report (bad magic)')
+    version = ord(f.read(1))
+    if version != 1:
+        raise RuntimeError('Unsupported format version: {0}'.format(version))
+    while True:
+        prefix = f.read(5)
+        if len(prefix) == 0:
+            return
+        if len(prefix) != 5:
+            raise RuntimeError('Truncated record prefix')
+        recordType, length = struct.unpack('<BI', prefix)
+        payload = f.read(length)
+        if len(payload) != length:
+            raise RuntimeError('Truncated record payload')
+        yield recordType, Payload(payload)
+
+
+def describe(recordType, p):
+    if recordType == 0x01:
+        return 'TestRunStarting   name={0!r}'.format(p.string())
+    if recordType == 0x02:
+        return 'TestGroupStarting name={0!r} group={1}/{2}'.format(p.string(), p.u64(), p.u64())
+    if recordType == 0x03:
+        return 'TestCaseStarting  name={0!r} class={1!r} at={2}:{3}'.format(
+            p.string(), p.string(), p.string(), p.u64())
+    if recordType == 0x04:
+        return 'SectionStarting   name={0!r} at={1}:{2}'.format(p.string(), p.string(), p.u64())
+    if recordType == 0x05:
+        resultType, ok = p.u32(), p.u8()
+        macro, expr, expanded, messages = p.string(), p.string(), p.string(), p.string()
+        return ('AssertionEnded    ok={0} type=0x{1:x} {2}({3}) expanded={4!r} '
+                'messages={5!r} at={6}:{7}').format(
+            ok, resultType, macro, expr, expanded, messages.rstrip('\n'), p.string(), p.u64())
+    if recordType == 0x06:
+        return 'SectionEnded      name={0!r} assertions={1} duration={2:.6f}s'.format(
+            p.string(), p.counts(), p.f64())
+    if recordType == 0x07:
+        name, assertions = p.string(), p.counts()
+        stdOut, stdErr = p.string(), p.string()
+        return 'TestCaseEnded     name={0!r} assertions={1} stdout={2}B stderr={3}B'.format(
+            name, assertions, len(stdOut), len(stdErr))
+    if recordType == 0x08:
+        return 'TestGroupEnded    name={0!r} assertions={1} testCases={2} aborting={3}'.format(
+            p.string(), p.counts(), p.counts(), p.u8())
+    if recordType == 0x09:
+        return 'TestRunEnded      name={0!r} assertions={1} testCases={2} aborting={3}'.format(
+            p.string(), p.counts(), p.counts(), p.u8())
+    return 'Unknown record    type=0x{0:x} ({1} bytes)'.format(recordType, len(p.data))
+
+
+def main():
+    if len(sys.argv) != 2:
+        print(__doc__)
+        sys.exit(1)
+    with open(sys.argv[1], 'rb') as f:
+        for recordType, payload in readRecords(f):
+            print(describe(recordType, payload))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,83 @@
+#!/usr/bin/env python
+
+"""
+Times the compilation of the representative TUs in
+projects/CompileTimeBenchmark, so that header-cost regressions in
+catch.hpp are caught like runtime regressions. Unlike
+benchmarkCompile.py, which generates a synthetic project, this compiles
+the checked-in TUs as-is - run it before and after a header change and
+diff the numbers.
+
+Normally invoked through the CompileTimeBenchmark target, which passes
+the configured compiler and include path:
+
+    cmake --build . --target CompileTimeBenchmark
+"""
+
+from __future__ import print_function
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+def median(lst):
+    lst = sorted(lst)
+    mid, odd = divmod(len(lst), 2)
+    if odd:
+        return lst[mid]
+    else:
+        return (lst[mid - 1] + lst[mid]) / 2.0
+
+def mean(lst):
+    return float(sum(lst)) / max(len(lst), 1)
+
+def compile_once(compiler, source, obj_path, include_dirs, flags):
+    cmd = [compiler, '-c', source, '-o', obj_path]
+    for dir in include_dirs:
+        cmd += ['-I', dir]
+    cmd += flags
+    start_t = time.time()
+    subprocess.check_call(cmd)
+    end_t = time.time()
+    return end_t - start_t
+
+def benchmark_source(compiler, source, include_dirs, flags, repeats, out_dir):
+    obj_path = os.path.join(out_dir, os.path.basename(source) + '.o')
+    results = [compile_once(compiler, source, obj_path, include_dirs, flags)
+               for i in range(repeats)]
+    return mean(results), median(results)
+
+
+parser = argparse.ArgumentParser(description="Benchmarks Catch's compile times for checked-in representative TUs")
+parser.add_argument('sources', nargs='+', help='Source files to time')
+parser.add_argument('-c', '--compiler', default='g++', help='Compiler to use, default: g++')
+parser.add_argument('-I', '--include', action='append', default=[], help='Include directory; may be given several times')
+parser.add_argument('-f', '--flags', help='Flags to be passed to the compiler. Pass as "," separated list')
+parser.add_argument('-n', '--repeats', type=int, default=5, help='Compilations per TU, default: 5')
+
+args = parser.parse_args()
+
+flags = args.flags.split(',') if args.flags else []
+
+out_dir = tempfile.mkdtemp(prefix='catch-compile-bench-')
+
+print('Compiler: {}'.format(args.compiler))
+if flags:
+    print('Flags: {}'.format(' '.join(flags)))
+print('{} compilations per TU\n'.format(args.repeats))
+
+failed = False
+for source in args.sources:
+    name = os.path.basename(source)
+    try:
+        mean_t, median_t = benchmark_source(args.compiler, source, args.include,
+                                            flags, args.repeats, out_dir)
+        print('{:<24} mean: {:6.2f} s, median: {:6.2f} s'.format(name, mean_t, median_t))
+    except subprocess.CalledProcessError:
+        print('{:<24} failed to compile'.format(name))
+        failed = True
+
+sys.exit(1 if failed else 0)